@@ -0,0 +1,27 @@
+#ifndef __DUALCORE__
+#define __DUALCORE__
+
+#include <stdint.h>
+
+// Offloads work from the inference task (core 0) to a worker task pinned
+// to core 1. The two tasks hand jobs over with direct task notifications,
+// so there is at most one job in flight.
+
+typedef void (*rows_fn)(const void *arg, int begin, int end);
+
+// cycles core 1 spent running jobs and cycles core 0 spent blocked in
+// dualcore_wait, since the last dualcore_reset_stats
+extern uint32_t dualcore_busy_cycles;
+extern uint32_t dualcore_wait_cycles;
+
+void dualcore_start();
+void dualcore_reset_stats();
+
+// runs fn(arg) on core 1; dualcore_wait blocks until it has returned
+void dualcore_submit(void (*fn)(void *arg), void *arg);
+void dualcore_wait();
+
+// runs fn over rows [0, nrows/2) here and [nrows/2, nrows) on core 1
+void dualcore_rows(rows_fn fn, const void *arg, int nrows);
+
+#endif // end of DUALCORE
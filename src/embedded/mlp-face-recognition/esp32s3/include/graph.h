@@ -0,0 +1,63 @@
+#ifndef __GRAPH__
+#define __GRAPH__
+
+#include <stdint.h>
+
+#include <nnops.h>
+
+// A model runs as a straight list of ops. The tensors between ops live in
+// one arena laid out by graph_plan: each op writes to the half its input
+// is not in (ping-pong) and element-wise ops work in place, so the arena
+// holds two activations at a time however deep the model is.
+
+#define GRAPH_MAX_OPS 24
+
+// tensor element types
+#define GRAPH_F32   0
+#define GRAPH_INT8  1
+#define GRAPH_INT32 2
+
+#define OP_QUANTIZE   0 // f32 -> int8
+#define OP_DEQUANTIZE 1 // int8 -> f32
+#define OP_DENSE      2 // f32 -> f32, int8 -> int8 (requantized), int8 -> int32
+                        // or int8 -> f32 (int4, scaled per row)
+#define OP_RELU       3 // f32 -> f32
+
+// graph_run flags
+#define GRAPH_ACCEL     0x1 // vector kernels (mvmx, mvm8x)
+#define GRAPH_DUAL_CORE 0x2 // split the rows of large dense ops across cores
+
+struct graph_op {
+    uint8_t type;
+    uint8_t in_dtype, out_dtype;
+    int nrows, ncols;           // element-wise ops have nrows == ncols
+    const void *weights, *bias; // dense, bias in the accumulator's type
+    struct bsr bsr;             // block-sparse dense, rows NULL if stored densely
+    const struct row_scale *row_scales; // int4 dense, NULL for other weights
+    const int32_t *bias8x;      // int8 dense: bias with the input zero folded in (mvm8x, mvm4)
+    struct qparams q;           // (de)quantize, or the input of an int8 dense op
+    struct requant rq;          // int8 -> int8 dense
+    int out;                    // arena offset of the output, set by graph_plan
+};
+
+struct graph {
+    struct graph_op ops[GRAPH_MAX_OPS];
+    int nops;
+    uint8_t *arena;
+    int acc;                    // arena offset of the int32 rows of mvm8x
+    int arena_size;
+    int nbatch;
+};
+
+// appends an op, NULL when the graph is full
+struct graph_op *graph_add(struct graph *g, int type, int in_dtype, int out_dtype, int nrows, int ncols);
+
+// Lays the tensors of up to nbatch samples out in arena and returns the
+// bytes used; the caller checks that against the arena it passed.
+int graph_plan(struct graph *g, uint8_t *arena, int nbatch);
+
+// Runs ops [first, nops) on n samples; input holds them back to back in
+// the in_dtype of ops[first]. Returns the last op's output.
+const void *graph_run(const struct graph *g, int first, const void *input, int n, int flags);
+
+#endif // end of GRAPH
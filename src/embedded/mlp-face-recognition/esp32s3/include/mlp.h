@@ -0,0 +1,81 @@
+#ifndef __MLP__
+#define __MLP__
+
+#include <stddef.h>
+
+#include <nnops.h>
+#include <graph.h>
+#include <pca.h>
+#include <model.h>
+
+// maximum number of faces classified by one batched call
+#define BATCH_MAX 16
+
+// maximum input and layer width of a loadable model
+#define MLP_MAX_LEN 256
+
+// maximum number of dense layers, and of their rows summed over layers
+#define MLP_MAX_LAYERS 8
+#define MLP_MAX_ROWS 1024
+
+// Scratch memory for the activations of BATCH_MAX faces. The shipped
+// model needs 14592 bytes (float blob) or 9792 (int8 blob); load_model
+// rejects models whose plan does not fit, and pack.py reports the size
+// a blob needs.
+#define MLP_ARENA_SIZE (16*1024)
+
+// the loaded model, its input and output widths and its input quantization
+extern const struct model_header *mlp_model;
+extern struct graph mlp_graph;
+extern int mlp_input_len, mlp_output_len;
+extern struct qparams mlp_input_qparams;
+
+// the model's on-device PCA, height 0 if it has none
+extern struct pca mlp_pca;
+
+// Validates a model blob and runs inference from it in place, so the
+// blob must stay mapped. Returns MODEL_OK or a MODEL_ERR_* code, and on
+// error keeps the previous model. Float modes need a MODEL_DTYPE_F32
+// blob, int8 modes a MODEL_DTYPE_INT8 one and the int4 mode a
+// MODEL_DTYPE_INT4 one.
+int load_model(const void *blob, size_t size);
+
+// split the larger dense layers of single-face inference across both
+// cores (dualcore_start must have been called)
+void set_dual_core(int enable);
+
+// Classifies n <= BATCH_MAX faces held back to back in inputs, either
+// floats (GRAPH_F32) or int8 quantized with mlp_input_qparams
+// (GRAPH_INT8). Faces are converted to the model's dtype first. accel
+// selects the vector kernels.
+void mlp_run(const void *inputs, int input_dtype, int *labels, int n, int accel);
+
+// Classifies a face streamed through mlp_pca: acc is the accumulator
+// after pca_begin and one pca_row per pixel row.
+int mlp_run_pca(const int32_t *acc, int accel);
+
+// one entry point per inference mode, on top of mlp_run. Each serves
+// only a model of its dtype (run_mlp/x float, run_mlp8* int8, run_mlp4*
+// int4) and classifies a face as -1 under any other.
+int run_mlp(const float *input);
+int run_mlpx(const float *input);
+int run_mlp8(const float *input);
+int run_mlp8x(const float *input);
+int run_mlp4(const float *input);
+
+// entry points for faces already quantized with mlp_input_qparams
+int run_mlp8q(const int8_t *input);
+int run_mlp8xq(const int8_t *input);
+int run_mlp4q(const int8_t *input);
+
+// inputs holds n faces back to back, labels receives one subject per face
+void run_mlp_batch(const float *inputs, int *labels, int n);
+void run_mlpx_batch(const float *inputs, int *labels, int n);
+void run_mlp8_batch(const float *inputs, int *labels, int n);
+void run_mlp8x_batch(const float *inputs, int *labels, int n);
+void run_mlp4_batch(const float *inputs, int *labels, int n);
+void run_mlp8q_batch(const int8_t *inputs, int *labels, int n);
+void run_mlp8xq_batch(const int8_t *inputs, int *labels, int n);
+void run_mlp4q_batch(const int8_t *inputs, int *labels, int n);
+
+#endif // end of MLP
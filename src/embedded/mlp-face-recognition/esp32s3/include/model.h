@@ -0,0 +1,99 @@
+#ifndef __MODEL__
+#define __MODEL__
+
+#include <stdint.h>
+
+// Binary model blob written by src/python/model/pack.py and read in place
+// (memory-mapped from the "model" flash partition on the device). All
+// fields are little-endian. The header is followed by nlayers layer
+// descriptors, then by the tensors, each starting on a 16-byte boundary.
+// Reserved bytes are zero.
+//
+// Bump MODEL_VERSION on any layout change; the firmware rejects blobs
+// of another version.
+
+#define MODEL_MAGIC 0x42504c4d // "MLPB"
+#define MODEL_VERSION 3
+
+#define MODEL_ALIGN 16
+
+// dtype of every weight and bias tensor in the blob
+#define MODEL_DTYPE_F32  0 // float weights, float bias
+#define MODEL_DTYPE_INT8 1 // int8 weights with STRIDE8 rows, int32 bias
+#define MODEL_DTYPE_INT4 2 // int4 weights with STRIDE4 rows, int32 bias
+
+// An int4 blob quantizes weights row by row: each layer's scales tensor
+// holds nrows struct row_scale, and weights_scale, multiplier and shift
+// are unused. Its layers are stored densely.
+
+// Storage of a layer's weights. A block-sparse layer's weights tensor
+// holds its blocks (struct bsr values, in the blob's dtype) and its index
+// tensor nrows + 1 uint16 row pointers followed by one uint16 column per
+// block, increasing within a row.
+#define MODEL_LAYER_DENSE 0
+#define MODEL_LAYER_BSR   1
+
+#define MODEL_OK          0
+#define MODEL_ERR_MAGIC   -1
+#define MODEL_ERR_VERSION -2
+#define MODEL_ERR_SIZE    -3
+#define MODEL_ERR_SHAPE   -4
+#define MODEL_ERR_DTYPE   -5
+#define MODEL_ERR_ARENA   -6 // activations do not fit MLP_ARENA_SIZE
+#define MODEL_ERR_QUANT   -7 // a requantization shift outside REQUANT_SHIFT_MIN..MAX
+
+struct model_header {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t dtype;
+    uint8_t nlayers;
+    uint32_t size;          // bytes, from the header to the last tensor
+    float input_scale;
+    int8_t input_zero;
+    uint8_t reserved0[3];
+    uint32_t pca;           // offset of a struct model_pca, 0 if there is none
+    uint8_t reserved1[8];
+};
+
+struct model_layer {
+    uint16_t nrows, ncols;
+    float scale;            // output activations
+    float weights_scale;
+    int32_t multiplier;     // int32 accumulator -> int8 output, see struct requant
+    int8_t shift;
+    int8_t zero;            // output activations
+    uint8_t relu;
+    uint8_t format;         // MODEL_LAYER_*
+    uint32_t weights;       // tensor offsets from the start of the blob
+    uint32_t bias;
+    uint32_t index;         // MODEL_LAYER_BSR: struct bsr rows, then cols
+    uint32_t scales;        // MODEL_DTYPE_INT4: struct row_scale per row
+};
+
+// Optional on-device PCA: projects a height x width 8-bit grayscale face
+// onto the model's input (layers[0].ncols components). The basis is int8
+// whatever the blob's dtype, stored as one block of ncomponents rows of
+// STRIDE8(width) per pixel row of the face. The int32 accumulator starts
+// at bias, which folds in the PCA mean and the pixels' zero point of 128.
+struct model_pca {
+    uint16_t height, width;
+    uint16_t ncomponents;
+    uint16_t reserved0;
+    float scale;            // input units per accumulator unit
+    int32_t multiplier;     // accumulator -> int8 input, see struct requant
+    int8_t shift;
+    uint8_t reserved1[3];
+    uint32_t basis;
+    uint32_t bias;
+    uint32_t reserved2;
+};
+
+static inline const struct model_layer *model_layers(const struct model_header *m) {
+    return (const struct model_layer *)(m + 1);
+}
+
+static inline const void *model_tensor(const struct model_header *m, uint32_t offset) {
+    return (const uint8_t *)m + offset;
+}
+
+#endif // end of MODEL
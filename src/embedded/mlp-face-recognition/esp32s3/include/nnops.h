@@ -8,24 +8,121 @@ struct qparams {
     float scale;
 };
 
-struct qlayer {
-    struct qparams input, weights, output;
+// Fixed-point requantization of an int32 accumulator to the output
+// scale: acc * multiplier * 2^(shift - 31), plus the output zero point,
+// clamped to [min, max]. Setting min to the zero point fuses ReLU.
+// shift must lie in [REQUANT_SHIFT_MIN, REQUANT_SHIFT_MAX], which keeps
+// the 31 - shift bit shift of the product within [1, 63].
+#define REQUANT_SHIFT_MIN -32
+#define REQUANT_SHIFT_MAX 30
+
+struct requant {
+    int32_t multiplier;
+    int8_t shift;
+    int8_t zero;
+    int8_t min, max;
 };
 
 float mac(const float *x, const float *y, int size);
-int16_t mac8(const int8_t *x, const int8_t *y, int size);
+int32_t mac8(const int8_t *x, const int8_t *y, int size);
+
+// int8 weight matrices store each row zero-padded to a multiple of 16
+// bytes, 16-byte aligned, so the S3 vector unit can load rows directly.
+#define STRIDE8(ncols) (((ncols) + 15) & ~15)
+
+// Columns of v that mvm8x keeps in vector registers per pass over M.
+#define MVM8X_CHUNK 64
+
+// Matrix-vector kernels add bias[row] to each dot product as it is
+// stored. Integer kernels take the bias pre-scaled to the accumulator
+// (input scale * weights scale) and accumulate in int32.
+void mvm(const float *M, const float *bias, const float *v, float *out, int nrows, int ncols);
+void mvmx(const float *M, const float *bias, const float *v, float *out, int nrows, int ncols);
+void mvm8(const int8_t *M, const int32_t *bias, const int8_t *v, int32_t *out, int8_t v_zero, int nrows, int ncols);
+
+// Vector int8 kernel: multiplies raw int8 activations, so its bias must
+// already hold the zero-point correction computed by fold_zero8.
+void fold_zero8(const int8_t *M, const int32_t *bias, int8_t v_zero, int32_t *out, int nrows, int ncols);
+void mvm8x(const int8_t *M, const int32_t *bias, const int8_t *v, int32_t *out, int nrows, int ncols);
+
+// mvm8x without the bias: adds M.v to out, to accumulate a product in parts
+void mvm8x_acc(const int8_t *M, const int8_t *v, int32_t *out, int nrows, int ncols);
+
+// out[row] += M[row*stride .. +16*nvec] . v[0 .. 16*nvec] for nvec <= 4,
+// with v held in q0-q3. M and v must be 16-byte aligned and v readable
+// for 64 bytes; nnops_aes3.S on the S3, a plain C loop on other targets.
+void mvm8_rows_aes3(const int8_t *M, int stride, const int8_t *v, int32_t *out, int nrows, int nvec);
+
+// Block-sparse matrix: each row keeps some of its 1 x BSR_BLOCK blocks of
+// weights, the rest are zero. Blocks of row r are [rows[r], rows[r+1]),
+// in column order; block i starts at column cols[i], a multiple of
+// BSR_BLOCK, and holds BSR_BLOCK values in values[i*BSR_BLOCK ..], zero
+// past the last column. An int8 block is one vector register wide.
+// Offsetting rows selects a range of rows.
+#define BSR_BLOCK 16
+
+struct bsr {
+    const void *values;
+    const uint16_t *rows;
+    const uint16_t *cols;
+};
+
+// Block-sparse kernels skip the pruned blocks: mvm_bsr serves both float
+// modes, mvm8_bsr and mvm8x_bsr mirror mvm8 and mvm8x.
+void mvm_bsr(const struct bsr *M, const float *bias, const float *v, float *out, int nrows, int ncols);
+void mvm8_bsr(const struct bsr *M, const int32_t *bias, const int8_t *v, int32_t *out, int8_t v_zero, int nrows, int ncols);
+void fold_zero8_bsr(const struct bsr *M, const int32_t *bias, int8_t v_zero, int32_t *out, int nrows);
+void mvm8x_bsr(const struct bsr *M, const int32_t *bias, const int8_t *v, int32_t *out, int nrows, int ncols);
+
+// out[row] += the blocks of row against v, one vector multiply per block;
+// values holds the blocks from the first row's on, cols their columns.
+// values and v must be 16-byte aligned and v readable up to the last
+// block's end. nnops_aes3.S on the S3, a plain C loop on other targets.
+void mvm8_bsr_aes3(const int8_t *values, const uint16_t *rows, const uint16_t *cols, const int8_t *v, int32_t *out, int nrows);
+
+// Packed int4 weights: two signed 4-bit values per byte, the even column
+// in the low nibble, each row zero-padded to STRIDE4(ncols) bytes. They
+// are quantized row by row, so each row has its own scale.
+#define STRIDE4(ncols) (STRIDE8(ncols) / 2)
+
+// Scale of one row of a row-quantized layer: of its int32 accumulator
+// (input scale * row weights scale), and the fixed-point requantization
+// of the accumulator to the output scale, as in struct requant.
+struct row_scale {
+    float scale;
+    int32_t multiplier;
+    int8_t shift;
+    uint8_t reserved[3];
+};
+
+// Like mvm8x, multiplies raw int8 activations with a bias folded by
+// fold_zero4. Weights are unpacked in registers, eight per 32-bit load.
+void fold_zero4(const uint8_t *M, const int32_t *bias, int8_t v_zero, int32_t *out, int nrows, int ncols);
+void mvm4(const uint8_t *M, const int32_t *bias, const int8_t *v, int32_t *out, int nrows, int ncols);
+
+// requantize8 and dequantization of nrows accumulators with a scale per row
+void requantize8_rows(const int32_t *x, const struct row_scale *rs, const struct requant *rq, int8_t *out, int nrows);
+void dequantize_rows(const int32_t *x, const struct row_scale *rs, float *out, int nrows);
+
+// Matrix-matrix variants: V holds nbatch inputs of ncols elements each,
+// out receives nbatch outputs of nrows elements each.
+void mmm(const float *M, const float *bias, const float *V, float *out, int nrows, int ncols, int nbatch);
+void mmmx(const float *M, const float *bias, const float *V, float *out, int nrows, int ncols, int nbatch);
+void mmm8(const int8_t *M, const int32_t *bias, const int8_t *V, int32_t *out, int8_t v_zero, int nrows, int ncols, int nbatch);
+void mmm8x(const int8_t *M, const int32_t *bias, const int8_t *V, int32_t *out, int nrows, int ncols, int nbatch);
 
-void mvm(const float *M, const float *v, float *out, int nrows, int ncols);
-void mvmx(const float *M, const float *v, float *out, int nrows, int ncols);
-void mvm8(const int8_t *M, int8_t *v, int16_t *out, int8_t v_zero, int nrows, int ncols);
-void mvm16(const int16_t *M, int16_t *v, int16_t *out, int16_t v_zero, int nrows, int ncols);
+// Fused int8 layer: int32 accumulate plus bias, requantize, clamp, store
+// as int8.
+void mvm8_requant(const int8_t *M, const int32_t *bias, const int8_t *v, int8_t v_zero, const struct requant *rq, int8_t *out, int nrows, int ncols);
+void mmm8_requant(const int8_t *M, const int32_t *bias, const int8_t *V, int8_t v_zero, const struct requant *rq, int8_t *out, int nrows, int ncols, int nbatch);
+void requantize8(const int32_t *x, const struct requant *rq, int8_t *out, int size);
 
 void relu(const float *x, float *out, int size);
 int argmax(const float *x, int size);
+int argmax32(const int32_t *x, int size);
 
 void quantize8(const float *x, float scale, int8_t zero, int8_t *out, int size);
-void quantize16(const float *x, float scale, int16_t zero, int16_t *out, int size);
 
-void dequantize16(const struct qlayer *qlayer, const int16_t *x, float *out, int size);
+void dequantize8(const int8_t *x, float scale, int8_t zero, float *out, int size);
 
 #endif // end of NNOPS
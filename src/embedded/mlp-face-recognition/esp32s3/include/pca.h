@@ -0,0 +1,30 @@
+#ifndef __PCA__
+#define __PCA__
+
+#include <stdint.h>
+
+#include <nnops.h>
+
+// Streaming PCA of a downsampled 8-bit grayscale face. The projection is
+// accumulated in int32 as each pixel row arrives, so neither the frame
+// nor a float copy of it is ever held: pca_begin loads the folded bias,
+// pca_row adds one row's basis block, and pca_output converts the result
+// to the model's input.
+
+#define PCA_MAX_WIDTH 256
+
+struct pca {
+    int height, width, ncomponents;
+    const int8_t *basis;    // height blocks of ncomponents x STRIDE8(width)
+    const int32_t *bias;
+    float scale;            // input units per accumulator unit
+    struct requant rq;      // accumulator -> int8 input
+};
+
+void pca_begin(const struct pca *p, int32_t *acc);
+void pca_row(const struct pca *p, int row, const uint8_t *pixels, int32_t *acc);
+
+void pca_output(const struct pca *p, const int32_t *acc, float *out);
+void pca_output8(const struct pca *p, const int32_t *acc, int8_t *out);
+
+#endif // end of PCA
@@ -0,0 +1,54 @@
+#ifndef __TRACE__
+#define __TRACE__
+
+#include <stdint.h>
+
+#include <sdkconfig.h>
+
+// Per-stage cycle counts of the inference loop, built only with
+// CONFIG_MLP_TRACE. Each request fills one record of a ring buffer that
+// keeps the last CONFIG_MLP_TRACE_DEPTH requests: trace_begin opens it,
+// TRACE() adds the cycles of one call to a stage and trace_end commits
+// it. Without CONFIG_MLP_TRACE, TRACE() runs the call untimed and no
+// record is kept.
+
+// stages in reply order of the dump stats command
+#define TRACE_RECV       0 // uart_read_bytes
+#define TRACE_QUANTIZE   1
+#define TRACE_DEQUANTIZE 2
+#define TRACE_PCA        3 // pca_row and pca_output
+#define TRACE_DENSE      4 // matrix-vector products and their requantization
+#define TRACE_RELU       5
+#define TRACE_ARGMAX     6
+#define TRACE_SEND       7 // uart_write_bytes
+#define TRACE_NSTAGES    8
+
+// trace_stats over the requests of every mode
+#define TRACE_ALL_MODES 0
+
+#ifdef CONFIG_MLP_TRACE
+#define TRACE(stage, call) do { \
+    uint32_t trace_begin_ = trace_cycles(); \
+    call; \
+    trace_add(stage, trace_cycles() - trace_begin_); \
+} while (0)
+#else
+#define TRACE(stage, call) do { call; } while (0)
+#endif
+
+struct trace_stats {
+    uint32_t min, mean, p99;
+};
+
+uint32_t trace_cycles();
+
+// mode is the request's command byte, which trace_stats filters on
+void trace_begin(int mode);
+void trace_add(int stage, uint32_t cycles);
+void trace_end();
+
+// Fills TRACE_NSTAGES stats over the kept requests of mode (or
+// TRACE_ALL_MODES) and returns how many there were.
+int trace_stats(int mode, struct trace_stats *stats);
+
+#endif // end of TRACE
@@ -0,0 +1,85 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_cpu.h>
+
+#include <dualcore.h>
+
+#define WORKER_STACK_SIZE 4096
+
+struct rows_job {
+    rows_fn fn;
+    const void *arg;
+    int begin, end;
+};
+
+static TaskHandle_t worker_task, caller_task;
+
+static void (*job_fn)(void *arg);
+static void *job_arg;
+static int job_pending;
+
+static struct rows_job upper_rows;
+
+uint32_t dualcore_busy_cycles;
+uint32_t dualcore_wait_cycles;
+
+static void worker(void *unused) {
+    uint32_t begin;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        begin = esp_cpu_get_cycle_count();
+        job_fn(job_arg);
+        dualcore_busy_cycles += esp_cpu_get_cycle_count() - begin;
+
+        xTaskNotifyGive(caller_task);
+    }
+}
+
+void dualcore_start() {
+    caller_task = xTaskGetCurrentTaskHandle();
+    xTaskCreatePinnedToCore(worker, "mlp_worker", WORKER_STACK_SIZE, NULL,
+                            uxTaskPriorityGet(NULL), &worker_task, 1);
+}
+
+void dualcore_reset_stats() {
+    dualcore_busy_cycles = 0;
+    dualcore_wait_cycles = 0;
+}
+
+void dualcore_submit(void (*fn)(void *arg), void *arg) {
+    job_fn = fn;
+    job_arg = arg;
+    job_pending = 1;
+
+    xTaskNotifyGive(worker_task);
+}
+
+void dualcore_wait() {
+    uint32_t begin;
+
+    if (!job_pending)
+        return;
+
+    begin = esp_cpu_get_cycle_count();
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    dualcore_wait_cycles += esp_cpu_get_cycle_count() - begin;
+
+    job_pending = 0;
+}
+
+static void run_rows(void *arg) {
+    struct rows_job *job = arg;
+    job->fn(job->arg, job->begin, job->end);
+}
+
+void dualcore_rows(rows_fn fn, const void *arg, int nrows) {
+    int half = nrows / 2;
+
+    upper_rows = (struct rows_job) {fn, arg, half, nrows};
+    dualcore_submit(run_rows, &upper_rows);
+
+    fn(arg, 0, half);
+    dualcore_wait();
+}
@@ -0,0 +1,224 @@
+#include <stddef.h>
+
+#include <nnops.h>
+#include <graph.h>
+#include <dualcore.h>
+#include <trace.h>
+
+// dense ops below this many MACs finish before core 1 would pick them up
+#define DUAL_CORE_MIN_MACS 4096
+
+#define ALIGN16(x) (((x) + 15) & ~15)
+
+struct dense_job {
+    const struct graph_op *op;
+    const void *in;
+    void *out;
+    int32_t *acc;
+    int accel;
+};
+
+static int dtype_size(int dtype) {
+    return dtype == GRAPH_INT8 ? sizeof(int8_t) : 4;
+}
+
+struct graph_op *graph_add(struct graph *g, int type, int in_dtype, int out_dtype, int nrows, int ncols) {
+    struct graph_op *op;
+
+    if (g->nops == GRAPH_MAX_OPS)
+        return NULL;
+
+    op = &g->ops[g->nops++];
+    *op = (struct graph_op) {
+        .type = type,
+        .in_dtype = in_dtype,
+        .out_dtype = out_dtype,
+        .nrows = nrows,
+        .ncols = ncols,
+    };
+
+    return op;
+}
+
+int graph_plan(struct graph *g, uint8_t *arena, int nbatch) {
+    int size[2] = {0, 0}, base[2];
+    int slot[GRAPH_MAX_OPS];
+    int acc = 0, cur = -1;
+
+    // the first op reads the caller's input, so it always gets a slot
+    for (int i = 0; i < g->nops; i++) {
+        const struct graph_op *op = &g->ops[i];
+        int bytes = op->nrows * dtype_size(op->out_dtype);
+
+        if (op->type != OP_RELU || cur < 0)
+            cur = cur == 0 ? 1 : 0;
+        slot[i] = cur;
+
+        if (bytes > size[cur])
+            size[cur] = bytes;
+        if (op->type == OP_DENSE && op->in_dtype == GRAPH_INT8 && op->out_dtype != GRAPH_INT32 && op->nrows * 4 > acc)
+            acc = op->nrows * 4;
+    }
+
+    base[0] = 0;
+    base[1] = ALIGN16(size[0] * nbatch);
+    g->acc = base[1] + ALIGN16(size[1] * nbatch);
+
+    for (int i = 0; i < g->nops; i++)
+        g->ops[i].out = base[slot[i]];
+
+    g->arena = arena;
+    g->nbatch = nbatch;
+    g->arena_size = g->acc + acc * nbatch;
+
+    return g->arena_size;
+}
+
+// rows [begin, end) of a block-sparse dense op, as dense_rows
+static void sparse_rows(const struct dense_job *job, int begin, int end) {
+    const struct graph_op *op = job->op;
+    int32_t *acc = op->out_dtype == GRAPH_INT8 ? job->acc : (int32_t *)job->out;
+    struct bsr M = op->bsr;
+    int rows = end - begin;
+
+    M.rows += begin;
+
+    if (op->in_dtype == GRAPH_F32) {
+        mvm_bsr(&M, (const float *)op->bias + begin, job->in, (float *)job->out + begin, rows, op->ncols);
+        return;
+    }
+
+    if (job->accel)
+        mvm8x_bsr(&M, &op->bias8x[begin], job->in, &acc[begin], rows, op->ncols);
+    else
+        mvm8_bsr(&M, (const int32_t *)op->bias + begin, job->in, &acc[begin], op->q.zero, rows, op->ncols);
+
+    if (op->out_dtype == GRAPH_INT8)
+        requantize8(&acc[begin], &op->rq, (int8_t *)job->out + begin, rows);
+}
+
+// rows [begin, end) of an int4 dense op, whose one kernel serves every mode
+static void int4_rows(const struct dense_job *job, int begin, int end) {
+    const struct graph_op *op = job->op;
+    const uint8_t *M = (const uint8_t *)op->weights + begin*STRIDE4(op->ncols);
+    int rows = end - begin;
+
+    mvm4(M, &op->bias8x[begin], job->in, &job->acc[begin], rows, op->ncols);
+
+    if (op->out_dtype == GRAPH_INT8)
+        requantize8_rows(&job->acc[begin], &op->row_scales[begin], &op->rq, (int8_t *)job->out + begin, rows);
+    else
+        dequantize_rows(&job->acc[begin], &op->row_scales[begin], (float *)job->out + begin, rows);
+}
+
+// Rows [begin, end) of a single-sample dense op. Each call writes only
+// its own rows, so two calls can run on different cores.
+static void dense_rows(const void *arg, int begin, int end) {
+    const struct dense_job *job = arg;
+    const struct graph_op *op = job->op;
+    const int8_t *M8 = (const int8_t *)op->weights + begin*STRIDE8(op->ncols);
+    const float *M = (const float *)op->weights + begin*op->ncols;
+    int rows = end - begin;
+
+    if (op->bsr.rows != NULL) {
+        sparse_rows(job, begin, end);
+    } else if (op->row_scales != NULL) {
+        int4_rows(job, begin, end);
+    } else if (op->in_dtype == GRAPH_F32) {
+        if (job->accel)
+            mvmx(M, (const float *)op->bias + begin, job->in, (float *)job->out + begin, rows, op->ncols);
+        else
+            mvm(M, (const float *)op->bias + begin, job->in, (float *)job->out + begin, rows, op->ncols);
+    } else if (op->out_dtype == GRAPH_INT8) {
+        if (job->accel) {
+            mvm8x(M8, &op->bias8x[begin], job->in, &job->acc[begin], rows, op->ncols);
+            requantize8(&job->acc[begin], &op->rq, (int8_t *)job->out + begin, rows);
+        } else {
+            mvm8_requant(M8, (const int32_t *)op->bias + begin, job->in, op->q.zero, &op->rq,
+                         (int8_t *)job->out + begin, rows, op->ncols);
+        }
+    } else {
+        if (job->accel)
+            mvm8x(M8, &op->bias8x[begin], job->in, (int32_t *)job->out + begin, rows, op->ncols);
+        else
+            mvm8(M8, (const int32_t *)op->bias + begin, job->in, (int32_t *)job->out + begin, op->q.zero, rows, op->ncols);
+    }
+}
+
+static void dense_batch(const struct graph_op *op, const void *in, void *out, int32_t *acc, int n, int accel) {
+    if (op->in_dtype == GRAPH_F32) {
+        if (accel)
+            mmmx(op->weights, op->bias, in, out, op->nrows, op->ncols, n);
+        else
+            mmm(op->weights, op->bias, in, out, op->nrows, op->ncols, n);
+    } else if (op->out_dtype == GRAPH_INT8) {
+        if (accel) {
+            mmm8x(op->weights, op->bias8x, in, acc, op->nrows, op->ncols, n);
+            requantize8(acc, &op->rq, out, op->nrows*n);
+        } else {
+            mmm8_requant(op->weights, op->bias, in, op->q.zero, &op->rq, out, op->nrows, op->ncols, n);
+        }
+    } else {
+        if (accel)
+            mmm8x(op->weights, op->bias8x, in, out, op->nrows, op->ncols, n);
+        else
+            mmm8(op->weights, op->bias, in, out, op->q.zero, op->nrows, op->ncols, n);
+    }
+}
+
+// ops without a batched kernel run one sample at a time, each with its
+// own accumulator rows
+static void sample_batch(const struct graph_op *op, const void *in, void *out, int32_t *acc, int n, int accel) {
+    for (int b = 0; b < n; b++) {
+        struct dense_job job = {
+            .op = op,
+            .in = (const uint8_t *)in + b*op->ncols*dtype_size(op->in_dtype),
+            .out = (uint8_t *)out + b*op->nrows*dtype_size(op->out_dtype),
+            .acc = acc + b*op->nrows,
+            .accel = accel,
+        };
+
+        dense_rows(&job, 0, op->nrows);
+    }
+}
+
+static void dense(const struct graph *g, const struct graph_op *op, const void *in, void *out, int n, int flags) {
+    struct dense_job job = {op, in, out, (int32_t *)(g->arena + g->acc), flags & GRAPH_ACCEL};
+
+    if (n > 1 && (op->bsr.rows != NULL || op->row_scales != NULL))
+        sample_batch(op, in, out, job.acc, n, job.accel);
+    else if (n > 1)
+        dense_batch(op, in, out, job.acc, n, job.accel);
+    else if ((flags & GRAPH_DUAL_CORE) && op->nrows * op->ncols >= DUAL_CORE_MIN_MACS)
+        dualcore_rows(dense_rows, &job, op->nrows);
+    else
+        dense_rows(&job, 0, op->nrows);
+}
+
+const void *graph_run(const struct graph *g, int first, const void *input, int n, int flags) {
+    const void *in = input;
+
+    for (int i = first; i < g->nops; i++) {
+        const struct graph_op *op = &g->ops[i];
+        void *out = g->arena + op->out;
+
+        switch(op->type) {
+            case OP_QUANTIZE:
+                TRACE(TRACE_QUANTIZE, quantize8(in, op->q.scale, op->q.zero, out, op->ncols*n));
+                break;
+            case OP_DEQUANTIZE:
+                TRACE(TRACE_DEQUANTIZE, dequantize8(in, op->q.scale, op->q.zero, out, op->ncols*n));
+                break;
+            case OP_RELU:
+                TRACE(TRACE_RELU, relu(in, out, op->ncols*n));
+                break;
+            case OP_DENSE:
+                TRACE(TRACE_DENSE, dense(g, op, in, out, n, flags));
+                break;
+        }
+
+        in = out;
+    }
+
+    return in;
+}
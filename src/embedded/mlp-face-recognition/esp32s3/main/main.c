@@ -4,23 +4,68 @@
 #include <sdkconfig.h>
 #include <driver/uart.h>
 #include <driver/gpio.h>
+#include <esp_partition.h>
+#include <esp_cpu.h>
 
 #include <nnops.h>
-#include <mlp_weights.h>
+#include <mlp.h>
+#include <model.h>
+#include <dualcore.h>
+#include <trace.h>
 
 #define UART_NUM UART_NUM_0
 
+// data partition holding the model blob (see partitions.csv)
+#define MODEL_PARTITION "model"
+
 #define CMD_NOOP 0
 #define CMD_INFERENCE_FLOAT       0b0001
 #define CMD_INFERENCE_FLOAT_ACCEL 0b0011
 #define CMD_INFERENCE_INT8        0b0101
 #define CMD_INFERENCE_INT8_ACCEL  0b1001
-
+#define CMD_INFERENCE_INT4        0b1011
+
+// Followed by a command byte, or 0 for all: the reply is the number of
+// recent requests with that command byte, TRACE_NSTAGES, then the min,
+// mean and p99 cycles of each stage over those requests. The count is 0
+// unless the firmware is built with CONFIG_MLP_TRACE.
+#define CMD_DUMP_STATS 0b0111
+
+// OR'ed with an inference command: a 1-byte count follows the command,
+// then count inputs. The reply is count subject ids, the cycles spent on
+// the whole batch and the cycles per sample.
+#define CMD_BATCH 0b10000
+
+// OR'ed with an inference command: inputs arrive as int8 values quantized
+// with the model's input scale and zero point instead of floats
+#define CMD_INPUT_INT8 0b100000
+
+// OR'ed with an inference command: layer 1 rows are split across both
+// cores and the reply gains each core's busy cycles. With CMD_BATCH the
+// batch is pipelined instead: core 0 receives (and quantizes) face n+1
+// while core 1 classifies face n.
+#define CMD_DUAL_CORE 0b1000000
+
+// OR'ed with an inference command, without CMD_BATCH or CMD_INPUT_INT8:
+// the face arrives as mlp_pca.height rows of mlp_pca.width 8-bit
+// grayscale pixels and is projected by the model's PCA as rows come in.
+// The reply is the subject id, the cycles from the last row to the label
+// and the cycles spent projecting all rows.
+#define CMD_INPUT_FRAME 0b10000000
 
 #define IS_INFERENCE(x) (x & 1)
+#define IS_BATCH(x) (x & CMD_BATCH)
+#define IS_INPUT_INT8(x) (x & CMD_INPUT_INT8)
+#define IS_DUAL_CORE(x) (x & CMD_DUAL_CORE)
+#define IS_INPUT_FRAME(x) (x & CMD_INPUT_FRAME)
+// int8 activations, whether the weights are int8 or int4
+#define IS_INT8_MODE(x) (INFERENCE_MODE(x) == CMD_INFERENCE_INT8 || INFERENCE_MODE(x) == CMD_INFERENCE_INT8_ACCEL || \
+                         INFERENCE_MODE(x) == CMD_INFERENCE_INT4)
+#define IS_ACCEL_MODE(x) (INFERENCE_MODE(x) == CMD_INFERENCE_FLOAT_ACCEL || INFERENCE_MODE(x) == CMD_INFERENCE_INT8_ACCEL)
+#define INFERENCE_MODE(x) (x & 0b1111)
 
 uart_config_t uart_config = {
-    .baud_rate = 115200,
+    .baud_rate = CONFIG_MLP_UART_BAUD_RATE,
     .data_bits = UART_DATA_8_BITS,
     .parity = UART_PARITY_DISABLE,
     .stop_bits = UART_STOP_BITS_1,
@@ -28,45 +73,30 @@ uart_config_t uart_config = {
     .source_clk = UART_SCLK_DEFAULT,
 };
 
-float input[132];
-int16_t fxp_input[132];
-
-float buffer[96];
-int16_t fxp_buffer[96];
-
-struct qlayer l1_qparams, l3_qparams;
-
-void setup_quantization() {
-    l1_qparams = (struct qlayer) {
-        .input = {
-            .zero = input_zero,
-            .scale = input_scale
-        },
-        .weights = {
-            .zero = layer_1_weights_zero,
-            .scale = layer_1_weights_scale,
-        },
-        .output = {
-            .zero = layer_1_zero,
-            .scale = layer_1_scale,
-        }
-    };
-
-    l3_qparams = (struct qlayer) {
-        .input = {
-            .zero = layer_1_zero,
-            .scale = layer_1_scale
-        },
-        .weights = {
-            .zero = layer_3_weights_zero,
-            .scale = layer_3_weights_scale,
-        },
-        .output = {
-            .zero = layer_3_zero,
-            .scale = layer_3_scale,
-        }
-    };
-}
+float input[MLP_MAX_LEN];
+int8_t input8[MLP_MAX_LEN];
+
+float batch_input[BATCH_MAX*MLP_MAX_LEN];
+int8_t batch_input8[BATCH_MAX*MLP_MAX_LEN];
+int batch_labels[BATCH_MAX];
+
+// one row of a streamed frame and the running PCA projection
+uint8_t frame_row[PCA_MAX_WIDTH];
+int32_t frame_acc[MLP_MAX_LEN];
+
+struct pipeline_slot {
+    char mode;
+    float input[MLP_MAX_LEN];
+    int8_t input8[MLP_MAX_LEN];
+    int *label;
+};
+
+struct pipeline_slot pipeline_slots[2];
+
+char msg_ready[] = "Ready\n";
+char msg_error[] = "Error\n";
+char msg_waiting[] = "Waiting for input\n";
+char msg_bad_model[] = "Invalid model\n";
 
 void setup_uart() {
     ESP_ERROR_CHECK(uart_param_config(UART_NUM, &uart_config));
@@ -74,81 +104,276 @@ void setup_uart() {
     ESP_ERROR_CHECK(uart_driver_install(UART_NUM, 1024 * 2, 1024 * 2, 0, NULL, 0));
 }
 
-int run_mlp(float *input) {
-    int output;
+// Maps the model partition through the flash cache and runs from it in
+// place. Without a valid model every request is answered with an error.
+void setup_model() {
+    const esp_partition_t *partition;
+    esp_partition_mmap_handle_t handle;
+    const void *blob;
+
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, MODEL_PARTITION);
+    if (partition == NULL) {
+        uart_write_bytes(UART_NUM, msg_bad_model, strlen(msg_bad_model));
+        return;
+    }
+
+    ESP_ERROR_CHECK(esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &blob, &handle));
+
+    if (load_model(blob, partition->size) != MODEL_OK)
+        uart_write_bytes(UART_NUM, msg_bad_model, strlen(msg_bad_model));
+}
+
+// a blob holds float, int8 or int4 tensors, which serve only the matching modes
+static int mode_supported(char cmd) {
+    if (mlp_model == NULL)
+        return 0;
 
-    mvm(layer_1_weights, input, buffer, LAYER_1_LEN, LAYER_INPUT_LEN);
-    relu(buffer, input, 96);
+    if (IS_INPUT_FRAME(cmd) && (mlp_pca.height == 0 || IS_BATCH(cmd) || IS_INPUT_INT8(cmd)))
+        return 0;
 
-    mvm(layer_3_weights, input, buffer, LAYER_3_LEN, LAYER_1_LEN);
-    output = argmax(buffer, LAYER_3_LEN);
+    if (INFERENCE_MODE(cmd) == CMD_INFERENCE_INT4)
+        return mlp_model->dtype == MODEL_DTYPE_INT4;
 
-    return output;
+    return mlp_model->dtype == (IS_INT8_MODE(cmd) ? MODEL_DTYPE_INT8 : MODEL_DTYPE_F32);
 }
 
-int run_mlpx(float *input) {
-    int output;
+// consumes the payload of a request that cannot run, then replies Error
+static void reject(char cmd) {
+    unsigned char count = 1;
+    int face_bytes = mlp_input_len * (IS_INPUT_INT8(cmd) ? sizeof(int8_t) : sizeof(float));
+
+    // Without a model, or a frame without PCA, the payload size is
+    // unknown: discard bytes until none arrives for a command poll.
+    if (mlp_model == NULL || (IS_INPUT_FRAME(cmd) && mlp_pca.height == 0)) {
+        while (uart_read_bytes(UART_NUM, input, sizeof(input), 100) > 0)
+            ;
+        uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+        return;
+    }
 
-    mvmx(layer_1_weights, input, buffer, LAYER_1_LEN, LAYER_INPUT_LEN);
-    relu(buffer, input, 96);
+    // a frame is consumed row by row
+    if (IS_INPUT_FRAME(cmd)) {
+        count = mlp_pca.height;
+        face_bytes = mlp_pca.width;
+    } else if (IS_BATCH(cmd)) {
+        uart_read_bytes(UART_NUM, &count, sizeof(char), 100000);
+    }
 
-    mvmx(layer_3_weights, input, buffer, LAYER_3_LEN, LAYER_1_LEN);
-    output = argmax(buffer, LAYER_3_LEN);
+    for (int n = 0; n < count; n++)
+        uart_read_bytes(UART_NUM, input, face_bytes, 100000);
 
-    return output;
+    uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
 }
 
-int run_mlp8(const float *input) {
-    int output;
+void run_batch(char cmd) {
+    unsigned char batch_size = 0;
+    int recv_bytes, expected_bytes;
+    int time_begin, time_end, time_elapsed, time_per_sample;
 
-    quantize8(input, l1_qparams.input.scale, l1_qparams.input.zero, (int8_t*)fxp_input, LAYER_INPUT_LEN);
+    TRACE(TRACE_RECV, uart_read_bytes(UART_NUM, &batch_size, sizeof(char), 100000));
+    if (batch_size == 0 || batch_size > BATCH_MAX) {
+        uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+        return;
+    }
 
-    mvm8(layer_1_weights8, (int8_t*)fxp_input, fxp_buffer, l1_qparams.input.zero, LAYER_1_LEN, LAYER_INPUT_LEN);
-    dequantize16(&l1_qparams, fxp_buffer, buffer, 96);
+    if (IS_INPUT_INT8(cmd)) {
+        expected_bytes = batch_size*mlp_input_len*sizeof(int8_t);
+        TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, batch_input8, expected_bytes, 100000));
+    } else {
+        expected_bytes = batch_size*mlp_input_len*sizeof(float);
+        TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, batch_input, expected_bytes, 100000));
+    }
 
-    relu(buffer, buffer, LAYER_1_LEN);
-    quantize8(buffer, l3_qparams.input.scale, l3_qparams.input.zero, (int8_t*)fxp_input, LAYER_1_LEN);
+    if (recv_bytes != expected_bytes) {
+        uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+        return;
+    }
 
-    mvm8(layer_3_weights8, (int8_t*)fxp_input, fxp_buffer, l3_qparams.input.zero, LAYER_3_LEN, LAYER_1_LEN);
-    dequantize16(&l3_qparams, fxp_buffer, buffer, LAYER_3_LEN);
+    time_begin = esp_cpu_get_cycle_count();
+    if (IS_INPUT_INT8(cmd))
+        mlp_run(batch_input8, GRAPH_INT8, batch_labels, batch_size, IS_ACCEL_MODE(cmd));
+    else
+        mlp_run(batch_input, GRAPH_F32, batch_labels, batch_size, IS_ACCEL_MODE(cmd));
+    time_end = esp_cpu_get_cycle_count();
 
-    output = argmax(buffer, LAYER_3_LEN);
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, batch_labels, batch_size*sizeof(int)));
 
-    return output;
+    time_elapsed = time_end - time_begin;
+    time_per_sample = time_elapsed / batch_size;
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&time_elapsed, sizeof(int)));
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&time_per_sample, sizeof(int)));
 }
 
-int run_mlp16(const float *input) {
-    int output;
+static void write_core_cycles(int elapsed) {
+    int core_cycles[2];
 
-    quantize16(input, l1_qparams.input.scale, (int16_t)l1_qparams.input.zero, fxp_input, LAYER_INPUT_LEN);
+    core_cycles[0] = elapsed - dualcore_wait_cycles;
+    core_cycles[1] = dualcore_busy_cycles;
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)core_cycles, sizeof(core_cycles)));
+}
 
-    mvm16(layer_1_weights16, fxp_input, fxp_buffer, (int16_t)l1_qparams.input.zero, LAYER_1_LEN, LAYER_INPUT_LEN);
-    dequantize16(&l1_qparams, fxp_buffer, buffer, LAYER_1_LEN);
+// runs on core 1: int8 modes get a quantized face, float modes a float one
+static void pipeline_infer(void *arg) {
+    struct pipeline_slot *slot = arg;
 
-    relu(buffer, buffer, LAYER_1_LEN);
-    quantize16(buffer, l3_qparams.input.scale, (int16_t)l3_qparams.input.zero, fxp_input, LAYER_1_LEN);
+    if (IS_INT8_MODE(slot->mode))
+        mlp_run(slot->input8, GRAPH_INT8, slot->label, 1, IS_ACCEL_MODE(slot->mode));
+    else
+        mlp_run(slot->input, GRAPH_F32, slot->label, 1, IS_ACCEL_MODE(slot->mode));
+}
+
+// Same request and reply as run_batch, followed by each core's busy
+// cycles. Faces are received one at a time into two alternating slots.
+void run_pipeline(char cmd) {
+    unsigned char batch_size = 0;
+    int recv_bytes, expected_bytes;
+    int time_begin, time_end, time_elapsed, time_per_sample;
+    char mode = INFERENCE_MODE(cmd);
+
+    TRACE(TRACE_RECV, uart_read_bytes(UART_NUM, &batch_size, sizeof(char), 100000));
+    if (batch_size == 0 || batch_size > BATCH_MAX) {
+        uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+        return;
+    }
 
-    mvm16(layer_3_weights16, fxp_input, fxp_buffer, (int16_t)l3_qparams.input.zero, LAYER_3_LEN, LAYER_1_LEN);
-    dequantize16(&l3_qparams, fxp_buffer, buffer, LAYER_3_LEN);
+    set_dual_core(0);
+    dualcore_reset_stats();
+
+    time_begin = esp_cpu_get_cycle_count();
+    for (int n = 0; n < batch_size; n++) {
+        struct pipeline_slot *slot = &pipeline_slots[n % 2];
+
+        // the previous face in this slot finished at the last wait
+        if (IS_INPUT_INT8(cmd)) {
+            expected_bytes = mlp_input_len*sizeof(int8_t);
+            TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, slot->input8, expected_bytes, 100000));
+            if (!IS_INT8_MODE(cmd))
+                TRACE(TRACE_DEQUANTIZE, dequantize8(slot->input8, mlp_input_qparams.scale, mlp_input_qparams.zero, slot->input, mlp_input_len));
+        } else {
+            expected_bytes = mlp_input_len*sizeof(float);
+            TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, slot->input, expected_bytes, 100000));
+            if (IS_INT8_MODE(cmd))
+                TRACE(TRACE_QUANTIZE, quantize8(slot->input, mlp_input_qparams.scale, mlp_input_qparams.zero, slot->input8, mlp_input_len));
+        }
 
-    output = argmax(buffer, 15);
+        dualcore_wait();
 
-    return output;
+        if (recv_bytes != expected_bytes) {
+            uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+            return;
+        }
+
+        slot->mode = mode;
+        slot->label = &batch_labels[n];
+        dualcore_submit(pipeline_infer, slot);
+    }
+    dualcore_wait();
+    time_end = esp_cpu_get_cycle_count();
+
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, batch_labels, batch_size*sizeof(int)));
+
+    time_elapsed = time_end - time_begin;
+    time_per_sample = time_elapsed / batch_size;
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&time_elapsed, sizeof(int)));
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&time_per_sample, sizeof(int)));
+    write_core_cycles(time_elapsed);
 }
 
-void app_main(void)
-{
-    char cmd;
-    int recv_bytes;
+// Each row is projected as soon as it is read, while the UART driver
+// keeps receiving the next one, so only the last row's projection and
+// the MLP remain once the frame is in.
+void run_frame(char cmd) {
+    int recv_bytes, subject_id;
+    int time_begin = 0, time_end, time_elapsed, project_cycles = 0;
+
+    set_dual_core(IS_DUAL_CORE(cmd));
+    dualcore_reset_stats();
+
+    pca_begin(&mlp_pca, frame_acc);
+    for (int row = 0; row < mlp_pca.height; row++) {
+        TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, frame_row, mlp_pca.width, 100000));
+        if (recv_bytes != mlp_pca.width) {
+            uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+            return;
+        }
+
+        time_begin = esp_cpu_get_cycle_count();
+        TRACE(TRACE_PCA, pca_row(&mlp_pca, row, frame_row, frame_acc));
+        time_end = esp_cpu_get_cycle_count();
+        project_cycles += time_end - time_begin;
+    }
+
+    subject_id = mlp_run_pca(frame_acc, IS_ACCEL_MODE(cmd));
+    time_end = esp_cpu_get_cycle_count();
+
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, &subject_id, sizeof(int)));
+
+    time_elapsed = time_end - time_begin;
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&time_elapsed, sizeof(int)));
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&project_cycles, sizeof(int)));
+
+    if (IS_DUAL_CORE(cmd))
+        write_core_cycles(time_elapsed);
+}
+
+void run_single(char cmd) {
+    int recv_bytes, expected_bytes;
     int subject_id;
     int time_begin, time_end, time_elapsed;
 
-    char msg_ready[] = "Ready\n";
-    char msg_error[] = "Error\n";
-    char msg_waiting[] = "Waiting for input\n";
+    if (IS_INPUT_INT8(cmd)) {
+        expected_bytes = mlp_input_len*sizeof(int8_t);
+        TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, input8, expected_bytes, 100000));
+    } else {
+        expected_bytes = mlp_input_len*sizeof(float);
+        TRACE(TRACE_RECV, recv_bytes = uart_read_bytes(UART_NUM, (float *)input, expected_bytes, 100000));
+    }
+
+    if (recv_bytes != expected_bytes) {
+        uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+        return;
+    }
+
+    set_dual_core(IS_DUAL_CORE(cmd));
+    dualcore_reset_stats();
+
+    // the model converts the face to its own dtype first
+    time_begin = esp_cpu_get_cycle_count();
+    if (IS_INPUT_INT8(cmd))
+        mlp_run(input8, GRAPH_INT8, &subject_id, 1, IS_ACCEL_MODE(cmd));
+    else
+        mlp_run(input, GRAPH_F32, &subject_id, 1, IS_ACCEL_MODE(cmd));
+    time_end = esp_cpu_get_cycle_count();
+
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, &subject_id, sizeof(int)));
+
+    time_elapsed = time_end - time_begin;
+    TRACE(TRACE_SEND, uart_write_bytes(UART_NUM, (int*)&time_elapsed, sizeof(int)));
+
+    if (IS_DUAL_CORE(cmd))
+        write_core_cycles(time_elapsed);
+}
+
+void dump_stats() {
+    unsigned char mode = TRACE_ALL_MODES;
+    struct trace_stats stats[TRACE_NSTAGES];
+    int header[2];
+
+    uart_read_bytes(UART_NUM, &mode, sizeof(char), 100000);
+
+    header[0] = trace_stats(mode, stats);
+    header[1] = TRACE_NSTAGES;
+    uart_write_bytes(UART_NUM, header, sizeof(header));
+    uart_write_bytes(UART_NUM, stats, sizeof(stats));
+}
+
+void app_main(void)
+{
+    char cmd;
 
-    setup_quantization();
     setup_uart();
+    setup_model();
+    dualcore_start();
 
     uart_write_bytes(UART_NUM, msg_ready, strlen(msg_ready));
 
@@ -160,32 +385,27 @@ void app_main(void)
         while (!IS_INFERENCE(cmd))
             uart_read_bytes(UART_NUM, (char *)&cmd, sizeof(char), 100);
 
-        recv_bytes = uart_read_bytes(UART_NUM, (float *)input, 132*4, 100000);
-        if (recv_bytes != 132*sizeof(float))
-            uart_write_bytes(UART_NUM, msg_error, strlen(msg_error));
+        if (cmd == CMD_DUMP_STATS) {
+            dump_stats();
+            continue;
+        }
 
-        asm volatile("esync; rsr %0,ccount":"=a" (time_begin));
-        switch(cmd) {
-            case CMD_INFERENCE_FLOAT:
-                subject_id = run_mlp(input);
-                break;
-            case CMD_INFERENCE_FLOAT_ACCEL:
-                subject_id = run_mlpx(input);
-                break;
-            case CMD_INFERENCE_INT8:
-                subject_id = run_mlp8(input);
-                break;
-            case CMD_INFERENCE_INT8_ACCEL:
-                subject_id = run_mlp16(input);
-                break;
-            default:
-                subject_id = run_mlp(input);
+        if (!mode_supported(cmd)) {
+            reject(cmd);
+            continue;
         }
-        asm volatile("esync; rsr %0,ccount":"=a" (time_end));
 
-        uart_write_bytes(UART_NUM, &subject_id, sizeof(int));
+        trace_begin((unsigned char)cmd);
+
+        if (IS_INPUT_FRAME(cmd))
+            run_frame(cmd);
+        else if (IS_BATCH(cmd) && IS_DUAL_CORE(cmd))
+            run_pipeline(cmd);
+        else if (IS_BATCH(cmd))
+            run_batch(cmd);
+        else
+            run_single(cmd);
 
-        time_elapsed = time_end - time_begin;
-        uart_write_bytes(UART_NUM, (int*)&time_elapsed, sizeof(int));
+        trace_end();
     }
 }
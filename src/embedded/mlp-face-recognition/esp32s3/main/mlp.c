@@ -0,0 +1,399 @@
+#include <nnops.h>
+#include <graph.h>
+#include <pca.h>
+#include <mlp.h>
+#include <model.h>
+#include <trace.h>
+
+static uint8_t arena[MLP_ARENA_SIZE] __attribute__((aligned(16)));
+
+// int8 and int4 layer biases with the layer's input zero point folded in,
+// for mvm8x and mvm4
+static int32_t bias8x[MLP_MAX_ROWS];
+
+const struct model_header *mlp_model;
+struct graph mlp_graph;
+int mlp_input_len, mlp_output_len;
+struct qparams mlp_input_qparams;
+struct pca mlp_pca;
+
+// a blob is built here and only replaces mlp_graph once it is valid
+static struct graph next_graph;
+
+static int dual_core;
+
+// an aligned tensor of size bytes at offset lies inside the blob
+static int tensor_fits(const struct model_header *m, uint32_t offset, uint32_t size) {
+    return offset % MODEL_ALIGN == 0 && offset <= m->size && size <= m->size - offset;
+}
+
+static int tensors_fit(const struct model_header *m, const struct model_layer *l) {
+    uint32_t weights_size, bias_size = l->nrows * 4;
+
+    if (m->dtype == MODEL_DTYPE_INT4)
+        return tensor_fits(m, l->weights, l->nrows * STRIDE4(l->ncols)) && tensor_fits(m, l->bias, bias_size) &&
+               tensor_fits(m, l->scales, l->nrows * sizeof(struct row_scale));
+
+    if (m->dtype == MODEL_DTYPE_INT8)
+        weights_size = l->nrows * STRIDE8(l->ncols);
+    else
+        weights_size = l->nrows * l->ncols * sizeof(float);
+
+    return tensor_fits(m, l->weights, weights_size) && tensor_fits(m, l->bias, bias_size);
+}
+
+static int shift_fits(int shift) {
+    return shift >= REQUANT_SHIFT_MIN && shift <= REQUANT_SHIFT_MAX;
+}
+
+// the layer's requantization, or with int4 that of each row
+static int check_shifts(const struct model_header *m, const struct model_layer *l) {
+    const struct row_scale *rs = model_tensor(m, l->scales);
+
+    if (!shift_fits(l->shift))
+        return MODEL_ERR_QUANT;
+
+    if (m->dtype == MODEL_DTYPE_INT4)
+        for (int r = 0; r < l->nrows; r++)
+            if (!shift_fits(rs[r].shift))
+                return MODEL_ERR_QUANT;
+
+    return MODEL_OK;
+}
+
+// Row pointers that only grow, and blocks that start inside the row in
+// increasing column order: the kernels take only a row's last block for
+// the one that may stop short of BSR_BLOCK columns.
+static int check_bsr(const struct model_header *m, const struct model_layer *l) {
+    const uint16_t *rows = model_tensor(m, l->index), *cols = rows + l->nrows + 1;
+    uint32_t nblocks, value_size = m->dtype == MODEL_DTYPE_INT8 ? 1 : sizeof(float);
+
+    if (!tensor_fits(m, l->index, (l->nrows + 1) * 2))
+        return MODEL_ERR_SIZE;
+
+    nblocks = rows[l->nrows];
+    if (!tensor_fits(m, l->index, (l->nrows + 1 + nblocks) * 2) ||
+        !tensor_fits(m, l->weights, nblocks * BSR_BLOCK * value_size) ||
+        !tensor_fits(m, l->bias, l->nrows * 4))
+        return MODEL_ERR_SIZE;
+
+    if (rows[0] != 0)
+        return MODEL_ERR_SHAPE;
+    for (int r = 0; r < l->nrows; r++)
+        if (rows[r] > rows[r + 1])
+            return MODEL_ERR_SHAPE;
+    for (uint32_t i = 0; i < nblocks; i++)
+        if (cols[i] % BSR_BLOCK != 0 || cols[i] >= l->ncols)
+            return MODEL_ERR_SHAPE;
+    for (int r = 0; r < l->nrows; r++)
+        for (int i = rows[r] + 1; i < rows[r + 1]; i++)
+            if (cols[i] <= cols[i - 1])
+                return MODEL_ERR_SHAPE;
+
+    return MODEL_OK;
+}
+
+// dense layers, each but the last optionally followed by ReLU
+static int check_layers(const struct model_header *m) {
+    const struct model_layer *layers = model_layers(m);
+    int rows = 0;
+
+    if (m->nlayers == 0 || m->nlayers > MLP_MAX_LAYERS || layers[m->nlayers - 1].relu)
+        return MODEL_ERR_SHAPE;
+
+    for (int i = 0; i < m->nlayers; i++) {
+        const struct model_layer *l = &layers[i];
+        int err;
+
+        if (l->ncols > MLP_MAX_LEN || l->nrows > MLP_MAX_LEN || l->nrows == 0)
+            return MODEL_ERR_SHAPE;
+        if (i > 0 && l->ncols != layers[i - 1].nrows)
+            return MODEL_ERR_SHAPE;
+
+        // int4 layers are only stored densely
+        if (l->format == MODEL_LAYER_BSR && m->dtype != MODEL_DTYPE_INT4)
+            err = check_bsr(m, l);
+        else if (l->format == MODEL_LAYER_DENSE)
+            err = tensors_fit(m, l) ? MODEL_OK : MODEL_ERR_SIZE;
+        else
+            err = MODEL_ERR_SHAPE;
+        if (err == MODEL_OK)
+            err = check_shifts(m, l);
+        if (err != MODEL_OK)
+            return err;
+
+        rows += l->nrows;
+    }
+
+    return rows > MLP_MAX_ROWS ? MODEL_ERR_SHAPE : MODEL_OK;
+}
+
+static int check_pca(const struct model_header *m) {
+    const struct model_pca *p = model_tensor(m, m->pca);
+
+    if (m->pca == 0)
+        return MODEL_OK;
+    if (!tensor_fits(m, m->pca, sizeof(*p)))
+        return MODEL_ERR_SIZE;
+    if (p->height == 0 || p->width == 0 || p->width > PCA_MAX_WIDTH || p->ncomponents != model_layers(m)[0].ncols)
+        return MODEL_ERR_SHAPE;
+    if (!tensor_fits(m, p->basis, (uint32_t)p->height * p->ncomponents * STRIDE8(p->width)) ||
+        !tensor_fits(m, p->bias, p->ncomponents * 4))
+        return MODEL_ERR_SIZE;
+    if (!shift_fits(p->shift))
+        return MODEL_ERR_QUANT;
+
+    return MODEL_OK;
+}
+
+static struct pca read_pca(const struct model_header *m) {
+    const struct model_pca *p = model_tensor(m, m->pca);
+
+    if (m->pca == 0)
+        return (struct pca) {0};
+
+    return (struct pca) {
+        .height = p->height,
+        .width = p->width,
+        .ncomponents = p->ncomponents,
+        .basis = model_tensor(m, p->basis),
+        .bias = model_tensor(m, p->bias),
+        .scale = p->scale,
+        .rq = {
+            .multiplier = p->multiplier,
+            .shift = p->shift,
+            .zero = m->input_zero,
+            .min = INT8_MIN,
+            .max = INT8_MAX,
+        },
+    };
+}
+
+// The first op converts the input to the model's dtype; mlp_run skips it
+// for inputs that already have that dtype.
+static void build_graph(const struct model_header *m, struct graph *g) {
+    const struct model_layer *layers = model_layers(m);
+    struct qparams in = {.zero = m->input_zero, .scale = m->input_scale};
+    struct graph_op *op;
+    // int4 models have int8 activations too
+    int int8 = m->dtype != MODEL_DTYPE_F32, int4 = m->dtype == MODEL_DTYPE_INT4;
+
+    g->nops = 0;
+
+    if (int8)
+        op = graph_add(g, OP_QUANTIZE, GRAPH_F32, GRAPH_INT8, layers[0].ncols, layers[0].ncols);
+    else
+        op = graph_add(g, OP_DEQUANTIZE, GRAPH_INT8, GRAPH_F32, layers[0].ncols, layers[0].ncols);
+    op->q = in;
+
+    for (int i = 0; i < m->nlayers; i++) {
+        const struct model_layer *l = &layers[i];
+        int last = i == m->nlayers - 1;
+
+        if (int8) {
+            // The last layer stays in the int32 accumulator for argmax32,
+            // or is scaled to float when rows have their own scale.
+            // Hidden layers clamp at their zero point to fuse ReLU.
+            op = graph_add(g, OP_DENSE, GRAPH_INT8, !last ? GRAPH_INT8 : int4 ? GRAPH_F32 : GRAPH_INT32, l->nrows, l->ncols);
+            op->q = in;
+            op->rq = (struct requant) {
+                .multiplier = l->multiplier,
+                .shift = l->shift,
+                .zero = l->zero,
+                .min = l->relu ? l->zero : INT8_MIN,
+                .max = INT8_MAX,
+            };
+        } else {
+            op = graph_add(g, OP_DENSE, GRAPH_F32, GRAPH_F32, l->nrows, l->ncols);
+        }
+
+        op->weights = model_tensor(m, l->weights);
+        op->bias = model_tensor(m, l->bias);
+
+        if (l->format == MODEL_LAYER_BSR) {
+            const uint16_t *rows = model_tensor(m, l->index);
+            op->bsr = (struct bsr) {op->weights, rows, rows + l->nrows + 1};
+        }
+
+        if (int4)
+            op->row_scales = model_tensor(m, l->scales);
+
+        if (l->relu && !int8)
+            graph_add(g, OP_RELU, GRAPH_F32, GRAPH_F32, l->nrows, l->nrows);
+
+        in = (struct qparams) {.zero = l->zero, .scale = l->scale};
+    }
+}
+
+int load_model(const void *blob, size_t size) {
+    const struct model_header *m = blob;
+    int err, rows = 0;
+
+    if (size < sizeof(*m) || m->magic != MODEL_MAGIC)
+        return MODEL_ERR_MAGIC;
+    if (m->version != MODEL_VERSION)
+        return MODEL_ERR_VERSION;
+    if (m->size > size || sizeof(*m) + m->nlayers * sizeof(struct model_layer) > m->size)
+        return MODEL_ERR_SIZE;
+    if (m->dtype != MODEL_DTYPE_F32 && m->dtype != MODEL_DTYPE_INT8 && m->dtype != MODEL_DTYPE_INT4)
+        return MODEL_ERR_DTYPE;
+
+    err = check_layers(m);
+    if (err == MODEL_OK)
+        err = check_pca(m);
+    if (err != MODEL_OK)
+        return err;
+
+    build_graph(m, &next_graph);
+    if (graph_plan(&next_graph, arena, BATCH_MAX) > MLP_ARENA_SIZE)
+        return MODEL_ERR_ARENA;
+
+    for (int i = 0; i < next_graph.nops; i++) {
+        struct graph_op *op = &next_graph.ops[i];
+
+        if (op->type != OP_DENSE || op->in_dtype != GRAPH_INT8)
+            continue;
+
+        if (op->row_scales != NULL)
+            fold_zero4(op->weights, op->bias, op->q.zero, &bias8x[rows], op->nrows, op->ncols);
+        else if (op->bsr.rows != NULL)
+            fold_zero8_bsr(&op->bsr, op->bias, op->q.zero, &bias8x[rows], op->nrows);
+        else
+            fold_zero8(op->weights, op->bias, op->q.zero, &bias8x[rows], op->nrows, op->ncols);
+        op->bias8x = &bias8x[rows];
+        rows += op->nrows;
+    }
+
+    mlp_graph = next_graph;
+    mlp_model = m;
+    mlp_input_len = model_layers(m)[0].ncols;
+    mlp_output_len = model_layers(m)[m->nlayers - 1].nrows;
+    mlp_input_qparams = mlp_graph.ops[0].q;
+    mlp_pca = read_pca(m);
+
+    return MODEL_OK;
+}
+
+void set_dual_core(int enable) {
+    dual_core = enable;
+}
+
+static void argmax_batch(const struct graph_op *last, const void *out, int *labels, int n) {
+    for (int b = 0; b < n; b++) {
+        if (last->out_dtype == GRAPH_F32)
+            labels[b] = argmax((const float *)out + b*last->nrows, last->nrows);
+        else
+            labels[b] = argmax32((const int32_t *)out + b*last->nrows, last->nrows);
+    }
+}
+
+void mlp_run(const void *inputs, int input_dtype, int *labels, int n, int accel) {
+    const struct graph_op *last = &mlp_graph.ops[mlp_graph.nops - 1];
+    int first = input_dtype == mlp_graph.ops[0].out_dtype;
+    int flags = (accel ? GRAPH_ACCEL : 0) | (dual_core ? GRAPH_DUAL_CORE : 0);
+    const void *out = graph_run(&mlp_graph, first, inputs, n, flags);
+
+    TRACE(TRACE_ARGMAX, argmax_batch(last, out, labels, n));
+}
+
+// the projection goes where the graph's input conversion would write
+int mlp_run_pca(const int32_t *acc, int accel) {
+    const struct graph_op *convert = &mlp_graph.ops[0];
+    void *input = mlp_graph.arena + convert->out;
+    int label;
+
+    if (convert->out_dtype == GRAPH_INT8)
+        TRACE(TRACE_PCA, pca_output8(&mlp_pca, acc, input));
+    else
+        TRACE(TRACE_PCA, pca_output(&mlp_pca, acc, input));
+
+    mlp_run(input, convert->out_dtype, &label, 1, accel);
+    return label;
+}
+
+// the run_mlp* entry points serve only a model of their own dtype
+static int model_is(int dtype) {
+    return mlp_model != NULL && mlp_model->dtype == dtype;
+}
+
+static int run_one(const void *input, int input_dtype, int dtype, int accel) {
+    int label = -1;
+
+    if (model_is(dtype))
+        mlp_run(input, input_dtype, &label, 1, accel);
+    return label;
+}
+
+static void run_many(const void *inputs, int input_dtype, int dtype, int *labels, int n, int accel) {
+    if (model_is(dtype)) {
+        mlp_run(inputs, input_dtype, labels, n, accel);
+        return;
+    }
+
+    for (int b = 0; b < n; b++)
+        labels[b] = -1;
+}
+
+int run_mlp(const float *input) {
+    return run_one(input, GRAPH_F32, MODEL_DTYPE_F32, 0);
+}
+
+int run_mlpx(const float *input) {
+    return run_one(input, GRAPH_F32, MODEL_DTYPE_F32, 1);
+}
+
+int run_mlp8(const float *input) {
+    return run_one(input, GRAPH_F32, MODEL_DTYPE_INT8, 0);
+}
+
+int run_mlp8x(const float *input) {
+    return run_one(input, GRAPH_F32, MODEL_DTYPE_INT8, 1);
+}
+
+int run_mlp4(const float *input) {
+    return run_one(input, GRAPH_F32, MODEL_DTYPE_INT4, 0);
+}
+
+int run_mlp8q(const int8_t *input) {
+    return run_one(input, GRAPH_INT8, MODEL_DTYPE_INT8, 0);
+}
+
+int run_mlp8xq(const int8_t *input) {
+    return run_one(input, GRAPH_INT8, MODEL_DTYPE_INT8, 1);
+}
+
+int run_mlp4q(const int8_t *input) {
+    return run_one(input, GRAPH_INT8, MODEL_DTYPE_INT4, 0);
+}
+
+void run_mlp_batch(const float *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_F32, MODEL_DTYPE_F32, labels, n, 0);
+}
+
+void run_mlpx_batch(const float *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_F32, MODEL_DTYPE_F32, labels, n, 1);
+}
+
+void run_mlp8_batch(const float *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_F32, MODEL_DTYPE_INT8, labels, n, 0);
+}
+
+void run_mlp8x_batch(const float *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_F32, MODEL_DTYPE_INT8, labels, n, 1);
+}
+
+void run_mlp4_batch(const float *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_F32, MODEL_DTYPE_INT4, labels, n, 0);
+}
+
+void run_mlp8q_batch(const int8_t *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_INT8, MODEL_DTYPE_INT8, labels, n, 0);
+}
+
+void run_mlp8xq_batch(const int8_t *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_INT8, MODEL_DTYPE_INT8, labels, n, 1);
+}
+
+void run_mlp4q_batch(const int8_t *inputs, int *labels, int n) {
+    run_many(inputs, GRAPH_INT8, MODEL_DTYPE_INT4, labels, n, 0);
+}
@@ -1,29 +0,0 @@
-#include "mlp_weights.h"
-
-const float input_zero = 53;
-const float input_scale = 1.2128163576126099;
-
-const int8_t layer_1_weights_zero = 0;
-const float layer_1_weights_scale = 0.002077600220218301;
-
-const int8_t layer_1_zero = 0;
-const float layer_1_scale = 0.13530057668685913;
-
-const int8_t layer_1_weights8[12672] = {-50, 17, 42, -36, -67, 54, 9, 81, 83, -2, 15, -63, 58, -17, 40, -36, -60, 24, 16, 3, 9, -39, -24, 3, 23, -9, -48, 63, -53, 13, -18, -10, 9, 9, 45, -49, -33, 22, 56, -7, -1, -55, 4, -11, -20, -13, 67, -20, -45, 44, 28, -11, 11, 51, 11, 19, -66, 29, -8, 16, -51, 41, -31, 2, -13, -70, 29, 4, 22, 19, 27, 1, -13, -49, -36, 34, 15, 30, -58, 36, 30, -16, -3, 19, -51, 9, -9, 2, -1, -10, 18, 8, 15, 44, 10, -36, 35, 18, 1, -20, 18, -74, -41, -42, 21, -52, -30, 6, 31, -16, 47, -7, -59, 9, -16, 49, 42, 38, 51, -24, 36, 20, -32, -21, 23, -2, 57, -10, -59, -5, 49, 71, 2, 16, -64, 72, 26, -23, -5, -35, -10, 55, -36, -44, 12, -14, -60, 31, -30, -32, -50, 16, 39, 29, 59, -17, -35, 19, 40, -21, 18, -8, -25, -45, -26, 14, 6, 79, -12, 11, 0, -13, -20, -1, -50, 54, 42, 8, -37, 1, -98, 10, -42, 15, 42, 50, -9, -19, 24, 63, 4, -23, 75, 8, 56, -60, -8, 74, 55, 29, 0, -9, -18, -22, -64, 48, 51, 3, -56, -59, 34, 14, 24, 33, -41, 4, -17, 16, -41, -6, 3, 38, 3, -26, -26, 0, 34, 58, 33, 4, 10, 65, -9, -36, 11, 0, 19, 52, 12, 22, 55, 11, -34, -2, 35, -11, 0, 52, -20, -26, -36, 20, 16, 24, -26, 46, 12, -17, -19, 51, 3, -13, -29, -60, -61, 2, -27, -8, -19, 24, -20, 57, -40, 18, 47, -24, -9, -65, 15, -60, 8, -43, -3, 12, 28, 12, -6, -45, -58, 30, -53, 10, 25, -30, 40, 24, 30, -54, 60, -4, 9, 2, -35, 56, 30, -9, -38, -1, 31, 17, -51, -8, -3, -28, -15, 30, -26, -21, -16, -19, -36, -49, 16, -9, -17, 59, -49, 73, 76, -50, 18, -16, 51, -5, -55, 24, 51, 34, 36, 37, 25, 11, -52, 13, -38, 62, 4, 50, 21, -10, -37, 2, 2, -27, -70, 3, 46, 40, -31, -24, 34, -22, -10, -3, 47, -8, 35, -49, 43, -23, 29, -23, 52, -20, 47, 58, 18, 40, 17, -20, 19, -20, -3, 16, 41, -40, 1, -26, -8, 21, 35, 25, -29, 20, 6, 7, 65, -72, 33, 60, 30, -9, -69, 42, -25, 0, -25, -24, 89, 19, -5, 60, -50, 16, 26, -26, 5, -6, 11, -22, 18, 23, 30, 52, -24, -61, 21, -2, -3, -1, -16, 39, -17, 26, -5, 50, 0, -5, 62, 49, 51, 30, -66, 13, -93, 13, 38, -22, 17, 7, 23, -67, -45, 26, -86, -28, -23, -26, 30, 70, 43, 16, 32, -2, -6, 43, -20, 34, -68, -17, 18, 17, -43, -12, -16, 22, -20, 2, -75, 27, -7, 51, 37, 50, -42, 51, -17, 15, -3, 11, -4, 61, 37, -22, 27, 2, 69, 34, -16, 8, -6, -17, -47, -62, -34, 18, 23, -38, 27, 3, 0, 3, -1, -26, -61, 2, 21, 27, -4, 45, 17, 14, -5, 1, 8, 22, -22, -2, -28, -24, 1, 24, 71, 11, 25, -42, 46, -91, -72, 12, -78, 52, 29, 13, -14, -22, -64, -39, -10, 16, 54, -24, 67, -1, -6, 39, 3, 6, -26, 3, 39, -9, -37, -1, -15, -15, -15, -15, 32, -37, -20, -4, -46, 26, 13, 15, 14, 56, 23, 48, -71, 49, 28, -14, -29, 45, 14, 16, 67, -54, 14, -11, 43, 62, 51, -42, 4, 8, -13, -15, -3, 74, -10, -3, -30, -8, 47, -43, -9, -40, -6, -9, -26, 63, 45, -42, 68, 71, 25, -54, -8, -35, 15, 17, 19, 36, -3, 46, -42, 46, -60, 28, -5, 7, -32, -63, -29, 7, 28, 26, 21, -13, 18, 17, -16, -22, 12, -11, -31, 21, -22, -4, 5, -10, -7, -12, -5, -51, 40, 20, -1, 16, 14, -32, -22, 39, 78, -54, -75, 15, 65, 19, -70, -35, -28, 29, -24, 4, -19, -13, -12, -81, -75, 24, -7, 42, 11, 9, 49, 37, 17, -24, -21, 76, -19, -31, -92, 4, -10, 36, -44, -6, 25, 19, -20, -17, 29, -2, -44, -57, 23, 5, 3, 44, 10, 20, -27, -40, 8, -13, -19, 44, -25, -22, 6, -56, 71, 43, -25, -51, 38, 22, 14, 22, -1, -22, 37, -12, 1, -36, 13, -50, -6, -37, -26, -14, 41, -21, 61, -55, 32, -52, -20, 1, 19, -42, -38, -1, 10, 18, -39, -6, -1, -30, 34, -18, -18, 33, 16, -13, 45, -18, -15, -22, -19, -67, 40, -3, 27, -23, 0, 56, 42, -40, -28, -1, 36, 9, 4, 42, -18, 25, 7, 35, 7, 15, 20, -24, -27, 54, -23, 5, -5, 40, 17, 65, -36, -89, -45, -41, 23, 21, 9, -40, 34, 0, -25, -19, -77, -2, 26, -27, -64, 8, 23, -7, 32, 16, 16, -44, 13, -30, -72, 12, -32, -19, 46, -11, 67, 10, 10, -37, 0, -3, -23, -11, -4, -34, -59, 29, 65, -61, 55, -13, 28, -9, 54, 23, -57, -41, -11, 7, -55, -76, 44, 9, 13, -55, -28, 36, -4, 48, 26, 8, 19, 33, -22, -53, -40, 42, -7, 7, -31, -20, -10, 23, -71, -1, 38, -3, 27, -31, 34, 3, 38, 9, -17, 45, 22, 10, -6, -23, -25, 35, -9, -62, -10, 2, -51, 20, -43, 25, -3, -52, -18, -33, -14, 51, 2, -12, 13, -22, -10, 10, -13, -5, 50, -19, -38, 36, 55, 86, 51, -22, 69, -69, 20, -2, -49, 65, -4, 11, 2, -40, 0, -21, -38, 61, -22, 3, 5, -74, 4, 7, -1, -24, 25, 71, -3, 19, -78, 88, 24, 45, -52, -22, 10, 3, -5, 1, 46, -29, -7, 80, 11, -9, 48, 17, -1, 28, -23, -4, -34, 74, 42, 39, 8, -42, 44, -48, 101, 11, 27, 2, 44, 33, -21, -33, -5, -18, 1, -15, -59, -74, -19, -9, 60, 1, -23, -24, 44, -26, 76, -15, 61, -26, 7, 64, -9, 26, 4, 68, 3, -26, -26, -8, -7, 2, -14, -30, -52, -65, -55, -20, 45, 15, -43, 35, 1, 29, 12, -10, -6, -50, -41, 38, 9, -70, -39, 41, 51, -12, -53, -1, -8, 42, 12, 11, 66, 38, -50, -17, 4, 9, -8, -11, 64, 46, 40, 92, -28, -22, -41, -67, 28, -33, 0, 5, -38, 35, 6, 24, -17, -69, -13, -4, -15, 16, -46, 4, -2, -2, -45, 15, 13, 19, -50, 19, 8, 21, 9, -6, 24, 45, 84, -43, -83, -21, 54, 8, 34, 18, -84, 1, 84, -62, 12, 48, 49, 79, 23, 0, 2, 16, -53, 25, -41, -10, 32, -40, -18, 22, -49, 71, -24, -24, 35, 29, 11, -42, 58, -59, 35, 11, 0, -82, -42, 23, -14, 59, -46, 53, 6, 29, -25, -51, 40, 42, -59, 17, -28, -2, -66, 18, -46, 34, -24, 23, 25, 3, -55, -3, 21, 21, -57, 21, -16, -8, -26, 37, -37, -51, 54, -12, -12, -51, -13, 35, -26, -22, -1, -29, 69, 61, -4, 6, -38, -17, 10, -33, 22, -68, -17, -33, 26, 7, 8, -44, 31, -6, -16, -39, 68, 7, -28, -6, 83, -30, -65, 42, 49, 4, 27, -5, 7, 42, -10, 11, 18, 7, 30, 44, 31, -61, -42, 17, -50, 46, 23, -15, 36, -72, 11, -10, 2, -1, 15, 37, 14, 0, 4, 33, 22, -9, 40, 76, 67, 12, 73, 25, -60, 19, -32, 6, -44, 11, 31, 11, -46, 33, -46, -43, 60, 14, -29, -63, 43, -5, -37, -49, -10, -19, 27, -16, 50, 67, 64, -49, 51, 9, -21, -54, 7, 3, 11, -9, 9, -50, 42, -7, -66, 30, 36, 15, 4, -25, 53, -50, -6, -18, -10, -44, 6, -6, -20, 45, 1, -29, -26, 15, 16, 0, -20, 57, 58, -6, -28, -74, 12, -28, -23, -62, 33, 35, -73, -60, 27, 1, -4, -22, -29, 56, -33, -52, 11, -38, 74, -28, 16, 17, -61, -2, 27, 2, -18, -7, 1, -35, -22, -50, 32, 29, -21, 15, 55, 54, -53, 8, -34, 13, 53, 46, -62, -6, -28, -70, -9, 43, -42, -50, 2, 15, 11, -44, -25, -6, -1, -15, 1, 2, 12, -32, -36, 4, -6, 1, -8, -71, -16, 37, -21, -13, -16, -12, 1, 53, -50, 55, -46, 63, 6, -11, -67, -18, 35, -3, 60, -43, -7, 49, 13, -19, 24, -67, -39, 4, 55, -65, -33, -3, -33, -17, 11, -13, -36, 12, 17, -44, -34, -32, 51, -5, 8, 10, -41, -32, -22, 64, -4, 30, -55, -44, 47, 11, 51, 2, -38, 84, 16, 47, -64, -34, 34, -34, -33, 38, 55, 0, -15, 39, 35, 10, 5, -18, -21, 57, -44, -9, -32, 42, -1, 18, -14, -44, -56, 32, 22, -8, 13, 69, -27, 20, -9, -35, -3, 46, -10, 26, 5, -1, 43, 1, 40, -33, 61, 81, 12, 26, -13, 60, -42, 59, -47, 5, 3, 66, -39, -35, 52, 29, -51, 11, 53, 31, 35, 13, -57, -27, -44, -48, -66, 26, 55, -2, 27, 6, -33, 14, -41, 7, 50, -41, -2, -17, 60, 28, 48, -4, -64, 38, 12, -44, 33, -42, -8, -5, -8, 0, 43, -18, -74, 38, 28, 0, 27, -13, 34, -25, 63, 33, 38, 6, -39, 33, 25, -49, 39, 45, 55, -32, -45, 17, -2, 8, 26, -74, 30, 54, 14, -13, -50, 2, 91, -27, -57, 36, 22, 21, 6, -1, -16, -51, -4, -7, 51, -50, -23, -30, -53, 30, 26, -5, -19, -54, 40, 17, 29, 19, -28, 10, -24, 7, -5, 3, 28, -3, -15, 21, -26, 14, -3, 32, 11, 35, 36, 19, -1, 27, -5, -17, -4, 3, -23, -55, 64, 4, 30, -32, 56, 28, 13, -17, -28, 4, 2, -54, 3, 43, 2, -23, -24, 2, 3, 13, 58, 2, 23, 5, 13, -14, 0, -67, -5, 28, 0, -18, 31, -1, -44, -64, 62, -35, 1, 23, -7, 4, -19, 31, -11, -16, 11, -48, -33, 14, -25, 8, -22, -6, 31, 3, -12, 7, 30, -34, -31, 10, -36, -25, 37, 35, 23, -56, 47, -50, 1, 20, 30, 9, -37, 7, -51, 64, 15, 30, -17, 71, -24, -44, 2, -4, -59, 7, 65, 35, 16, 19, -76, -6, -22, 10, 12, -18, 2, -13, 48, 63, 38, -20, 34, 43, 42, 41, -2, 9, -27, 56, 56, 22, -78, 11, -16, -21, -8, -79, 21, -33, -35, 9, -3, -18, 19, 21, 23, 11, -56, 23, 7, -19, -32, -50, -74, -60, 49, -21, 31, 13, 59, 50, -45, 2, 11, 50, 29, 18, 52, 14, 37, -24, -29, -35, -11, -12, 25, -63, 29, -49, -6, 2, 38, 17, 43, -47, -51, 50, 16, -58, -42, -51, -17, 18, -87, -19, 8, -70, 36, 2, 15, 31, 42, 12, 39, 26, 4, -85, -65, 19, 18, 61, 37, -34, -6, 31, 54, 19, -9, -16, -7, 17, 28, -10, 11, -10, 92, 8, 3, -7, -21, 60, 38, -65, -10, -54, 65, 78, -29, 20, -57, -11, 32, -1, 49, 10, -18, 6, -9, -14, -3, -45, 18, -34, 45, -25, 64, 7, -8, 27, -61, 17, 19, -24, -11, 8, 0, 6, -19, -48, -22, 8, 30, -21, 32, 43, 44, -59, 27, 9, -43, 7, 16, 53, -19, -30, 68, 14, 27, 26, 22, -18, 5, 11, -17, 57, -40, 13, -47, -65, 39, -20, 42, -62, 83, -31, 3, 6, 29, -57, 6, 17, 47, -21, 33, -17, 42, 36, -17, 21, 11, 26, 9, -5, -60, -3, -35, -14, 33, -34, -9, -13, -56, -24, 15, -16, 73, 7, 32, 5, 66, -23, 59, 6, -26, -38, -9, -3, -9, 0, -25, -12, 28, 6, -13, -19, -10, 5, 3, 32, -36, -7, -86, 54, -67, 18, 72, -55, 9, 6, -17, -41, 17, 20, -69, 26, 41, 70, 37, -10, -92, 60, 16, 38, 2, 10, -49, 42, 19, 60, -10, -61, -29, -9, -6, -4, -17, -19, 25, -31, 17, 34, 53, 4, -38, 56, 82, -34, -44, -6, 1, -80, -31, 48, -49, 36, -30, 43, 21, -70, -73, 14, 16, -27, -23, 1, 42, 19, 15, 41, -31, 26, 24, 31, -40, 61, -37, -25, -11, 75, -42, 30, -53, -65, -29, -19, 8, 49, -2, -22, 32, -15, -1, -64, -16, -19, 49, 9, -13, -33, 75, 34, 8, -26, -44, -50, 41, -46, -42, -16, 41, -7, 13, 8, 6, -19, -22, 36, 20, -2, 42, -8, 32, 4, 15, -12, -10, -28, -23, -15, -7, 55, -48, 5, -77, 20, 12, 62, 37, -7, -24, 0, 29, 44, 20, -13, -46, 10, 6, -41, 73, 0, -66, -60, 55, 56, 25, -35, -22, 12, 44, 31, 60, -34, -48, -2, 11, 19, -38, -30, 37, -22, -30, -46, 12, -5, -27, 43, 32, -19, 1, -62, 0, -34, -40, 30, -36, 32, -50, 0, -45, -41, -62, 20, 39, -32, -15, 35, 27, -27, -39, 39, -38, 34, 28, -10, -27, -49, -8, 33, 11, -27, -46, 28, 28, 22, 1, 44, -15, 8, 57, 20, -50, 23, -13, -19, 34, -51, 43, -37, 4, 70, 67, 38, 41, 31, 28, 43, -37, -49, 4, -34, -20, -8, -20, -15, 23, 3, 16, 14, -35, -34, -2, -6, -89, 31, -46, -15, 25, -51, 19, -15, 17, -12, -34, -8, -56, -47, 51, 47, 57, -47, 3, 55, -9, -10, 18, 5, -42, 55, 57, -47, 68, -44, -43, -46, 2, 18, -8, 17, 41, 41, 20, 41, -14, 10, -5, 11, 50, -10, -40, 15, 15, 5, -88, 59, -41, 6, -22, 23, 59, -21, -70, -6, -54, -70, 11, 1, 2, 25, -4, 86, -1, 75, -43, 65, -54, -8, 13, 19, 5, -44, -47, 4, -2, -20, 68, 23, 7, -32, 16, -41, 14, -3, 27, 5, 32, 47, 41, 9, 0, 67, 50, -4, 0, 48, 4, -49, 47, 2, -23, -32, 25, 6, 35, 9, -14, -6, 1, 32, -4, -23, 17, -46, 2, 13, 55, -81, 22, 11, -14, 50, -4, -25, 8, 37, 0, -39, 22, -45, 62, -49, -10, 31, -14, -57, 43, 28, -19, -43, -10, 21, 76, 13, -28, 71, -60, -35, -4, 63, -1, -51, -41, 11, 43, 0, 81, -49, -48, 14, 42, 79, 39, 41, 50, 74, -41, 64, 39, -64, -38, 53, 4, -29, -79, -26, -46, 38, 36, 56, -33, -34, -18, -30, -14, 54, -56, 64, -68, 31, -49, -24, -1, -5, 51, 30, -20, -86, 28, -11, 55, -5, 39, 16, 30, -6, -29, 7, -56, 77, 12, 40, 18, -19, -1, -22, 6, 67, -34, 7, 33, 0, -43, 5, -8, 39, -22, -23, 30, -80, 37, 41, 58, 65, -2, -37, -29, 59, 28, 38, 24, 2, 34, 27, -35, 8, 7, 38, -29, 28, -10, -4, -27, 24, -35, 11, 13, 12, -18, 42, -11, 9, 27, -40, 39, -43, -32, -69, 70, -33, 63, 27, -22, 47, -44, -51, -48, 73, 28, -34, 37, -14, -13, -27, -38, 66, -4, -34, 35, 34, -12, 57, 49, -11, -74, -17, -50, 54, -32, 88, 86, -74, 43, 17, -30, 52, 37, 42, 26, -63, 55, 17, -92, 0, -59, -5, 46, 51, -10, -29, -12, 25, -2, -8, -6, -38, -31, 29, 2, -64, -61, -17, -39, -55, 13, 0, -20, 13, -33, 1, 3, -1, 61, 59, 7, 44, 19, -37, 46, -10, -56, -23, 18, 37, 1, 31, 34, -12, 62, 32, 39, -49, -2, 35, 14, -51, 37, -2, 43, 37, 66, 6, -51, 14, -83, 14, -23, 60, -65, 29, -5, 8, -13, -10, -13, 63, -20, -6, -12, -15, 5, 4, 9, 12, 16, -38, 14, 7, 94, 9, -47, 65, 9, 17, -7, 20, 34, 2, 34, -35, 41, 47, -93, -31, 77, -16, -15, 33, -6, -22, 38, 29, -32, 8, -8, -16, 44, 38, -70, -5, -26, 10, -54, 27, 15, -41, 26, 11, 40, 38, -15, -18, -26, 41, 49, 14, -1, 4, 35, -68, -39, -39, 47, -34, 11, -5, 21, -5, 6, 18, 3, 51, -52, -28, 43, -45, -56, 26, 58, -35, -3, -42, 19, 6, 15, -23, -23, 74, 1, 38, 22, 1, -56, 14, 38, -4, -26, 8, 42, -9, 37, 7, -8, 58, 18, 35, -47, 20, -47, -21, -46, 30, -1, -19, -46, -3, -82, 10, 30, -32, 2, 2, 37, -34, -21, -34, 11, -23, -2, -26, 4, 2, -2, 37, -16, -52, 12, -39, 55, 43, -39, 7, -3, -31, -30, -2, 58, 11, -57, 57, -77, 61, -23, 4, 20, -33, 70, -61, 32, 25, -10, 16, -1, -40, -9, -52, -53, 34, -11, -9, -76, -21, -50, -28, 22, 10, -28, 1, 73, -39, -31, -32, -4, 90, 2, -1, 2, -18, 110, 10, 13, -72, -28, -20, -5, -16, -19, -1, 58, -16, 43, -1, 34, 51, 6, 67, 11, 4, 1, -40, 10, -28, -18, 13, 14, -8, 28, 56, 31, -76, 3, -82, 2, -46, 24, -42, -26, -73, 2, 43, -30, -36, 3, 62, -7, -52, -46, -70, -23, 39, -51, -19, -67, 13, -12, 19, -6, -7, -6, 17, 26, 9, -12, 9, 56, 8, -59, 20, 26, 11, 56, -12, -2, -61, 23, -58, 13, -43, -71, 11, -33, -48, -53, -34, -22, 48, 4, 62, -39, 19, 19, 37, 90, -29, -27, -19, 27, 38, 29, 26, 128, -1, -48, -13, -46, 2, 52, -24, -31, -6, 49, -8, 36, 48, 76, -26, -27, -68, -48, 18, -26, -8, -1, -28, -32, -40, -50, -67, 1, 31, -12, -32, -16, 16, 8, 15, 21, 34, -45, 56, -10, -6, 38, -5, -41, -17, -14, -11, 16, -4, -1, -22, 79, 48, 17, -1, 3, 54, -20, 58, -39, 33, 37, 50, 28, 5, -32, -23, -23, 57, 8, 16, -27, 36, 30, -36, 56, -34, 19, 27, 60, -62, 70, -18, 31, 66, 20, -13, -61, -61, 16, -21, -2, -18, 25, -42, 24, 23, 75, -8, -31, 34, 13, -48, 36, 40, -30, 54, 9, -20, -63, 0, -5, -82, -21, -13, -75, 3, -56, 11, -58, 37, 35, -20, -20, -44, 10, -47, -13, 56, -11, 58, 0, -26, -44, -9, 3, 9, 75, -10, -49, -1, -37, -38, -3, -1, 27, -37, -10, 60, 11, 3, -17, 50, 74, -14, -38, -37, -9, 13, -18, 7, -24, -31, 10, -8, 9, -6, 26, -59, 3, 40, -2, 44, 37, 12, -30, 8, 36, -36, -38, 10, -19, 20, 45, 48, 14, 35, -7, 27, 16, 44, -5, -2, -2, 10, 15, 13, 8, 47, -47, 24, -71, -30, 9, 36, 11, -23, -30, 12, 14, 1, 53, -30, 57, 37, 16, 64, 61, -1, 6, -33, -24, -28, 9, 5, -35, -34, -18, 23, -6, -3, -5, 28, -13, -53, 15, -3, -15, 52, 25, -29, -27, 14, 3, -3, 23, -35, 5, -19, 16, -69, 13, 17, -29, 49, -64, 39, 24, 41, -1, -61, 46, -36, -67, -3, -7, -33, 30, -18, 51, -36, -54, 53, -12, -45, 14, -45, -5, -17, 85, -12, 47, -15, -14, -18, 21, 35, 32, 8, 30, 28, 33, -45, -24, -42, 33, -62, -38, -6, -13, -23, -14, -67, -4, -4, 5, -22, -56, 3, -15, 36, 17, -38, 13, -2, -14, 6, -40, 23, -2, 21, -42, 19, -52, 26, 32, -89, 3, 55, -54, 60, 26, -94, -6, 20, -70, -96, -1, -26, -14, 5, 12, 21, 19, 16, -20, -24, -54, 37, -21, -1, -18, -44, -56, -32, -25, -4, -8, 50, 13, -6, -101, -3, -37, -33, 2, 46, 28, 3, 46, -24, 52, 4, 20, -69, -87, 21, 39, -43, -20, 29, 30, -4, -6, 24, -69, 82, -73, -8, 17, -37, 31, -87, 11, -78, -64, 27, -15, -13, -8, -43, -15, 10, 19, 27, 8, 9, -10, -9, -2, -40, -14, 55, 30, -78, 7, 59, -16, 57, 8, 6, -17, 14, 33, -16, -24, -50, 45, -65, 6, 23, 28, -59, 30, 78, 65, -53, 38, 39, 21, -44, -2, 10, 16, -69, 10, 8, 22, -24, -42, -30, 23, -19, 17, 29, -49, -6, -9, 6, 10, 53, -56, 56, -3, -17, 42, -58, -70, 19, 5, -16, 7, 24, 17, 2, -22, 23, -54, 5, 46, 4, 13, -18, -59, -4, 29, -33, 6, 1, -18, -16, -44, -33, 6, -6, 18, -57, 26, -6, -44, 44, -5, 13, -73, -13, 20, 32, -24, 4, -7, -11, -48, -27, -34, 29, -60, -34, 6, -23, -13, -33, -35, -25, 71, 52, 29, 40, 46, 54, 27, 66, 38, -13, -21, 31, 53, -82, -30, 15, 30, 37, 68, 0, -27, -15, -9, 39, -25, -7, 29, -11, 33, -73, 32, -61, -24, -20, -9, 7, -17, 76, 26, 0, -42, 36, -18, -9, -43, 9, -61, -60, 39, -20, 21, -35, -11, 43, 47, 16, 41, 30, -13, -7, 84, 23, 22, -53, -31, -57, 9, 25, -15, 0, 26, -26, -15, 46, 28, 6, -24, 75, -39, -19, -24, -48, 66, -67, 41, -40, 16, -19, 25, 32, -8, 11, 39, 22, -29, -12, -52, -6, 1, -67, 39, 54, -27, 32, 67, -19, -28, -37, -3, 14, 12, 31, 0, -59, 9, -5, 40, -1, 29, -7, 12, 3, -25, 7, 54, -2, -61, -6, 48, 5, -78, -22, 7, -47, 70, -3, 54, 23, 20, -42, -41, 27, -6, -91, -36, 20, -29, -18, -22, -45, 10, 16, 37, -41, -47, 23, 39, 44, -47, -27, 13, 54, 6, -25, 40, -32, 1, 107, 16, 5, -12, 19, 20, -29, 50, -54, -2, -4, 29, -14, 52, -35, -61, 24, -9, -75, 20, 7, -15, -61, -33, -28, -1, 28, -40, 49, 28, -11, 40, -27, 18, 0, 3, -12, -29, -40, 67, -6, -36, -18, -35, 35, -26, 57, 44, 10, 8, 5, 7, -52, -25, -6, -24, 64, -86, 35, -8, -27, -12, -2, -8, 30, 25, -42, -2, 11, -54, -37, 34, 67, -51, -50, -5, -26, 18, 23, -47, 23, -51, 11, -3, -13, 72, -47, 79, -28, 40, -90, -16, 52, -3, -14, 43, 7, -25, -94, 6, -43, -4, 35, -43, 13, 39, 4, 0, 2, 58, -10, -33, 15, 4, -16, -49, 32, 25, 65, -26, -50, 84, -21, 18, 27, 23, 39, -52, -25, -3, -17, -33, -12, 7, 50, -18, 16, -19, -51, 17, -64, 17, -16, -13, 12, 31, 41, 22, 1, 27, -4, -31, -10, -66, -33, 41, -9, -38, -19, 13, -78, 44, -75, -36, -36, 51, -45, 39, 53, 56, 32, 6, -19, -1, -58, -31, 40, -14, 13, -32, -38, -23, 46, -49, -14, 11, -35, -45, -13, 61, 42, -20, 57, 39, 42, 6, 3, 8, 13, -61, 45, 3, -8, 44, 37, -26, -48, 69, -24, -30, 45, -23, -37, 15, -36, 37, 43, -65, 42, -15, -91, -18, 78, 42, -9, 66, -20, -9, -27, 14, 11, -6, -8, -28, -51, -45, 7, 30, 54, -12, 15, 26, 26, -9, -44, -25, 30, -38, 38, -18, -11, -7, -10, -53, 40, -17, -4, 4, 33, 9, -19, 44, -41, -8, 37, -54, 30, -69, -38, -19, 1, -16, 31, 8, 45, -8, -5, -7, -71, -42, -41, 7, -39, 36, -8, 43, 39, 21, 54, -36, 42, -6, -6, 10, -13, -44, -75, -54, 38, -16, 42, 31, -20, 11, 66, -29, 24, 54, -39, 43, 15, 43, 70, -20, -55, -9, 54, 16, -21, -12, -38, 10, 7, 1, -39, 73, 10, 0, 69, -25, -45, -2, -28, -10, 27, -21, 14, 43, -26, -6, 0, 23, -7, -4, -2, -12, -42, 14, -42, -75, 2, -40, -30, -72, 89, 22, 68, -19, -21, -4, -22, 5, 62, -5, 71, 30, -67, 53, 40, 5, -14, 7, 0, -27, -55, 13, -3, 44, 30, 39, -59, -35, -61, 51, 46, -6, 19, 0, 13, -21, -13, -37, 22, 15, 65, -67, -58, -1, -45, 31, -37, -37, -36, -65, -11, -3, 17, -53, 69, -53, 9, 31, 3, 19, -3, -67, 51, 13, 10, 2, 18, 4, -54, -39, 27, -38, 29, 29, 28, -30, 8, -18, 68, -55, 43, -42, -36, -32, -32, -15, -8, 19, 55, 29, 23, 16, 34, 26, -30, 26, 25, 57, 2, -16, -41, 1, -4, -22, -26, -44, 15, -92, 29, -25, 2, 12, 17, -32, 3, -53, 33, 45, 13, -39, 4, 10, 43, 0, 35, -34, -84, 46, 67, -26, -61, 30, -23, -70, 58, -62, -35, 48, 34, 98, -63, 27, -30, -55, 53, -16, -41, -9, -20, 45, -39, -2, 13, -25, -43, 12, -67, 21, -31, 85, 52, -40, 10, 25, -1, 12, -45, 57, 8, 37, -4, 8, -46, 29, 1, 24, -12, -45, 11, 10, -17, -84, -40, 82, 44, 54, -29, 17, -42, -21, -47, -1, -65, 27, -76, -37, -53, 19, -12, -43, 36, -15, -10, 24, 29, 30, -19, -45, 46, -21, -63, -28, 57, 87, 25, -77, 52, 38, -25, -88, 41, 91, -80, -18, 13, -26, 40, -102, -41, -75, 24, -27, 9, 12, -2, -45, -16, 79, 26, -24, -27, -93, 9, 4, -112, 14, -80, 32, -25, -35, 2, -13, 16, 58, 23, -37, 52, -5, 23, -26, -31, -7, -41, -91, -7, -39, -50, -1, 8, 21, 28, 22, -32, 39, -5, -47, -6, -63, 44, 22, 73, 8, 10, 42, -40, -26, -13, -37, -37, 25, -13, -23, -16, 18, -6, -60, 19, 1, -25, -35, 29, 27, 11, 27, -6, -32, -9, 7, -24, 53, 7, -37, -11, -60, -2, 2, 24, -63, 21, 20, -36, -40, -33, -11, 45, -33, -13, 54, -69, -15, -41, 17, -10, 17, -11, -80, -2, 8, 46, 9, -33, 23, 30, -7, -22, 6, 12, 23, -74, -47, 17, -29, -27, 1, -9, 83, 9, -14, -24, -4, -23, -12, 22, 9, -27, -25, 56, 21, -2, -5, -13, -32, -43, -33, 7, -43, 20, 55, -28, -7, 42, 17, 14, 3, -22, -13, -53, -27, 7, 21, -62, 3, 43, 34, 11, 83, 64, -32, -69, -67, 52, -29, 9, 46, 29, -79, -52, -47, -13, -31, 21, 68, 28, -4, -8, -27, -5, -4, 34, -54, 0, -26, -2, 0, -27, 5, 25, 3, -15, 35, 39, 14, -22, 80, -15, -59, 42, -25, -25, 20, 43, 26, -46, -9, -8, -7, 10, -17, -7, 15, 34, -32, -32, -13, 55, 90, -12, -46, 42, 25, 1, 72, 4, 36, -65, 20, -23, 45, 40, -7, -46, 39, -3, -53, -72, 26, -19, 24, 16, 4, 12, 13, -76, 19, -17, 0, -41, 75, 50, 73, -27, -22, 51, 17, -7, 30, 23, -25, -25, -72, -20, 6, 9, -35, -10, -13, -68, -12, 9, 17, 43, 1, -6, 47, -26, 18, -31, -25, -21, -71, -39, -47, 67, -63, 31, 89, 78, -9, -38, 14, -23, -49, -26, -31, -7, -16, 81, -55, -70, -99, -12, -36, 38, -23, 64, 20, -31, 36, 35, -6, -8, 7, -56, 5, 38, -23, -18, -52, -64, -14, 10, 24, -6, -13, -21, 11, 11, -13, -34, 3, -71, -26, 57, 25, -12, 20, -47, -36, -1, -21, -22, 16, -47, -29, -87, 21, -62, 50, 34, -6, -11, 1, -22, 60, 2, 17, -22, -39, 8, 44, -19, -53, -30, -64, -8, -14, -79, -3, -12, 24, 43, -30, 0, -34, -46, -10, -28, 41, -23, 75, -14, 21, 4, 32, -33, -18, -19, -55, -35, -6, -2, 42, 21, 50, -8, 6, -12, 73, 12, 11, -3, -9, -35, 71, 31, 36, 23, 40, 26, 6, 17, 2, -9, 32, 14, -35, -56, -8, 66, -43, -17, -8, 48, 49, 20, -81, 0, 18, -1, 8, 59, 48, -25, 36, 23, -29, 38, -5, 21, -11, -45, -6, -26, 39, 35, -12, -33, -81, -61, -51, -26, 57, 2, -41, -28, -10, 0, -69, -75, 25, -8, -13, 7, -11, -2, -47, 70, 21, 17, -15, -31, 45, 63, 10, 24, 27, -15, 68, 6, 45, 20, -43, 11, -18, 60, -78, -43, 9, -17, 16, -28, 21, 1, 25, -15, 52, -18, 28, -13, 33, 78, 25, -55, 44, 28, -16, -3, -4, 12, 42, -6, -36, -54, -59, -46, -6, -37, -43, -26, -83, 68, -27, 2, 12, 15, -45, -20, 90, 30, 26, 60, 1, 29, 63, 17, -10, 9, 2, -16, -35, 61, 14, 48, -16, -1, -70, 59, 4, 73, 38, -48, 9, 3, -39, -16, -32, 83, -43, 8, -74, -9, -28, -52, -3, 38, -20, 11, -40, 21, 0, -4, 25, 17, -37, 42, -9, -76, 7, 59, 28, 64, 36, -70, -26, 19, -8, -41, -1, 21, 36, 3, 14, 4, -32, 16, 6, 40, 6, -1, 47, -37, -2, -37, -9, -9, 57, -21, 29, -57, -47, 24, -9, -20, 65, 25, 9, 16, 60, -69, 33, 27, 48, 46, -5, -29, -18, -14, -79, 5, 26, -24, 28, -13, 6, -8, -60, -57, 24, -15, 31, -29, -44, 33, 34, 1, -31, 3, -16, 36, -14, -35, -17, 66, -37, 45, 25, -7, 11, -12, -1, -27, -34, -2, -50, -12, 24, 41, 15, -20, -32, -12, -11, 16, 53, 19, -29, 68, -48, -47, -25, -33, -83, -3, -19, 77, 46, -9, -20, 61, 0, 78, -15, 45, 31, 43, 32, -49, 49, 10, -27, 2, 21, -36, 62, 3, -33, 9, -45, 31, 5, 12, 88, -13, 6, -39, -13, 24, 59, -18, 7, 21, -12, -22, -12, -45, -27, -21, 12, 4, -2, 24, 12, 10, -25, -60, -13, 39, 44, 12, -95, -1, 17, -3, 31, 37, 34, -16, 65, 32, 10, 0, -5, 50, -25, 28, -40, -5, -13, 26, 73, -7, -72, 0, -24, -8, 6, -12, 7, 23, 26, -40, 21, -2, -18, 29, 0, 14, -1, -58, -4, 37, 28, 12, -42, -31, 22, 17, 23, 19, 53, 2, -20, 67, 23, 34, -48, 15, 10, -39, 6, -15, 17, 12, 34, -42, 10, -47, 13, 13, 19, -10, -60, -16, -32, -75, -9, 38, 5, 81, -20, 29, -11, 72, 0, 23, 10, -76, 32, 5, -44, -18, -34, -57, -66, -17, -22, -3, 53, 51, -48, -25, -82, 25, 43, -25, 27, 2, 38, 26, -27, 81, -47, -2, -21, -17, 13, -3, -7, -46, 16, -13, -58, -16, -17, -25, 18, -39, -18, -10, 43, 47, 47, -17, -19, 0, -49, 6, 11, 14, 30, -43, -21, -43, 26, -27, 12, 0, 39, 49, 19, -73, 33, -14, 62, -9, 31, -61, -44, -38, 5, 4, 56, 37, -10, -33, 18, -7, 18, 29, -47, -83, 30, -3, -7, 44, -35, 21, -4, -61, 6, 27, -66, 17, 36, -23, -25, 44, -7, -5, 45, 20, -9, -1, 54, -46, 34, -16, -12, -1, 13, 16, -69, 27, 67, -47, 56, 45, 4, 48, 15, -45, -12, -65, -63, 39, -52, -33, -56, -89, -60, -44, 1, 51, -56, 18, -50, 45, -26, 45, -9, 70, -36, -68, -22, -16, 38, -1, 32, -23, -53, -49, -29, -23, 11, 10, 18, 21, -58, -5, -16, 50, -29, 12, -30, 76, 68, 30, -3, -15, -59, 38, -10, 43, 6, -16, -25, -37, 34, 27, 27, 6, 3, 2, 12, 33, -20, -2, 47, 30, 40, -30, -21, 21, 5, -14, 10, -24, -77, -48, 42, 22, 79, -13, 8, 76, 7, -15, -33, -78, -27, -26, -78, -19, 53, -39, 16, -13, 25, 62, -97, 42, 13, 73, 10, 29, 29, 29, -51, 3, 4, -22, 21, 24, 57, -20, -2, -11, -14, 20, 43, -33, 27, -28, -33, 10, -42, 65, 35, 40, -61, 86, 84, 32, -55, 64, 6, 85, -21, 34, -86, 2, 81, -62, 50, 34, -2, -26, -10, 58, -16, -52, -28, 18, -5, 47, 16, -12, -51, -75, 7, -4, 4, -52, -7, -1, -33, 67, 24, -21, -23, 55, -43, -38, -76, 17, 18, -40, -32, 50, -58, -91, -75, 5, 4, 46, -60, 18, 21, -57, -10, 89, 20, -6, -2, 4, -23, 23, 55, -18, -36, -14, -24, 21, 32, 14, 12, -29, 24, 28, -41, 51, -55, 4, 42, 24, -65, 68, -61, -24, -5, 15, 55, -4, -11, -70, 12, 54, -5, 15, 21, -28, 3, 7, -28, 7, 6, -24, -15, 31, -12, 11, 28, -12, 18, -30, 9, 16, -17, 27, 8, 29, 16, 49, -75, -12, -20, -18, 30, 89, -11, -8, 15, -14, 70, -15, 5, 30, 66, 31, -51, 26, -27, -26, -26, -66, -70, 30, -1, 54, -23, -11, 49, -9, 19, -6, -6, 14, -17, 18, 7, 20, -12, -75, 36, 40, -31, 37, -74, -69, -49, 58, 48, 4, -51, -30, 14, 49, -7, -13, -63, 14, -24, 8, -29, -28, 35, -34, 28, -7, 15, -9, 89, 18, 26, 60, 5, 51, 33, -85, 12, 23, 45, -32, 36, 21, -39, -28, 16, -41, -11, 7, 24, -72, 15, -6, -9, 61, 52, 13, -5, 23, -39, -56, -8, 44, 53, 7, 9, -26, 64, -62, -57, 12, -25, 73, 47, 16, 33, -36, 8, -36, 2, 63, -40, -29, -51, 3, 18, -15, 58, 32, -24, 1, -9, 2, -72, -24, 17, -17, -56, 66, 65, 61, 72, -52, 46, -17, 84, 9, -28, -21, -20, 58, 66, 1, 86, 16, -35, 74, 16, 73, 3, -70, 39, 64, -2, -31, -40, 2, -47, 77, -49, 32, -20, -9, 44, 8, -21, 4, -22, -78, 5, 49, 42, -11, -23, -8, 21, 19, -48, -47, 27, -7, 7, 51, 13, 25, 17, 52, -92, -18, 14, 18, -56, -28, 0, -6, 54, 36, 75, -43, -35, 11, -26, 6, -4, 34, -54, -33, 8, -16, 6, 24, 84, 34, -20, -37, 6, -20, 40, -82, 41, -3, 64, 82, 0, -31, 79, 32, 25, 37, 35, -63, -6, -19, 43, -8, 15, -49, 25, 11, -29, 46, 68, -62, -46, -18, -26, 35, 26, -11, 56, 40, 7, -11, 37, -52, 57, -14, 6, -32, -38, -59, -36, -65, -43, -72, 14, -39, -1, 17, 61, -22, -4, 1, 36, 77, 17, -10, -26, -11, 46, -19, 52, -31, -16, 39, -39, -2, -39, 0, -5, -43, -39, -22, 41, -88, 9, 83, 18, -38, -70, 18, -20, 68, 44, -4, 40, 36, 72, 1, -54, 39, 58, -47, -24, 10, -5, -21, 67, 61, -3, 13, -66, 54, -28, -24, -26, -12, -25, -41, -59, 2, 6, 39, -13, -54, -21, 15, 34, 66, -18, 50, -3, 49, 35, 9, -24, -40, -11, -32, -12, -30, 18, 3, 33, 54, 77, 3, -1, 14, -68, 8, -46, -4, 17, -55, 2, -17, -45, -18, -23, -47, 32, -82, -17, 36, -33, -36, 5, 18, -35, -17, 53, -5, 33, -30, 17, -42, 43, -4, 26, -8, -16, -24, 67, -29, -49, -18, 79, 58, -50, -49, 23, -17, -52, -82, -51, -17, -53, 2, 53, 17, 75, -39, 14, 79, -9, -22, -34, -24, 42, -44, -60, 73, 6, -52, 11, 44, 73, -35, -38, 45, 16, 17, -1, -28, -2, 24, -14, 72, -11, -56, 5, 51, -16, -2, 11, 21, 43, -41, -68, -38, 22, -20, -14, -7, -73, 54, -12, -34, -45, -14, -29, -13, -12, -33, -33, 31, 14, 43, -20, 16, -75, -9, 20, 53, 13, 9, -16, -10, 1, 33, 20, 13, -2, 46, -38, -4, 5, -46, 3, 11, 45, -11, 20, 1, 8, 39, -27, 8, 3, -23, 4, 22, 14, 7, 23, 12, 23, -24, -26, 10, 16, 55, -27, -22, -10, 17, 1, -14, -60, 13, -8, 12, 0, 31, 59, -54, -10, -46, 41, 50, -63, 16, 56, 101, -19, -56, 54, -25, -30, -43, -10, -1, 89, 18, -42, 39, -1, 22, 44, 7, 93, -38, -7, 52, 43, 49, -3, -42, 23, 59, 4, 59, -75, -40, -18, 49, 42, -6, -43, 1, 11, -50, -41, 53, 16, -64, -8, 71, -16, -36, 11, 11, 44, 27, -3, -9, -21, -18, -38, 43, -15, -8, 63, 19, -8, 32, 29, 15, -4, 73, -62, 2, 48, -84, 10, 62, 7, -12, 58, -6, -20, -47, 8, -1, -10, 2, 3, 36, -29, 11, -8, 15, -50, -84, -14, 35, 43, -3, 7, 45, -21, 70, 43, 14, 44, -25, -28, 58, 15, -65, -39, 53, -13, -24, -10, -49, 17, 19, 10, 75, -2, 51, -21, 71, -53, -56, -61, -59, 5, 5, 37, 7, -67, -5, 29, -36, 36, 10, -10, -4, 1, 16, -59, -37, 16, 5, 13, -42, 17, 4, 40, 22, -106, -12, 4, 11, -41, 42, 28, -2, 47, -23, 71, 53, -110, 12, 5, 69, -20, -23, -48, -33, -46, -38, -6, -20, 68, -80, -91, -64, -39, -54, -65, -33, 2, 52, 14, 28, 15, 23, -15, 40, 34, 25, -42, -5, -64, 19, -69, 73, -39, -15, -49, 27, 18, 41, 18, 58, -32, -11, -3, -5, -1, -5, -9, 8, 4, -39, -42, 45, 73, 63, -9, -20, -72, -6, -30, 9, 35, -32, -55, 32, -1, 6, -25, -1, -66, -70, 33, -34, -50, 74, -34, -13, -47, -7, 16, -63, -11, -34, 41, -7, -39, 34, -20, -13, 26, -23, -17, -43, -42, -52, 8, 38, -53, -12, -6, 5, 49, -40, -11, 52, 1, -3, 31, 28, 42, -11, -44, 16, -60, -22, 61, 22, 2, -8, 30, -33, 63, 8, 22, 13, 10, 19, -37, -46, -9, 82, -10, -22, -43, 7, -29, 13, -10, -80, 29, 45, -11, 8, -4, -43, 43, -28, -58, 53, 20, 40, 34, 37, -61, 37, -68, -15, -5, -8, 16, -47, 11, -9, -17, -20, 1, -1, 50, 13, 0, -1, 14, 80, -56, -11, -32, 30, -2, -21, 20, 29, 11, -69, 25, -47, -53, 48, 21, -45, -59, -7, -12, 18, 35, -32, 11, 28, 15, 25, -22, -14, 5, -17, -37, 9, 8, 4, 2, 23, -3, -3, -6, 26, -34, 2, -29, 12, -22, -34, 23, 24, 62, -9, 49, 98, 13, -33, -2, -14, 71, 34, -68, 1, -56, 63, -6, 30, 31, -25, 66, 57, -8, 56, 13, 19, -14, -33, 10, 52, -30, 5, -37, 6, -56, -17, 22, -7, -37, -7, -42, -13, -26, -34, -64, 24, 15, 49, -43, 51, -13, 30, 11, -34, -42, 19, -10, 38, -14, 18, -39, -54, 33, -11, 54, -66, 25, 19, -31, 6, -13, 83, 16, 36, -35, -66, -17, 16, 7, -13, -50, -6, 35, -60, 49, -21, 9, -15, 34, -49, 6, -66, -18, 43, 53, 0, -35, -20, 8, -75, 21, -14, 113, -13, 42, 5, 43, -16, 32, -17, -13, 1, -17, -22, 3, 37, 57, -7, 39, 26, -59, 53, 36, 35, -39, 34, -25, 54, 18, -23, 24, -49, -20, -3, -25, 48, -13, 65, -27, -37, -20, -56, 86, -39, -10, 18, -8, 16, 40, 67, -17, -41, -6, -23, 10, 29, 13, -18, -7, -52, -31, -9, 41, 67, 29, -42, -6, -1, 38, 31, -15, 12, -25, -23, -54, -21, -59, -60, 83, 45, 21, 14, -43, -22, 85, -59, -30, 47, -3, 17, -14, 34, -55, -1, -15, -60, 2, -1, -10, -18, 42, -3, -18, 70, 51, 38, 48, -1, 15, 5, -31, -4, -29, 69, -29, -30, -13, -49, 1, 49, -6, -38, 85, 34, -45, 9, 6, -8, -22, -43, 18, 0, 0, 43, 19, -18, 66, 2, -32, 14, -35, 17, -7, -8, 29, -71, -7, -34, 30, -9, 37, -10, -38, -12, 28, 10, -57, 58, -6, -11, -80, 1, -21, -12, -66, -65, -28, -59, -51, -14, -55, 31, -61, 33, -63, -15, 40, 22, -10, 31, -26, -41, -3, 14, 37, -9, -52, 19, 84, -2, -48, -8, -46, -5, 46, -3, 58, -38, 43, -5, 8, 27, -1, -34, -10, -44, 86, 14, 27, -53, -41, -7, -42, -21, -58, 16, 30, -16, -10, 32, -43, -41, 20, 38, -15, -24, -85, -33, -30, 9, -42, -19, 61, -62, 1, -16, 25, 13, 20, -53, -55, 35, -19, -25, -16, -3, -62, 57, -32, -50, -4, 31, 3, 51, 4, -4, -49, -50, -60, 19, 22, 7, 0, -37, 16, 58, -10, 43, 35, 45, 4, 28, 72, -2, -72, -26, -52, -36, -9, 20, -25, -7, 26, -23, -35, -72, -9, -26, 22, 41, -45, 4, -6, 32, -29, 31, -17, -82, 2, 63, -37, -8, 13, 35, 25, -3, -7, 3, 44, 23, 72, -38, -12, -71, -95, 17, -65, -58, 24, -6, -7, -35, -2, 59, -48, -36, -22, 31, 94, 9, 107, -48, 5, 55, 22, -2, -12, -24, 63, -1, 68, -26, -42, -13, -34, -87, 76, 26, -32, -72, -53, -2, -4, 50, 4, 9, -51, -36, 44, -10, 18, -19, 25, -93, -16, -36, 16, -18, 2, -56, -16, -25, -46, -39, 37, 46, -61, -65, -44, 48, 6, -24, -67, -36, 22, 89, -72, -39, -7, -5, -73, 13, 89, 20, 28, 55, -8, -13, -1, -31, 23, -8, 21, 21, 0, 59, -34, -80, 39, 30, 43, -47, 18, 27, 16, -37, -72, -9, -12, 22, 25, 0, 37, -14, 58, 14, 63, 41, 22, 66, 32, 2, -13, -17, -64, -77, 51, 51, 95, -63, -52, 75, -4, 69, 9, 6, 10, -11, 45, -32, 9, 60, -99, -8, 23, 25, 39, -85, 91, -66, 17, 20, -20, 52, 40, -13, -32, -57, -97, -41, -27, -14, 20, -52, 74, 38, -44, 54, -13, 27, 9, 53, -48, 80, 12, -16, -3, 51, 86, 4, 22, -2, -5, -26, 60, 55, -43, 35, 17, 36, -55, 10, 23, 70, 6, -62, 44, -49, -11, 62, -36, -82, 1, 3, -52, -6, 14, 78, 83, 73, -29, -70, -74, 19, 16, -86, -31, -46, -49, -10, 36, -66, -62, -26, -28, 12, -28, -59, 46, -16, 73, -14, 50, 32, -34, 25, -23, -59, 35, -88, -40, -54, -86, -39, -12, 13, -27, 48, -63, -50, 34, -21, -24, 62, 19, 80, 51, 14, 45, -43, -16, -76, 65, -25, 62, 33, -24, -21, -23, -5, -21, 9, -28, -27, -17, 2, -19, 69, 20, 0, -35, 40, -9, 32, -65, 34, -39, 54, 27, 66, 48, 19, -31, -20, -45, -11, 45, -7, 12, -20, 22, 46, -28, -32, 40, -14, -31, 74, -14, 18, 22, 1, -39, -29, 58, -78, 18, -21, 14, -11, 3, -3, 0, 65, 1, 26, 9, 38, 59, 2, -28, -24, 5, -5, -16, 8, -7, 48, -26, 6, -36, 57, 0, -4, 25, 36, 5, 36, -22, 16, -2, 10, 2, 3, 66, -8, 3, 34, 2, 4, -20, -84, 89, -19, 19, -20, 36, -10, -25, 17, -48, -45, 62, 6, 41, 6, 11, -56, 43, 32, -51, 24, 76, -35, 85, 28, 46, -7, 19, -31, -22, -20, 80, 25, 61, 89, 10, -7, 36, -35, -35, -35, 4, 9, 3, -23, -61, 35, 90, 19, 31, -39, 31, -48, -3, 35, 18, 60, -3, -20, -15, 12, -68, 40, -52, -12, -2, 12, 33, 67, -21, -28, -20, -28, 8, 17, 23, 1, 68, 0, 59, -58, 22, 26, 5, 45, 25, -9, 38, 21, -68, 47, 22, -26, 1, -7, -44, 69, 5, -52, 16, -1, 4, 25, 70, -25, 41, -6, 72, 26, 31, -47, 4, 2, 37, -8, -50, 74, -49, -3, -52, 52, -5, 50, 6, -11, 43, 21, 16, -25, -29, -43, 10, 37, 7, 23, 17, -23, -34, 62, -30, -85, 30, -34, -3, 8, 47, -14, -27, 1, 6, 53, -18, -38, 86, -42, 87, -45, -5, -52, 19, -53, -10, 11, 114, -45, -15, -97, -95, 27, 2, 71, 80, 50, -11, -37, -45, -71, -2, 8, 9, -64, -5, -48, 9, -31, -10, -41, -62, -23, -14, 0, 19, 17, -24, 50, -46, 16, -17, 1, 62, 25, -26, 16, 18, -4, 37, -18, -39, 24, 73, 4, -29, 46, 80, -38, -24, 54, 7, 7, -26, -25, -104, 65, 73, 31, 67, -1, -36, -23, -10, 29, 5, -10, -26, -4, -28, -38, 17, 38, 54, -41, -41, 32, 8, -29, -32, -22, 30, -26, -16, 12, -22, -68, 48, 35, 26, 19, -38, 5, 41, 3, 101, 3, -10, 14, -25, -12, -66, 12, -69, 35, 26, 68, 0, -19, -11, -32, 25, -17, -27, 8, 16, 30, -55, -6, -1, 46, -34, -47, 30, -49, -50, -22, -37, 27, 29, 85, 66, 75, -30, -42, -29, -27, 6, -14, -69, -3, 35, -21, 14, 50, 39, 2, 47, 4, -56, -14, -16, 44, -1, 19, 1, -40, 18, 35, -20, 21, -12, 5, -60, 81, 29, 25, -28, -8, -40, -63, 31, -6, 32, -58, 19, 35, -39, -76, -32, 31, 3, 10, -5, -14, 12, 22, -49, 16, -1, 28, 33, -53, -20, -40, 52, 1, -48, -31, 0, 16, 2, -51, 45, 68, 51, -99, -32, -79, -24, -65, -2, 28, 59, 2, -32, 56, -25, 59, -36, -18, 33, 28, -10, -13, 25, -50, -25, 36, 43, 70, 19, -9, -40, -30, -26, 20, -32, 1, -40, 90, -12, 1, 83, -2, -45, 48, -29, 22, 5, 17, -20, -53, -65, -14, 34, -72, 11, -9, -62, -9, -58, 24, 52, 50, -1, -75, 17, -31, 6, 61, -5, 3, 45, 3, -31, -31, -2, 17, 1, -6, 15, -6, -51, -33, 54, -10, -34, -9, 32, -52, 43, 48, 10, 55, -9, 54, 31, -20, 0, -27, 59, -55, -49, 32, 25, -40, 36, -22, 52, -44, 53, 8, 24, 11, 13, 54, -1, -27, -6, 44, -1, 2, 41, -50, -1, 29, 62, -2, 28, -11, 43, -76, 23, 42, 13, 61, 27, 1, -14, -44, -49, 4, 32, -14, -63, 20, 3, 50, -58, 14, -42, 30, -43, -10, -44, 5, -27, 17, -20, 3, -22, -28, -35, -12, 39, -55, -68, 9, -13, -69, 2, 48, -49, -8, 12, -43, -4, -16, -8, 2, -11, -18, -51, 97, -10, 14, -43, 30, 10, 3, -8, -5, 31, -47, -26, 15, 30, 9, -12, 5, -39, -50, 33, 76, -3, 38, -22, 64, 64, -24, -26, -8, -21, 50, -29, 13, -41, 24, 51, 33, -65, -16, 14, 54, 9, -36, -42, 7, -16, 12, -4, -40, -23, -12, 22, -49, -29, -8, -40, 52, -2, -26, -70, 12, 15, 3, 29, -10, 60, 53, -33, 14, -48, 42, 60, -22, 76, 5, 10, -22, -50, 34, -53, -2, 36, -39, -6, 17, 42, 60, 26, -15, 47, -36, -11, 34, -20, -11, -76, -21, 8, -13, 23, -12, -21, -48, 78, -28, 29, -7, -50, 81, 11, -12, 97, -55, -47, 49, 38, 27, 19, -20, -59, 4, 55, 35, -49, 16, -8, -4, -42, 2, 52, -27, -70, -39, -50, -68, -56, 64, -30, 54, -86, -4, -43, -50, -3, -15, 56, 2, 29, 13, 52, 65, 1, 52, 14, 6, 33, -13, -56, -29, -14, 10, 41, 69, 36, 9, -52, 6, -34, 30, -33, -40, 29, -51, 33, -44, 28, -19, 25, -8, -34, 9, -15, -37, 18, -18, 18, 42, 10, -40, 31, 14, -25, 0, -56, 26, 24, 36, 13, 24, 8, -58, -30, -50, -89, 34, 2, -52, -54, -14, -4, 22, 22, 23, 24, 74, 28, -29, -38, 76, 19, -22, -10, 55, -82, 32, 17, -3, 1, -53, 65, 11, -14, 20, 42, 45, 4, 54, -28, 17, 29, 9, -16, 2, -42, 1, 11, 70, 22, 24, 47, 30, 3, -70, -11, -18, -10, 42, -41, -51, 15, -38, 15, -29, 77, -61, 21, -7, 4, 27, 0, -55, -50, 45, -37, 0, 34, -33, 65, -51, 45, 18, -66, 30, 76, -1, -21, -10, 22, 13, 2, -55, -39, -14, 45, 56, 18, 52, 25, -1, 49, 37, -20, 57, 2, 51, 40, 8, -25, -4, -1, -5, -37, -1, 54, -38, -24, -45, 3, 11, 58, 16, 56, -37, -15, 23, 71, -11, -11, -28, -26, -40, -1, 29, -21, -12, -47, -62, 31, -18, 40, -79, 29, 37, 51, -27, 38, -82, 42, 30, 31, 12, 62, -8, 0, -34, -14, 90, -34, 53, 33, -12, -49, -61, 13, -24, 13, -22, -37, 28, 98, -11, 20, 33, -31, -8, -38, 0, 11, 16, -46, -19, 55, -69, 51, 40, -5, 69, -37, 2, 10, 57, -53, -1, 7, 48, 2, -68, 62, -46, 5, 7, -35, -66, -60, 41, -76, 73, -18, -37, -40, -70, -33, -7, 18, -38, 70, -47, 12, -13, 26, -14, -41, -41, -38, 13, 60, -69, 20, -52, 54, -36, -12, 11, -24, -72, 11, 31, 56, 23, 22, -28, -37, 21, -44, 28, -27, -21, -19, 90, -34, 2, 0, -37, 22, -24, 19, -24, -55, -48, -2, 18, -31, 20, -9, -18, 24, -29, -49, -50, 6, -36, -49, -69, -48, -7, 21, 42, 38, -47, 21, 18, -20, 17, -24, -33, -1, 4, -27, 8, -18, 12, 39, -27, 4, 17, -71, -25, 14, -86, -49, 56, 76, -11, 18, -49, -21, 26, -22, 31, -12, 26, -11, -38, 11, 20, 14, -7, -28, 8, 36, -6, -35, 62, -57, 45, -8, 29, -31, -53, -62, 23, 3, 17, 37, -52, 10, 19, -40, -22, -55, -26, 52, -23, 28, -45, 22, -5, -47, 45, -36, 45, 73, -39, -4, -4, -35, -99, 45, 1, 1, 24, 35, -30, -13, 79, 42, -40, 52, -21, 33, 9, 9, -59, 68, -50, 42, -23, 19, 13, -8, -62, -17, 6, -18, 25, -48, 10, -42, -46, -25, 2, 37, -53, -20, 14, 41, -34, 6, -5, 51, 78, -46, 10, -29, 18, -2, -4, -63, -62, 26, 37, -11, -22, -6, 6, 26, 74, -36, -10, 26, -19, 0, -11, 62, -16, 29, -4, -27, 44, -13, 18, -5, 18, 52, 10, 65, -8, -61, 2, 16, -28, -62, 15, 32, -30, 43, 0, -68, -5, 73, 13, 27, 46, -48, 46, 69, 30, 38, 56, 97, 9, -6, -55, -76, -83, -29, 6, 18, -38, 77, -48, 79, -23, 7, 13, 42, 58, -27, -22, -1, 9, -5, 76, -20, 23, 61, 14, -33, -18, -84, 20, 60, 0, -60, 32, 72, 37, 5, 36, 42, -43, -7, 19, -54, 91, 18, 41, -90, -60, -36, -44, 53, -9, -66, -16, 53, -66, 0, -52, -55, 39, -52, -15, -23, -31, -21, -34, -3, 72, 33, -42, 13, -32, 74, 8, -81, -2, -29, -3, -21, 61, -29, -29, 1, 58, -7, -16, -5, -32, -14, -4, 56, -4, -42, 13, 8, -36, 38, -90, 14, 65, 6, -31, -67, 29, 21, -97, 79, -25, 0, 21, -16, -50, 33, -23, 17, -48, -52, -47, -14, -70, -76, 20, -5, -14, 7, -54, 0, 33, 21, -89, 70, -21, -64, 38, -62, 33, -11, 13, -84, 44, -27, 24, 28, 45, 19, 50, 87, -30, -26, -69, -15, 79, -8, 59, 40, -4, -27, -65, -5, 49, 3, 26, 27, 12, -5, 20, 10, 44, 9, 36, -3, -10, 53, 47, 50, 41, -36, 21, -28, 22, -36, -8, 89, -25, 23, 25, 34, -1, 15, -14, -23, -63, 7, 6, -11, -42, -3, -3, -11, 90, 42, -46, -21, -6, 52, 23, -58, -25, 16, -25, 5, 19, -34, -50, 0, 5, -3, -19, -86, 12, -17, -65, -54, -27, 58, 38, -53, 37, 47, 24, -37, -44, -56, 36, -45, 37, 41, -86, -8, -5, -18, -37, 13, 7, 49, -49, -29, -10, -5, -30, -16, 23, 22, -32, 4, -48, 20, -24, -29, -8, 9, -76, 41, 11, -27, -58, -2, -42, 29, 50, -69, 12, -30, 37, -36, -19, -32, -45, -1, 57, 58, 78, -13, -50, 36, -11, 28, -3, -45, 6, -35, 42, -7, 14, -13, -11, 10, -2, 51, 32, 3, 3, -19, 39, -5, 4, 89, -1, 2, 44, -8, -82, 50, -37, 47, -43, -12, -79, 44, -8, -36, 26, -55, 7, -37, 39, -77, 48, -54, 44, 14, 55, -31, 18, 24, -64, -18, -74, -22, -11, -32, 30, 5, -53, 5, -5, 40, 38, 31, -20, -81, 2, -5, -94, -22, 28, 10, -64, -8, 60, 89, 23, 22, -19, -16, 37, -14, 57, 30, -12, 69, 31, -59, -17, -74, -10, -72, -2, -34, -56, 43, 39, -15, 28, -75, -20, 11, 14, 35, 11, -27, -65, -10, -57, 10, -13, 30, -95, -50, -17, 36, -56, -48, -18, 16, 60, 4, -65, -37, 41, -54, 52, 43, 37, 36, -37, 79, -52, 18, -38, -6, -44, 37, 17, -29, -23, 19, -63, -31, -58, -8, 14, -69, 2, -44, 35, -14, -17, 47, -1, -55, 23, 12, -27, 9, -35, 31, 1, -53, -12, -7, 50, 19, -5, -34, 48, -23, 66, -7, 16, -23, -71, -27, 32, 55, 2, -60, -47, 55, 2, -3, -6, -76, 57, 16, 11, 21, -1, -29, 0, 1, 56, -18, -3, 54, -4, -25, -51, -64, -7, -2, 56, 39, 53, -17, -19, -8, 1, 49, 30, -44, -16, 17, 3, -15, -73, 0, -32, -53, -24, -39, -15, -8, 25, 36, -52, -49, -22, 29, -7, 15, -26, -70, -20, -43, -32, 34, -20, -19, 10, -52, 70, -23, -45, 78, -66, 9, -79, -13, -54, -34, 41, -66, 20, 15, -94, 7, 53, -39, 25, -9, -1, -14, 5, 12, -40, 27, 35, 41, 33, -73, 38, 10, 23, -6, -66, 50, -5, 7, -3, -8, -1, 17, 44, -8, 85, -30, 29, 38, 44, -31, 47, -37, 61, -24, 67, 38, -51, -36, -49, 3, -6, -43, -10, 64, -37, 37, 50, -20, 21, 1, 21, -15, 22, 54, 7, -37, -35, -35, -9, 10, -7, -35, 6, -36, 58, -33, 47, -2, -59, 30, 11, 15, -1, 33, 22, 57, 60, -2, 35, 23, -16, 12, -7, 40, -1, 12, -56, 27, -47, -41, 35, 43, -24, 14, 41, -27, -22, -3, 37, -14, 7, 10, 2, 39, 9, -27, 46, 39, -49, -11, -21, -45, -22, 6, 28, 31, 50, 89, 46, 57, -5, 0, 33, 18, -20, 53, -4, 8, 19, 61, 2, -40, 8, -56, 1, 59, -24, -41, 16, 34, 7, 8, -82, -3, -23, 25, -44, -15, -29, -74, 33, 0, 47, 3, 83, -16, -62, 32, -7, 8, 8, -32, 16, 16, -84, 20, -65, -7, 89, -29, -16, 48, 4, 9, -24, -74, 1, 19, -54, -1, -8, 38, -16, 8, 14, 8, -4, 52, -1, 36, -11, -6, 33, 15, 53, 9, -51, -80, -4, -12, -7, 14, -13, 48, 81, 19, -15, 66, 49, 34, 41, 62, -8, -20, -59, 80, -32, -71, 9, -4, -44, -61, 37, 13, -52, 8, 50, -36, 33, -27, 44, 60, -37, -61, -7, 0, -5, -23, -31, -62, -23, -20, -18, -87, 33, -33, 59, 39, -83, -4, -85, 57, -34, 28, 38, -62, 63, 46, 56, 34, 14, 4, 6, 40, 48, 4, 6, 11, 67, 60, 20, -5, -56, -37, -21, 54, 48, -13, -56, 92, -17, -80, -16, 11, -32, -34, -12, -26, 5, -34, -43, 1, -68, -45, 47, 21, 46, -1, 59, -49, -2, -45, 9, -1, -43, 31, -24, 33, -71, -12, 79, 27, 47, 69, 29, -46, -36, -38, 50, 59, 41, 37, -1, -64, -6, -60, 28, -61, -8, 7, 12, -18, 30, 5, 33, 10, -81, -31, 20, 37, 34, 13, 72, 11, -24, -48, 16, -23, 28, -69, -25, -21, -20, -54, -19, -4, -13, 11, 2, 1, -29, 33, 26, -25, 59, -21, -14, 35, -39, 6, 33, 9, -20, -18, -11, 99, 2, -66, 18, -24, -53, 15, -7, 2, -34, -52, 12, 70, 20, 31, -68, -47, -20, 6, 6, -31, 22, 20, 3, 6, -28, 11, -14, -23, -44, -73, -40, -43, -16, -10, 45, 21, 52, -34, -37, -33, 23, 47, 37, -17, 2, 2, -49, -73, -7, 21, -36, 10, -3, -21, 0, 33, 46, -19, 16, 8, 36, -47, 28, 6, -12, 8, 5, 54, 5, 8, -27, 31, 38, -53, 11, 21, 8, -22, 70, -31, -7, 18, 40, 41, -41, 12, 24, 29, 10, -40, 49, -7, 57, 47, 0, -27, -4, 12, -12, -19, -10, -28, 6, -29, 8, 2, 5, -69, 11, 54, 10, 0, 3, -14, 2, 36, 38, -50, 9, 5, 4, -14, -34, 3, -14, -5, 45, 25, -65, 60, 17, 35, 16, -17, 0, -54, 27, -31, -36, -22, -27, -5, -93, 78, -15, -65, -5, 43, 24, -71, 0, 56, -45, -14, 47, -50, -14, -34, -81, 32, 12, 37, 30, -17, -55, 6, -18, 77, -72, -5, 59, 8, 11, 4, 2, 17, 58, -27, -10, 19, 48, 32, -31, 20, -46, 36, -49, 1, -9, -21, -31, 46, 2, -34, 19, 32, 0, -30, -16, -18, 44, -44, -47, 9, 7, 15, 27, 67, -47, 18, -14, 49, 5, -8, 63, -4, -10, 6, -4, -30, 23, -70, 51, -60, -7, -52, -10, -7, -12, 38, 25, 2, -14, 69, 32, -4, -11, -48, -38, -32, 3, -23, -8, -45, -26, -33, 13, 22, 15, 39, 12, -31, -23, -30, 4, 48, 35, -6, 10, -59, 75, 35, -25, 2, -72, 29, 3, -10, -10, 46, 42, 24, -1, 12, -21, 11, 12, -11, 50, -101, -30, 2, 38, -72, 63, 52, 49, 52, 41, -64, -42, -63, 46, 2, 72, 54, -15, 46, 17, -64, -12, 26, 30, 75, 34, 40, 13, 25, 22, 46, 75, 33, 53, -17, -48, -33, -20, -5, 14, 24, 4, 12, 29, -5, 16, 16, 2, -1, -1, -49, -13, 19, -37, -25, -9, -9, 83, 52, -42, -47, 1, 28, -46, -14, -39, 38, 2, 21, -32, -55, -56, -5, 5, 5, -46, -49, 8, -5, 49, -22, -35, -16, -56, -24, 18, 47, -18, -29, 27, -2, 29, 33, 20, -10, -57, -16, -4, -22, 3, 9, 17, -25, 26, 12, 1, 67, 3, 0, 8, -18, -27, -4, 8, 86, 12, -54, -73, -45, 14, -41, -9, 4, 86, -59, -62, -8, 0, 39, -34, 41, 12, 19, -50, -21, 75, -45, -24, 13, -65, 6, 99, -7, 32, -46, 42, -46, -8, 41, -39, -34, 16, -26, 63, -59, 11, -58, -10, 64, -30, -20, 67, 61, 22, 20, 60, 30, 9, 26, -44, -13, 4, -23, 43, 4, -4, 7, 28, 3, -18, 13, 50, 5, -17, -41, -7, -42, 30, -9, -8, 4, -23, -19, -17, 25, -60, 24, 44, 26, -36, 36, -55, 29, -17, -53, 72, 51, -34, -8, 31, -11, -9, -24, -34, 2, -24, -16, -40, -22, 8, -3, -48, 16, 14, -23, 39, 53, -39, 9, 63, -72, 53, 22, 26, -45, -50, 15, -27, 19, -10, -42, -23, -20, 0, -39, 8, 41, 47, 55, 32, 8, 8, 24, 8, 59, 84, 0, 69, 7, -4, 64, -17, -10, 24, -36, 59, -60, -18, -79, -16, 53, 17, 22, -16, 9, 29, -37, 57, 48, 42, 9, 18, -86, -47, -33, 0, 6, -9, 51, -38, 36, -66, 38, -82, 32, -27, 31, -6, -85, 17, 18, -56, -27, -10, 39, 13, 14, -14, 61, -34, 79, -8, -5, -52, -59, -62, -20, -14, 52, 26, 8, -4, -10, -30, 17, -25, 69, -48, 16, -6, 43, 5, -1, -21, -13, -64, 13, 17, 19, -18, -11, -43, -17, 34, 50, -41, 40, 14, -28, 39, 12, 34, -4, -14, 16, -8, 21, 11, 5, 36, -4, -18, 37, -28, -34, 16, 9, -2, 5, 10, 4, -3, 53, -24, -49, 19, 5, 64, -10, -71, 5, -59, -27, -50, 56, 77, 24, -2, -64, 1, 13, 12, -25, 16, 19, 30, -16, -62, 27, 46, 14, 26, -46, -69, -29, 7, 18, 23, 41, -39, -62, 20, -59, -5, -34, 25, -33, -53, -14, -30, 33, -45, -13, -5, -18, 20, 27, 19, -64, 20, -32, -47, 5, 32, -30, 21, -53, 2, -73, 18, -53, 3, 31, -25, 27, -28, 0, 25, -51, -27, -19, 41, 50, -18, -45, -34, -42, 42, -76, 28, -2, 53, 52, 56, -30, 26, -25, 20, -55, -4, 24, -13, 50, 50, 2, 27, -8, -8, -34, -18, -10, 43, 0, -10, 11, -17, -8, 6, 22, -29, -50, -5, 33, 68, 17, 30, 30, -1, 5, 5, -33, 8, -7, -1, 13, 23, 24, 44, 14, -51, 42, -37, -8, -51, 8, 12, -13, 13, -84, -44, -20, -75, 86, -67, 75, -13, -57, 39, -7, -12, -39, -44, -12, 8, 0, 32, -6, -46, -15, -62, 22, 44, 38, -70, -14, 35, 34, 12, 25, -27, 19, 13, 48, -22, 24, -73, -12, -8, 15, -5, -40, -5, 2, 47, 32, -7, 50, 42, -23, 8, 40, -13, -70, 3, -52, -70, 43, 9, -37, -35, -12, -35, -7, 6, 40, 9, 19, -1, 31, -65, 33, 9, -27, -29, -21, -29, 72, 27, -59, 60, 51, 20, -32, -1, 47, -3, -47, 4, -36, 36, -75, -3, -61, 20, -55, 45, -50, -19, 18, 15, 29, 61, 19, 29, -14, 41, -26, -47, 47, -9, -24, -5, 13, -30, 29, 14, -28, 21, -37, -44, 50, 38, -31, -7, 9, -59, 31, -32, -49, -32, -55, -39, 85, 41, 42, 7, 52, 3, -97, 88, 20, -61, 28, -74, 39, -6, 22, 42, -14, -55, 44, -50, 14, 25, -1, 34, -71, -50, 11, 41, 60, 19, 39, -39, -15, 37, 24, -95, 28, -44, 54, -36, 18, 28, -74, 80, 3, 54, 16, 35, 8, -44, 46, 19, 18, -63, -48, 40, 12, -11, -58, 16, 2, 18, 30, 27, -2, -68, 31, 49, 36, -9, 35, -50, 26, -35, -21, 19, -33, 5, -39, 25, 16, -16, 23, 70, -7, 10, -40, -24, 16, -17, -21, -19, -45, 2, 20, -39, 0, 41, -7, 7, 26, -16, -2, -73, 15, -5, 29, -51, -55, -54, -16, 15, 10, 10, -26, -21, 29, 39, -3, -5, -34, 1, -10, 10, 11, 76, -84, 18, -41, -54, 17, -22, 59, 34, 31, 42, 3, -15, -41, -53, 7, 53, -2, 50, 1, 19, 46, -7, -47, 22, 32, 55, 97, -53, -19, -22, -68, 6, -79, -3, 48, -9, 55, 14, 26, 4, -29, 25, -7, 24, 4, 32, 65, -33, 5, 1, -10, -17, -14, -24, -14, -48, -28, -72, 77, -30, -57, 38, 54, 2, 31, -13, 44, 11, 96, -13, -17, 52, -11, 31, 55, -17, -10, -55, 70, -10, -56, -5, 11, 18, 13, 68, -58, 41, -58, -16, -16, -39, 64, -50, -12, 15, 70, -23, 35, 52, -18, 0, -36, -48, -15, -37, -9, -64, 16, 18, 17, 24, -30, -23, -27, -8, 36, 29, -11, 42, 28, 29, -15, 40, 16, -25, -69, 49, 81, -9, 82, -36, 9, -53, -19, 41, 9, 47, 5, 78, -32, -20, 30, -38, -17, -36, -28, -46, 20, -19, 33, -27, -18, 5, 27, 1, -7, -77, 22, 14, 50, 44, 49, -10, -15, -40, 19, 28, 47, 16, -19, 34, 6, 17, 17, 42, 14, 50, 24, 24, 70, 10, 1, -86, -20, -61, 16, 11, 63, 51, 27, 45, 45, 20, -5, 17, -16, 34, -13, 16, -18, 2, 23, -38, -4, -16, -4, -36, -22, -32, 72, 32, 7, -39, -3, -64, -28, -7, -29, 19, 39, -47, -7, -29, -68, 16, -12, -13, -29, 9, -33, -18, 50, 36, -49, 25, 45, -3, 42, 67, 33, -17, -34, 46, 0, -78, -12, 6, -14, -31, -47, -30, 55, 33, -40, 61, 24, -3, -39, -95, -69, -9, -55, -76, -33, 3, 16, -63, 57, -19, -14, -83, -8, -18, 68, 0, 30, 65, -75, -42, -23, 26, 71, -10, 2, 14, -17, -43, -34, 33, 2, 12, 26, -23, -30, -12, 77, -28, 12, 26, -24, 54, -30, 12, -8, -24, -1, 12, -24, 44, 39, 32, -8, -30, 1, 10, -14, 4, 65, 14, -39, 34, -49, -1, -54, -65, 62, 31, 13, 34, 47, 20, -76, 54, 6, 21, 42, -25, 36, -49, -4, 34, -28, 6, 21, -56, -38, 6, -10, 13, 21, -64, 22, 29, 14, 6, 37, 16, 51, 31, -40, 81, 1, -54, 15, -25, 21, 52, -19, 12, 13, 82, -1, 10, -12, 34, -42, 34, -42, 7, 18, -64, 16, -19, 2, -7, -5, 65, -53, -16, -18, -23, -15, 9, -9, 31, 33, -57, 13, 83, -30, -68, 26, 57, -7, 55, -30, 40, 65, -56, -35, -51, 41, -39, 33, -20, 31, -18, 12, -35, 65, 35, 18, -65, 36, 0, -1, 29, 37, 16, 28, 31, -40, -54, -59, -27, 8, 12, -38, -51, -49, 26, -25, 0, -46, -21, 43, 41, 18, 10, 35, 34, 21, -3, 38, 6, -10, 31, -14, 1, 33, 4, 22, -37, 7, 18, -61, 45, -8, 26, 26, -34, 19, 41, -13, 8, -6, 7, 12, -53, -12, 19, 42, -69, 3, 68, 1, 10, -41, 52, 48, 21, 9, 26, 37, -79, -75, -33, -19, 35, -4, 32, 14, -37, -50, 16, 70, -18, -5, 43, 31, -15, -21, 35, 37, -41, -27, -27, 61, -74, 25, -11, -25, -7, 47, 59, -18, -51, -81, 1, 15, -54, 67, -29, 58, -35, -64, -40, -84, 57, 14, -29, 13, -14, 20, 44, -13, -15, -8, -45, -31, -38, 43, -42, 41, 19, -59, -29, 54, 13, -26, -5, -28, -32, 22, -52, 59, 54, 15, 14, -59, 30, 46, 4, -24, 70, 9, 50, 24, -22, 17, 61, 61, 46, -8, 0, -31, 10, 63, -20, 1, 22, -14, 1, 24, 2, -17, 48, 21, 37, 20, 26, -24, 44, -25, 32, -21, -9, -35, 1, 55, -39, 70, 10, -55, -16, -30, 32, -24, 30, 50, -17, -15, 28, -16, 20, -18, 7, 0, 2, -1, -21, 37, -22, -2, 8, -3, 25, -68, -3, -31, -1, -14, 23, 11, 9, 11, 13, 24, 17, -44, 33, -25, 23, -11, 77, 70, -29, 5, 20, 20, -78, -41, -30, -37, -19, 30, 81, 67, 16, -27, 0, -62, 47, 19, 19, 53, -23, 48, 20, -43, 46, -39, 35, 46, 46, 27, 24, -42, -10, -13, 7, -47, -42, 11, 3, 45, -54, 23, -19, -19, 45, 30, -20, -45, -13, 17, -46, -48, 26, -73, 56, 0, 9, -48, -8, 36, -10, -4, -60, -42, -19, 60, -73, -34, -20, 30, 57, 35, -29, 6, -45, -40, 53, 43, 20, -15, 21, 37, -17, -18, 23, 25, 38, -16, 21, -50, 1, -35, -24, -5, -47, 54, -8, -13, 13, -11, -31, 0, 7, 52, 29, 6, 19, -43, -4, 41, -44, -45, 48, 62, 11, 21, 15, -45, -11, 69, 4, -3, 26, -37, -39, 0, -19, 25, -56, -68, 86, 42, 29, 19, 58, 21, 1, -14, -11, 0, 3, 10, 51, 22, -3, -9, -27, -11, 41, 47, 37, -46, 12, 36, 69, 12, -4, -40, 66, 20, -52, -28, 78, -24, 2, 31, -12, -28, -27, 16, 6, 26, 18, 44, -1, -37, 42, 25, 25, -33, -32, 68, -56, -44, 35, 10, 13, -54, -9, -33, -15, 72, 4, 27, -33, 4, 59, -12, -4, -43, 74, -17, 3, -37, 17, 33, 23, 13, 0, -34, 25, 51, 10, 11, 4, 16, 40, 62, -9, 5, -29, -39, 31, 3, 17, -50, -3, 1, 19, 41, -13, 12, 35, 28, 33, -26, 55, -14, 43, 47, -2, 15, 12, -44, -8, -36, 54, 41, -15, -20, 46, 55, 0, -43, -12, 34, 55, -7, 3, -74, -45, 49, -4, -58, -44, 58, 2, 83, -54, 66, 37, 45, -50, -36, 2, -25, 33, 61, 10, 6, -22, 37, -2, 31, -67, 57, 28, 34, 18, -35, -53, 81, -29, -27, -22, -23, -11, -49, -27, 91, -5, 39, -19, -23, 7, -12, 6, 36, 23, 26, -50, -67, -4, -59, -6, -4, 7, -49, 98, 50, -13, 29, -1, -49, -20, 36, -41, -6, 80, -26, -6, 5, 46, 51, 24, 29, -15, -64, -27, 66, 53, -19, 40, -34, -24, 6, -15, 22, 18, 22, 9, 18, 59, 71, 0, -35, 38, -17, -1, -22, -69, 64, 27, 21, -24, -16, 1, -8, -25, 8, -18, -8, 40, 29, 41, 78, 29, 59, 24, 13, -39, -15, -17, 20, 17, -52, -3, -9, 42, -46, 7, -36, -30, -27, -10, -61, 28, -13, 52, -6, -11, 95, -77, 8, -24, 42, -12, 68, 37, -57, -36, -42, -44, 4, 35, -25, 4, 23, -12, -16, 62, 12, -12, -40, 8, 32, 40, -73, -28, -61, 51, 8, -73, 3, -15, -24, -37, 7, 3, 50, 16, 83, -76, 19, 12, 13, 22, 36, -21, -2, 55, -18, -6, 0, -6, -45, -36, 23, -38, -2, 25, -12, -6, -34, -31, 26, 35, -9, 48, -6, 6, 17, -42, -18, -16, 9, 46, 14, -8, -51, 24, 3, 55, 19, 56, 49, -61, 30, -42, 5, -36, 24, -36, -10, -15, 4, 7, 56, -44, 38, 17, 33, -17, -47, -8, 74, -14, -39, -19, 47, -47, 18, 14, -36, -44, 70, 14, 3, -21, 12, 23, -48, -22, -21, -6, 65, -54, 35, 55, 73, -24, 1, -20, 13, 63, -52, 37, 34, 36, 7, -57, 79, -16, -91, -55, -59, -52, 22, 18, -13, -49, -2, -3, -12, 4, 40, -66, -2, 65, 35, 11, -29, -9, 6, 56, 0, 47, -25, 0, -9, 5, -12, -26, 10, -38, 9, 17, -8, 20, 28, -41, 56, 83, 32, -28, 46, 33, 10, -54, 10, 48, 23, 21, -38, -2, -79, -11, 50, -33, -40, -19, 73, -20, 14, 16, -42, -60, 6, 33, -5, -8, -18, 5, -4, -28, -29, 0, 55, -21, 4, 25, 0, 14, -72, 28, -34, 1, -45, -36, -60, 3, -9, 19, 13, 60, 3, 5, 7, 50, -26, -59, -40, 48, 22, -38, 19, 18, -10, -3, 21, -67, 50, 37, -20, -21, -29, 26, 66, 15, 2, 29, 16, -4, 37, -41, -78, 28, -36, 11, 82, 58, 20, 24, 20, 24, -42, 10, 0, 1, 11, 11, 68, -25, 3, 13, -22, 2, 71, -47, -45, 0, 71, 17, -19, 5, 51, -78, 52, 2, 70, -26, 24, 34, -40, 38, 6, 36, -16, -18, -16, -2, 43, -4, 28, 48, 41, -45, 52, 36, 27, -45, 10, -6, 29, -13, -63, 26, -16, 30, 55, -50, -11, -6, -30, 33, -18, -7, 23, 25, 19, -29, -8, 74, 32, 20, -40, -20, -9, -63, 13, 24, -23, 6, -17, 12, -74, 37, 19, -2, 32, 35, 0, 34, 2, -7, 15, 15, -47, -53, 5, -8, -5, -41, 5, -4, 18, -29, -28, 25, -17, -12, -2, -23, 11, 31, 4, 15, 38, 25, 4, -62, 7, 18, -53, -89, 60, 16, -5, 49, -71, -91, 52, -42, -33, -20, -72, 46, -6, -16, 10, -43, -25, -19, 68, -17, -55, 17, -21, -82, 28, -70, 9, -32, -26, -30, -36, 64, 16, -52, 38, -12, 62, 34, 52, -64, 27, 24, 44, 29, 54, -14, -80, -31, 72, -11, -36, -1, 5, -7, -38, 38, 23, 24, -21, 18, -28, -53, -23, -78, -41, -54, 34, 58, 0, 16, -36, -9, 5, -5, 31, 2, -79, 55, -21, 50, -31, -7, 21, 30, -19, -35, 71, -8, 16, -2, 64, -2, 24, -10, -10, -39, -28, 12, -47, 16, 17, 72, 6, -31, -21, -82, -13, 45, -4, -1, -71, -32, -18, -66, 19, -33, 64, -5, 19, -23, 30, 20, -12, -34, -55, -52, 68, 55, -13, -47, -8, 47, 17, 11, 6, 69, -5, -48, -29, 6, -46, 73, -42, 25, 76, -55, 63, -28, -27, -35, 48, -20, -38, -85, 42, -25, 18, -22, -5, -43, -42, -19, -36, 14, 56, 15, 39, -25, 11, -31, -17, 18, 22, 3, 35, -41, -59, -33, -11, -42, 42, -3, 26, 36, 41, 48, 5, 12, 5, 64, -43, -9, -28, 49, -30, -19, 20, -4, -18, -39, 2, 13, -32, -8, 34, 0, -22, 35, -47, -23, 10, 21, 33, 3, -60, 24, -22, -5, -5, 9, 34, 63, -50, 40, -37, 27, -28, 39, 23, 33, 70, -50, -26, -18, -17, -31, 38, -57, 3, 52, 36, -42, 9, -24, 27, -9, 4, -29, 10, -19, 25, -19, -5, 1, 19, -14, 18, -6, -14, -7, 87, 1, 21, -3, -4, -35, 1, 14, -13, 67, 39, -29, 12, -17, 42, 6, 19, 4, -75, -22, 87, -36, -21, -26, 13, -8, 32, 6, -78, 23, -36, 48, 25, -2, 53, 8, 65, 59, -6, 90, -17, -35, -13, 52, 41, -78, 43, 11, 0, 39, 28, 19, 37, -70, 26, -48, 0, -46, 50, 40, -1, -29, -39, 21, -1, -9, 6, -13, -54, -27, 17, -40, -10, 8, 75, -27, -49, -13, -39, -20, 49, 15, -12, 46, 18, -29, -16, -3, -82, -17, 23, 47, 20, 25, -21, -2, 15, 25, -58, -30, -65, -35, -14, -16, -5, 29, -5, -29, 5, 16, -25, 42, 20, 0, -68, 31, -14, -19, -7, 58, -10, -63, 43, -7, -15, -8, -73, 2, -48, -24, -51, 38, -56, -18, -7, 41, 40, -21, 64, -80, -13, -93, -1, 55, 30, -16, -50, -12, -57, 12, -29, 19, -17, -28, 18, 5, 21, 11, -53, -56, 80, -18, 60, -18, -66, 44, -2, 16, -6, -60, 19, 4, -7, -25, 22, 14, -8, 18, 29, -21, 12, 61, 10, 2, -22, 14, 4, 24, 24, 31, -11, 3, -25, -21, 52, -36, -30, 69, 39, -12, -36, 30, 85, 26, -25, -28, -23, -27, 10, 32, 22, 48, -17, -19, -9, -30, -78, 58, -3, 24, -49, 5, 19, -51, 20, -36, 24, 20, 11, -40, 22, 25, 15, 10, 22, -11, 46, -27, 3, 65, -53, -51, -2, -16, -3, 29, 57, 0, -21, 5, -2, -80, 38, 9, -25, 63, -51, -13, 41, -2, -89, -42, 15, -15, 30, -21, -9, -96, -32, -8, -59, 36, 20, 55, 26, -28, 32, -39, 39, 14, 35, 17, -8, 21, 1, -71, 2, -12, 29, 24, 45, -20, 22, -52, -3, -40, -6, -8, -39, -37, 20, 22, -16, 8, -18, 25, -11, 21, 38, -54, -43, -7, 34, -83, -45, -39, 23, 5, 66, 11, 26, -3, 55, 38, 14, 39, -24, -25, -55, -38, -5, -16, 68, -24, -11, -57, 7, 41, 55, -12, -58, 27, 50, -38, -6, 57, -10, -5, 19, 15, 42, -37, -41, 35, 70, -61, -34, 25, 31, 46, -27, 19, -62, -29, -42, -2, -9, 15, -43, -1, -40, -48, -14, -11, -18, 12, 18, -3, -48, -11, -16, 11, 19, 48, -34, -14, 18, -36, 66, -16, 29, 25, 14, 50, -91, 55, -4, 8, 45, 79, 18, -20, -16, 17, -8, 27, -42, -11, 11, -4, -22, -54, 44, 8, 35, -3, -75, 11, -59, 3, -59, 57, -12, -9, -36, -77, -2, -2, 4, 32, -62, -6, -44, -14, 8, -34, 59, 49, 69, 2, -69, -64, 41, 18, 54, 9, -61, 7, 18, 42, -3, 53, 16, -2, 15, -16, 22, -32, 17, -35, 2, 22, 29, 9, -3, 9, 47, 38, -47, -4, 75, -13, 22, -46, -7, -24, 13, -43, -7, -52, -30, 13, 20, -12, 20, -10, -77, 1, 13, -13, 16, -8, -17, 21, -19, -57, 15, -43, 4, -4, 30, 22, -16, 31, 32, 40, 28, -11, 1, 55, 28, 7, -25, -30, -25, 5, -8, -70, -8, 5, 32, 35, -27, -59, 77, -34, -85, 5, 61, -37, -63, 52, 54, -47, -39, -36, -13, 68, 19, 25, 11, 14, 4, -23, -25, 19, 72, -8, -51, 27, -46, 31, 28, 8, -15, 33, -49, -9, 0, 9, 33, 35, -14, -49, 34, -47, -10, -37, 27, -25, -15, -1, 8, -44, 75, -15, 55, 42, 52, 6, -4, 46, -41, 3, -21, 29, 7, -5, 38, 68, 10, -35, 63, -41, -10, 3, 0, -1, 27, -21, 8, -24, 24, -42, 41, -54, 5, 0, 44, -30, 27, -32, -5, -47, -25, 8, 14, -40, -26, 61, 38, -16, -36, -51, 8, 38, -31, -67, -19, 18, 19, 48, -9, -2, -61, 33, -16, 18, 20, 25, 4, -2, -1, 25, 27, -8, 3, 22, -41, -55, -4, 17, -7, 10};
-
-const int16_t layer_1_weights16[12672] = {-50, 17, 42, -36, -67, 54, 9, 81, 83, -2, 15, -63, 58, -17, 40, -36, -60, 24, 16, 3, 9, -39, -24, 3, 23, -9, -48, 63, -53, 13, -18, -10, 9, 9, 45, -49, -33, 22, 56, -7, -1, -55, 4, -11, -20, -13, 67, -20, -45, 44, 28, -11, 11, 51, 11, 19, -66, 29, -8, 16, -51, 41, -31, 2, -13, -70, 29, 4, 22, 19, 27, 1, -13, -49, -36, 34, 15, 30, -58, 36, 30, -16, -3, 19, -51, 9, -9, 2, -1, -10, 18, 8, 15, 44, 10, -36, 35, 18, 1, -20, 18, -74, -41, -42, 21, -52, -30, 6, 31, -16, 47, -7, -59, 9, -16, 49, 42, 38, 51, -24, 36, 20, -32, -21, 23, -2, 57, -10, -59, -5, 49, 71, 2, 16, -64, 72, 26, -23, -5, -35, -10, 55, -36, -44, 12, -14, -60, 31, -30, -32, -50, 16, 39, 29, 59, -17, -35, 19, 40, -21, 18, -8, -25, -45, -26, 14, 6, 79, -12, 11, 0, -13, -20, -1, -50, 54, 42, 8, -37, 1, -98, 10, -42, 15, 42, 50, -9, -19, 24, 63, 4, -23, 75, 8, 56, -60, -8, 74, 55, 29, 0, -9, -18, -22, -64, 48, 51, 3, -56, -59, 34, 14, 24, 33, -41, 4, -17, 16, -41, -6, 3, 38, 3, -26, -26, 0, 34, 58, 33, 4, 10, 65, -9, -36, 11, 0, 19, 52, 12, 22, 55, 11, -34, -2, 35, -11, 0, 52, -20, -26, -36, 20, 16, 24, -26, 46, 12, -17, -19, 51, 3, -13, -29, -60, -61, 2, -27, -8, -19, 24, -20, 57, -40, 18, 47, -24, -9, -65, 15, -60, 8, -43, -3, 12, 28, 12, -6, -45, -58, 30, -53, 10, 25, -30, 40, 24, 30, -54, 60, -4, 9, 2, -35, 56, 30, -9, -38, -1, 31, 17, -51, -8, -3, -28, -15, 30, -26, -21, -16, -19, -36, -49, 16, -9, -17, 59, -49, 73, 76, -50, 18, -16, 51, -5, -55, 24, 51, 34, 36, 37, 25, 11, -52, 13, -38, 62, 4, 50, 21, -10, -37, 2, 2, -27, -70, 3, 46, 40, -31, -24, 34, -22, -10, -3, 47, -8, 35, -49, 43, -23, 29, -23, 52, -20, 47, 58, 18, 40, 17, -20, 19, -20, -3, 16, 41, -40, 1, -26, -8, 21, 35, 25, -29, 20, 6, 7, 65, -72, 33, 60, 30, -9, -69, 42, -25, 0, -25, -24, 89, 19, -5, 60, -50, 16, 26, -26, 5, -6, 11, -22, 18, 23, 30, 52, -24, -61, 21, -2, -3, -1, -16, 39, -17, 26, -5, 50, 0, -5, 62, 49, 51, 30, -66, 13, -93, 13, 38, -22, 17, 7, 23, -67, -45, 26, -86, -28, -23, -26, 30, 70, 43, 16, 32, -2, -6, 43, -20, 34, -68, -17, 18, 17, -43, -12, -16, 22, -20, 2, -75, 27, -7, 51, 37, 50, -42, 51, -17, 15, -3, 11, -4, 61, 37, -22, 27, 2, 69, 34, -16, 8, -6, -17, -47, -62, -34, 18, 23, -38, 27, 3, 0, 3, -1, -26, -61, 2, 21, 27, -4, 45, 17, 14, -5, 1, 8, 22, -22, -2, -28, -24, 1, 24, 71, 11, 25, -42, 46, -91, -72, 12, -78, 52, 29, 13, -14, -22, -64, -39, -10, 16, 54, -24, 67, -1, -6, 39, 3, 6, -26, 3, 39, -9, -37, -1, -15, -15, -15, -15, 32, -37, -20, -4, -46, 26, 13, 15, 14, 56, 23, 48, -71, 49, 28, -14, -29, 45, 14, 16, 67, -54, 14, -11, 43, 62, 51, -42, 4, 8, -13, -15, -3, 74, -10, -3, -30, -8, 47, -43, -9, -40, -6, -9, -26, 63, 45, -42, 68, 71, 25, -54, -8, -35, 15, 17, 19, 36, -3, 46, -42, 46, -60, 28, -5, 7, -32, -63, -29, 7, 28, 26, 21, -13, 18, 17, -16, -22, 12, -11, -31, 21, -22, -4, 5, -10, -7, -12, -5, -51, 40, 20, -1, 16, 14, -32, -22, 39, 78, -54, -75, 15, 65, 19, -70, -35, -28, 29, -24, 4, -19, -13, -12, -81, -75, 24, -7, 42, 11, 9, 49, 37, 17, -24, -21, 76, -19, -31, -92, 4, -10, 36, -44, -6, 25, 19, -20, -17, 29, -2, -44, -57, 23, 5, 3, 44, 10, 20, -27, -40, 8, -13, -19, 44, -25, -22, 6, -56, 71, 43, -25, -51, 38, 22, 14, 22, -1, -22, 37, -12, 1, -36, 13, -50, -6, -37, -26, -14, 41, -21, 61, -55, 32, -52, -20, 1, 19, -42, -38, -1, 10, 18, -39, -6, -1, -30, 34, -18, -18, 33, 16, -13, 45, -18, -15, -22, -19, -67, 40, -3, 27, -23, 0, 56, 42, -40, -28, -1, 36, 9, 4, 42, -18, 25, 7, 35, 7, 15, 20, -24, -27, 54, -23, 5, -5, 40, 17, 65, -36, -89, -45, -41, 23, 21, 9, -40, 34, 0, -25, -19, -77, -2, 26, -27, -64, 8, 23, -7, 32, 16, 16, -44, 13, -30, -72, 12, -32, -19, 46, -11, 67, 10, 10, -37, 0, -3, -23, -11, -4, -34, -59, 29, 65, -61, 55, -13, 28, -9, 54, 23, -57, -41, -11, 7, -55, -76, 44, 9, 13, -55, -28, 36, -4, 48, 26, 8, 19, 33, -22, -53, -40, 42, -7, 7, -31, -20, -10, 23, -71, -1, 38, -3, 27, -31, 34, 3, 38, 9, -17, 45, 22, 10, -6, -23, -25, 35, -9, -62, -10, 2, -51, 20, -43, 25, -3, -52, -18, -33, -14, 51, 2, -12, 13, -22, -10, 10, -13, -5, 50, -19, -38, 36, 55, 86, 51, -22, 69, -69, 20, -2, -49, 65, -4, 11, 2, -40, 0, -21, -38, 61, -22, 3, 5, -74, 4, 7, -1, -24, 25, 71, -3, 19, -78, 88, 24, 45, -52, -22, 10, 3, -5, 1, 46, -29, -7, 80, 11, -9, 48, 17, -1, 28, -23, -4, -34, 74, 42, 39, 8, -42, 44, -48, 101, 11, 27, 2, 44, 33, -21, -33, -5, -18, 1, -15, -59, -74, -19, -9, 60, 1, -23, -24, 44, -26, 76, -15, 61, -26, 7, 64, -9, 26, 4, 68, 3, -26, -26, -8, -7, 2, -14, -30, -52, -65, -55, -20, 45, 15, -43, 35, 1, 29, 12, -10, -6, -50, -41, 38, 9, -70, -39, 41, 51, -12, -53, -1, -8, 42, 12, 11, 66, 38, -50, -17, 4, 9, -8, -11, 64, 46, 40, 92, -28, -22, -41, -67, 28, -33, 0, 5, -38, 35, 6, 24, -17, -69, -13, -4, -15, 16, -46, 4, -2, -2, -45, 15, 13, 19, -50, 19, 8, 21, 9, -6, 24, 45, 84, -43, -83, -21, 54, 8, 34, 18, -84, 1, 84, -62, 12, 48, 49, 79, 23, 0, 2, 16, -53, 25, -41, -10, 32, -40, -18, 22, -49, 71, -24, -24, 35, 29, 11, -42, 58, -59, 35, 11, 0, -82, -42, 23, -14, 59, -46, 53, 6, 29, -25, -51, 40, 42, -59, 17, -28, -2, -66, 18, -46, 34, -24, 23, 25, 3, -55, -3, 21, 21, -57, 21, -16, -8, -26, 37, -37, -51, 54, -12, -12, -51, -13, 35, -26, -22, -1, -29, 69, 61, -4, 6, -38, -17, 10, -33, 22, -68, -17, -33, 26, 7, 8, -44, 31, -6, -16, -39, 68, 7, -28, -6, 83, -30, -65, 42, 49, 4, 27, -5, 7, 42, -10, 11, 18, 7, 30, 44, 31, -61, -42, 17, -50, 46, 23, -15, 36, -72, 11, -10, 2, -1, 15, 37, 14, 0, 4, 33, 22, -9, 40, 76, 67, 12, 73, 25, -60, 19, -32, 6, -44, 11, 31, 11, -46, 33, -46, -43, 60, 14, -29, -63, 43, -5, -37, -49, -10, -19, 27, -16, 50, 67, 64, -49, 51, 9, -21, -54, 7, 3, 11, -9, 9, -50, 42, -7, -66, 30, 36, 15, 4, -25, 53, -50, -6, -18, -10, -44, 6, -6, -20, 45, 1, -29, -26, 15, 16, 0, -20, 57, 58, -6, -28, -74, 12, -28, -23, -62, 33, 35, -73, -60, 27, 1, -4, -22, -29, 56, -33, -52, 11, -38, 74, -28, 16, 17, -61, -2, 27, 2, -18, -7, 1, -35, -22, -50, 32, 29, -21, 15, 55, 54, -53, 8, -34, 13, 53, 46, -62, -6, -28, -70, -9, 43, -42, -50, 2, 15, 11, -44, -25, -6, -1, -15, 1, 2, 12, -32, -36, 4, -6, 1, -8, -71, -16, 37, -21, -13, -16, -12, 1, 53, -50, 55, -46, 63, 6, -11, -67, -18, 35, -3, 60, -43, -7, 49, 13, -19, 24, -67, -39, 4, 55, -65, -33, -3, -33, -17, 11, -13, -36, 12, 17, -44, -34, -32, 51, -5, 8, 10, -41, -32, -22, 64, -4, 30, -55, -44, 47, 11, 51, 2, -38, 84, 16, 47, -64, -34, 34, -34, -33, 38, 55, 0, -15, 39, 35, 10, 5, -18, -21, 57, -44, -9, -32, 42, -1, 18, -14, -44, -56, 32, 22, -8, 13, 69, -27, 20, -9, -35, -3, 46, -10, 26, 5, -1, 43, 1, 40, -33, 61, 81, 12, 26, -13, 60, -42, 59, -47, 5, 3, 66, -39, -35, 52, 29, -51, 11, 53, 31, 35, 13, -57, -27, -44, -48, -66, 26, 55, -2, 27, 6, -33, 14, -41, 7, 50, -41, -2, -17, 60, 28, 48, -4, -64, 38, 12, -44, 33, -42, -8, -5, -8, 0, 43, -18, -74, 38, 28, 0, 27, -13, 34, -25, 63, 33, 38, 6, -39, 33, 25, -49, 39, 45, 55, -32, -45, 17, -2, 8, 26, -74, 30, 54, 14, -13, -50, 2, 91, -27, -57, 36, 22, 21, 6, -1, -16, -51, -4, -7, 51, -50, -23, -30, -53, 30, 26, -5, -19, -54, 40, 17, 29, 19, -28, 10, -24, 7, -5, 3, 28, -3, -15, 21, -26, 14, -3, 32, 11, 35, 36, 19, -1, 27, -5, -17, -4, 3, -23, -55, 64, 4, 30, -32, 56, 28, 13, -17, -28, 4, 2, -54, 3, 43, 2, -23, -24, 2, 3, 13, 58, 2, 23, 5, 13, -14, 0, -67, -5, 28, 0, -18, 31, -1, -44, -64, 62, -35, 1, 23, -7, 4, -19, 31, -11, -16, 11, -48, -33, 14, -25, 8, -22, -6, 31, 3, -12, 7, 30, -34, -31, 10, -36, -25, 37, 35, 23, -56, 47, -50, 1, 20, 30, 9, -37, 7, -51, 64, 15, 30, -17, 71, -24, -44, 2, -4, -59, 7, 65, 35, 16, 19, -76, -6, -22, 10, 12, -18, 2, -13, 48, 63, 38, -20, 34, 43, 42, 41, -2, 9, -27, 56, 56, 22, -78, 11, -16, -21, -8, -79, 21, -33, -35, 9, -3, -18, 19, 21, 23, 11, -56, 23, 7, -19, -32, -50, -74, -60, 49, -21, 31, 13, 59, 50, -45, 2, 11, 50, 29, 18, 52, 14, 37, -24, -29, -35, -11, -12, 25, -63, 29, -49, -6, 2, 38, 17, 43, -47, -51, 50, 16, -58, -42, -51, -17, 18, -87, -19, 8, -70, 36, 2, 15, 31, 42, 12, 39, 26, 4, -85, -65, 19, 18, 61, 37, -34, -6, 31, 54, 19, -9, -16, -7, 17, 28, -10, 11, -10, 92, 8, 3, -7, -21, 60, 38, -65, -10, -54, 65, 78, -29, 20, -57, -11, 32, -1, 49, 10, -18, 6, -9, -14, -3, -45, 18, -34, 45, -25, 64, 7, -8, 27, -61, 17, 19, -24, -11, 8, 0, 6, -19, -48, -22, 8, 30, -21, 32, 43, 44, -59, 27, 9, -43, 7, 16, 53, -19, -30, 68, 14, 27, 26, 22, -18, 5, 11, -17, 57, -40, 13, -47, -65, 39, -20, 42, -62, 83, -31, 3, 6, 29, -57, 6, 17, 47, -21, 33, -17, 42, 36, -17, 21, 11, 26, 9, -5, -60, -3, -35, -14, 33, -34, -9, -13, -56, -24, 15, -16, 73, 7, 32, 5, 66, -23, 59, 6, -26, -38, -9, -3, -9, 0, -25, -12, 28, 6, -13, -19, -10, 5, 3, 32, -36, -7, -86, 54, -67, 18, 72, -55, 9, 6, -17, -41, 17, 20, -69, 26, 41, 70, 37, -10, -92, 60, 16, 38, 2, 10, -49, 42, 19, 60, -10, -61, -29, -9, -6, -4, -17, -19, 25, -31, 17, 34, 53, 4, -38, 56, 82, -34, -44, -6, 1, -80, -31, 48, -49, 36, -30, 43, 21, -70, -73, 14, 16, -27, -23, 1, 42, 19, 15, 41, -31, 26, 24, 31, -40, 61, -37, -25, -11, 75, -42, 30, -53, -65, -29, -19, 8, 49, -2, -22, 32, -15, -1, -64, -16, -19, 49, 9, -13, -33, 75, 34, 8, -26, -44, -50, 41, -46, -42, -16, 41, -7, 13, 8, 6, -19, -22, 36, 20, -2, 42, -8, 32, 4, 15, -12, -10, -28, -23, -15, -7, 55, -48, 5, -77, 20, 12, 62, 37, -7, -24, 0, 29, 44, 20, -13, -46, 10, 6, -41, 73, 0, -66, -60, 55, 56, 25, -35, -22, 12, 44, 31, 60, -34, -48, -2, 11, 19, -38, -30, 37, -22, -30, -46, 12, -5, -27, 43, 32, -19, 1, -62, 0, -34, -40, 30, -36, 32, -50, 0, -45, -41, -62, 20, 39, -32, -15, 35, 27, -27, -39, 39, -38, 34, 28, -10, -27, -49, -8, 33, 11, -27, -46, 28, 28, 22, 1, 44, -15, 8, 57, 20, -50, 23, -13, -19, 34, -51, 43, -37, 4, 70, 67, 38, 41, 31, 28, 43, -37, -49, 4, -34, -20, -8, -20, -15, 23, 3, 16, 14, -35, -34, -2, -6, -89, 31, -46, -15, 25, -51, 19, -15, 17, -12, -34, -8, -56, -47, 51, 47, 57, -47, 3, 55, -9, -10, 18, 5, -42, 55, 57, -47, 68, -44, -43, -46, 2, 18, -8, 17, 41, 41, 20, 41, -14, 10, -5, 11, 50, -10, -40, 15, 15, 5, -88, 59, -41, 6, -22, 23, 59, -21, -70, -6, -54, -70, 11, 1, 2, 25, -4, 86, -1, 75, -43, 65, -54, -8, 13, 19, 5, -44, -47, 4, -2, -20, 68, 23, 7, -32, 16, -41, 14, -3, 27, 5, 32, 47, 41, 9, 0, 67, 50, -4, 0, 48, 4, -49, 47, 2, -23, -32, 25, 6, 35, 9, -14, -6, 1, 32, -4, -23, 17, -46, 2, 13, 55, -81, 22, 11, -14, 50, -4, -25, 8, 37, 0, -39, 22, -45, 62, -49, -10, 31, -14, -57, 43, 28, -19, -43, -10, 21, 76, 13, -28, 71, -60, -35, -4, 63, -1, -51, -41, 11, 43, 0, 81, -49, -48, 14, 42, 79, 39, 41, 50, 74, -41, 64, 39, -64, -38, 53, 4, -29, -79, -26, -46, 38, 36, 56, -33, -34, -18, -30, -14, 54, -56, 64, -68, 31, -49, -24, -1, -5, 51, 30, -20, -86, 28, -11, 55, -5, 39, 16, 30, -6, -29, 7, -56, 77, 12, 40, 18, -19, -1, -22, 6, 67, -34, 7, 33, 0, -43, 5, -8, 39, -22, -23, 30, -80, 37, 41, 58, 65, -2, -37, -29, 59, 28, 38, 24, 2, 34, 27, -35, 8, 7, 38, -29, 28, -10, -4, -27, 24, -35, 11, 13, 12, -18, 42, -11, 9, 27, -40, 39, -43, -32, -69, 70, -33, 63, 27, -22, 47, -44, -51, -48, 73, 28, -34, 37, -14, -13, -27, -38, 66, -4, -34, 35, 34, -12, 57, 49, -11, -74, -17, -50, 54, -32, 88, 86, -74, 43, 17, -30, 52, 37, 42, 26, -63, 55, 17, -92, 0, -59, -5, 46, 51, -10, -29, -12, 25, -2, -8, -6, -38, -31, 29, 2, -64, -61, -17, -39, -55, 13, 0, -20, 13, -33, 1, 3, -1, 61, 59, 7, 44, 19, -37, 46, -10, -56, -23, 18, 37, 1, 31, 34, -12, 62, 32, 39, -49, -2, 35, 14, -51, 37, -2, 43, 37, 66, 6, -51, 14, -83, 14, -23, 60, -65, 29, -5, 8, -13, -10, -13, 63, -20, -6, -12, -15, 5, 4, 9, 12, 16, -38, 14, 7, 94, 9, -47, 65, 9, 17, -7, 20, 34, 2, 34, -35, 41, 47, -93, -31, 77, -16, -15, 33, -6, -22, 38, 29, -32, 8, -8, -16, 44, 38, -70, -5, -26, 10, -54, 27, 15, -41, 26, 11, 40, 38, -15, -18, -26, 41, 49, 14, -1, 4, 35, -68, -39, -39, 47, -34, 11, -5, 21, -5, 6, 18, 3, 51, -52, -28, 43, -45, -56, 26, 58, -35, -3, -42, 19, 6, 15, -23, -23, 74, 1, 38, 22, 1, -56, 14, 38, -4, -26, 8, 42, -9, 37, 7, -8, 58, 18, 35, -47, 20, -47, -21, -46, 30, -1, -19, -46, -3, -82, 10, 30, -32, 2, 2, 37, -34, -21, -34, 11, -23, -2, -26, 4, 2, -2, 37, -16, -52, 12, -39, 55, 43, -39, 7, -3, -31, -30, -2, 58, 11, -57, 57, -77, 61, -23, 4, 20, -33, 70, -61, 32, 25, -10, 16, -1, -40, -9, -52, -53, 34, -11, -9, -76, -21, -50, -28, 22, 10, -28, 1, 73, -39, -31, -32, -4, 90, 2, -1, 2, -18, 110, 10, 13, -72, -28, -20, -5, -16, -19, -1, 58, -16, 43, -1, 34, 51, 6, 67, 11, 4, 1, -40, 10, -28, -18, 13, 14, -8, 28, 56, 31, -76, 3, -82, 2, -46, 24, -42, -26, -73, 2, 43, -30, -36, 3, 62, -7, -52, -46, -70, -23, 39, -51, -19, -67, 13, -12, 19, -6, -7, -6, 17, 26, 9, -12, 9, 56, 8, -59, 20, 26, 11, 56, -12, -2, -61, 23, -58, 13, -43, -71, 11, -33, -48, -53, -34, -22, 48, 4, 62, -39, 19, 19, 37, 90, -29, -27, -19, 27, 38, 29, 26, 128, -1, -48, -13, -46, 2, 52, -24, -31, -6, 49, -8, 36, 48, 76, -26, -27, -68, -48, 18, -26, -8, -1, -28, -32, -40, -50, -67, 1, 31, -12, -32, -16, 16, 8, 15, 21, 34, -45, 56, -10, -6, 38, -5, -41, -17, -14, -11, 16, -4, -1, -22, 79, 48, 17, -1, 3, 54, -20, 58, -39, 33, 37, 50, 28, 5, -32, -23, -23, 57, 8, 16, -27, 36, 30, -36, 56, -34, 19, 27, 60, -62, 70, -18, 31, 66, 20, -13, -61, -61, 16, -21, -2, -18, 25, -42, 24, 23, 75, -8, -31, 34, 13, -48, 36, 40, -30, 54, 9, -20, -63, 0, -5, -82, -21, -13, -75, 3, -56, 11, -58, 37, 35, -20, -20, -44, 10, -47, -13, 56, -11, 58, 0, -26, -44, -9, 3, 9, 75, -10, -49, -1, -37, -38, -3, -1, 27, -37, -10, 60, 11, 3, -17, 50, 74, -14, -38, -37, -9, 13, -18, 7, -24, -31, 10, -8, 9, -6, 26, -59, 3, 40, -2, 44, 37, 12, -30, 8, 36, -36, -38, 10, -19, 20, 45, 48, 14, 35, -7, 27, 16, 44, -5, -2, -2, 10, 15, 13, 8, 47, -47, 24, -71, -30, 9, 36, 11, -23, -30, 12, 14, 1, 53, -30, 57, 37, 16, 64, 61, -1, 6, -33, -24, -28, 9, 5, -35, -34, -18, 23, -6, -3, -5, 28, -13, -53, 15, -3, -15, 52, 25, -29, -27, 14, 3, -3, 23, -35, 5, -19, 16, -69, 13, 17, -29, 49, -64, 39, 24, 41, -1, -61, 46, -36, -67, -3, -7, -33, 30, -18, 51, -36, -54, 53, -12, -45, 14, -45, -5, -17, 85, -12, 47, -15, -14, -18, 21, 35, 32, 8, 30, 28, 33, -45, -24, -42, 33, -62, -38, -6, -13, -23, -14, -67, -4, -4, 5, -22, -56, 3, -15, 36, 17, -38, 13, -2, -14, 6, -40, 23, -2, 21, -42, 19, -52, 26, 32, -89, 3, 55, -54, 60, 26, -94, -6, 20, -70, -96, -1, -26, -14, 5, 12, 21, 19, 16, -20, -24, -54, 37, -21, -1, -18, -44, -56, -32, -25, -4, -8, 50, 13, -6, -101, -3, -37, -33, 2, 46, 28, 3, 46, -24, 52, 4, 20, -69, -87, 21, 39, -43, -20, 29, 30, -4, -6, 24, -69, 82, -73, -8, 17, -37, 31, -87, 11, -78, -64, 27, -15, -13, -8, -43, -15, 10, 19, 27, 8, 9, -10, -9, -2, -40, -14, 55, 30, -78, 7, 59, -16, 57, 8, 6, -17, 14, 33, -16, -24, -50, 45, -65, 6, 23, 28, -59, 30, 78, 65, -53, 38, 39, 21, -44, -2, 10, 16, -69, 10, 8, 22, -24, -42, -30, 23, -19, 17, 29, -49, -6, -9, 6, 10, 53, -56, 56, -3, -17, 42, -58, -70, 19, 5, -16, 7, 24, 17, 2, -22, 23, -54, 5, 46, 4, 13, -18, -59, -4, 29, -33, 6, 1, -18, -16, -44, -33, 6, -6, 18, -57, 26, -6, -44, 44, -5, 13, -73, -13, 20, 32, -24, 4, -7, -11, -48, -27, -34, 29, -60, -34, 6, -23, -13, -33, -35, -25, 71, 52, 29, 40, 46, 54, 27, 66, 38, -13, -21, 31, 53, -82, -30, 15, 30, 37, 68, 0, -27, -15, -9, 39, -25, -7, 29, -11, 33, -73, 32, -61, -24, -20, -9, 7, -17, 76, 26, 0, -42, 36, -18, -9, -43, 9, -61, -60, 39, -20, 21, -35, -11, 43, 47, 16, 41, 30, -13, -7, 84, 23, 22, -53, -31, -57, 9, 25, -15, 0, 26, -26, -15, 46, 28, 6, -24, 75, -39, -19, -24, -48, 66, -67, 41, -40, 16, -19, 25, 32, -8, 11, 39, 22, -29, -12, -52, -6, 1, -67, 39, 54, -27, 32, 67, -19, -28, -37, -3, 14, 12, 31, 0, -59, 9, -5, 40, -1, 29, -7, 12, 3, -25, 7, 54, -2, -61, -6, 48, 5, -78, -22, 7, -47, 70, -3, 54, 23, 20, -42, -41, 27, -6, -91, -36, 20, -29, -18, -22, -45, 10, 16, 37, -41, -47, 23, 39, 44, -47, -27, 13, 54, 6, -25, 40, -32, 1, 107, 16, 5, -12, 19, 20, -29, 50, -54, -2, -4, 29, -14, 52, -35, -61, 24, -9, -75, 20, 7, -15, -61, -33, -28, -1, 28, -40, 49, 28, -11, 40, -27, 18, 0, 3, -12, -29, -40, 67, -6, -36, -18, -35, 35, -26, 57, 44, 10, 8, 5, 7, -52, -25, -6, -24, 64, -86, 35, -8, -27, -12, -2, -8, 30, 25, -42, -2, 11, -54, -37, 34, 67, -51, -50, -5, -26, 18, 23, -47, 23, -51, 11, -3, -13, 72, -47, 79, -28, 40, -90, -16, 52, -3, -14, 43, 7, -25, -94, 6, -43, -4, 35, -43, 13, 39, 4, 0, 2, 58, -10, -33, 15, 4, -16, -49, 32, 25, 65, -26, -50, 84, -21, 18, 27, 23, 39, -52, -25, -3, -17, -33, -12, 7, 50, -18, 16, -19, -51, 17, -64, 17, -16, -13, 12, 31, 41, 22, 1, 27, -4, -31, -10, -66, -33, 41, -9, -38, -19, 13, -78, 44, -75, -36, -36, 51, -45, 39, 53, 56, 32, 6, -19, -1, -58, -31, 40, -14, 13, -32, -38, -23, 46, -49, -14, 11, -35, -45, -13, 61, 42, -20, 57, 39, 42, 6, 3, 8, 13, -61, 45, 3, -8, 44, 37, -26, -48, 69, -24, -30, 45, -23, -37, 15, -36, 37, 43, -65, 42, -15, -91, -18, 78, 42, -9, 66, -20, -9, -27, 14, 11, -6, -8, -28, -51, -45, 7, 30, 54, -12, 15, 26, 26, -9, -44, -25, 30, -38, 38, -18, -11, -7, -10, -53, 40, -17, -4, 4, 33, 9, -19, 44, -41, -8, 37, -54, 30, -69, -38, -19, 1, -16, 31, 8, 45, -8, -5, -7, -71, -42, -41, 7, -39, 36, -8, 43, 39, 21, 54, -36, 42, -6, -6, 10, -13, -44, -75, -54, 38, -16, 42, 31, -20, 11, 66, -29, 24, 54, -39, 43, 15, 43, 70, -20, -55, -9, 54, 16, -21, -12, -38, 10, 7, 1, -39, 73, 10, 0, 69, -25, -45, -2, -28, -10, 27, -21, 14, 43, -26, -6, 0, 23, -7, -4, -2, -12, -42, 14, -42, -75, 2, -40, -30, -72, 89, 22, 68, -19, -21, -4, -22, 5, 62, -5, 71, 30, -67, 53, 40, 5, -14, 7, 0, -27, -55, 13, -3, 44, 30, 39, -59, -35, -61, 51, 46, -6, 19, 0, 13, -21, -13, -37, 22, 15, 65, -67, -58, -1, -45, 31, -37, -37, -36, -65, -11, -3, 17, -53, 69, -53, 9, 31, 3, 19, -3, -67, 51, 13, 10, 2, 18, 4, -54, -39, 27, -38, 29, 29, 28, -30, 8, -18, 68, -55, 43, -42, -36, -32, -32, -15, -8, 19, 55, 29, 23, 16, 34, 26, -30, 26, 25, 57, 2, -16, -41, 1, -4, -22, -26, -44, 15, -92, 29, -25, 2, 12, 17, -32, 3, -53, 33, 45, 13, -39, 4, 10, 43, 0, 35, -34, -84, 46, 67, -26, -61, 30, -23, -70, 58, -62, -35, 48, 34, 98, -63, 27, -30, -55, 53, -16, -41, -9, -20, 45, -39, -2, 13, -25, -43, 12, -67, 21, -31, 85, 52, -40, 10, 25, -1, 12, -45, 57, 8, 37, -4, 8, -46, 29, 1, 24, -12, -45, 11, 10, -17, -84, -40, 82, 44, 54, -29, 17, -42, -21, -47, -1, -65, 27, -76, -37, -53, 19, -12, -43, 36, -15, -10, 24, 29, 30, -19, -45, 46, -21, -63, -28, 57, 87, 25, -77, 52, 38, -25, -88, 41, 91, -80, -18, 13, -26, 40, -102, -41, -75, 24, -27, 9, 12, -2, -45, -16, 79, 26, -24, -27, -93, 9, 4, -112, 14, -80, 32, -25, -35, 2, -13, 16, 58, 23, -37, 52, -5, 23, -26, -31, -7, -41, -91, -7, -39, -50, -1, 8, 21, 28, 22, -32, 39, -5, -47, -6, -63, 44, 22, 73, 8, 10, 42, -40, -26, -13, -37, -37, 25, -13, -23, -16, 18, -6, -60, 19, 1, -25, -35, 29, 27, 11, 27, -6, -32, -9, 7, -24, 53, 7, -37, -11, -60, -2, 2, 24, -63, 21, 20, -36, -40, -33, -11, 45, -33, -13, 54, -69, -15, -41, 17, -10, 17, -11, -80, -2, 8, 46, 9, -33, 23, 30, -7, -22, 6, 12, 23, -74, -47, 17, -29, -27, 1, -9, 83, 9, -14, -24, -4, -23, -12, 22, 9, -27, -25, 56, 21, -2, -5, -13, -32, -43, -33, 7, -43, 20, 55, -28, -7, 42, 17, 14, 3, -22, -13, -53, -27, 7, 21, -62, 3, 43, 34, 11, 83, 64, -32, -69, -67, 52, -29, 9, 46, 29, -79, -52, -47, -13, -31, 21, 68, 28, -4, -8, -27, -5, -4, 34, -54, 0, -26, -2, 0, -27, 5, 25, 3, -15, 35, 39, 14, -22, 80, -15, -59, 42, -25, -25, 20, 43, 26, -46, -9, -8, -7, 10, -17, -7, 15, 34, -32, -32, -13, 55, 90, -12, -46, 42, 25, 1, 72, 4, 36, -65, 20, -23, 45, 40, -7, -46, 39, -3, -53, -72, 26, -19, 24, 16, 4, 12, 13, -76, 19, -17, 0, -41, 75, 50, 73, -27, -22, 51, 17, -7, 30, 23, -25, -25, -72, -20, 6, 9, -35, -10, -13, -68, -12, 9, 17, 43, 1, -6, 47, -26, 18, -31, -25, -21, -71, -39, -47, 67, -63, 31, 89, 78, -9, -38, 14, -23, -49, -26, -31, -7, -16, 81, -55, -70, -99, -12, -36, 38, -23, 64, 20, -31, 36, 35, -6, -8, 7, -56, 5, 38, -23, -18, -52, -64, -14, 10, 24, -6, -13, -21, 11, 11, -13, -34, 3, -71, -26, 57, 25, -12, 20, -47, -36, -1, -21, -22, 16, -47, -29, -87, 21, -62, 50, 34, -6, -11, 1, -22, 60, 2, 17, -22, -39, 8, 44, -19, -53, -30, -64, -8, -14, -79, -3, -12, 24, 43, -30, 0, -34, -46, -10, -28, 41, -23, 75, -14, 21, 4, 32, -33, -18, -19, -55, -35, -6, -2, 42, 21, 50, -8, 6, -12, 73, 12, 11, -3, -9, -35, 71, 31, 36, 23, 40, 26, 6, 17, 2, -9, 32, 14, -35, -56, -8, 66, -43, -17, -8, 48, 49, 20, -81, 0, 18, -1, 8, 59, 48, -25, 36, 23, -29, 38, -5, 21, -11, -45, -6, -26, 39, 35, -12, -33, -81, -61, -51, -26, 57, 2, -41, -28, -10, 0, -69, -75, 25, -8, -13, 7, -11, -2, -47, 70, 21, 17, -15, -31, 45, 63, 10, 24, 27, -15, 68, 6, 45, 20, -43, 11, -18, 60, -78, -43, 9, -17, 16, -28, 21, 1, 25, -15, 52, -18, 28, -13, 33, 78, 25, -55, 44, 28, -16, -3, -4, 12, 42, -6, -36, -54, -59, -46, -6, -37, -43, -26, -83, 68, -27, 2, 12, 15, -45, -20, 90, 30, 26, 60, 1, 29, 63, 17, -10, 9, 2, -16, -35, 61, 14, 48, -16, -1, -70, 59, 4, 73, 38, -48, 9, 3, -39, -16, -32, 83, -43, 8, -74, -9, -28, -52, -3, 38, -20, 11, -40, 21, 0, -4, 25, 17, -37, 42, -9, -76, 7, 59, 28, 64, 36, -70, -26, 19, -8, -41, -1, 21, 36, 3, 14, 4, -32, 16, 6, 40, 6, -1, 47, -37, -2, -37, -9, -9, 57, -21, 29, -57, -47, 24, -9, -20, 65, 25, 9, 16, 60, -69, 33, 27, 48, 46, -5, -29, -18, -14, -79, 5, 26, -24, 28, -13, 6, -8, -60, -57, 24, -15, 31, -29, -44, 33, 34, 1, -31, 3, -16, 36, -14, -35, -17, 66, -37, 45, 25, -7, 11, -12, -1, -27, -34, -2, -50, -12, 24, 41, 15, -20, -32, -12, -11, 16, 53, 19, -29, 68, -48, -47, -25, -33, -83, -3, -19, 77, 46, -9, -20, 61, 0, 78, -15, 45, 31, 43, 32, -49, 49, 10, -27, 2, 21, -36, 62, 3, -33, 9, -45, 31, 5, 12, 88, -13, 6, -39, -13, 24, 59, -18, 7, 21, -12, -22, -12, -45, -27, -21, 12, 4, -2, 24, 12, 10, -25, -60, -13, 39, 44, 12, -95, -1, 17, -3, 31, 37, 34, -16, 65, 32, 10, 0, -5, 50, -25, 28, -40, -5, -13, 26, 73, -7, -72, 0, -24, -8, 6, -12, 7, 23, 26, -40, 21, -2, -18, 29, 0, 14, -1, -58, -4, 37, 28, 12, -42, -31, 22, 17, 23, 19, 53, 2, -20, 67, 23, 34, -48, 15, 10, -39, 6, -15, 17, 12, 34, -42, 10, -47, 13, 13, 19, -10, -60, -16, -32, -75, -9, 38, 5, 81, -20, 29, -11, 72, 0, 23, 10, -76, 32, 5, -44, -18, -34, -57, -66, -17, -22, -3, 53, 51, -48, -25, -82, 25, 43, -25, 27, 2, 38, 26, -27, 81, -47, -2, -21, -17, 13, -3, -7, -46, 16, -13, -58, -16, -17, -25, 18, -39, -18, -10, 43, 47, 47, -17, -19, 0, -49, 6, 11, 14, 30, -43, -21, -43, 26, -27, 12, 0, 39, 49, 19, -73, 33, -14, 62, -9, 31, -61, -44, -38, 5, 4, 56, 37, -10, -33, 18, -7, 18, 29, -47, -83, 30, -3, -7, 44, -35, 21, -4, -61, 6, 27, -66, 17, 36, -23, -25, 44, -7, -5, 45, 20, -9, -1, 54, -46, 34, -16, -12, -1, 13, 16, -69, 27, 67, -47, 56, 45, 4, 48, 15, -45, -12, -65, -63, 39, -52, -33, -56, -89, -60, -44, 1, 51, -56, 18, -50, 45, -26, 45, -9, 70, -36, -68, -22, -16, 38, -1, 32, -23, -53, -49, -29, -23, 11, 10, 18, 21, -58, -5, -16, 50, -29, 12, -30, 76, 68, 30, -3, -15, -59, 38, -10, 43, 6, -16, -25, -37, 34, 27, 27, 6, 3, 2, 12, 33, -20, -2, 47, 30, 40, -30, -21, 21, 5, -14, 10, -24, -77, -48, 42, 22, 79, -13, 8, 76, 7, -15, -33, -78, -27, -26, -78, -19, 53, -39, 16, -13, 25, 62, -97, 42, 13, 73, 10, 29, 29, 29, -51, 3, 4, -22, 21, 24, 57, -20, -2, -11, -14, 20, 43, -33, 27, -28, -33, 10, -42, 65, 35, 40, -61, 86, 84, 32, -55, 64, 6, 85, -21, 34, -86, 2, 81, -62, 50, 34, -2, -26, -10, 58, -16, -52, -28, 18, -5, 47, 16, -12, -51, -75, 7, -4, 4, -52, -7, -1, -33, 67, 24, -21, -23, 55, -43, -38, -76, 17, 18, -40, -32, 50, -58, -91, -75, 5, 4, 46, -60, 18, 21, -57, -10, 89, 20, -6, -2, 4, -23, 23, 55, -18, -36, -14, -24, 21, 32, 14, 12, -29, 24, 28, -41, 51, -55, 4, 42, 24, -65, 68, -61, -24, -5, 15, 55, -4, -11, -70, 12, 54, -5, 15, 21, -28, 3, 7, -28, 7, 6, -24, -15, 31, -12, 11, 28, -12, 18, -30, 9, 16, -17, 27, 8, 29, 16, 49, -75, -12, -20, -18, 30, 89, -11, -8, 15, -14, 70, -15, 5, 30, 66, 31, -51, 26, -27, -26, -26, -66, -70, 30, -1, 54, -23, -11, 49, -9, 19, -6, -6, 14, -17, 18, 7, 20, -12, -75, 36, 40, -31, 37, -74, -69, -49, 58, 48, 4, -51, -30, 14, 49, -7, -13, -63, 14, -24, 8, -29, -28, 35, -34, 28, -7, 15, -9, 89, 18, 26, 60, 5, 51, 33, -85, 12, 23, 45, -32, 36, 21, -39, -28, 16, -41, -11, 7, 24, -72, 15, -6, -9, 61, 52, 13, -5, 23, -39, -56, -8, 44, 53, 7, 9, -26, 64, -62, -57, 12, -25, 73, 47, 16, 33, -36, 8, -36, 2, 63, -40, -29, -51, 3, 18, -15, 58, 32, -24, 1, -9, 2, -72, -24, 17, -17, -56, 66, 65, 61, 72, -52, 46, -17, 84, 9, -28, -21, -20, 58, 66, 1, 86, 16, -35, 74, 16, 73, 3, -70, 39, 64, -2, -31, -40, 2, -47, 77, -49, 32, -20, -9, 44, 8, -21, 4, -22, -78, 5, 49, 42, -11, -23, -8, 21, 19, -48, -47, 27, -7, 7, 51, 13, 25, 17, 52, -92, -18, 14, 18, -56, -28, 0, -6, 54, 36, 75, -43, -35, 11, -26, 6, -4, 34, -54, -33, 8, -16, 6, 24, 84, 34, -20, -37, 6, -20, 40, -82, 41, -3, 64, 82, 0, -31, 79, 32, 25, 37, 35, -63, -6, -19, 43, -8, 15, -49, 25, 11, -29, 46, 68, -62, -46, -18, -26, 35, 26, -11, 56, 40, 7, -11, 37, -52, 57, -14, 6, -32, -38, -59, -36, -65, -43, -72, 14, -39, -1, 17, 61, -22, -4, 1, 36, 77, 17, -10, -26, -11, 46, -19, 52, -31, -16, 39, -39, -2, -39, 0, -5, -43, -39, -22, 41, -88, 9, 83, 18, -38, -70, 18, -20, 68, 44, -4, 40, 36, 72, 1, -54, 39, 58, -47, -24, 10, -5, -21, 67, 61, -3, 13, -66, 54, -28, -24, -26, -12, -25, -41, -59, 2, 6, 39, -13, -54, -21, 15, 34, 66, -18, 50, -3, 49, 35, 9, -24, -40, -11, -32, -12, -30, 18, 3, 33, 54, 77, 3, -1, 14, -68, 8, -46, -4, 17, -55, 2, -17, -45, -18, -23, -47, 32, -82, -17, 36, -33, -36, 5, 18, -35, -17, 53, -5, 33, -30, 17, -42, 43, -4, 26, -8, -16, -24, 67, -29, -49, -18, 79, 58, -50, -49, 23, -17, -52, -82, -51, -17, -53, 2, 53, 17, 75, -39, 14, 79, -9, -22, -34, -24, 42, -44, -60, 73, 6, -52, 11, 44, 73, -35, -38, 45, 16, 17, -1, -28, -2, 24, -14, 72, -11, -56, 5, 51, -16, -2, 11, 21, 43, -41, -68, -38, 22, -20, -14, -7, -73, 54, -12, -34, -45, -14, -29, -13, -12, -33, -33, 31, 14, 43, -20, 16, -75, -9, 20, 53, 13, 9, -16, -10, 1, 33, 20, 13, -2, 46, -38, -4, 5, -46, 3, 11, 45, -11, 20, 1, 8, 39, -27, 8, 3, -23, 4, 22, 14, 7, 23, 12, 23, -24, -26, 10, 16, 55, -27, -22, -10, 17, 1, -14, -60, 13, -8, 12, 0, 31, 59, -54, -10, -46, 41, 50, -63, 16, 56, 101, -19, -56, 54, -25, -30, -43, -10, -1, 89, 18, -42, 39, -1, 22, 44, 7, 93, -38, -7, 52, 43, 49, -3, -42, 23, 59, 4, 59, -75, -40, -18, 49, 42, -6, -43, 1, 11, -50, -41, 53, 16, -64, -8, 71, -16, -36, 11, 11, 44, 27, -3, -9, -21, -18, -38, 43, -15, -8, 63, 19, -8, 32, 29, 15, -4, 73, -62, 2, 48, -84, 10, 62, 7, -12, 58, -6, -20, -47, 8, -1, -10, 2, 3, 36, -29, 11, -8, 15, -50, -84, -14, 35, 43, -3, 7, 45, -21, 70, 43, 14, 44, -25, -28, 58, 15, -65, -39, 53, -13, -24, -10, -49, 17, 19, 10, 75, -2, 51, -21, 71, -53, -56, -61, -59, 5, 5, 37, 7, -67, -5, 29, -36, 36, 10, -10, -4, 1, 16, -59, -37, 16, 5, 13, -42, 17, 4, 40, 22, -106, -12, 4, 11, -41, 42, 28, -2, 47, -23, 71, 53, -110, 12, 5, 69, -20, -23, -48, -33, -46, -38, -6, -20, 68, -80, -91, -64, -39, -54, -65, -33, 2, 52, 14, 28, 15, 23, -15, 40, 34, 25, -42, -5, -64, 19, -69, 73, -39, -15, -49, 27, 18, 41, 18, 58, -32, -11, -3, -5, -1, -5, -9, 8, 4, -39, -42, 45, 73, 63, -9, -20, -72, -6, -30, 9, 35, -32, -55, 32, -1, 6, -25, -1, -66, -70, 33, -34, -50, 74, -34, -13, -47, -7, 16, -63, -11, -34, 41, -7, -39, 34, -20, -13, 26, -23, -17, -43, -42, -52, 8, 38, -53, -12, -6, 5, 49, -40, -11, 52, 1, -3, 31, 28, 42, -11, -44, 16, -60, -22, 61, 22, 2, -8, 30, -33, 63, 8, 22, 13, 10, 19, -37, -46, -9, 82, -10, -22, -43, 7, -29, 13, -10, -80, 29, 45, -11, 8, -4, -43, 43, -28, -58, 53, 20, 40, 34, 37, -61, 37, -68, -15, -5, -8, 16, -47, 11, -9, -17, -20, 1, -1, 50, 13, 0, -1, 14, 80, -56, -11, -32, 30, -2, -21, 20, 29, 11, -69, 25, -47, -53, 48, 21, -45, -59, -7, -12, 18, 35, -32, 11, 28, 15, 25, -22, -14, 5, -17, -37, 9, 8, 4, 2, 23, -3, -3, -6, 26, -34, 2, -29, 12, -22, -34, 23, 24, 62, -9, 49, 98, 13, -33, -2, -14, 71, 34, -68, 1, -56, 63, -6, 30, 31, -25, 66, 57, -8, 56, 13, 19, -14, -33, 10, 52, -30, 5, -37, 6, -56, -17, 22, -7, -37, -7, -42, -13, -26, -34, -64, 24, 15, 49, -43, 51, -13, 30, 11, -34, -42, 19, -10, 38, -14, 18, -39, -54, 33, -11, 54, -66, 25, 19, -31, 6, -13, 83, 16, 36, -35, -66, -17, 16, 7, -13, -50, -6, 35, -60, 49, -21, 9, -15, 34, -49, 6, -66, -18, 43, 53, 0, -35, -20, 8, -75, 21, -14, 113, -13, 42, 5, 43, -16, 32, -17, -13, 1, -17, -22, 3, 37, 57, -7, 39, 26, -59, 53, 36, 35, -39, 34, -25, 54, 18, -23, 24, -49, -20, -3, -25, 48, -13, 65, -27, -37, -20, -56, 86, -39, -10, 18, -8, 16, 40, 67, -17, -41, -6, -23, 10, 29, 13, -18, -7, -52, -31, -9, 41, 67, 29, -42, -6, -1, 38, 31, -15, 12, -25, -23, -54, -21, -59, -60, 83, 45, 21, 14, -43, -22, 85, -59, -30, 47, -3, 17, -14, 34, -55, -1, -15, -60, 2, -1, -10, -18, 42, -3, -18, 70, 51, 38, 48, -1, 15, 5, -31, -4, -29, 69, -29, -30, -13, -49, 1, 49, -6, -38, 85, 34, -45, 9, 6, -8, -22, -43, 18, 0, 0, 43, 19, -18, 66, 2, -32, 14, -35, 17, -7, -8, 29, -71, -7, -34, 30, -9, 37, -10, -38, -12, 28, 10, -57, 58, -6, -11, -80, 1, -21, -12, -66, -65, -28, -59, -51, -14, -55, 31, -61, 33, -63, -15, 40, 22, -10, 31, -26, -41, -3, 14, 37, -9, -52, 19, 84, -2, -48, -8, -46, -5, 46, -3, 58, -38, 43, -5, 8, 27, -1, -34, -10, -44, 86, 14, 27, -53, -41, -7, -42, -21, -58, 16, 30, -16, -10, 32, -43, -41, 20, 38, -15, -24, -85, -33, -30, 9, -42, -19, 61, -62, 1, -16, 25, 13, 20, -53, -55, 35, -19, -25, -16, -3, -62, 57, -32, -50, -4, 31, 3, 51, 4, -4, -49, -50, -60, 19, 22, 7, 0, -37, 16, 58, -10, 43, 35, 45, 4, 28, 72, -2, -72, -26, -52, -36, -9, 20, -25, -7, 26, -23, -35, -72, -9, -26, 22, 41, -45, 4, -6, 32, -29, 31, -17, -82, 2, 63, -37, -8, 13, 35, 25, -3, -7, 3, 44, 23, 72, -38, -12, -71, -95, 17, -65, -58, 24, -6, -7, -35, -2, 59, -48, -36, -22, 31, 94, 9, 107, -48, 5, 55, 22, -2, -12, -24, 63, -1, 68, -26, -42, -13, -34, -87, 76, 26, -32, -72, -53, -2, -4, 50, 4, 9, -51, -36, 44, -10, 18, -19, 25, -93, -16, -36, 16, -18, 2, -56, -16, -25, -46, -39, 37, 46, -61, -65, -44, 48, 6, -24, -67, -36, 22, 89, -72, -39, -7, -5, -73, 13, 89, 20, 28, 55, -8, -13, -1, -31, 23, -8, 21, 21, 0, 59, -34, -80, 39, 30, 43, -47, 18, 27, 16, -37, -72, -9, -12, 22, 25, 0, 37, -14, 58, 14, 63, 41, 22, 66, 32, 2, -13, -17, -64, -77, 51, 51, 95, -63, -52, 75, -4, 69, 9, 6, 10, -11, 45, -32, 9, 60, -99, -8, 23, 25, 39, -85, 91, -66, 17, 20, -20, 52, 40, -13, -32, -57, -97, -41, -27, -14, 20, -52, 74, 38, -44, 54, -13, 27, 9, 53, -48, 80, 12, -16, -3, 51, 86, 4, 22, -2, -5, -26, 60, 55, -43, 35, 17, 36, -55, 10, 23, 70, 6, -62, 44, -49, -11, 62, -36, -82, 1, 3, -52, -6, 14, 78, 83, 73, -29, -70, -74, 19, 16, -86, -31, -46, -49, -10, 36, -66, -62, -26, -28, 12, -28, -59, 46, -16, 73, -14, 50, 32, -34, 25, -23, -59, 35, -88, -40, -54, -86, -39, -12, 13, -27, 48, -63, -50, 34, -21, -24, 62, 19, 80, 51, 14, 45, -43, -16, -76, 65, -25, 62, 33, -24, -21, -23, -5, -21, 9, -28, -27, -17, 2, -19, 69, 20, 0, -35, 40, -9, 32, -65, 34, -39, 54, 27, 66, 48, 19, -31, -20, -45, -11, 45, -7, 12, -20, 22, 46, -28, -32, 40, -14, -31, 74, -14, 18, 22, 1, -39, -29, 58, -78, 18, -21, 14, -11, 3, -3, 0, 65, 1, 26, 9, 38, 59, 2, -28, -24, 5, -5, -16, 8, -7, 48, -26, 6, -36, 57, 0, -4, 25, 36, 5, 36, -22, 16, -2, 10, 2, 3, 66, -8, 3, 34, 2, 4, -20, -84, 89, -19, 19, -20, 36, -10, -25, 17, -48, -45, 62, 6, 41, 6, 11, -56, 43, 32, -51, 24, 76, -35, 85, 28, 46, -7, 19, -31, -22, -20, 80, 25, 61, 89, 10, -7, 36, -35, -35, -35, 4, 9, 3, -23, -61, 35, 90, 19, 31, -39, 31, -48, -3, 35, 18, 60, -3, -20, -15, 12, -68, 40, -52, -12, -2, 12, 33, 67, -21, -28, -20, -28, 8, 17, 23, 1, 68, 0, 59, -58, 22, 26, 5, 45, 25, -9, 38, 21, -68, 47, 22, -26, 1, -7, -44, 69, 5, -52, 16, -1, 4, 25, 70, -25, 41, -6, 72, 26, 31, -47, 4, 2, 37, -8, -50, 74, -49, -3, -52, 52, -5, 50, 6, -11, 43, 21, 16, -25, -29, -43, 10, 37, 7, 23, 17, -23, -34, 62, -30, -85, 30, -34, -3, 8, 47, -14, -27, 1, 6, 53, -18, -38, 86, -42, 87, -45, -5, -52, 19, -53, -10, 11, 114, -45, -15, -97, -95, 27, 2, 71, 80, 50, -11, -37, -45, -71, -2, 8, 9, -64, -5, -48, 9, -31, -10, -41, -62, -23, -14, 0, 19, 17, -24, 50, -46, 16, -17, 1, 62, 25, -26, 16, 18, -4, 37, -18, -39, 24, 73, 4, -29, 46, 80, -38, -24, 54, 7, 7, -26, -25, -104, 65, 73, 31, 67, -1, -36, -23, -10, 29, 5, -10, -26, -4, -28, -38, 17, 38, 54, -41, -41, 32, 8, -29, -32, -22, 30, -26, -16, 12, -22, -68, 48, 35, 26, 19, -38, 5, 41, 3, 101, 3, -10, 14, -25, -12, -66, 12, -69, 35, 26, 68, 0, -19, -11, -32, 25, -17, -27, 8, 16, 30, -55, -6, -1, 46, -34, -47, 30, -49, -50, -22, -37, 27, 29, 85, 66, 75, -30, -42, -29, -27, 6, -14, -69, -3, 35, -21, 14, 50, 39, 2, 47, 4, -56, -14, -16, 44, -1, 19, 1, -40, 18, 35, -20, 21, -12, 5, -60, 81, 29, 25, -28, -8, -40, -63, 31, -6, 32, -58, 19, 35, -39, -76, -32, 31, 3, 10, -5, -14, 12, 22, -49, 16, -1, 28, 33, -53, -20, -40, 52, 1, -48, -31, 0, 16, 2, -51, 45, 68, 51, -99, -32, -79, -24, -65, -2, 28, 59, 2, -32, 56, -25, 59, -36, -18, 33, 28, -10, -13, 25, -50, -25, 36, 43, 70, 19, -9, -40, -30, -26, 20, -32, 1, -40, 90, -12, 1, 83, -2, -45, 48, -29, 22, 5, 17, -20, -53, -65, -14, 34, -72, 11, -9, -62, -9, -58, 24, 52, 50, -1, -75, 17, -31, 6, 61, -5, 3, 45, 3, -31, -31, -2, 17, 1, -6, 15, -6, -51, -33, 54, -10, -34, -9, 32, -52, 43, 48, 10, 55, -9, 54, 31, -20, 0, -27, 59, -55, -49, 32, 25, -40, 36, -22, 52, -44, 53, 8, 24, 11, 13, 54, -1, -27, -6, 44, -1, 2, 41, -50, -1, 29, 62, -2, 28, -11, 43, -76, 23, 42, 13, 61, 27, 1, -14, -44, -49, 4, 32, -14, -63, 20, 3, 50, -58, 14, -42, 30, -43, -10, -44, 5, -27, 17, -20, 3, -22, -28, -35, -12, 39, -55, -68, 9, -13, -69, 2, 48, -49, -8, 12, -43, -4, -16, -8, 2, -11, -18, -51, 97, -10, 14, -43, 30, 10, 3, -8, -5, 31, -47, -26, 15, 30, 9, -12, 5, -39, -50, 33, 76, -3, 38, -22, 64, 64, -24, -26, -8, -21, 50, -29, 13, -41, 24, 51, 33, -65, -16, 14, 54, 9, -36, -42, 7, -16, 12, -4, -40, -23, -12, 22, -49, -29, -8, -40, 52, -2, -26, -70, 12, 15, 3, 29, -10, 60, 53, -33, 14, -48, 42, 60, -22, 76, 5, 10, -22, -50, 34, -53, -2, 36, -39, -6, 17, 42, 60, 26, -15, 47, -36, -11, 34, -20, -11, -76, -21, 8, -13, 23, -12, -21, -48, 78, -28, 29, -7, -50, 81, 11, -12, 97, -55, -47, 49, 38, 27, 19, -20, -59, 4, 55, 35, -49, 16, -8, -4, -42, 2, 52, -27, -70, -39, -50, -68, -56, 64, -30, 54, -86, -4, -43, -50, -3, -15, 56, 2, 29, 13, 52, 65, 1, 52, 14, 6, 33, -13, -56, -29, -14, 10, 41, 69, 36, 9, -52, 6, -34, 30, -33, -40, 29, -51, 33, -44, 28, -19, 25, -8, -34, 9, -15, -37, 18, -18, 18, 42, 10, -40, 31, 14, -25, 0, -56, 26, 24, 36, 13, 24, 8, -58, -30, -50, -89, 34, 2, -52, -54, -14, -4, 22, 22, 23, 24, 74, 28, -29, -38, 76, 19, -22, -10, 55, -82, 32, 17, -3, 1, -53, 65, 11, -14, 20, 42, 45, 4, 54, -28, 17, 29, 9, -16, 2, -42, 1, 11, 70, 22, 24, 47, 30, 3, -70, -11, -18, -10, 42, -41, -51, 15, -38, 15, -29, 77, -61, 21, -7, 4, 27, 0, -55, -50, 45, -37, 0, 34, -33, 65, -51, 45, 18, -66, 30, 76, -1, -21, -10, 22, 13, 2, -55, -39, -14, 45, 56, 18, 52, 25, -1, 49, 37, -20, 57, 2, 51, 40, 8, -25, -4, -1, -5, -37, -1, 54, -38, -24, -45, 3, 11, 58, 16, 56, -37, -15, 23, 71, -11, -11, -28, -26, -40, -1, 29, -21, -12, -47, -62, 31, -18, 40, -79, 29, 37, 51, -27, 38, -82, 42, 30, 31, 12, 62, -8, 0, -34, -14, 90, -34, 53, 33, -12, -49, -61, 13, -24, 13, -22, -37, 28, 98, -11, 20, 33, -31, -8, -38, 0, 11, 16, -46, -19, 55, -69, 51, 40, -5, 69, -37, 2, 10, 57, -53, -1, 7, 48, 2, -68, 62, -46, 5, 7, -35, -66, -60, 41, -76, 73, -18, -37, -40, -70, -33, -7, 18, -38, 70, -47, 12, -13, 26, -14, -41, -41, -38, 13, 60, -69, 20, -52, 54, -36, -12, 11, -24, -72, 11, 31, 56, 23, 22, -28, -37, 21, -44, 28, -27, -21, -19, 90, -34, 2, 0, -37, 22, -24, 19, -24, -55, -48, -2, 18, -31, 20, -9, -18, 24, -29, -49, -50, 6, -36, -49, -69, -48, -7, 21, 42, 38, -47, 21, 18, -20, 17, -24, -33, -1, 4, -27, 8, -18, 12, 39, -27, 4, 17, -71, -25, 14, -86, -49, 56, 76, -11, 18, -49, -21, 26, -22, 31, -12, 26, -11, -38, 11, 20, 14, -7, -28, 8, 36, -6, -35, 62, -57, 45, -8, 29, -31, -53, -62, 23, 3, 17, 37, -52, 10, 19, -40, -22, -55, -26, 52, -23, 28, -45, 22, -5, -47, 45, -36, 45, 73, -39, -4, -4, -35, -99, 45, 1, 1, 24, 35, -30, -13, 79, 42, -40, 52, -21, 33, 9, 9, -59, 68, -50, 42, -23, 19, 13, -8, -62, -17, 6, -18, 25, -48, 10, -42, -46, -25, 2, 37, -53, -20, 14, 41, -34, 6, -5, 51, 78, -46, 10, -29, 18, -2, -4, -63, -62, 26, 37, -11, -22, -6, 6, 26, 74, -36, -10, 26, -19, 0, -11, 62, -16, 29, -4, -27, 44, -13, 18, -5, 18, 52, 10, 65, -8, -61, 2, 16, -28, -62, 15, 32, -30, 43, 0, -68, -5, 73, 13, 27, 46, -48, 46, 69, 30, 38, 56, 97, 9, -6, -55, -76, -83, -29, 6, 18, -38, 77, -48, 79, -23, 7, 13, 42, 58, -27, -22, -1, 9, -5, 76, -20, 23, 61, 14, -33, -18, -84, 20, 60, 0, -60, 32, 72, 37, 5, 36, 42, -43, -7, 19, -54, 91, 18, 41, -90, -60, -36, -44, 53, -9, -66, -16, 53, -66, 0, -52, -55, 39, -52, -15, -23, -31, -21, -34, -3, 72, 33, -42, 13, -32, 74, 8, -81, -2, -29, -3, -21, 61, -29, -29, 1, 58, -7, -16, -5, -32, -14, -4, 56, -4, -42, 13, 8, -36, 38, -90, 14, 65, 6, -31, -67, 29, 21, -97, 79, -25, 0, 21, -16, -50, 33, -23, 17, -48, -52, -47, -14, -70, -76, 20, -5, -14, 7, -54, 0, 33, 21, -89, 70, -21, -64, 38, -62, 33, -11, 13, -84, 44, -27, 24, 28, 45, 19, 50, 87, -30, -26, -69, -15, 79, -8, 59, 40, -4, -27, -65, -5, 49, 3, 26, 27, 12, -5, 20, 10, 44, 9, 36, -3, -10, 53, 47, 50, 41, -36, 21, -28, 22, -36, -8, 89, -25, 23, 25, 34, -1, 15, -14, -23, -63, 7, 6, -11, -42, -3, -3, -11, 90, 42, -46, -21, -6, 52, 23, -58, -25, 16, -25, 5, 19, -34, -50, 0, 5, -3, -19, -86, 12, -17, -65, -54, -27, 58, 38, -53, 37, 47, 24, -37, -44, -56, 36, -45, 37, 41, -86, -8, -5, -18, -37, 13, 7, 49, -49, -29, -10, -5, -30, -16, 23, 22, -32, 4, -48, 20, -24, -29, -8, 9, -76, 41, 11, -27, -58, -2, -42, 29, 50, -69, 12, -30, 37, -36, -19, -32, -45, -1, 57, 58, 78, -13, -50, 36, -11, 28, -3, -45, 6, -35, 42, -7, 14, -13, -11, 10, -2, 51, 32, 3, 3, -19, 39, -5, 4, 89, -1, 2, 44, -8, -82, 50, -37, 47, -43, -12, -79, 44, -8, -36, 26, -55, 7, -37, 39, -77, 48, -54, 44, 14, 55, -31, 18, 24, -64, -18, -74, -22, -11, -32, 30, 5, -53, 5, -5, 40, 38, 31, -20, -81, 2, -5, -94, -22, 28, 10, -64, -8, 60, 89, 23, 22, -19, -16, 37, -14, 57, 30, -12, 69, 31, -59, -17, -74, -10, -72, -2, -34, -56, 43, 39, -15, 28, -75, -20, 11, 14, 35, 11, -27, -65, -10, -57, 10, -13, 30, -95, -50, -17, 36, -56, -48, -18, 16, 60, 4, -65, -37, 41, -54, 52, 43, 37, 36, -37, 79, -52, 18, -38, -6, -44, 37, 17, -29, -23, 19, -63, -31, -58, -8, 14, -69, 2, -44, 35, -14, -17, 47, -1, -55, 23, 12, -27, 9, -35, 31, 1, -53, -12, -7, 50, 19, -5, -34, 48, -23, 66, -7, 16, -23, -71, -27, 32, 55, 2, -60, -47, 55, 2, -3, -6, -76, 57, 16, 11, 21, -1, -29, 0, 1, 56, -18, -3, 54, -4, -25, -51, -64, -7, -2, 56, 39, 53, -17, -19, -8, 1, 49, 30, -44, -16, 17, 3, -15, -73, 0, -32, -53, -24, -39, -15, -8, 25, 36, -52, -49, -22, 29, -7, 15, -26, -70, -20, -43, -32, 34, -20, -19, 10, -52, 70, -23, -45, 78, -66, 9, -79, -13, -54, -34, 41, -66, 20, 15, -94, 7, 53, -39, 25, -9, -1, -14, 5, 12, -40, 27, 35, 41, 33, -73, 38, 10, 23, -6, -66, 50, -5, 7, -3, -8, -1, 17, 44, -8, 85, -30, 29, 38, 44, -31, 47, -37, 61, -24, 67, 38, -51, -36, -49, 3, -6, -43, -10, 64, -37, 37, 50, -20, 21, 1, 21, -15, 22, 54, 7, -37, -35, -35, -9, 10, -7, -35, 6, -36, 58, -33, 47, -2, -59, 30, 11, 15, -1, 33, 22, 57, 60, -2, 35, 23, -16, 12, -7, 40, -1, 12, -56, 27, -47, -41, 35, 43, -24, 14, 41, -27, -22, -3, 37, -14, 7, 10, 2, 39, 9, -27, 46, 39, -49, -11, -21, -45, -22, 6, 28, 31, 50, 89, 46, 57, -5, 0, 33, 18, -20, 53, -4, 8, 19, 61, 2, -40, 8, -56, 1, 59, -24, -41, 16, 34, 7, 8, -82, -3, -23, 25, -44, -15, -29, -74, 33, 0, 47, 3, 83, -16, -62, 32, -7, 8, 8, -32, 16, 16, -84, 20, -65, -7, 89, -29, -16, 48, 4, 9, -24, -74, 1, 19, -54, -1, -8, 38, -16, 8, 14, 8, -4, 52, -1, 36, -11, -6, 33, 15, 53, 9, -51, -80, -4, -12, -7, 14, -13, 48, 81, 19, -15, 66, 49, 34, 41, 62, -8, -20, -59, 80, -32, -71, 9, -4, -44, -61, 37, 13, -52, 8, 50, -36, 33, -27, 44, 60, -37, -61, -7, 0, -5, -23, -31, -62, -23, -20, -18, -87, 33, -33, 59, 39, -83, -4, -85, 57, -34, 28, 38, -62, 63, 46, 56, 34, 14, 4, 6, 40, 48, 4, 6, 11, 67, 60, 20, -5, -56, -37, -21, 54, 48, -13, -56, 92, -17, -80, -16, 11, -32, -34, -12, -26, 5, -34, -43, 1, -68, -45, 47, 21, 46, -1, 59, -49, -2, -45, 9, -1, -43, 31, -24, 33, -71, -12, 79, 27, 47, 69, 29, -46, -36, -38, 50, 59, 41, 37, -1, -64, -6, -60, 28, -61, -8, 7, 12, -18, 30, 5, 33, 10, -81, -31, 20, 37, 34, 13, 72, 11, -24, -48, 16, -23, 28, -69, -25, -21, -20, -54, -19, -4, -13, 11, 2, 1, -29, 33, 26, -25, 59, -21, -14, 35, -39, 6, 33, 9, -20, -18, -11, 99, 2, -66, 18, -24, -53, 15, -7, 2, -34, -52, 12, 70, 20, 31, -68, -47, -20, 6, 6, -31, 22, 20, 3, 6, -28, 11, -14, -23, -44, -73, -40, -43, -16, -10, 45, 21, 52, -34, -37, -33, 23, 47, 37, -17, 2, 2, -49, -73, -7, 21, -36, 10, -3, -21, 0, 33, 46, -19, 16, 8, 36, -47, 28, 6, -12, 8, 5, 54, 5, 8, -27, 31, 38, -53, 11, 21, 8, -22, 70, -31, -7, 18, 40, 41, -41, 12, 24, 29, 10, -40, 49, -7, 57, 47, 0, -27, -4, 12, -12, -19, -10, -28, 6, -29, 8, 2, 5, -69, 11, 54, 10, 0, 3, -14, 2, 36, 38, -50, 9, 5, 4, -14, -34, 3, -14, -5, 45, 25, -65, 60, 17, 35, 16, -17, 0, -54, 27, -31, -36, -22, -27, -5, -93, 78, -15, -65, -5, 43, 24, -71, 0, 56, -45, -14, 47, -50, -14, -34, -81, 32, 12, 37, 30, -17, -55, 6, -18, 77, -72, -5, 59, 8, 11, 4, 2, 17, 58, -27, -10, 19, 48, 32, -31, 20, -46, 36, -49, 1, -9, -21, -31, 46, 2, -34, 19, 32, 0, -30, -16, -18, 44, -44, -47, 9, 7, 15, 27, 67, -47, 18, -14, 49, 5, -8, 63, -4, -10, 6, -4, -30, 23, -70, 51, -60, -7, -52, -10, -7, -12, 38, 25, 2, -14, 69, 32, -4, -11, -48, -38, -32, 3, -23, -8, -45, -26, -33, 13, 22, 15, 39, 12, -31, -23, -30, 4, 48, 35, -6, 10, -59, 75, 35, -25, 2, -72, 29, 3, -10, -10, 46, 42, 24, -1, 12, -21, 11, 12, -11, 50, -101, -30, 2, 38, -72, 63, 52, 49, 52, 41, -64, -42, -63, 46, 2, 72, 54, -15, 46, 17, -64, -12, 26, 30, 75, 34, 40, 13, 25, 22, 46, 75, 33, 53, -17, -48, -33, -20, -5, 14, 24, 4, 12, 29, -5, 16, 16, 2, -1, -1, -49, -13, 19, -37, -25, -9, -9, 83, 52, -42, -47, 1, 28, -46, -14, -39, 38, 2, 21, -32, -55, -56, -5, 5, 5, -46, -49, 8, -5, 49, -22, -35, -16, -56, -24, 18, 47, -18, -29, 27, -2, 29, 33, 20, -10, -57, -16, -4, -22, 3, 9, 17, -25, 26, 12, 1, 67, 3, 0, 8, -18, -27, -4, 8, 86, 12, -54, -73, -45, 14, -41, -9, 4, 86, -59, -62, -8, 0, 39, -34, 41, 12, 19, -50, -21, 75, -45, -24, 13, -65, 6, 99, -7, 32, -46, 42, -46, -8, 41, -39, -34, 16, -26, 63, -59, 11, -58, -10, 64, -30, -20, 67, 61, 22, 20, 60, 30, 9, 26, -44, -13, 4, -23, 43, 4, -4, 7, 28, 3, -18, 13, 50, 5, -17, -41, -7, -42, 30, -9, -8, 4, -23, -19, -17, 25, -60, 24, 44, 26, -36, 36, -55, 29, -17, -53, 72, 51, -34, -8, 31, -11, -9, -24, -34, 2, -24, -16, -40, -22, 8, -3, -48, 16, 14, -23, 39, 53, -39, 9, 63, -72, 53, 22, 26, -45, -50, 15, -27, 19, -10, -42, -23, -20, 0, -39, 8, 41, 47, 55, 32, 8, 8, 24, 8, 59, 84, 0, 69, 7, -4, 64, -17, -10, 24, -36, 59, -60, -18, -79, -16, 53, 17, 22, -16, 9, 29, -37, 57, 48, 42, 9, 18, -86, -47, -33, 0, 6, -9, 51, -38, 36, -66, 38, -82, 32, -27, 31, -6, -85, 17, 18, -56, -27, -10, 39, 13, 14, -14, 61, -34, 79, -8, -5, -52, -59, -62, -20, -14, 52, 26, 8, -4, -10, -30, 17, -25, 69, -48, 16, -6, 43, 5, -1, -21, -13, -64, 13, 17, 19, -18, -11, -43, -17, 34, 50, -41, 40, 14, -28, 39, 12, 34, -4, -14, 16, -8, 21, 11, 5, 36, -4, -18, 37, -28, -34, 16, 9, -2, 5, 10, 4, -3, 53, -24, -49, 19, 5, 64, -10, -71, 5, -59, -27, -50, 56, 77, 24, -2, -64, 1, 13, 12, -25, 16, 19, 30, -16, -62, 27, 46, 14, 26, -46, -69, -29, 7, 18, 23, 41, -39, -62, 20, -59, -5, -34, 25, -33, -53, -14, -30, 33, -45, -13, -5, -18, 20, 27, 19, -64, 20, -32, -47, 5, 32, -30, 21, -53, 2, -73, 18, -53, 3, 31, -25, 27, -28, 0, 25, -51, -27, -19, 41, 50, -18, -45, -34, -42, 42, -76, 28, -2, 53, 52, 56, -30, 26, -25, 20, -55, -4, 24, -13, 50, 50, 2, 27, -8, -8, -34, -18, -10, 43, 0, -10, 11, -17, -8, 6, 22, -29, -50, -5, 33, 68, 17, 30, 30, -1, 5, 5, -33, 8, -7, -1, 13, 23, 24, 44, 14, -51, 42, -37, -8, -51, 8, 12, -13, 13, -84, -44, -20, -75, 86, -67, 75, -13, -57, 39, -7, -12, -39, -44, -12, 8, 0, 32, -6, -46, -15, -62, 22, 44, 38, -70, -14, 35, 34, 12, 25, -27, 19, 13, 48, -22, 24, -73, -12, -8, 15, -5, -40, -5, 2, 47, 32, -7, 50, 42, -23, 8, 40, -13, -70, 3, -52, -70, 43, 9, -37, -35, -12, -35, -7, 6, 40, 9, 19, -1, 31, -65, 33, 9, -27, -29, -21, -29, 72, 27, -59, 60, 51, 20, -32, -1, 47, -3, -47, 4, -36, 36, -75, -3, -61, 20, -55, 45, -50, -19, 18, 15, 29, 61, 19, 29, -14, 41, -26, -47, 47, -9, -24, -5, 13, -30, 29, 14, -28, 21, -37, -44, 50, 38, -31, -7, 9, -59, 31, -32, -49, -32, -55, -39, 85, 41, 42, 7, 52, 3, -97, 88, 20, -61, 28, -74, 39, -6, 22, 42, -14, -55, 44, -50, 14, 25, -1, 34, -71, -50, 11, 41, 60, 19, 39, -39, -15, 37, 24, -95, 28, -44, 54, -36, 18, 28, -74, 80, 3, 54, 16, 35, 8, -44, 46, 19, 18, -63, -48, 40, 12, -11, -58, 16, 2, 18, 30, 27, -2, -68, 31, 49, 36, -9, 35, -50, 26, -35, -21, 19, -33, 5, -39, 25, 16, -16, 23, 70, -7, 10, -40, -24, 16, -17, -21, -19, -45, 2, 20, -39, 0, 41, -7, 7, 26, -16, -2, -73, 15, -5, 29, -51, -55, -54, -16, 15, 10, 10, -26, -21, 29, 39, -3, -5, -34, 1, -10, 10, 11, 76, -84, 18, -41, -54, 17, -22, 59, 34, 31, 42, 3, -15, -41, -53, 7, 53, -2, 50, 1, 19, 46, -7, -47, 22, 32, 55, 97, -53, -19, -22, -68, 6, -79, -3, 48, -9, 55, 14, 26, 4, -29, 25, -7, 24, 4, 32, 65, -33, 5, 1, -10, -17, -14, -24, -14, -48, -28, -72, 77, -30, -57, 38, 54, 2, 31, -13, 44, 11, 96, -13, -17, 52, -11, 31, 55, -17, -10, -55, 70, -10, -56, -5, 11, 18, 13, 68, -58, 41, -58, -16, -16, -39, 64, -50, -12, 15, 70, -23, 35, 52, -18, 0, -36, -48, -15, -37, -9, -64, 16, 18, 17, 24, -30, -23, -27, -8, 36, 29, -11, 42, 28, 29, -15, 40, 16, -25, -69, 49, 81, -9, 82, -36, 9, -53, -19, 41, 9, 47, 5, 78, -32, -20, 30, -38, -17, -36, -28, -46, 20, -19, 33, -27, -18, 5, 27, 1, -7, -77, 22, 14, 50, 44, 49, -10, -15, -40, 19, 28, 47, 16, -19, 34, 6, 17, 17, 42, 14, 50, 24, 24, 70, 10, 1, -86, -20, -61, 16, 11, 63, 51, 27, 45, 45, 20, -5, 17, -16, 34, -13, 16, -18, 2, 23, -38, -4, -16, -4, -36, -22, -32, 72, 32, 7, -39, -3, -64, -28, -7, -29, 19, 39, -47, -7, -29, -68, 16, -12, -13, -29, 9, -33, -18, 50, 36, -49, 25, 45, -3, 42, 67, 33, -17, -34, 46, 0, -78, -12, 6, -14, -31, -47, -30, 55, 33, -40, 61, 24, -3, -39, -95, -69, -9, -55, -76, -33, 3, 16, -63, 57, -19, -14, -83, -8, -18, 68, 0, 30, 65, -75, -42, -23, 26, 71, -10, 2, 14, -17, -43, -34, 33, 2, 12, 26, -23, -30, -12, 77, -28, 12, 26, -24, 54, -30, 12, -8, -24, -1, 12, -24, 44, 39, 32, -8, -30, 1, 10, -14, 4, 65, 14, -39, 34, -49, -1, -54, -65, 62, 31, 13, 34, 47, 20, -76, 54, 6, 21, 42, -25, 36, -49, -4, 34, -28, 6, 21, -56, -38, 6, -10, 13, 21, -64, 22, 29, 14, 6, 37, 16, 51, 31, -40, 81, 1, -54, 15, -25, 21, 52, -19, 12, 13, 82, -1, 10, -12, 34, -42, 34, -42, 7, 18, -64, 16, -19, 2, -7, -5, 65, -53, -16, -18, -23, -15, 9, -9, 31, 33, -57, 13, 83, -30, -68, 26, 57, -7, 55, -30, 40, 65, -56, -35, -51, 41, -39, 33, -20, 31, -18, 12, -35, 65, 35, 18, -65, 36, 0, -1, 29, 37, 16, 28, 31, -40, -54, -59, -27, 8, 12, -38, -51, -49, 26, -25, 0, -46, -21, 43, 41, 18, 10, 35, 34, 21, -3, 38, 6, -10, 31, -14, 1, 33, 4, 22, -37, 7, 18, -61, 45, -8, 26, 26, -34, 19, 41, -13, 8, -6, 7, 12, -53, -12, 19, 42, -69, 3, 68, 1, 10, -41, 52, 48, 21, 9, 26, 37, -79, -75, -33, -19, 35, -4, 32, 14, -37, -50, 16, 70, -18, -5, 43, 31, -15, -21, 35, 37, -41, -27, -27, 61, -74, 25, -11, -25, -7, 47, 59, -18, -51, -81, 1, 15, -54, 67, -29, 58, -35, -64, -40, -84, 57, 14, -29, 13, -14, 20, 44, -13, -15, -8, -45, -31, -38, 43, -42, 41, 19, -59, -29, 54, 13, -26, -5, -28, -32, 22, -52, 59, 54, 15, 14, -59, 30, 46, 4, -24, 70, 9, 50, 24, -22, 17, 61, 61, 46, -8, 0, -31, 10, 63, -20, 1, 22, -14, 1, 24, 2, -17, 48, 21, 37, 20, 26, -24, 44, -25, 32, -21, -9, -35, 1, 55, -39, 70, 10, -55, -16, -30, 32, -24, 30, 50, -17, -15, 28, -16, 20, -18, 7, 0, 2, -1, -21, 37, -22, -2, 8, -3, 25, -68, -3, -31, -1, -14, 23, 11, 9, 11, 13, 24, 17, -44, 33, -25, 23, -11, 77, 70, -29, 5, 20, 20, -78, -41, -30, -37, -19, 30, 81, 67, 16, -27, 0, -62, 47, 19, 19, 53, -23, 48, 20, -43, 46, -39, 35, 46, 46, 27, 24, -42, -10, -13, 7, -47, -42, 11, 3, 45, -54, 23, -19, -19, 45, 30, -20, -45, -13, 17, -46, -48, 26, -73, 56, 0, 9, -48, -8, 36, -10, -4, -60, -42, -19, 60, -73, -34, -20, 30, 57, 35, -29, 6, -45, -40, 53, 43, 20, -15, 21, 37, -17, -18, 23, 25, 38, -16, 21, -50, 1, -35, -24, -5, -47, 54, -8, -13, 13, -11, -31, 0, 7, 52, 29, 6, 19, -43, -4, 41, -44, -45, 48, 62, 11, 21, 15, -45, -11, 69, 4, -3, 26, -37, -39, 0, -19, 25, -56, -68, 86, 42, 29, 19, 58, 21, 1, -14, -11, 0, 3, 10, 51, 22, -3, -9, -27, -11, 41, 47, 37, -46, 12, 36, 69, 12, -4, -40, 66, 20, -52, -28, 78, -24, 2, 31, -12, -28, -27, 16, 6, 26, 18, 44, -1, -37, 42, 25, 25, -33, -32, 68, -56, -44, 35, 10, 13, -54, -9, -33, -15, 72, 4, 27, -33, 4, 59, -12, -4, -43, 74, -17, 3, -37, 17, 33, 23, 13, 0, -34, 25, 51, 10, 11, 4, 16, 40, 62, -9, 5, -29, -39, 31, 3, 17, -50, -3, 1, 19, 41, -13, 12, 35, 28, 33, -26, 55, -14, 43, 47, -2, 15, 12, -44, -8, -36, 54, 41, -15, -20, 46, 55, 0, -43, -12, 34, 55, -7, 3, -74, -45, 49, -4, -58, -44, 58, 2, 83, -54, 66, 37, 45, -50, -36, 2, -25, 33, 61, 10, 6, -22, 37, -2, 31, -67, 57, 28, 34, 18, -35, -53, 81, -29, -27, -22, -23, -11, -49, -27, 91, -5, 39, -19, -23, 7, -12, 6, 36, 23, 26, -50, -67, -4, -59, -6, -4, 7, -49, 98, 50, -13, 29, -1, -49, -20, 36, -41, -6, 80, -26, -6, 5, 46, 51, 24, 29, -15, -64, -27, 66, 53, -19, 40, -34, -24, 6, -15, 22, 18, 22, 9, 18, 59, 71, 0, -35, 38, -17, -1, -22, -69, 64, 27, 21, -24, -16, 1, -8, -25, 8, -18, -8, 40, 29, 41, 78, 29, 59, 24, 13, -39, -15, -17, 20, 17, -52, -3, -9, 42, -46, 7, -36, -30, -27, -10, -61, 28, -13, 52, -6, -11, 95, -77, 8, -24, 42, -12, 68, 37, -57, -36, -42, -44, 4, 35, -25, 4, 23, -12, -16, 62, 12, -12, -40, 8, 32, 40, -73, -28, -61, 51, 8, -73, 3, -15, -24, -37, 7, 3, 50, 16, 83, -76, 19, 12, 13, 22, 36, -21, -2, 55, -18, -6, 0, -6, -45, -36, 23, -38, -2, 25, -12, -6, -34, -31, 26, 35, -9, 48, -6, 6, 17, -42, -18, -16, 9, 46, 14, -8, -51, 24, 3, 55, 19, 56, 49, -61, 30, -42, 5, -36, 24, -36, -10, -15, 4, 7, 56, -44, 38, 17, 33, -17, -47, -8, 74, -14, -39, -19, 47, -47, 18, 14, -36, -44, 70, 14, 3, -21, 12, 23, -48, -22, -21, -6, 65, -54, 35, 55, 73, -24, 1, -20, 13, 63, -52, 37, 34, 36, 7, -57, 79, -16, -91, -55, -59, -52, 22, 18, -13, -49, -2, -3, -12, 4, 40, -66, -2, 65, 35, 11, -29, -9, 6, 56, 0, 47, -25, 0, -9, 5, -12, -26, 10, -38, 9, 17, -8, 20, 28, -41, 56, 83, 32, -28, 46, 33, 10, -54, 10, 48, 23, 21, -38, -2, -79, -11, 50, -33, -40, -19, 73, -20, 14, 16, -42, -60, 6, 33, -5, -8, -18, 5, -4, -28, -29, 0, 55, -21, 4, 25, 0, 14, -72, 28, -34, 1, -45, -36, -60, 3, -9, 19, 13, 60, 3, 5, 7, 50, -26, -59, -40, 48, 22, -38, 19, 18, -10, -3, 21, -67, 50, 37, -20, -21, -29, 26, 66, 15, 2, 29, 16, -4, 37, -41, -78, 28, -36, 11, 82, 58, 20, 24, 20, 24, -42, 10, 0, 1, 11, 11, 68, -25, 3, 13, -22, 2, 71, -47, -45, 0, 71, 17, -19, 5, 51, -78, 52, 2, 70, -26, 24, 34, -40, 38, 6, 36, -16, -18, -16, -2, 43, -4, 28, 48, 41, -45, 52, 36, 27, -45, 10, -6, 29, -13, -63, 26, -16, 30, 55, -50, -11, -6, -30, 33, -18, -7, 23, 25, 19, -29, -8, 74, 32, 20, -40, -20, -9, -63, 13, 24, -23, 6, -17, 12, -74, 37, 19, -2, 32, 35, 0, 34, 2, -7, 15, 15, -47, -53, 5, -8, -5, -41, 5, -4, 18, -29, -28, 25, -17, -12, -2, -23, 11, 31, 4, 15, 38, 25, 4, -62, 7, 18, -53, -89, 60, 16, -5, 49, -71, -91, 52, -42, -33, -20, -72, 46, -6, -16, 10, -43, -25, -19, 68, -17, -55, 17, -21, -82, 28, -70, 9, -32, -26, -30, -36, 64, 16, -52, 38, -12, 62, 34, 52, -64, 27, 24, 44, 29, 54, -14, -80, -31, 72, -11, -36, -1, 5, -7, -38, 38, 23, 24, -21, 18, -28, -53, -23, -78, -41, -54, 34, 58, 0, 16, -36, -9, 5, -5, 31, 2, -79, 55, -21, 50, -31, -7, 21, 30, -19, -35, 71, -8, 16, -2, 64, -2, 24, -10, -10, -39, -28, 12, -47, 16, 17, 72, 6, -31, -21, -82, -13, 45, -4, -1, -71, -32, -18, -66, 19, -33, 64, -5, 19, -23, 30, 20, -12, -34, -55, -52, 68, 55, -13, -47, -8, 47, 17, 11, 6, 69, -5, -48, -29, 6, -46, 73, -42, 25, 76, -55, 63, -28, -27, -35, 48, -20, -38, -85, 42, -25, 18, -22, -5, -43, -42, -19, -36, 14, 56, 15, 39, -25, 11, -31, -17, 18, 22, 3, 35, -41, -59, -33, -11, -42, 42, -3, 26, 36, 41, 48, 5, 12, 5, 64, -43, -9, -28, 49, -30, -19, 20, -4, -18, -39, 2, 13, -32, -8, 34, 0, -22, 35, -47, -23, 10, 21, 33, 3, -60, 24, -22, -5, -5, 9, 34, 63, -50, 40, -37, 27, -28, 39, 23, 33, 70, -50, -26, -18, -17, -31, 38, -57, 3, 52, 36, -42, 9, -24, 27, -9, 4, -29, 10, -19, 25, -19, -5, 1, 19, -14, 18, -6, -14, -7, 87, 1, 21, -3, -4, -35, 1, 14, -13, 67, 39, -29, 12, -17, 42, 6, 19, 4, -75, -22, 87, -36, -21, -26, 13, -8, 32, 6, -78, 23, -36, 48, 25, -2, 53, 8, 65, 59, -6, 90, -17, -35, -13, 52, 41, -78, 43, 11, 0, 39, 28, 19, 37, -70, 26, -48, 0, -46, 50, 40, -1, -29, -39, 21, -1, -9, 6, -13, -54, -27, 17, -40, -10, 8, 75, -27, -49, -13, -39, -20, 49, 15, -12, 46, 18, -29, -16, -3, -82, -17, 23, 47, 20, 25, -21, -2, 15, 25, -58, -30, -65, -35, -14, -16, -5, 29, -5, -29, 5, 16, -25, 42, 20, 0, -68, 31, -14, -19, -7, 58, -10, -63, 43, -7, -15, -8, -73, 2, -48, -24, -51, 38, -56, -18, -7, 41, 40, -21, 64, -80, -13, -93, -1, 55, 30, -16, -50, -12, -57, 12, -29, 19, -17, -28, 18, 5, 21, 11, -53, -56, 80, -18, 60, -18, -66, 44, -2, 16, -6, -60, 19, 4, -7, -25, 22, 14, -8, 18, 29, -21, 12, 61, 10, 2, -22, 14, 4, 24, 24, 31, -11, 3, -25, -21, 52, -36, -30, 69, 39, -12, -36, 30, 85, 26, -25, -28, -23, -27, 10, 32, 22, 48, -17, -19, -9, -30, -78, 58, -3, 24, -49, 5, 19, -51, 20, -36, 24, 20, 11, -40, 22, 25, 15, 10, 22, -11, 46, -27, 3, 65, -53, -51, -2, -16, -3, 29, 57, 0, -21, 5, -2, -80, 38, 9, -25, 63, -51, -13, 41, -2, -89, -42, 15, -15, 30, -21, -9, -96, -32, -8, -59, 36, 20, 55, 26, -28, 32, -39, 39, 14, 35, 17, -8, 21, 1, -71, 2, -12, 29, 24, 45, -20, 22, -52, -3, -40, -6, -8, -39, -37, 20, 22, -16, 8, -18, 25, -11, 21, 38, -54, -43, -7, 34, -83, -45, -39, 23, 5, 66, 11, 26, -3, 55, 38, 14, 39, -24, -25, -55, -38, -5, -16, 68, -24, -11, -57, 7, 41, 55, -12, -58, 27, 50, -38, -6, 57, -10, -5, 19, 15, 42, -37, -41, 35, 70, -61, -34, 25, 31, 46, -27, 19, -62, -29, -42, -2, -9, 15, -43, -1, -40, -48, -14, -11, -18, 12, 18, -3, -48, -11, -16, 11, 19, 48, -34, -14, 18, -36, 66, -16, 29, 25, 14, 50, -91, 55, -4, 8, 45, 79, 18, -20, -16, 17, -8, 27, -42, -11, 11, -4, -22, -54, 44, 8, 35, -3, -75, 11, -59, 3, -59, 57, -12, -9, -36, -77, -2, -2, 4, 32, -62, -6, -44, -14, 8, -34, 59, 49, 69, 2, -69, -64, 41, 18, 54, 9, -61, 7, 18, 42, -3, 53, 16, -2, 15, -16, 22, -32, 17, -35, 2, 22, 29, 9, -3, 9, 47, 38, -47, -4, 75, -13, 22, -46, -7, -24, 13, -43, -7, -52, -30, 13, 20, -12, 20, -10, -77, 1, 13, -13, 16, -8, -17, 21, -19, -57, 15, -43, 4, -4, 30, 22, -16, 31, 32, 40, 28, -11, 1, 55, 28, 7, -25, -30, -25, 5, -8, -70, -8, 5, 32, 35, -27, -59, 77, -34, -85, 5, 61, -37, -63, 52, 54, -47, -39, -36, -13, 68, 19, 25, 11, 14, 4, -23, -25, 19, 72, -8, -51, 27, -46, 31, 28, 8, -15, 33, -49, -9, 0, 9, 33, 35, -14, -49, 34, -47, -10, -37, 27, -25, -15, -1, 8, -44, 75, -15, 55, 42, 52, 6, -4, 46, -41, 3, -21, 29, 7, -5, 38, 68, 10, -35, 63, -41, -10, 3, 0, -1, 27, -21, 8, -24, 24, -42, 41, -54, 5, 0, 44, -30, 27, -32, -5, -47, -25, 8, 14, -40, -26, 61, 38, -16, -36, -51, 8, 38, -31, -67, -19, 18, 19, 48, -9, -2, -61, 33, -16, 18, 20, 25, 4, -2, -1, 25, 27, -8, 3, 22, -41, -55, -4, 17, -7, 10};
-
-const float layer_1_weights[12672] = {-0.10478589683771133, 0.034749213606119156, 0.086245097219944, -0.07528308033943176, -0.13841202855110168, 0.11172578483819962, 0.017822567373514175, 0.16890226304531097, 0.17143744230270386, -0.004937519785016775, 0.032083384692668915, -0.13060037791728973, 0.12094291299581528, -0.035436294972896576, 0.08362503349781036, -0.07415605336427689, -0.12528787553310394, 0.049255043268203735, 0.032217592000961304, 0.006954261101782322, 0.01933826319873333, -0.08196015655994415, -0.049770817160606384, 0.006016709841787815, 0.04745472967624664, -0.017793621867895126, -0.09948725253343582, 0.13063669204711914, -0.11003327369689941, 0.02768959105014801, -0.03766908496618271, -0.021634340286254883, 0.018137432634830475, 0.019326183944940567, 0.0927165076136589, -0.10156130790710449, -0.06828662753105164, 0.04537587985396385, 0.11644744127988815, -0.015480278059840202, -0.002802451141178608, -0.11382383853197098, 0.008007857017219067, -0.02260088361799717, -0.0409046970307827, -0.02658611349761486, 0.14008253812789917, -0.04161323606967926, -0.09332967549562454, 0.09175361692905426, 0.057635318487882614, -0.02288905158638954, 0.021919501945376396, 0.1065630093216896, 0.023237332701683044, 0.040404804050922394, -0.13709959387779236, 0.06045932695269585, -0.017651814967393875, 0.03330933675169945, -0.10543818771839142, 0.08545397222042084, -0.06417488306760788, 0.003626648336648941, -0.02794409729540348, -0.1448834389448166, 0.06015017628669739, 0.008363088592886925, 0.04502573981881142, 0.03982127085328102, 0.05645433068275452, 0.0023000456858426332, -0.026976369321346283, -0.10230651497840881, -0.07451419532299042, 0.07131638377904892, 0.03036918304860592, 0.061910197138786316, -0.12149673700332642, 0.0737847164273262, 0.06282168626785278, -0.032556384801864624, -0.006449414882808924, 0.03962457552552223, -0.10563139617443085, 0.019732950255274773, -0.019692637026309967, 0.003849846078082919, -0.001932651037350297, -0.020974790677428246, 0.036610137671232224, 0.017312081530690193, 0.03169337287545204, 0.09046787023544312, 0.020673133432865143, -0.07443308085203171, 0.07358461618423462, 0.03737476095557213, 0.00285977590829134, -0.04191024601459503, 0.036400165408849716, -0.15382374823093414, -0.08415988832712173, -0.0870988667011261, 0.04465256631374359, -0.10719364136457443, -0.06328793615102768, 0.011558379046618938, 0.06463579833507538, -0.03284158557653427, 0.09799879044294357, -0.014730097725987434, -0.1227126270532608, 0.01874733343720436, -0.03408890217542648, 0.10277838259935379, 0.08829537779092789, 0.07953768223524094, 0.10584878921508789, -0.05015093833208084, 0.07468964904546738, 0.04247776046395302, -0.0656576156616211, -0.04456225410103798, 0.047072820365428925, -0.00480633182451129, 0.11771384626626968, -0.020006364211440086, -0.12167157232761383, -0.010247689671814442, 0.10182676464319229, 0.14688383042812347, 0.0035532908514142036, 0.0330527201294899, -0.13215097784996033, 0.1501273214817047, 0.053029756993055344, -0.048735447227954865, -0.01106072124093771, -0.07316943258047104, -0.021408021450042725, 0.11489250510931015, -0.07534681260585785, -0.09130667895078659, 0.02493760921061039, -0.03011377528309822, -0.12376188486814499, 0.06517276167869568, -0.06159020960330963, -0.06741458177566528, -0.10318247228860855, 0.032968614250421524, 0.08149512857198715, 0.061243124306201935, 0.1223876029253006, -0.03601911664009094, -0.07279004156589508, 0.04028071090579033, 0.08295872807502747, -0.04361261427402496, 0.03787410259246826, -0.01601032167673111, -0.051216959953308105, -0.0943235382437706, -0.05451185628771782, 0.029414236545562744, 0.012414178811013699, 0.16497500240802765, -0.025275325402617455, 0.02355993539094925, -0.00040617032209411263, -0.027183344587683678, -0.04221329092979431, -0.0019804758485406637, -0.1029585599899292, 0.11117380857467651, 0.08647669851779938, 0.017294136807322502, -0.07634805887937546, 0.0023542812559753656, -0.204152449965477, 0.021120285615324974, -0.08636739104986191, 0.030209746211767197, 0.08742933720350266, 0.10364402085542679, -0.018295837566256523, -0.03985167667269707, 0.049523744732141495, 0.1307884156703949, 0.008531018160283566, -0.04783663526177406, 0.1558261662721634, 0.0162510983645916, 0.11728788912296295, -0.1252024620771408, -0.017410648986697197, 0.15327021479606628, 0.11421223729848862, 0.0606304369866848, -0.0005072355852462351, -0.01787775382399559, -0.03777239844202995, -0.04607338830828667, -0.13198569416999817, 0.10065486282110214, 0.10556405782699585, 0.006166335195302963, -0.11624202132225037, -0.12272382527589798, 0.0715642124414444, 0.02911859005689621, 0.04894804209470749, 0.06844008713960648, -0.08556497097015381, 0.007833115756511688, -0.03440564125776291, 0.032297249883413315, -0.08543440699577332, -0.01178264431655407, 0.007205250207334757, 0.07911429554224014, 0.0060795266181230545, -0.05500892177224159, -0.054915834218263626, 0.00018878209812100977, 0.07061637192964554, 0.11989586800336838, 0.06799706816673279, 0.008285164833068848, 0.020198579877614975, 0.1343878209590912, -0.017964022234082222, -0.07436560094356537, 0.021834950894117355, 0.0009682771633379161, 0.04027160629630089, 0.10880421102046967, 0.025215057656168938, 0.046101026237010956, 0.1144995391368866, 0.022069431841373444, -0.06995312869548798, -0.005089971236884594, 0.07306855171918869, -0.022701870650053024, -0.0004571139288600534, 0.10820067673921585, -0.041491877287626266, -0.054246336221694946, -0.07478242367506027, 0.04114433750510216, 0.03401189297437668, 0.04958145692944527, -0.053498782217502594, 0.09556623548269272, 0.025477172806859016, -0.03489893302321434, -0.040242839604616165, 0.10691935569047928, 0.005495586898177862, -0.0279442947357893, -0.060643862932920456, -0.12428240478038788, -0.1262510120868683, 0.0045275818556547165, -0.05617544800043106, -0.017266560345888138, -0.039857227355241776, 0.05028814822435379, -0.042322978377342224, 0.1174144595861435, -0.08406936377286911, 0.03740660846233368, 0.09792505949735641, -0.050868868827819824, -0.01904655620455742, -0.13463295996189117, 0.031433165073394775, -0.12470704317092896, 0.017545737326145172, -0.08871735632419586, -0.005334299057722092, 0.024574007838964462, 0.05835961177945137, 0.024700205773115158, -0.011912083253264427, -0.0936361625790596, -0.12120029330253601, 0.0632183700799942, -0.11080650985240936, 0.021181583404541016, 0.052970752120018005, -0.06322622299194336, 0.08248312026262283, 0.050860125571489334, 0.06272972375154495, -0.11140456050634384, 0.12522709369659424, -0.007431706879287958, 0.01880364678800106, 0.00399252912029624, -0.07335218787193298, 0.11584177613258362, 0.06151875853538513, -0.019156716763973236, -0.0798865556716919, -0.0014569973573088646, 0.06484300643205643, 0.03584139794111252, -0.10613302141427994, -0.01625390723347664, -0.0057997927069664, -0.05859259516000748, -0.03166666999459267, 0.06209246441721916, -0.054323721677064896, -0.04360999912023544, -0.03382418677210808, -0.03988135606050491, -0.07510045915842056, -0.10270623117685318, 0.033881016075611115, -0.017962859943509102, -0.03520391881465912, 0.12256468832492828, -0.1025339737534523, 0.15232501924037933, 0.15809622406959534, -0.10349047929048538, 0.036387473344802856, -0.03350440412759781, 0.1056121215224266, -0.009504564106464386, -0.11361649632453918, 0.050368666648864746, 0.10652323812246323, 0.0708155557513237, 0.07525079697370529, 0.07685273140668869, 0.05190524831414223, 0.023834990337491035, -0.10835108906030655, 0.02798321284353733, -0.07793939113616943, 0.12778189778327942, 0.00774213345721364, 0.10386399924755096, 0.04364916309714317, -0.019890444353222847, -0.07758653163909912, 0.0036720747593790293, 0.005185198504477739, -0.05608188733458519, -0.14461661875247955, 0.007053344044834375, 0.09563018381595612, 0.08363310992717743, -0.06466247141361237, -0.04993549734354019, 0.06978794932365417, -0.045145127922296524, -0.020236877724528313, -0.005853676702827215, 0.09669240564107895, -0.015820451080799103, 0.07174939662218094, -0.1013561487197876, 0.08929505944252014, -0.04751930013298988, 0.06052336469292641, -0.048405252397060394, 0.10857772827148438, -0.041246045380830765, 0.09708146750926971, 0.1211976632475853, 0.03746946156024933, 0.08304668217897415, 0.0354311466217041, -0.04183736443519592, 0.03958786278963089, -0.04218943044543266, -0.006502530537545681, 0.033772263675928116, 0.08480335026979446, -0.08315447717905045, 0.002725577214732766, -0.05437074229121208, -0.016625359654426575, 0.04329199716448784, 0.07325718551874161, 0.05218761786818504, -0.06065524369478226, 0.04100421443581581, 0.011951667256653309, 0.013928535394370556, 0.13500270247459412, -0.14864210784435272, 0.06933563202619553, 0.12371837347745895, 0.06163293123245239, -0.01918422430753708, -0.1427305042743683, 0.08817978203296661, -0.05266864597797394, -5.619143121293746e-05, -0.05120834335684776, -0.050710100680589676, 0.18489748239517212, 0.03986373916268349, -0.01044533122330904, 0.12564997375011444, -0.10294623672962189, 0.03410118445754051, 0.05443111062049866, -0.05429884418845177, 0.01138035487383604, -0.011475363746285439, 0.022197900339961052, -0.046575792133808136, 0.03696932643651962, 0.04715371131896973, 0.0623118095099926, 0.10772250592708588, -0.04906158894300461, -0.12582072615623474, 0.04428451508283615, -0.003437207080423832, -0.007076175417751074, -0.0029112771153450012, -0.03294999152421951, 0.08067427575588226, -0.034770991653203964, 0.05313798785209656, -0.010858646593987942, 0.103505440056324, -0.0010284777963533998, -0.01038017775863409, 0.12804065644741058, 0.10138141363859177, 0.10678926110267639, 0.061400093138217926, -0.13754354417324066, 0.026654763147234917, -0.19236750900745392, 0.02781732566654682, 0.0788349062204361, -0.0461963452398777, 0.03610914945602417, 0.013558091595768929, 0.047155290842056274, -0.13942557573318481, -0.09405101090669632, 0.05431787297129631, -0.1786579042673111, -0.05898125097155571, -0.047741033136844635, -0.05368616059422493, 0.062257591634988785, 0.14503388106822968, 0.08836529403924942, 0.03407924994826317, 0.06747805327177048, -0.0032915216870605946, -0.013157586567103863, 0.08893336355686188, -0.040598299354314804, 0.07081180810928345, -0.14198507368564606, -0.03458263725042343, 0.03685254231095314, 0.035544753074645996, -0.08961550891399384, -0.023961011320352554, -0.03258946165442467, 0.04481113329529762, -0.04100367799401283, 0.004406407009810209, -0.15640947222709656, 0.05576957389712334, -0.014085342176258564, 0.10635953396558762, 0.07602749764919281, 0.10310835391283035, -0.08676713705062866, 0.10602156817913055, -0.034963496029376984, 0.030931852757930756, -0.006220651790499687, 0.022312261164188385, -0.007696650922298431, 0.12749513983726501, 0.07645365595817566, -0.04571952670812607, 0.0568586103618145, 0.0033560895826667547, 0.1430322825908661, 0.07059333473443985, -0.032454632222652435, 0.017415424808859825, -0.013106769882142544, -0.03635101765394211, -0.09719651937484741, -0.12872838973999023, -0.06991612166166306, 0.036607805639505386, 0.046943873167037964, -0.07904444634914398, 0.056310273706912994, 0.005496707279235125, 0.0004265572060830891, 0.005982185248285532, -0.002969087567180395, -0.05477103963494301, -0.12611548602581024, 0.004227094817906618, 0.044389672577381134, 0.056728195399045944, -0.008588587865233421, 0.09283605962991714, 0.035700052976608276, 0.028981372714042664, -0.009967961348593235, 0.0016970490105450153, 0.016184981912374496, 0.045042723417282104, -0.04601961001753807, -0.004791051149368286, -0.057315997779369354, -0.049500927329063416, 0.0014361171051859856, 0.049950920045375824, 0.14740610122680664, 0.02256586402654648, 0.052145324647426605, -0.0870840921998024, 0.09562689065933228, -0.18804232776165009, -0.14989055693149567, 0.025164101272821426, -0.16283737123012543, 0.10722175240516663, 0.060050368309020996, 0.027133602648973465, -0.028731537982821465, -0.04654138162732124, -0.1332225501537323, -0.0816725641489029, -0.021053938195109367, 0.03421621769666672, 0.11214124411344528, -0.050418075174093246, 0.13891483843326569, -0.0022891280241310596, -0.012199614197015762, 0.0816243514418602, 0.005819298326969147, 0.011693255044519901, -0.054505206644535065, 0.006146552041172981, 0.08170775324106216, -0.019199777394533157, -0.07616806030273438, -0.001454891636967659, -0.03041602484881878, -0.031153662130236626, -0.03216519206762314, -0.03034221939742565, 0.06648364663124084, -0.07721779495477676, -0.0406380370259285, -0.007820123806595802, -0.09630903601646423, 0.053296491503715515, 0.026188286021351814, 0.03175055980682373, 0.028646882623434067, 0.11659087985754013, 0.04787976294755936, 0.09878071397542953, -0.14684231579303741, 0.10173296928405762, 0.05815081298351288, -0.028404073789715767, -0.06016980856657028, 0.09305978566408157, 0.030091779306530952, 0.034002795815467834, 0.13875629007816315, -0.11157289147377014, 0.029868517071008682, -0.02275564707815647, 0.08886084705591202, 0.12934637069702148, 0.10632206499576569, -0.08791879564523697, 0.008647643961012363, 0.01584276743233204, -0.026532651856541634, -0.03130480274558067, -0.006960664410144091, 0.154238760471344, -0.020767824724316597, -0.005523168481886387, -0.06241564080119133, -0.01710604503750801, 0.0978301465511322, -0.08836141973733902, -0.018401334062218666, -0.08393503725528717, -0.013017666526138783, -0.018596522510051727, -0.054901160299777985, 0.13011449575424194, 0.09344248473644257, -0.08674336224794388, 0.141923189163208, 0.1477089822292328, 0.05271356552839279, -0.11121205240488052, -0.01606595143675804, -0.07374799996614456, 0.03206687793135643, 0.03522484749555588, 0.03953079879283905, 0.0742039680480957, -0.005365912336856127, 0.09546247869729996, -0.08628085255622864, 0.09558964520692825, -0.12367285043001175, 0.05814061686396599, -0.009892504662275314, 0.01503076683729887, -0.0672733262181282, -0.1305350959300995, -0.061248358339071274, 0.014779599383473396, 0.0580640584230423, 0.05304529145359993, 0.04406309500336647, -0.026519188657402992, 0.03725926950573921, 0.03623279929161072, -0.032612208276987076, -0.045861780643463135, 0.024295950308442116, -0.023748712614178658, -0.06349299103021622, 0.043120499700307846, -0.04584603011608124, -0.008904818445444107, 0.0112281059846282, -0.020293980836868286, -0.013810291886329651, -0.02492559887468815, -0.010536128655076027, -0.10498163849115372, 0.08255862444639206, 0.04219943284988403, -0.001138116349466145, 0.032381851226091385, 0.02946150116622448, -0.06669522821903229, -0.045569516718387604, 0.08152256160974503, 0.16216345131397247, -0.11134488135576248, -0.1548427939414978, 0.032143864780664444, 0.13542906939983368, 0.03909427300095558, -0.14611037075519562, -0.07291026413440704, -0.05900665372610092, 0.06007404997944832, -0.050565194338560104, 0.008001870475709438, -0.038741689175367355, -0.027257507666945457, -0.02552373707294464, -0.16814443469047546, -0.15573272109031677, 0.05009640380740166, -0.01539874542504549, 0.086518794298172, 0.023177824914455414, 0.01785341650247574, 0.10163407027721405, 0.07785557210445404, 0.03555726632475853, -0.05044975504279137, -0.043907180428504944, 0.15732499957084656, -0.03957958146929741, -0.06523172557353973, -0.19115430116653442, 0.008529647253453732, -0.021321594715118408, 0.07451813668012619, -0.09110993146896362, -0.011734833009541035, 0.05270018428564072, 0.03869284689426422, -0.041436973959207535, -0.03586161136627197, 0.06013169884681702, -0.005051951855421066, -0.09202785789966583, -0.11898980289697647, 0.04829036444425583, 0.0109506631270051, 0.005399787798523903, 0.09071908891201019, 0.020550481975078583, 0.041075821965932846, -0.05683546140789986, -0.08408700674772263, 0.01691589504480362, -0.026898348703980446, -0.03892963007092476, 0.09039721637964249, -0.05163290351629257, -0.045450977981090546, 0.013229603879153728, -0.11671589314937592, 0.14785774052143097, 0.0895678699016571, -0.05228289216756821, -0.1067553162574768, 0.07952482253313065, 0.04534626379609108, 0.02840259112417698, 0.04661567509174347, -0.0011836281046271324, -0.0454917773604393, 0.07623118162155151, -0.025405118241906166, 0.0017535247607156634, -0.07392699271440506, 0.027541955932974815, -0.10406779497861862, -0.01195159088820219, -0.07621335238218307, -0.05464553087949753, -0.029224252328276634, 0.08505525439977646, -0.04333801940083504, 0.1268821656703949, -0.11324404180049896, 0.06558316946029663, -0.10718758404254913, -0.04140074923634529, 0.0018931739032268524, 0.038638222962617874, -0.08691461384296417, -0.07853095978498459, -0.0014925779541954398, 0.021776124835014343, 0.03790885955095291, -0.08072461187839508, -0.011817429214715958, -0.0022544744424521923, -0.06159505620598793, 0.07098563760519028, -0.03806905448436737, -0.038275983184576035, 0.06832486391067505, 0.03376492112874985, -0.02702510356903076, 0.09408285468816757, -0.03831953927874565, -0.031588345766067505, -0.046631328761577606, -0.038916200399398804, -0.13987548649311066, 0.08364713191986084, -0.006997444201260805, 0.05649522691965103, -0.048539645969867706, -0.00045764457900077105, 0.11697911471128464, 0.0870315283536911, -0.08239155262708664, -0.057864803820848465, -0.0016049901023507118, 0.07420071214437485, 0.01917426660656929, 0.007883028127253056, 0.08705133944749832, -0.037066370248794556, 0.05236446484923363, 0.014265242964029312, 0.07366324216127396, 0.014775434508919716, 0.03137720376253128, 0.04228711128234863, -0.05030946806073189, -0.05661720037460327, 0.11228523403406143, -0.0480487234890461, 0.011319201439619064, -0.010129380039870739, 0.08286163955926895, 0.03563424199819565, 0.13456062972545624, -0.07398051768541336, -0.18468931317329407, -0.09309380501508713, -0.08603084087371826, 0.047825079411268234, 0.04274890944361687, 0.0177041944116354, -0.08213162422180176, 0.07142899930477142, 0.0009772275807335973, -0.052483007311820984, -0.039974942803382874, -0.16050294041633606, -0.004148493520915508, 0.05320317670702934, -0.055666472762823105, -0.1337156742811203, 0.017093045637011528, 0.04781950265169144, -0.01358790136873722, 0.06582935899496078, 0.033075395971536636, 0.0327695868909359, -0.09165982156991959, 0.027353385463356972, -0.06318426132202148, -0.15062235295772552, 0.023924019187688828, -0.06660082936286926, -0.04006001353263855, 0.09654590487480164, -0.022934358566999435, 0.13995614647865295, 0.02048870548605919, 0.021775294095277786, -0.07668410241603851, -0.0004121723468415439, -0.005206263158470392, -0.04763892665505409, -0.022333331406116486, -0.007635816000401974, -0.07112624496221542, -0.12323398888111115, 0.060173772275447845, 0.13457335531711578, -0.12652891874313354, 0.11417306959629059, -0.02709961123764515, 0.05903477221727371, -0.018994225189089775, 0.11139203608036041, 0.047340378165245056, -0.11908512562513351, -0.08591713011264801, -0.02277948148548603, 0.014629987068474293, -0.1148161068558693, -0.15705110132694244, 0.09048792719841003, 0.01779913529753685, 0.02784620225429535, -0.113625168800354, -0.05747406184673309, 0.07484883069992065, -0.00789959728717804, 0.09923854470252991, 0.05382426828145981, 0.01701054535806179, 0.03859443962574005, 0.06829777359962463, -0.045213546603918076, -0.11065105348825455, -0.0830066129565239, 0.086311936378479, -0.014454122632741928, 0.015076233074069023, -0.0643560066819191, -0.04121579974889755, -0.020213516429066658, 0.04868130385875702, -0.14850683510303497, -0.0019877052400261164, 0.079471156001091, -0.0067582218907773495, 0.05666252598166466, -0.06375569850206375, 0.06991041451692581, 0.006446140818297863, 0.07865333557128906, 0.01802760176360607, -0.03583529219031334, 0.09320314228534698, 0.04603545367717743, 0.02070542611181736, -0.012768032029271126, -0.04816276207566261, -0.05115198343992233, 0.07325047254562378, -0.017948444932699203, -0.12784884870052338, -0.02088090591132641, 0.003904553595930338, -0.10508829355239868, 0.04220356419682503, -0.08872540295124054, 0.05220432206988335, -0.006412644404917955, -0.1079830527305603, -0.03788479417562485, -0.06861217319965363, -0.02999504655599594, 0.10533222556114197, 0.0045099505223333836, -0.024255648255348206, 0.02755126729607582, -0.045760683715343475, -0.0202390868216753, 0.021679861471056938, -0.026193957775831223, -0.011011687107384205, 0.10341208428144455, -0.04037100449204445, -0.07940078526735306, 0.07430554181337357, 0.11474023014307022, 0.17870600521564484, 0.10600865632295609, -0.046246979385614395, 0.14255249500274658, -0.143877312541008, 0.041037194430828094, -0.0033050370402634144, -0.10202699899673462, 0.13409805297851562, -0.008383993059396744, 0.022603362798690796, 0.003645130665972829, -0.08256662636995316, -0.0004532065649982542, -0.0426625981926918, -0.07836935669183731, 0.12734319269657135, -0.045782819390296936, 0.006625150330364704, 0.011087283492088318, -0.15327036380767822, 0.008182683028280735, 0.015338526107370853, -0.0012918461579829454, -0.04998970031738281, 0.05263629928231239, 0.1484457403421402, -0.005564587656408548, 0.03860251605510712, -0.16264291107654572, 0.18204626441001892, 0.04991612583398819, 0.09323663264513016, -0.10893579572439194, -0.0449819341301918, 0.020244820043444633, 0.006261616479605436, -0.010205627419054508, 0.0015865411842241883, 0.09476005285978317, -0.05929586663842201, -0.014049445278942585, 0.1671961545944214, 0.022903963923454285, -0.017665864899754524, 0.10015875101089478, 0.03480442613363266, -0.0024259130004793406, 0.05792893469333649, -0.048493679612874985, -0.008015304803848267, -0.07045840471982956, 0.1534535437822342, 0.08811526000499725, 0.08165238797664642, 0.01585226133465767, -0.08734026551246643, 0.09086496382951736, -0.10057412087917328, 0.20985311269760132, 0.022780340164899826, 0.05681610479950905, 0.004154453054070473, 0.09182485193014145, 0.0692732110619545, -0.042957402765750885, -0.06941268593072891, -0.010499408468604088, -0.036786410957574844, 0.002388925524428487, -0.031086556613445282, -0.1225634291768074, -0.15436092019081116, -0.03861252963542938, -0.01941644214093685, 0.12448705732822418, 0.0018727215938270092, -0.04720637947320938, -0.04908118024468422, 0.09125477075576782, -0.05380822718143463, 0.15823578834533691, -0.03219093009829521, 0.12642040848731995, -0.05363345146179199, 0.014758470468223095, 0.13374115526676178, -0.01785893738269806, 0.054189059883356094, 0.0088049890473485, 0.14149758219718933, 0.006473937071859837, -0.05406384542584419, -0.05347298085689545, -0.01702791638672352, -0.0142849525436759, 0.005188320763409138, -0.028423093259334564, -0.06308078020811081, -0.1077258363366127, -0.13507245481014252, -0.1147911325097084, -0.04204421490430832, 0.09300695359706879, 0.031738582998514175, -0.08983899652957916, 0.07195968925952911, 0.0014270961983129382, 0.05927378684282303, 0.02412627637386322, -0.020398057997226715, -0.011943627148866653, -0.10391084104776382, -0.08606807887554169, 0.07859339565038681, 0.019473792985081673, -0.14566542208194733, -0.08115462958812714, 0.08600879460573196, 0.10495449602603912, -0.02420826070010662, -0.11020869016647339, -0.0011806630063802004, -0.01706624962389469, 0.08819739520549774, 0.025040218606591225, 0.02227972075343132, 0.1377684324979782, 0.0780651792883873, -0.10383386164903641, -0.035068973898887634, 0.008215369656682014, 0.019578106701374054, -0.01645132340490818, -0.022760890424251556, 0.13303646445274353, 0.09646938741207123, 0.08339174836874008, 0.1916901171207428, -0.0577341765165329, -0.044828757643699646, -0.08510510623455048, -0.13943855464458466, 0.05833222717046738, -0.06933491677045822, 0.000960129254963249, 0.010614998638629913, -0.0796906128525734, 0.0718584880232811, 0.013444910757243633, 0.04956802725791931, -0.03629043325781822, -0.14243239164352417, -0.02597619593143463, -0.009072939865291119, -0.03184483200311661, 0.033903155475854874, -0.09481645375490189, 0.008529778569936752, -0.00432744761928916, -0.00406073359772563, -0.09343768656253815, 0.031144462525844574, 0.02694305032491684, 0.03864118456840515, -0.10368501394987106, 0.04045462980866432, 0.016819825395941734, 0.04381902888417244, 0.019633084535598755, -0.012065389193594456, 0.049185171723365784, 0.09354695677757263, 0.17518778145313263, -0.08943359553813934, -0.17261233925819397, -0.04310069978237152, 0.1122792661190033, 0.01723511517047882, 0.07027928531169891, 0.03690939024090767, -0.1739242523908615, 0.002070775954052806, 0.17365695536136627, -0.12796048820018768, 0.024130279198288918, 0.10011908411979675, 0.10185297578573227, 0.1631089597940445, 0.04687097296118736, -0.0001572615437908098, 0.0038516377098858356, 0.03249611705541611, -0.10978840291500092, 0.05248796567320824, -0.08501613140106201, -0.020366106182336807, 0.06616751104593277, -0.08226107805967331, -0.037274111062288284, 0.045356735587120056, -0.10155478864908218, 0.1469588577747345, -0.05022319406270981, -0.049630116671323776, 0.07343360781669617, 0.06080322340130806, 0.02210247330367565, -0.0867839828133583, 0.11994758248329163, -0.12167149782180786, 0.07329600304365158, 0.023146213963627815, -0.0002133999514626339, -0.1705383062362671, -0.08779948204755783, 0.04801761358976364, -0.028938475996255875, 0.12199865281581879, -0.09564020484685898, 0.10920336097478867, 0.012260504998266697, 0.05959603935480118, -0.0525655560195446, -0.10558951646089554, 0.08292512595653534, 0.08640816807746887, -0.12319736182689667, 0.035049036145210266, -0.05859476700425148, -0.004347654525190592, -0.1363370716571808, 0.03642953559756279, -0.09549088031053543, 0.07066625356674194, -0.05041317641735077, 0.048068784177303314, 0.05195988714694977, 0.007150544319301844, -0.11489913612604141, -0.005502928979694843, 0.0427158921957016, 0.042804867029190063, -0.11747565865516663, 0.042822789400815964, -0.03307051211595535, -0.01635674759745598, -0.053819384425878525, 0.076191745698452, -0.07784280925989151, -0.1055106669664383, 0.11287260800600052, -0.024654101580381393, -0.025485748425126076, -0.10684125125408173, -0.02756025828421116, 0.07308755815029144, -0.053545836359262466, -0.04628578573465347, -0.002276234095916152, -0.059363238513469696, 0.14329054951667786, 0.12700869143009186, -0.009105011820793152, 0.012353970669209957, -0.0779249519109726, -0.035286594182252884, 0.019991306588053703, -0.06834230571985245, 0.04607067629694939, -0.14079642295837402, -0.03545194864273071, -0.0682433471083641, 0.05464779585599899, 0.015425779856741428, 0.01627078838646412, -0.09178869426250458, 0.06351304054260254, -0.012704583816230297, -0.03394997864961624, -0.08001551032066345, 0.14175660908222198, 0.015023109503090382, -0.0583004504442215, -0.012732766568660736, 0.1724424511194229, -0.06195061281323433, -0.13571478426456451, 0.08646080642938614, 0.10187336802482605, 0.0081062912940979, 0.05634443461894989, -0.010699352249503136, 0.014697006903588772, 0.08811837434768677, -0.02057522162795067, 0.023594750091433525, 0.03677063807845116, 0.0140770822763443, 0.06167198717594147, 0.09228559583425522, 0.0637461468577385, -0.12745043635368347, -0.086290642619133, 0.03629806637763977, -0.10305511951446533, 0.09464848786592484, 0.04851343855261803, -0.03096754103899002, 0.07401826232671738, -0.14903171360492706, 0.02320924773812294, -0.021125225350260735, 0.0032543858978897333, -0.002518246416002512, 0.031479839235544205, 0.07692962884902954, 0.02953510917723179, -0.000968892709352076, 0.008717629127204418, 0.06905898451805115, 0.04655863344669342, -0.019619187340140343, 0.08331168442964554, 0.1578134298324585, 0.13948659598827362, 0.02559339627623558, 0.15114112198352814, 0.05215106159448624, -0.12453906238079071, 0.03927453234791756, -0.06639895588159561, 0.012690095230937004, -0.0906696766614914, 0.022032419219613075, 0.06520900875329971, 0.022171858698129654, -0.09516514092683792, 0.06757287681102753, -0.09620974957942963, -0.0903313010931015, 0.12549234926700592, 0.030057268217206, -0.061166856437921524, -0.13176169991493225, 0.08854016661643982, -0.01054645050317049, -0.07742989808320999, -0.1022837832570076, -0.019769571721553802, -0.039473406970500946, 0.056932609528303146, -0.03261423110961914, 0.10396934300661087, 0.13939408957958221, 0.13224244117736816, -0.10174882411956787, 0.10590364038944244, 0.018583087250590324, -0.04329058527946472, -0.11302164942026138, 0.014106799848377705, 0.006249002180993557, 0.022407984361052513, -0.018160667270421982, 0.018112320452928543, -0.10400153696537018, 0.08717857301235199, -0.014724320732057095, -0.13634257018566132, 0.06292306631803513, 0.07496577501296997, 0.030374741181731224, 0.00751891452819109, -0.05288591980934143, 0.11113143712282181, -0.10365330427885056, -0.012989254668354988, -0.03829749673604965, -0.020855620503425598, -0.09069447964429855, 0.013280677609145641, -0.013080918230116367, -0.041944585740566254, 0.09378568828105927, 0.002644388237968087, -0.061123982071876526, -0.05423044413328171, 0.03052673302590847, 0.03301908075809479, -0.00013056950410827994, -0.04149263724684715, 0.1185564175248146, 0.12059082835912704, -0.01234867051243782, -0.057877227663993835, -0.15315118432044983, 0.025951147079467773, -0.05734957754611969, -0.047117967158555984, -0.12811942398548126, 0.06842425465583801, 0.07327571511268616, -0.15180139243602753, -0.12481750547885895, 0.05707307532429695, 0.0017801024951040745, -0.008023620583117008, -0.0454535111784935, -0.060389623045921326, 0.11711061000823975, -0.06869690120220184, -0.10743262618780136, 0.022591976448893547, -0.077998585999012, 0.15332427620887756, -0.05774466693401337, 0.034141261130571365, 0.03516596928238869, -0.12703435122966766, -0.0047130160965025425, 0.05644216015934944, 0.004742075223475695, -0.037659477442502975, -0.015005973167717457, 0.0015728598227724433, -0.07339678704738617, -0.04517186060547829, -0.10326465964317322, 0.06596037745475769, 0.059242743998765945, -0.04456968232989311, 0.030737854540348053, 0.11488612741231918, 0.11166422069072723, -0.11111344397068024, 0.017127646133303642, -0.07002910226583481, 0.02784222736954689, 0.1094268336892128, 0.09468226879835129, -0.12898415327072144, -0.011504072695970535, -0.0579715296626091, -0.1462169736623764, -0.01827654056251049, 0.0883149728178978, -0.08750975877046585, -0.10423395782709122, 0.004505629185587168, 0.031416155397892, 0.0226764939725399, -0.09085799753665924, -0.052441392093896866, -0.012379986234009266, -0.0030474283266812563, -0.03098216839134693, 0.00117884436622262, 0.004061565268784761, 0.024047669023275375, -0.06594739854335785, -0.07391147315502167, 0.009236426092684269, -0.012147638015449047, 0.0017798974877223372, -0.01749439351260662, -0.1470901519060135, -0.03401502966880798, 0.07625401020050049, -0.043389029800891876, -0.02774438075721264, -0.03390752151608467, -0.02575533650815487, 0.002398249227553606, 0.10997602343559265, -0.10403618961572647, 0.11491964012384415, -0.09506731480360031, 0.1316518783569336, 0.01218657661229372, -0.02240062691271305, -0.13834838569164276, -0.03705818951129913, 0.07236679643392563, -0.007074364461004734, 0.12465276569128036, -0.08916258066892624, -0.01499117724597454, 0.10162076354026794, 0.027506116777658463, -0.03869961202144623, 0.049849797040224075, -0.14019444584846497, -0.0806809738278389, 0.008967757225036621, 0.1141948252916336, -0.13554993271827698, -0.06893891096115112, -0.005646251607686281, -0.06803235411643982, -0.03535812720656395, 0.022069046273827553, -0.02720409445464611, -0.07400151342153549, 0.023953957483172417, 0.035404156893491745, -0.09156329184770584, -0.06985453516244888, -0.06565672159194946, 0.10620834678411484, -0.009970617480576038, 0.01671377755701542, 0.02160065434873104, -0.08548726886510849, -0.06688382476568222, -0.045326683670282364, 0.1339118778705597, -0.009342748671770096, 0.062175024300813675, -0.11326327919960022, -0.09091776609420776, 0.09818171709775925, 0.02363244816660881, 0.1057741641998291, 0.004521120805293322, -0.07866380363702774, 0.1735769659280777, 0.03369659185409546, 0.09825189411640167, -0.13353097438812256, -0.0697953850030899, 0.07079143077135086, -0.07109872996807098, -0.06896305829286575, 0.0798240527510643, 0.11496714502573013, 0.0005237156292423606, -0.03126039355993271, 0.08194715529680252, 0.07202789187431335, 0.021779684349894524, 0.009851106442511082, -0.036791782826185226, -0.04320617392659187, 0.11930936574935913, -0.09041162580251694, -0.01774209924042225, -0.06687655299901962, 0.08742941915988922, -0.002130327746272087, 0.03640219569206238, -0.029270702973008156, -0.09119083732366562, -0.11661066859960556, 0.06690848618745804, 0.045198164880275726, -0.016051096841692924, 0.027247924357652664, 0.14368610084056854, -0.0567893348634243, 0.04176788404583931, -0.019396403804421425, -0.07345093786716461, -0.007096052635461092, 0.09518497437238693, -0.020614420995116234, 0.0537618063390255, 0.009992696344852448, -0.0011234296252951026, 0.08858392387628555, 0.002412691479548812, 0.08251146227121353, -0.06821643561124802, 0.12614573538303375, 0.1681690663099289, 0.024508507922291756, 0.05427497252821922, -0.027940912172198296, 0.1252325177192688, -0.08828392624855042, 0.12330038845539093, -0.09838423877954483, 0.01011590100824833, 0.007112659513950348, 0.13671761751174927, -0.08150207996368408, -0.07223068177700043, 0.1075405701994896, 0.05965377390384674, -0.10661096125841141, 0.0232603270560503, 0.11004054546356201, 0.06500919908285141, 0.07341833412647247, 0.026884673163294792, -0.11849625408649445, -0.05523255839943886, -0.09048254787921906, -0.10035030543804169, -0.1366620510816574, 0.054524146020412445, 0.11520329117774963, -0.004343877546489239, 0.05563008040189743, 0.013348218984901905, -0.06795681267976761, 0.029134850949048996, -0.08548726886510849, 0.013881693594157696, 0.1031600758433342, -0.08455989509820938, -0.0034650471061468124, -0.03460734337568283, 0.1246538907289505, 0.05799074098467827, 0.09908965975046158, -0.007487596478313208, -0.13253194093704224, 0.0789613351225853, 0.024260174483060837, -0.09106264263391495, 0.06771287322044373, -0.08690915256738663, -0.017327800393104553, -0.010868222452700138, -0.017457321286201477, 0.0007004316430538893, 0.08985341340303421, -0.037713803350925446, -0.15318989753723145, 0.07950066775083542, 0.05813947692513466, 0.0009762427653186023, 0.05659790337085724, -0.02695932798087597, 0.06988731026649475, -0.05253908410668373, 0.13177257776260376, 0.0695233941078186, 0.07865588366985321, 0.012289216741919518, -0.08077970147132874, 0.06779300421476364, 0.05101590231060982, -0.1015043780207634, 0.08071531355381012, 0.09420518577098846, 0.11451391875743866, -0.06722797453403473, -0.09385799616575241, 0.03501269966363907, -0.003830217057839036, 0.016565628349781036, 0.05357768386602402, -0.1544421911239624, 0.06310215592384338, 0.11235176026821136, 0.028554728254675865, -0.027254637330770493, -0.10463131964206696, 0.005010184366255999, 0.18881186842918396, -0.05575745925307274, -0.11778945475816727, 0.07431559264659882, 0.04625075310468674, 0.044535309076309204, 0.012857498601078987, -0.0017934587085619569, -0.03380192816257477, -0.10522276163101196, -0.008999079465866089, -0.014990503899753094, 0.10637772083282471, -0.10400185734033585, -0.04768155887722969, -0.06320737302303314, -0.11008353531360626, 0.06144481897354126, 0.05388612672686577, -0.009405351243913174, -0.03919801488518715, -0.11234445124864578, 0.0839572325348854, 0.035657282918691635, 0.06019916385412216, 0.03896024450659752, -0.05756973475217819, 0.020124614238739014, -0.048892099410295486, 0.013559547252953053, -0.010995532386004925, 0.005737654399126768, 0.05755753815174103, -0.006061970721930265, -0.03067668341100216, 0.04432165250182152, -0.05493692681193352, 0.029557129368185997, -0.006514784414321184, 0.06632530689239502, 0.021901685744524002, 0.0730210393667221, 0.07538553327322006, 0.03904891386628151, -0.00281136273406446, 0.05615410581231117, -0.011238640174269676, -0.03433786705136299, -0.008058940060436726, 0.007172438781708479, -0.04809550568461418, -0.11521003395318985, 0.13266071677207947, 0.009332518093287945, 0.06140907481312752, -0.06655074656009674, 0.11728210747241974, 0.05820624902844429, 0.026280811056494713, -0.03504366800189018, -0.05787617713212967, 0.009255093522369862, 0.0038675570394843817, -0.11135607212781906, 0.005406642332673073, 0.08990798145532608, 0.005017930641770363, -0.04874385520815849, -0.0507693812251091, 0.004233941435813904, 0.005826910957694054, 0.0262770839035511, 0.12105884402990341, 0.004276172257959843, 0.04873347282409668, 0.009464109316468239, 0.026917077600955963, -0.029715199023485184, -5.8238598285242915e-05, -0.13902276754379272, -0.00986211746931076, 0.05763682723045349, -0.000613395357504487, -0.03653448075056076, 0.06395907700061798, -0.0017703823978081346, -0.09133521467447281, -0.13252310454845428, 0.1279640644788742, -0.07203585654497147, 0.0021708239801228046, 0.04791945964097977, -0.01474517211318016, 0.00885323528200388, -0.038648828864097595, 0.06386662274599075, -0.022064322605729103, -0.032443054020404816, 0.0232783742249012, -0.09954532980918884, -0.06838160008192062, 0.028355784714221954, -0.05164298415184021, 0.017499079927802086, -0.046308837831020355, -0.012570635415613651, 0.06443025171756744, 0.006756133399903774, -0.025568252429366112, 0.014556771144270897, 0.06164371594786644, -0.07077907770872116, -0.06446810066699982, 0.019974568858742714, -0.07576508074998856, -0.05208093300461769, 0.07730477303266525, 0.07291973382234573, 0.048182323575019836, -0.11716677248477936, 0.09848760068416595, -0.10329777747392654, 0.003069432219490409, 0.041943252086639404, 0.06134388595819473, 0.018995096907019615, -0.07628856599330902, 0.014246286824345589, -0.10668829828500748, 0.13303732872009277, 0.031793538480997086, 0.061374399811029434, -0.03446655347943306, 0.1483571082353592, -0.05069981887936592, -0.09223112463951111, 0.0034482560586184263, -0.00886633899062872, -0.12254389375448227, 0.013936849310994148, 0.1345427930355072, 0.07218578457832336, 0.03419213742017746, 0.03874639794230461, -0.15708152949810028, -0.012312965467572212, -0.04529651999473572, 0.021412856876850128, 0.02572936750948429, -0.03705708310008049, 0.00507134385406971, -0.026821784675121307, 0.1000814139842987, 0.13151803612709045, 0.07879748940467834, -0.04147862270474434, 0.06962461769580841, 0.08904027193784714, 0.08639425039291382, 0.08499504625797272, -0.004060947336256504, 0.018361179158091545, -0.05544625595211983, 0.11665738373994827, 0.11683978885412216, 0.04625117778778076, -0.16194546222686768, 0.023859145119786263, -0.03306332603096962, -0.0429329089820385, -0.016758572310209274, -0.165167897939682, 0.044091179966926575, -0.06915108859539032, -0.07229813933372498, 0.019564563408493996, -0.005963364150375128, -0.03834415227174759, 0.03843940421938896, 0.043322037905454636, 0.047527946531772614, 0.022708192467689514, -0.11554685235023499, 0.047368861734867096, 0.015478805638849735, -0.03997395932674408, -0.06580743938684464, -0.10463510453701019, -0.15465311706066132, -0.1254492551088333, 0.10157930850982666, -0.04454997926950455, 0.06431625038385391, 0.0278357844799757, 0.12281882762908936, 0.10477836430072784, -0.09342485666275024, 0.004150207154452801, 0.023130331188440323, 0.10423314571380615, 0.06021600961685181, 0.03833509981632233, 0.10767681151628494, 0.029378745704889297, 0.07619380205869675, -0.05012267455458641, -0.060311779379844666, -0.07346151024103165, -0.022259529680013657, -0.02418847754597664, 0.052418000996112823, -0.13028554618358612, 0.059966232627630234, -0.10254554450511932, -0.011934240348637104, 0.0034543259534984827, 0.07829087227582932, 0.03628110885620117, 0.08921901881694794, -0.09702718257904053, -0.10564348846673965, 0.10365051031112671, 0.03323327377438545, -0.12094072252511978, -0.08743957430124283, -0.10620072484016418, -0.035123735666275024, 0.03661482781171799, -0.1800207793712616, -0.04021941497921944, 0.016985919326543808, -0.1464681476354599, 0.0757002979516983, 0.0037040626630187035, 0.03176737204194069, 0.0643811821937561, 0.08630595356225967, 0.024610167369246483, 0.08196289092302322, 0.05339542031288147, 0.008652742952108383, -0.17592866718769073, -0.1348017007112503, 0.040166061371564865, 0.0370231494307518, 0.12734591960906982, 0.07724568247795105, -0.07123521715402603, -0.013089528307318687, 0.06461004167795181, 0.11163496971130371, 0.03938765451312065, -0.018941238522529602, -0.0340869165956974, -0.014874577522277832, 0.035865768790245056, 0.058332160115242004, -0.020753957331180573, 0.023430150002241135, -0.021809544414281845, 0.19206106662750244, 0.01670348085463047, 0.0072151776403188705, -0.014859444461762905, -0.044558025896549225, 0.12524761259555817, 0.0783822312951088, -0.13525766134262085, -0.019956273958086967, -0.11313275992870331, 0.13579781353473663, 0.16288530826568604, -0.05974039062857628, 0.04218551516532898, -0.11844053864479065, -0.02289196476340294, 0.06666335463523865, -0.0024841942358762026, 0.10211754590272903, 0.020438695326447487, -0.03766614943742752, 0.012563154101371765, -0.01856326125562191, -0.029737582430243492, -0.006864085793495178, -0.09386759996414185, 0.03648129850625992, -0.07029340416193008, 0.09329480677843094, -0.05184445530176163, 0.13385234773159027, 0.014918169006705284, -0.016258712857961655, 0.056752368807792664, -0.1268506795167923, 0.034854717552661896, 0.03915401175618172, -0.04981079697608948, -0.02219654619693756, 0.016047732904553413, 0.0005583168822340667, 0.012834449298679829, -0.03965367376804352, -0.10019372403621674, -0.04654227942228317, 0.016494020819664, 0.06138342246413231, -0.04357236251235008, 0.06567078828811646, 0.08935803920030594, 0.09040090441703796, -0.12208238989114761, 0.056906815618276596, 0.019642231985926628, -0.08992563933134079, 0.015323624014854431, 0.03257536143064499, 0.11092593520879745, -0.03898080438375473, -0.06293952465057373, 0.14118969440460205, 0.02935079298913479, 0.05567910894751549, 0.05446481704711914, 0.04669647663831711, -0.038094256073236465, 0.011099991388618946, 0.023398499935865402, -0.03545788303017616, 0.11809328198432922, -0.08228372782468796, 0.02663601003587246, -0.09772215038537979, -0.13446110486984253, 0.08151663094758987, -0.040697384625673294, 0.0876862034201622, -0.12905487418174744, 0.1717466115951538, -0.06372824311256409, 0.006641005631536245, 0.01254693791270256, 0.06108759716153145, -0.11805952340364456, 0.012198067270219326, 0.034571629017591476, 0.0976010411977768, -0.044352851808071136, 0.06913424283266068, -0.0352022722363472, 0.08727028220891953, 0.07430988550186157, -0.0361042320728302, 0.042632464319467545, 0.023535553365945816, 0.05404823645949364, 0.018110692501068115, -0.010914496146142483, -0.12561050057411194, -0.006341548170894384, -0.0718044713139534, -0.028102051466703415, 0.06896776705980301, -0.07100492715835571, -0.017868805676698685, -0.027166523039340973, -0.1154269352555275, -0.05035356432199478, 0.030962010845541954, -0.033016473054885864, 0.15172308683395386, 0.015036286786198616, 0.06730791926383972, 0.01052000094205141, 0.13771852850914001, -0.047572068870067596, 0.12163284420967102, 0.012914789840579033, -0.05434226617217064, -0.0782005563378334, -0.01855076290667057, -0.007192389108240604, -0.01945086009800434, -0.0008297663880512118, -0.051180485635995865, -0.025608599185943604, 0.058993298560380936, 0.012424320913851261, -0.026345200836658478, -0.039424922317266464, -0.021664544939994812, 0.010840071365237236, 0.005536905024200678, 0.06659501045942307, -0.07416673749685287, -0.014211034402251244, -0.1791476011276245, 0.11117483675479889, -0.13843517005443573, 0.03661179915070534, 0.14917802810668945, -0.11367697268724442, 0.018360015004873276, 0.012274401262402534, -0.03549804911017418, -0.08432096242904663, 0.03477776050567627, 0.04169454425573349, -0.14396631717681885, 0.05357974022626877, 0.08509782701730728, 0.14562386274337769, 0.07761379331350327, -0.020604969933629036, -0.19048170745372772, 0.12405069917440414, 0.032730527222156525, 0.07806860655546188, 0.004988973960280418, 0.01996227726340294, -0.1010463535785675, 0.08694648742675781, 0.03958866745233536, 0.12486407905817032, -0.021009180694818497, -0.1267133504152298, -0.05962040647864342, -0.017725037410855293, -0.013339388184249401, -0.007692171260714531, -0.034938208758831024, -0.03922836109995842, 0.052966710180044174, -0.06485319137573242, 0.03434668481349945, 0.06991579383611679, 0.11015552282333374, 0.008208506740629673, -0.07815186679363251, 0.11660715192556381, 0.17006589472293854, -0.06999015063047409, -0.09095362573862076, -0.013078298419713974, 0.001814165385439992, -0.1660827100276947, -0.0645112544298172, 0.09890981018543243, -0.10234139114618301, 0.07401445508003235, -0.06166861206293106, 0.08964528143405914, 0.043443214148283005, -0.1451118141412735, -0.15179596841335297, 0.02911415323615074, 0.03325174003839493, -0.0564432367682457, -0.046917624771595, 0.001748945564031601, 0.08680639415979385, 0.03931082785129547, 0.03041630983352661, 0.08606722950935364, -0.0640716701745987, 0.05383209511637688, 0.05057603865861893, 0.06530188024044037, -0.0827811062335968, 0.1257019191980362, -0.07741785049438477, -0.051898740231990814, -0.023204516619443893, 0.15543030202388763, -0.08783268928527832, 0.06238212808966637, -0.10968372970819473, -0.13551898300647736, -0.060908928513526917, -0.03993776813149452, 0.016460102051496506, 0.10184836387634277, -0.004383916966617107, -0.045296620577573776, 0.06561114639043808, -0.031301725655794144, -0.0021257763728499413, -0.1320224404335022, -0.0322616882622242, -0.03850151225924492, 0.10252196341753006, 0.017892466858029366, -0.026831863448023796, -0.06884995847940445, 0.15581554174423218, 0.07026220113039017, 0.015849942341446877, -0.05382905527949333, -0.09047914296388626, -0.10316355526447296, 0.08518799394369125, -0.09516847878694534, -0.08791077882051468, -0.03422939032316208, 0.08603163063526154, -0.0155271515250206, 0.0261552631855011, 0.015644632279872894, 0.013366669416427612, -0.03996022418141365, -0.04552832990884781, 0.07389026880264282, 0.04102855175733566, -0.004287406802177429, 0.08731890469789505, -0.017497524619102478, 0.06639056652784348, 0.009171650744974613, 0.030421175062656403, -0.0259227454662323, -0.02077215537428856, -0.059034328907728195, -0.04797796905040741, -0.030727842822670937, -0.014650416560471058, 0.11374397575855255, -0.09943485260009766, 0.011346555314958096, -0.15970222651958466, 0.04171529412269592, 0.024115417152643204, 0.1286141574382782, 0.07709553837776184, -0.01398113276809454, -0.048933763056993484, 0.00025472359266132116, 0.06027266010642052, 0.09066835045814514, 0.0406450591981411, -0.027702605351805687, -0.09651189297437668, 0.021643901243805885, 0.013145401142537594, -0.08617366850376129, 0.15216495096683502, -2.457315531501081e-05, -0.13747750222682953, -0.12537482380867004, 0.11405719816684723, 0.1169644296169281, 0.05157921463251114, -0.07261180132627487, -0.04487282782793045, 0.023982014507055283, 0.0917629674077034, 0.06515949964523315, 0.1243126392364502, -0.07018998265266418, -0.09962628036737442, -0.0037491980474442244, 0.022725116461515427, 0.039716687053442, -0.07939422130584717, -0.0628962442278862, 0.07711213082075119, -0.045695893466472626, -0.0620395690202713, -0.09509415179491043, 0.02549614943563938, -0.010277285240590572, -0.05614204332232475, 0.08836720883846283, 0.06648086756467819, -0.039149630814790726, 0.002421225653961301, -0.12809360027313232, 0.0008481849217787385, -0.07143975794315338, -0.08211125433444977, 0.06149134412407875, -0.07500535249710083, 0.06601171940565109, -0.10469319671392441, 4.3143212678842247e-05, -0.0936727225780487, -0.08584000915288925, -0.12921328842639923, 0.041809480637311935, 0.0820227712392807, -0.06649454683065414, -0.030901996418833733, 0.07195748388767242, 0.05566665530204773, -0.056824203580617905, -0.07998798787593842, 0.08054839074611664, -0.0780780166387558, 0.07127255201339722, 0.05833334103226662, -0.019775468856096268, -0.055652398616075516, -0.10220123082399368, -0.016874149441719055, 0.06789176911115646, 0.023872679099440575, -0.05531502142548561, -0.09561484307050705, 0.05733442306518555, 0.05773942917585373, 0.045870646834373474, 0.002322334796190262, 0.09235960990190506, -0.03016359731554985, 0.016316205263137817, 0.11869056522846222, 0.04191914573311806, -0.10325540602207184, 0.04845336824655533, -0.0269918330013752, -0.039806049317121506, 0.07071694731712341, -0.10559872537851334, 0.08917070925235748, -0.07676434516906738, 0.0073806350119411945, 0.14489127695560455, 0.13887177407741547, 0.07916447520256042, 0.08560489118099213, 0.06443808972835541, 0.059057775884866714, 0.08931148797273636, -0.07787708193063736, -0.10251759737730026, 0.0075319381430745125, -0.06983314454555511, -0.04202573001384735, -0.015671102330088615, -0.04227045550942421, -0.03175108879804611, 0.04764707013964653, 0.005857840180397034, 0.03379961848258972, 0.028055328875780106, -0.07203847169876099, -0.06986270099878311, -0.003173372009769082, -0.011897794902324677, -0.18477001786231995, 0.06392423063516617, -0.0958879142999649, -0.03118521347641945, 0.05193889141082764, -0.1067591980099678, 0.03953500837087631, -0.03165888041257858, 0.034972913563251495, -0.024304809048771858, -0.07084298133850098, -0.016530625522136688, -0.11620677262544632, -0.09767208993434906, 0.10510294139385223, 0.09665529429912567, 0.1183934435248375, -0.09745772927999496, 0.00679415138438344, 0.1132727563381195, -0.018264254555106163, -0.019791681319475174, 0.036722488701343536, 0.01067893486469984, -0.08669820427894592, 0.11323799192905426, 0.11758481711149216, -0.09748739749193192, 0.14074456691741943, -0.09088336676359177, -0.08939459919929504, -0.09642212837934494, 0.00503641227260232, 0.038042422384023666, -0.015597728081047535, 0.035295210778713226, 0.08481349796056747, 0.08536709100008011, 0.04168005287647247, 0.08596702665090561, -0.029325297102332115, 0.020187221467494965, -0.010355246253311634, 0.0225425623357296, 0.1033378392457962, -0.02059188485145569, -0.08411120623350143, 0.03043486177921295, 0.030466867610812187, 0.01114620454609394, -0.18349924683570862, 0.12223149836063385, -0.08610160648822784, 0.013365558348596096, -0.04625803977251053, 0.04691113904118538, 0.12240272015333176, -0.04301876574754715, -0.14549696445465088, -0.011449136771261692, -0.1122528612613678, -0.1448007971048355, 0.023839900270104408, 0.0029600730631500483, 0.00336424820125103, 0.052781764417886734, -0.007799502462148666, 0.17846138775348663, -0.002731938846409321, 0.1549985259771347, -0.08847375214099884, 0.13487549126148224, -0.1122312918305397, -0.01658775471150875, 0.027920691296458244, 0.039901863783597946, 0.011306984350085258, -0.09057622402906418, -0.09737836569547653, 0.008658726699650288, -0.003913993015885353, -0.04074768349528313, 0.14156471192836761, 0.04745592549443245, 0.014536384493112564, -0.06632868945598602, 0.03303741291165352, -0.08587943017482758, 0.029135219752788544, -0.006335390731692314, 0.05579683184623718, 0.010185777209699154, 0.06734149903059006, 0.09800834208726883, 0.08444205671548843, 0.01825273595750332, 0.00033221105695702136, 0.1400860697031021, 0.1034269854426384, -0.00887358095496893, 6.399027915904298e-05, 0.10003925859928131, 0.007955986075103283, -0.10168483108282089, 0.09675084054470062, 0.0043230485171079636, -0.04814619570970535, -0.06735330075025558, 0.05147441104054451, 0.013488538563251495, 0.07283569127321243, 0.017995212227106094, -0.029153011739253998, -0.01202481985092163, 0.0010859820758923888, 0.06717027723789215, -0.009339677169919014, -0.04856036230921745, 0.03623130917549133, -0.09640645980834961, 0.0032721906900405884, 0.028007976710796356, 0.11453660577535629, -0.1679062396287918, 0.044960834085941315, 0.023247256875038147, -0.028247559443116188, 0.10360699892044067, -0.008331977762281895, -0.05293885990977287, 0.01663522608578205, 0.07653845846652985, -0.00014521452249027789, -0.0813521221280098, 0.04652011767029762, -0.09296832233667374, 0.12821219861507416, -0.10227789729833603, -0.02046060375869274, 0.0649273619055748, -0.02883685752749443, -0.11822272092103958, 0.08904861658811569, 0.05795993283390999, -0.039293739944696426, -0.08931197971105576, -0.021557800471782684, 0.042837128043174744, 0.15891285240650177, 0.027449699118733406, -0.05795683711767197, 0.14755879342556, -0.12471137195825577, -0.07204317301511765, -0.007327635306864977, 0.12997277081012726, -0.0015127687947824597, -0.10655193030834198, -0.0860658586025238, 0.02263908088207245, 0.08858924359083176, 0.0004779361770488322, 0.16738462448120117, -0.10192152857780457, -0.10047734528779984, 0.029776908457279205, 0.0877823606133461, 0.1633143573999405, 0.08035747706890106, 0.08555403351783752, 0.10485243052244186, 0.15339253842830658, -0.08570512384176254, 0.133902907371521, 0.08183680474758148, -0.13226200640201569, -0.07982171326875687, 0.11062654852867126, 0.007682450115680695, -0.0599532276391983, -0.16389046609401703, -0.053222186863422394, -0.09462292492389679, 0.07825902849435806, 0.07393697649240494, 0.11582036316394806, -0.06906057894229889, -0.07006707042455673, -0.03788117319345474, -0.06210542470216751, -0.030007606372237206, 0.11203669756650925, -0.11593355983495712, 0.13215744495391846, -0.14084120094776154, 0.06428901851177216, -0.10120108723640442, -0.049459900707006454, -0.002770822960883379, -0.009793326258659363, 0.10581713914871216, 0.061863239854574203, -0.0411028154194355, -0.17936986684799194, 0.05870501324534416, -0.022111542522907257, 0.11447978019714355, -0.011027866974473, 0.08072564005851746, 0.0332261398434639, 0.061774883419275284, -0.01253794226795435, -0.061165258288383484, 0.013930482789874077, -0.11593759804964066, 0.1607934981584549, 0.02467764914035797, 0.08351688832044601, 0.03683093935251236, -0.03867475315928459, -0.0010690041817724705, -0.04635501652956009, 0.012641321867704391, 0.13841623067855835, -0.07067111134529114, 0.014157929457724094, 0.06799264252185822, 0.0006777437520213425, -0.08956825733184814, 0.009663864970207214, -0.016040390357375145, 0.08025089651346207, -0.044835589826107025, -0.04719003289937973, 0.06240908429026604, -0.16676227748394012, 0.07731502503156662, 0.08551036566495895, 0.12125818431377411, 0.13556385040283203, -0.0037821338046342134, -0.07634018361568451, -0.05975359305739403, 0.12168741971254349, 0.05835292115807533, 0.07890303432941437, 0.049769822508096695, 0.004167516715824604, 0.0710752084851265, 0.05688835680484772, -0.07204330712556839, 0.017590301111340523, 0.014833618886768818, 0.07870817929506302, -0.060019638389348984, 0.057618625462055206, -0.020870095118880272, -0.009213753044605255, -0.0554959736764431, 0.04981902986764908, -0.07183270901441574, 0.023764528334140778, 0.02712036482989788, 0.024774858728051186, -0.038273341953754425, 0.08773316442966461, -0.02331588603556156, 0.018362337723374367, 0.05634118616580963, -0.08333124965429306, 0.08008017390966415, -0.08860724419355392, -0.0663815289735794, -0.14292407035827637, 0.14571596682071686, -0.06759940087795258, 0.13152271509170532, 0.05509126931428909, -0.04534301534295082, 0.09789793193340302, -0.09127799421548843, -0.10598055273294449, -0.09980310499668121, 0.15129274129867554, 0.05854972079396248, -0.06978114694356918, 0.07698564976453781, -0.028427965939044952, -0.02799505554139614, -0.05522427335381508, -0.07925379276275635, 0.13759177923202515, -0.00774253299459815, -0.07116971164941788, 0.07353582978248596, 0.07080697268247604, -0.02469792030751705, 0.11768005788326263, 0.10110687464475632, -0.023433420807123184, -0.15377689898014069, -0.03623313829302788, -0.1044248566031456, 0.11205120384693146, -0.06685630232095718, 0.18191824853420258, 0.17942655086517334, -0.15443618595600128, 0.0901094451546669, 0.0358421616256237, -0.06147554889321327, 0.10875798761844635, 0.07632284611463547, 0.08828596770763397, 0.05345006659626961, -0.13190825283527374, 0.11327430605888367, 0.03447302430868149, -0.19190050661563873, 0.000576370395720005, -0.12327825278043747, -0.009508028626441956, 0.09617463499307632, 0.10532279312610626, -0.0209064818918705, -0.060781028121709824, -0.024801025167107582, 0.05100112035870552, -0.005104098003357649, -0.01737995073199272, -0.012397904880344868, -0.07800427079200745, -0.06366600096225739, 0.060217827558517456, 0.004612170625478029, -0.1323574185371399, -0.12692788243293762, -0.0362970344722271, -0.08000503480434418, -0.11426205188035965, 0.02638113871216774, -0.0010207218583673239, -0.041151098906993866, 0.027636514976620674, -0.06771855801343918, 0.0013730808859691024, 0.0055891377851367, -0.002782221417874098, 0.12677034735679626, 0.12290980666875839, 0.015561576932668686, 0.09227290749549866, 0.03935549035668373, -0.07679843157529831, 0.09462258964776993, -0.02118622697889805, -0.11555658280849457, -0.04747992381453514, 0.038013990968465805, 0.07682488113641739, 0.0030195179861038923, 0.06401579082012177, 0.0715571790933609, -0.02494031935930252, 0.1281384527683258, 0.06680554151535034, 0.0810844898223877, -0.10172303020954132, -0.003531420836225152, 0.07177083194255829, 0.0301100742071867, -0.1049720048904419, 0.076573945581913, -0.004773108754307032, 0.089359350502491, 0.07596060633659363, 0.13704074919223785, 0.012736483477056026, -0.10572598874568939, 0.03011382557451725, -0.1715325564146042, 0.028705289587378502, -0.04708046093583107, 0.12409429252147675, -0.1352798044681549, 0.06086347624659538, -0.009391755796968937, 0.017500316724181175, -0.02787698060274124, -0.021658528596162796, -0.02698497474193573, 0.13163802027702332, -0.04124809429049492, -0.011798572726547718, -0.025369688868522644, -0.03073195368051529, 0.00944187119603157, 0.00847163051366806, 0.01948285475373268, 0.024194922298192978, 0.03326156735420227, -0.07869099080562592, 0.028551684692502022, 0.013652587309479713, 0.19533753395080566, 0.017677517607808113, -0.0972708985209465, 0.13400615751743317, 0.01805303618311882, 0.03576274216175079, -0.01557500846683979, 0.041465722024440765, 0.07052022963762283, 0.003319489536806941, 0.07025832682847977, -0.07185909152030945, 0.08455085754394531, 0.09813709557056427, -0.19414947926998138, -0.06407417356967926, 0.16087809205055237, -0.03376021236181259, -0.030949875712394714, 0.06862402707338333, -0.012075405567884445, -0.0464232861995697, 0.07943882793188095, 0.05938319116830826, -0.0663599967956543, 0.016712544485926628, -0.015799324959516525, -0.03383303061127663, 0.09158618748188019, 0.07857795059680939, -0.14470870792865753, -0.010892092250287533, -0.054911766201257706, 0.020620550960302353, -0.11238373816013336, 0.05652245506644249, 0.03194878622889519, -0.0854407399892807, 0.05392048880457878, 0.021894363686442375, 0.08319561928510666, 0.07863497734069824, -0.031880080699920654, -0.036825064569711685, -0.05503226816654205, 0.08494585752487183, 0.10164379328489304, 0.028650090098381042, -0.0018377765081822872, 0.007790791802108288, 0.07287311553955078, -0.14200401306152344, -0.0814163088798523, -0.08053891360759735, 0.09795393794775009, -0.06973978877067566, 0.02368977852165699, -0.010927023366093636, 0.04451552405953407, -0.01089573372155428, 0.011464962735772133, 0.03684375062584877, 0.00704914378002286, 0.10603898763656616, -0.10778902471065521, -0.0587334930896759, 0.08933018893003464, -0.09330148994922638, -0.11694422364234924, 0.05453900992870331, 0.12144056707620621, -0.07291834056377411, -0.006635486613959074, -0.08678033202886581, 0.03864175081253052, 0.01242121309041977, 0.031132923439145088, -0.04697708413004875, -0.04873696714639664, 0.1532658040523529, 0.002095867646858096, 0.0790393203496933, 0.04474573954939842, 0.003111273981630802, -0.1157270148396492, 0.029739348217844963, 0.07839697599411011, -0.007410520687699318, -0.05420071631669998, 0.017292628064751625, 0.08750828355550766, -0.017998022958636284, 0.07619334012269974, 0.014642289839684963, -0.015720313414931297, 0.12139824777841568, 0.0370451845228672, 0.07278870046138763, -0.09747995436191559, 0.042478810995817184, -0.09731264412403107, -0.04444630444049835, -0.09627407044172287, 0.06279707700014114, -0.002218357753008604, -0.04012710973620415, -0.09643571823835373, -0.005774438846856356, -0.17029692232608795, 0.02170516923069954, 0.06291104853153229, -0.06548239290714264, 0.004137292969971895, 0.005069032311439514, 0.07652847468852997, -0.0698053315281868, -0.043477725237607956, -0.07129646092653275, 0.022732794284820557, -0.047151289880275726, -0.005161759443581104, -0.05453921854496002, 0.00913409423083067, 0.0031700641848146915, -0.003279946744441986, 0.07599044591188431, -0.03359553590416908, -0.10712950676679611, 0.025266652926802635, -0.0801057368516922, 0.11332458257675171, 0.08967027813196182, -0.08147011697292328, 0.014733032323420048, -0.005572325550019741, -0.06424126774072647, -0.061786096543073654, -0.005176426377147436, 0.11958600580692291, 0.02372639626264572, -0.11886453628540039, 0.11944274604320526, -0.15919597446918488, 0.12724775075912476, -0.047423336654901505, 0.007363137789070606, 0.04191284254193306, -0.0686899796128273, 0.14505818486213684, -0.12615498900413513, 0.06674019992351532, 0.05121887847781181, -0.020951539278030396, 0.03228708356618881, -0.0011105498997494578, -0.08348365128040314, -0.019556842744350433, -0.10876553505659103, -0.10920687764883041, 0.0706694945693016, -0.022082632407546043, -0.017684848979115486, -0.15886257588863373, -0.04465198889374733, -0.1044575497508049, -0.057889293879270554, 0.04651083052158356, 0.020768065005540848, -0.058138407766819, 0.0023001977242529392, 0.15116682648658752, -0.08015796542167664, -0.0647672563791275, -0.0673728808760643, -0.008018615655601025, 0.18681369721889496, 0.00421113520860672, -0.0011421614326536655, 0.0036941608414053917, -0.037593547254800797, 0.22906191647052765, 0.020357606932520866, 0.02629992552101612, -0.14982478320598602, -0.05820639058947563, -0.042025499045848846, -0.010877656750380993, -0.03335224464535713, -0.03965567797422409, -0.001121016452088952, 0.11997079104185104, -0.033009763807058334, 0.08956283330917358, -0.0023659970611333847, 0.07031866908073425, 0.10651278495788574, 0.01183995045721531, 0.13925041258335114, 0.022944165393710136, 0.008428206667304039, 0.0014787331456318498, -0.08254874497652054, 0.020950378850102425, -0.05816744267940521, -0.0378120057284832, 0.02629460208117962, 0.029741957783699036, -0.017092471942305565, 0.057360898703336716, 0.11690270155668259, 0.06359666585922241, -0.15701596438884735, 0.006960321683436632, -0.16998590528964996, 0.004229705315083265, -0.09632439911365509, 0.050612542778253555, -0.08810050040483475, -0.05470704287290573, -0.15139831602573395, 0.0032318017911165953, 0.08931103348731995, -0.06178009882569313, -0.07568635046482086, 0.005629117134958506, 0.12957684695720673, -0.014693249948322773, -0.10770341753959656, -0.0964989885687828, -0.14583200216293335, -0.04839799180626869, 0.08012618869543076, -0.10542430728673935, -0.040334586054086685, -0.13951781392097473, 0.027307134121656418, -0.02577960677444935, 0.03875163570046425, -0.012664485722780228, -0.014277270995080471, -0.012478755787014961, 0.035924457013607025, 0.05355110019445419, 0.01967667229473591, -0.02402326464653015, 0.019509946927428246, 0.11608303338289261, 0.016418740153312683, -0.1221536323428154, 0.041559942066669464, 0.05487842112779617, 0.023841632530093193, 0.1165076196193695, -0.02585950680077076, -0.0038105833809822798, -0.1265077143907547, 0.04823203757405281, -0.11976667493581772, 0.026658499613404274, -0.08982692658901215, -0.14792239665985107, 0.023260017856955528, -0.06793531030416489, -0.099603570997715, -0.1109376847743988, -0.07057157903909683, -0.04522956535220146, 0.0988873690366745, 0.007811566814780235, 0.12969082593917847, -0.08139680325984955, 0.03913860768079758, 0.03925023972988129, 0.07584214955568314, 0.18720892071723938, -0.06073785200715065, -0.05631256103515625, -0.04028370603919029, 0.05611437186598778, 0.07838693261146545, 0.05966433137655258, 0.05332861468195915, 0.264894038438797, -0.0011493880301713943, -0.09919758141040802, -0.027785057201981544, -0.09462786465883255, 0.003122244728729129, 0.1071617528796196, -0.05048873648047447, -0.06467025727033615, -0.01269389409571886, 0.10103216022253036, -0.016965683549642563, 0.07385124266147614, 0.09977889806032181, 0.1582973748445511, -0.053037699311971664, -0.05581865832209587, -0.14113591611385345, -0.09934075176715851, 0.03679492324590683, -0.053625594824552536, -0.01592974364757538, -0.0022054603323340416, -0.05776156485080719, -0.06738211959600449, -0.08318545669317245, -0.10358083248138428, -0.13876071572303772, 0.002427420113235712, 0.06337869167327881, -0.02540254220366478, -0.0658140555024147, -0.03389524668455124, 0.03405216336250305, 0.01696617715060711, 0.03167183697223663, 0.04361028969287872, 0.07098741084337234, -0.09409481287002563, 0.11727176606655121, -0.020752737298607826, -0.012857282534241676, 0.07893473654985428, -0.011278510093688965, -0.08530683070421219, -0.03479045629501343, -0.029553133994340897, -0.023231113329529762, 0.03275783732533455, -0.008478492498397827, -0.0018685415852814913, -0.04654315859079361, 0.16481845080852509, 0.09968077391386032, 0.035597965121269226, -0.0012392074568197131, 0.007257264107465744, 0.11301527172327042, -0.04137134924530983, 0.12074431777000427, -0.0811767578125, 0.06916947662830353, 0.0773472934961319, 0.10451623797416687, 0.057376082986593246, 0.009979594498872757, -0.0660557970404625, -0.04816269502043724, -0.048144422471523285, 0.1182418093085289, 0.01628737896680832, 0.03413499891757965, -0.05526500940322876, 0.07512268424034119, 0.06241212785243988, -0.07575362175703049, 0.11678755283355713, -0.07099582254886627, 0.03988199681043625, 0.05621277540922165, 0.12491339445114136, -0.129484623670578, 0.14509354531764984, -0.037564877420663834, 0.0643044263124466, 0.1368391513824463, 0.04101012274622917, -0.027323881164193153, -0.12762881815433502, -0.12629875540733337, 0.033993419259786606, -0.04417770355939865, -0.0031524028163403273, -0.03771885111927986, 0.051857840269804, -0.08818452805280685, 0.04935911297798157, 0.04875124618411064, 0.15577390789985657, -0.01599166914820671, -0.0651186853647232, 0.07091075927019119, 0.02669866383075714, -0.10026048123836517, 0.07469406723976135, 0.08329301327466965, -0.061377402395009995, 0.11218743026256561, 0.018666550517082214, -0.04178944602608681, -0.13097259402275085, -0.0006274671177379787, -0.009584094397723675, -0.17063230276107788, -0.043353237211704254, -0.027241088449954987, -0.15587173402309418, 0.007038084790110588, -0.11686423420906067, 0.02317534014582634, -0.12099545449018478, 0.0761067271232605, 0.07204364240169525, -0.04237471520900726, -0.0425589345395565, -0.0911833867430687, 0.02169538475573063, -0.09816963225603104, -0.026848051697015762, 0.11538656055927277, -0.023157315328717232, 0.12145848572254181, -0.0007464751251973212, -0.05437099561095238, -0.09237374365329742, -0.018124233931303024, 0.0070025138556957245, 0.01872801035642624, 0.1556786298751831, -0.020315615460276604, -0.10158411413431168, -0.002457529539242387, -0.07619743794202805, -0.07879187166690826, -0.006102723069489002, -0.001906613353639841, 0.055171072483062744, -0.07659876346588135, -0.021335450932383537, 0.12484285980463028, 0.023884223774075508, 0.005625234916806221, -0.035208333283662796, 0.10470875352621078, 0.15305167436599731, -0.02958986908197403, -0.07901962846517563, -0.0770295113325119, -0.01810283027589321, 0.02623218670487404, -0.03691065311431885, 0.014563709497451782, -0.04961064085364342, -0.0636262595653534, 0.020535225048661232, -0.017347440123558044, 0.019397089257836342, -0.011485166847705841, 0.05383066087961197, -0.12325499206781387, 0.005273868795484304, 0.08313319087028503, -0.0037824600003659725, 0.09206365048885345, 0.07637399435043335, 0.024796605110168457, -0.06333010643720627, 0.015874305739998817, 0.0754663497209549, -0.07498642802238464, -0.07888802886009216, 0.019965972751379013, -0.03978637233376503, 0.04071207717061043, 0.09412810206413269, 0.1001158058643341, 0.0294822845607996, 0.07182040065526962, -0.014155530370771885, 0.055101193487644196, 0.034021370112895966, 0.09183365851640701, -0.01001518964767456, -0.0035140106920152903, -0.004843527916818857, 0.020039686933159828, 0.03182714432477951, 0.02624785527586937, 0.01643853262066841, 0.09743887186050415, -0.09833167493343353, 0.05089692398905754, -0.14779320359230042, -0.06326430290937424, 0.018293472006917, 0.0752573311328888, 0.0225013867020607, -0.04792378842830658, -0.06308137625455856, 0.024520324543118477, 0.028904205188155174, 0.001791680813767016, 0.10920286178588867, -0.06172941252589226, 0.11805282533168793, 0.07684309780597687, 0.0326501838862896, 0.13321883976459503, 0.12698450684547424, -0.0016208792803809047, 0.01300685852766037, -0.06806281954050064, -0.0507960207760334, -0.05811695754528046, 0.019145412370562553, 0.00973452627658844, -0.07218435406684875, -0.07167387008666992, -0.03823735564947128, 0.04721848666667938, -0.011600666679441929, -0.006188997067511082, -0.009444254450500011, 0.057178620249032974, -0.027628717944025993, -0.10918978601694107, 0.03163545951247215, -0.005383989308029413, -0.03177456185221672, 0.1077384352684021, 0.05273682624101639, -0.06017373502254486, -0.057118821889162064, 0.028664201498031616, 0.0053553106263279915, -0.006776825524866581, 0.04878850653767586, -0.07174977660179138, 0.010114900767803192, -0.0387243889272213, 0.03278697654604912, -0.14430035650730133, 0.027993464842438698, 0.03615819662809372, -0.059501852840185165, 0.10222864896059036, -0.13242043554782867, 0.08143524825572968, 0.0499231219291687, 0.08616816997528076, -0.0019639243837445974, -0.1269051879644394, 0.09578004479408264, -0.07546405494213104, -0.13895061612129211, -0.0064053465612232685, -0.014554870314896107, -0.06894559413194656, 0.062238629907369614, -0.037018027156591415, 0.10519778728485107, -0.07478281855583191, -0.1119331419467926, 0.1110968142747879, -0.024176079779863358, -0.09414919465780258, 0.029805662110447884, -0.09391143172979355, -0.01116796676069498, -0.03543952852487564, 0.17675262689590454, -0.024187209084630013, 0.0979824960231781, -0.030535252764821053, -0.029672272503376007, -0.03650427982211113, 0.04283737391233444, 0.07284794747829437, 0.06738537549972534, 0.017655599862337112, 0.061429448425769806, 0.05813189595937729, 0.06892523169517517, -0.0926205962896347, -0.05019678547978401, -0.08731450140476227, 0.06774654239416122, -0.12845972180366516, -0.0799056887626648, -0.012604955583810806, -0.026535851880908012, -0.047768525779247284, -0.028504662215709686, -0.13906677067279816, -0.008753057569265366, -0.009137928485870361, 0.01039611455053091, -0.04622995853424072, -0.11692488938570023, 0.005399459972977638, -0.03204844146966934, 0.07517825067043304, 0.03579520806670189, -0.07870001345872879, 0.027214620262384415, -0.004712760914117098, -0.02819802239537239, 0.013258256018161774, -0.08317320048809052, 0.04772507771849632, -0.0036485407035797834, 0.042982399463653564, -0.08622302114963531, 0.04041092097759247, -0.10837457329034805, 0.054669637233018875, 0.06723347306251526, -0.1841861605644226, 0.005322680342942476, 0.11483636498451233, -0.1123683899641037, 0.12496423721313477, 0.05450114607810974, -0.19589050114154816, -0.011695541441440582, 0.04058093577623367, -0.14455507695674896, -0.19965212047100067, -0.0031138884369283915, -0.05498270317912102, -0.02826176956295967, 0.010191191919147968, 0.024352876469492912, 0.04465777054429054, 0.0386013388633728, 0.03426063433289528, -0.041187405586242676, -0.050215501338243484, -0.11240677535533905, 0.0770430713891983, -0.04333062842488289, -0.0028247020673006773, -0.037989355623722076, -0.09162499010562897, -0.11591847985982895, -0.06737276911735535, -0.0509476400911808, -0.008168465457856655, -0.01738166995346546, 0.1038716584444046, 0.027241108939051628, -0.011808807030320168, -0.2093772143125534, -0.007193873170763254, -0.07735336571931839, -0.06859499216079712, 0.005182287655770779, 0.09612239897251129, 0.057748276740312576, 0.007101242430508137, 0.09537412971258163, -0.04985379800200462, 0.1084294468164444, 0.0089179128408432, 0.04056190699338913, -0.14431527256965637, -0.1802506148815155, 0.043574657291173935, 0.08027723431587219, -0.09034369140863419, -0.04100751131772995, 0.0598893016576767, 0.06184181943535805, -0.007746226154267788, -0.011990985833108425, 0.04908908158540726, -0.142496258020401, 0.17030541598796844, -0.15190568566322327, -0.016299594193696976, 0.03535197675228119, -0.07778824865818024, 0.06340105086565018, -0.1807624101638794, 0.022172510623931885, -0.1630510836839676, -0.13396978378295898, 0.05666763707995415, -0.03022174723446369, -0.02672746777534485, -0.016812307760119438, -0.09006383270025253, -0.031742844730615616, 0.02009752206504345, 0.03934232145547867, 0.056117258965969086, 0.01624813675880432, 0.019130725413560867, -0.020669324323534966, -0.019552798941731453, -0.0035692944657057524, -0.08280466496944427, -0.028776491060853004, 0.11378608644008636, 0.06130105257034302, -0.16280920803546906, 0.01530275959521532, 0.12172414362430573, -0.033726468682289124, 0.11767042428255081, 0.017422636970877647, 0.011644585058093071, -0.03547842055559158, 0.028439823538064957, 0.0677976906299591, -0.03290635347366333, -0.049801457673311234, -0.10338348895311356, 0.09374192357063293, -0.1354292780160904, 0.012332135811448097, 0.047031644731760025, 0.057570721954107285, -0.12224745750427246, 0.062347523868083954, 0.1623450517654419, 0.13515223562717438, -0.11030127108097076, 0.07925023883581161, 0.08147924393415451, 0.0444355234503746, -0.09104607254266739, -0.003958532121032476, 0.01981125958263874, 0.033395200967788696, -0.14422670006752014, 0.01993093453347683, 0.015821730718016624, 0.0453067272901535, -0.04910401627421379, -0.0879310816526413, -0.06224782392382622, 0.04718802496790886, -0.03977072983980179, 0.035991787910461426, 0.061159372329711914, -0.1016826406121254, -0.012598331086337566, -0.019158964976668358, 0.012175323441624641, 0.020366720855236053, 0.11039642989635468, -0.11715129017829895, 0.11636088043451309, -0.006135446019470692, -0.03458587825298309, 0.08757288008928299, -0.12092314660549164, -0.14478492736816406, 0.03943731263279915, 0.010565933771431446, -0.03248501196503639, 0.014003290794789791, 0.04971317946910858, 0.03612569719552994, 0.004589392337948084, -0.046533506363630295, 0.0478295162320137, -0.11282619088888168, 0.00944832805544138, 0.09483347088098526, 0.007865088991820812, 0.02733585238456726, -0.03790339455008507, -0.12290019541978836, -0.008998271077871323, 0.06001335009932518, -0.06823378056287766, 0.013119610957801342, 0.0018895954126492143, -0.03715048357844353, -0.0342751145362854, -0.09196047484874725, -0.06939360499382019, 0.013069148175418377, -0.012962959706783295, 0.03683914989233017, -0.11908159404993057, 0.0543111190199852, -0.012898100540041924, -0.09106260538101196, 0.09087780117988586, -0.010013626888394356, 0.02699154056608677, -0.15124809741973877, -0.026262424886226654, 0.0416921004652977, 0.06588732451200485, -0.04964428022503853, 0.008407382294535637, -0.014985156245529652, -0.023743750527501106, -0.09925040602684021, -0.05630185455083847, -0.07157253473997116, 0.0609932504594326, -0.12440706789493561, -0.06975722312927246, 0.011876334436237812, -0.04760713130235672, -0.02720666490495205, -0.06817909330129623, -0.07294946163892746, -0.05126800388097763, 0.14843210577964783, 0.10800927877426147, 0.06115778908133507, 0.0821165144443512, 0.0952543169260025, 0.11269078403711319, 0.055609237402677536, 0.13805073499679565, 0.07948612421751022, -0.027564119547605515, -0.04391176253557205, 0.06408799439668655, 0.11041335016489029, -0.17009900510311127, -0.0619138665497303, 0.031996577978134155, 0.06137979403138161, 0.07774420827627182, 0.14099983870983124, 0.00014128116890788078, -0.05699782818555832, -0.03193417564034462, -0.0184538122266531, 0.08050597459077835, -0.052281755954027176, -0.01383676566183567, 0.060632992535829544, -0.023519713431596756, 0.06791529804468155, -0.15154989063739777, 0.06617545336484909, -0.1268659234046936, -0.050098761916160583, -0.04223007336258888, -0.018253158777952194, 0.014315452426671982, -0.03623133897781372, 0.15718385577201843, 0.05378524586558342, 0.0006907217903062701, -0.0866183415055275, 0.07562548667192459, -0.03830523043870926, -0.017897672951221466, -0.08834314346313477, 0.01821502484381199, -0.12683932483196259, -0.1250912994146347, 0.08191195875406265, -0.04195911064743996, 0.04414473846554756, -0.073299840092659, -0.02220085635781288, 0.08953659236431122, 0.09754327684640884, 0.03416013717651367, 0.08452919125556946, 0.06300800293684006, -0.02770855650305748, -0.014500925317406654, 0.17508968710899353, 0.04690482094883919, 0.04533703252673149, -0.11102370917797089, -0.06532260030508041, -0.11754179000854492, 0.019551917910575867, 0.051512472331523895, -0.03133782744407654, 6.450210639741272e-05, 0.05332004651427269, -0.054140858352184296, -0.030324870720505714, 0.09460371732711792, 0.05896560475230217, 0.012456553988158703, -0.04920748248696327, 0.15646421909332275, -0.08042600005865097, -0.04049647971987724, -0.05036917328834534, -0.09870537370443344, 0.13685762882232666, -0.14011789858341217, 0.08600567281246185, -0.08345185965299606, 0.032864201813936234, -0.03987272083759308, 0.052743811160326004, 0.06588375568389893, -0.01656746305525303, 0.02298978716135025, 0.08039694279432297, 0.045304831117391586, -0.05982063710689545, -0.024150341749191284, -0.10901937633752823, -0.01236034370958805, 0.003093558130785823, -0.13866613805294037, 0.08161301165819168, 0.11168108135461807, -0.05656734108924866, 0.0671558678150177, 0.13865149021148682, -0.040234096348285675, -0.05881362780928612, -0.07674787193536758, -0.006904173642396927, 0.029158765450119972, 0.02437075600028038, 0.06426908820867538, 0.000172353713423945, -0.12325626611709595, 0.018029149621725082, -0.01132736261934042, 0.08343317359685898, -0.002166933845728636, 0.06063723936676979, -0.013908695429563522, 0.025354215875267982, 0.007080237381160259, -0.051902979612350464, 0.013737191446125507, 0.11159507185220718, -0.00514847319573164, -0.12636622786521912, -0.012866787612438202, 0.0994979739189148, 0.00968120340257883, -0.16220629215240479, -0.04543587565422058, 0.013787676580250263, -0.09706154465675354, 0.14558884501457214, -0.007087359670549631, 0.11224687844514847, 0.048328448086977005, 0.04144427552819252, -0.08803527802228928, -0.08491235226392746, 0.055953290313482285, -0.011497370898723602, -0.1888001561164856, -0.0751081332564354, 0.04170043766498566, -0.059393733739852905, -0.0369073711335659, -0.044801533222198486, -0.09305387735366821, 0.02172379195690155, 0.033560220152139664, 0.07613000273704529, -0.08503469824790955, -0.0985894501209259, 0.0473344512283802, 0.08206214010715485, 0.09118697792291641, -0.09788454324007034, -0.056773629039525986, 0.027751030400395393, 0.11308909952640533, 0.01173014659434557, -0.0526261180639267, 0.08375834673643112, -0.06721308082342148, 0.002185952151194215, 0.22240926325321198, 0.03395603597164154, 0.0112843606621027, -0.02481175772845745, 0.038510337471961975, 0.04131964221596718, -0.060409776866436005, 0.10460647940635681, -0.11263976991176605, -0.004003997892141342, -0.008662143722176552, 0.06026001274585724, -0.028764506801962852, 0.10838635265827179, -0.0722159817814827, -0.12743613123893738, 0.049995679408311844, -0.0180178415030241, -0.15492761135101318, 0.042037319391965866, 0.0151674784719944, -0.03197109326720238, -0.12607577443122864, -0.06812575459480286, -0.05899114906787872, -0.001534232753328979, 0.05846991762518883, -0.08299592137336731, 0.10094556957483292, 0.057529106736183167, -0.023852629587054253, 0.08330795913934708, -0.055993810296058655, 0.037008609622716904, 0.0003999139880761504, 0.006117183715105057, -0.024582000449299812, -0.059483837336301804, -0.08301128447055817, 0.13969872891902924, -0.011950896121561527, -0.07509434968233109, -0.03796103224158287, -0.07339855283498764, 0.07285527139902115, -0.05423576012253761, 0.11921947449445724, 0.09160514175891876, 0.020940566435456276, 0.016012195497751236, 0.011311445385217667, 0.01521892286837101, -0.10772968083620071, -0.05279262363910675, -0.012499609030783176, -0.04913768172264099, 0.13317590951919556, -0.17815807461738586, 0.07347086071968079, -0.016400661319494247, -0.05670389533042908, -0.024000031873583794, -0.0047503202222287655, -0.017527641728520393, 0.06226452440023422, 0.05125955119729042, -0.08813092857599258, -0.005138243082910776, 0.023050323128700256, -0.11229884624481201, -0.07717763632535934, 0.07006026804447174, 0.13937996327877045, -0.10617288202047348, -0.10428649187088013, -0.010948501527309418, -0.05360671877861023, 0.037566132843494415, 0.04840850830078125, -0.09674331545829773, 0.04773258417844772, -0.10619077831506729, 0.023566728457808495, -0.005829447880387306, -0.027068905532360077, 0.15032392740249634, -0.09848958998918533, 0.1645847111940384, -0.05787556245923042, 0.08302631974220276, -0.18712274730205536, -0.03370501846075058, 0.10717160254716873, -0.005246718879789114, -0.028674140572547913, 0.08917837589979172, 0.013910721056163311, -0.05192423611879349, -0.19515618681907654, 0.012069052085280418, -0.09004711359739304, -0.007301419973373413, 0.07243950664997101, -0.08883334696292877, 0.027807051315903664, 0.0803048312664032, 0.008877086453139782, -0.00047371917753480375, 0.004934980534017086, 0.12083632498979568, -0.020457904785871506, -0.06862135976552963, 0.030165378004312515, 0.0093484902754426, -0.032343294471502304, -0.10127266496419907, 0.0673404186964035, 0.05152329057455063, 0.13456206023693085, -0.05321032181382179, -0.10292833298444748, 0.17481856048107147, -0.04438114911317825, 0.036774665117263794, 0.056029774248600006, 0.048003170639276505, 0.08031211048364639, -0.10758893191814423, -0.0522301159799099, -0.005382921546697617, -0.034487515687942505, -0.06907841563224792, -0.024163946509361267, 0.01549393031746149, 0.10364200174808502, -0.03802661970257759, 0.032571181654930115, -0.03853492811322212, -0.10693800449371338, 0.03579211235046387, -0.1325356513261795, 0.03430390730500221, -0.03227955847978592, -0.02654891461133957, 0.025118829682469368, 0.06386279314756393, 0.08594067394733429, 0.04519442096352577, 0.0017081093974411488, 0.055864810943603516, -0.008204749785363674, -0.06353010982275009, -0.020822111517190933, -0.1381392627954483, -0.06906579434871674, 0.0856577455997467, -0.017955243587493896, -0.07959948480129242, -0.038494475185871124, 0.026764484122395515, -0.1630081683397293, 0.09206593781709671, -0.15521083772182465, -0.0756673663854599, -0.07405191659927368, 0.1067933738231659, -0.09316815435886383, 0.08169980347156525, 0.10973711311817169, 0.11546564102172852, 0.06738724559545517, 0.012215899303555489, -0.03904186189174652, -0.0022130177821964025, -0.11998051404953003, -0.06413823366165161, 0.08335326611995697, -0.028141459450125694, 0.027784179896116257, -0.0661446675658226, -0.0791282206773758, -0.04706481099128723, 0.09620025753974915, -0.10131661593914032, -0.029462410137057304, 0.02231491543352604, -0.07334453612565994, -0.09360961616039276, -0.02726745419204235, 0.1271931678056717, 0.0870116800069809, -0.04171924665570259, 0.11899217218160629, 0.08201443403959274, 0.0882607027888298, 0.012029333971440792, 0.0064271846786141396, 0.017216283828020096, 0.02803133800625801, -0.12711188197135925, 0.09435116499662399, 0.00637040613219142, -0.017525941133499146, 0.0909179225564003, 0.07725069671869278, -0.05341727286577225, -0.09981366991996765, 0.1441788524389267, -0.048836834728717804, -0.06262891739606857, 0.09394536167383194, -0.04749080166220665, -0.07654807716608047, 0.03081795759499073, -0.07575008273124695, 0.07753713428974152, 0.09013905376195908, -0.1354808807373047, 0.08688198029994965, -0.03173455595970154, -0.18928442895412445, -0.03685002028942108, 0.16190573573112488, 0.0874270424246788, -0.019523432478308678, 0.1375485062599182, -0.040706902742385864, -0.017923563718795776, -0.05625198036432266, 0.028623314574360847, 0.02364237979054451, -0.01155848428606987, -0.016178738325834274, -0.058885540813207626, -0.10650688409805298, -0.09405133128166199, 0.01391906663775444, 0.06267004460096359, 0.11321921646595001, -0.02431136928498745, 0.031506504863500595, 0.05470522865653038, 0.05373714119195938, -0.018651168793439865, -0.09199417382478714, -0.05166969448328018, 0.06199648976325989, -0.07883337140083313, 0.07859945297241211, -0.03732379525899887, -0.022317759692668915, -0.014122369699180126, -0.020469048991799355, -0.1094532310962677, 0.08279421180486679, -0.03483959287405014, -0.008904639631509781, 0.008351500146090984, 0.06948109716176987, 0.019178269430994987, -0.040389858186244965, 0.09229294210672379, -0.0858227014541626, -0.01562240906059742, 0.07739944010972977, -0.11226582527160645, 0.06318997591733932, -0.14436224102973938, -0.07805759459733963, -0.03895585611462593, 0.00205807713791728, -0.03260503336787224, 0.06497397273778915, 0.016538146883249283, 0.09308597445487976, -0.016580907627940178, -0.0098080113530159, -0.013746111653745174, -0.14663057029247284, -0.08688574284315109, -0.08494438976049423, 0.014370925724506378, -0.08188844472169876, 0.0754517912864685, -0.01684601977467537, 0.09027597308158875, 0.08109427243471146, 0.04349837079644203, 0.1111988052725792, -0.07463392615318298, 0.08800508081912994, -0.01154419407248497, -0.013034365139901638, 0.021223057061433792, -0.027105359360575676, -0.09139682352542877, -0.1555199772119522, -0.11217889934778214, 0.07838894426822662, -0.03353429213166237, 0.08681312948465347, 0.06418871134519577, -0.04127892479300499, 0.023456649854779243, 0.13777321577072144, -0.059326931834220886, 0.04988952726125717, 0.11157321184873581, -0.08193029463291168, 0.08867752552032471, 0.03148502856492996, 0.08998892456293106, 0.14628291130065918, -0.04156825691461563, -0.11513223499059677, -0.018468515947461128, 0.11207064986228943, 0.03242986276745796, -0.04369835928082466, -0.023902105167508125, -0.07982730865478516, 0.0216702651232481, 0.014824018813669682, 0.0027558787260204554, -0.08115745335817337, 0.15117351710796356, 0.021551644429564476, -6.276032945606858e-05, 0.14248783886432648, -0.05277516692876816, -0.09309064596891403, -0.0034181035589426756, -0.0582568533718586, -0.01986098475754261, 0.056279171258211136, -0.044411059468984604, 0.02865981124341488, 0.08946266025304794, -0.05440528318285942, -0.013064360246062279, 0.00022731255739927292, 0.04875054955482483, -0.013827532529830933, -0.009278440847992897, -0.004799394868314266, -0.024274775758385658, -0.08632660657167435, 0.02952348254621029, -0.08638283610343933, -0.15550334751605988, 0.004935166798532009, -0.08242014050483704, -0.06140216812491417, -0.1494915634393692, 0.18469832837581635, 0.046218253672122955, 0.14027144014835358, -0.038520511239767075, -0.04460877925157547, -0.00860768835991621, -0.04626378044486046, 0.010427533648908138, 0.12963731586933136, -0.010576299391686916, 0.14823272824287415, 0.06164460629224777, -0.13880273699760437, 0.1100272461771965, 0.08232948184013367, 0.010674799792468548, -0.029205862432718277, 0.014223304577171803, 3.497675061225891e-05, -0.05669190734624863, -0.11498189717531204, 0.026993896812200546, -0.007126905489712954, 0.0904359519481659, 0.062264516949653625, 0.08117193728685379, -0.12219113856554031, -0.07280556112527847, -0.1268983632326126, 0.10555201768875122, 0.09650614112615585, -0.0126185342669487, 0.038583554327487946, 0.00047052878653630614, 0.02664921246469021, -0.04442434757947922, -0.027308303862810135, -0.07635128498077393, 0.04652932658791542, 0.03145858272910118, 0.13502979278564453, -0.13925901055335999, -0.11957817524671555, -0.0013304969761520624, -0.09349576383829117, 0.06531520187854767, -0.07679473608732224, -0.07766497880220413, -0.07486402988433838, -0.13575197756290436, -0.023179808631539345, -0.0063566486351192, 0.03431781008839607, -0.11029212921857834, 0.14394670724868774, -0.10972727835178375, 0.019688036292791367, 0.06424470245838165, 0.006108293775469065, 0.03985730558633804, -0.006766104139387608, -0.13922691345214844, 0.10631173104047775, 0.02601739391684532, 0.020235583186149597, 0.003989729098975658, 0.03716358169913292, 0.008161084726452827, -0.11301058530807495, -0.0800672397017479, 0.05677275359630585, -0.07923723012208939, 0.05948078632354736, 0.0607328787446022, 0.059022609144449234, -0.06207580119371414, 0.016338784247636795, -0.037090495228767395, 0.1404290348291397, -0.11406688392162323, 0.08886762708425522, -0.08769629895687103, -0.07561776041984558, -0.06618694216012955, -0.06693903356790543, -0.0321820043027401, -0.016840336844325066, 0.03935341164469719, 0.1139141321182251, 0.05965670570731163, 0.04683446139097214, 0.03266451880335808, 0.07058797031641006, 0.05326465144753456, -0.06182768568396568, 0.05464962124824524, 0.05109421908855438, 0.11843258142471313, 0.00334428483620286, -0.0324743278324604, -0.08433818072080612, 0.00219000899232924, -0.00821798387914896, -0.04602888226509094, -0.05348093807697296, -0.09088219702243805, 0.031568098813295364, -0.1908467561006546, 0.06024082377552986, -0.05239258334040642, 0.0037383101880550385, 0.02443350851535797, 0.03560437634587288, -0.06707993894815445, 0.006623589899390936, -0.11027306318283081, 0.06937193870544434, 0.0927586480975151, 0.02691352553665638, -0.08149567246437073, 0.0076661366038024426, 0.02119310386478901, 0.09026020765304565, 0.0008226412464864552, 0.07247209548950195, -0.07019846886396408, -0.17486360669136047, 0.09465303272008896, 0.14010269939899445, -0.05381198227405548, -0.1274878829717636, 0.06311947107315063, -0.047310877591371536, -0.14641748368740082, 0.12029416859149933, -0.12818439304828644, -0.07193773239850998, 0.09934119135141373, 0.07015511393547058, 0.20366092026233673, -0.13130410015583038, 0.056427374482154846, -0.062274254858493805, -0.11481887102127075, 0.10994046926498413, -0.03222519904375076, -0.0844968855381012, -0.017823439091444016, -0.04064543545246124, 0.09349359571933746, -0.08112800121307373, -0.00505094975233078, 0.02645905315876007, -0.05289071425795555, -0.08914773166179657, 0.02503528818488121, -0.1394486278295517, 0.04338981211185455, -0.06464250385761261, 0.17688408493995667, 0.10861973464488983, -0.08244369179010391, 0.02135264314711094, 0.051784224808216095, -0.0017968741012737155, 0.02413710206747055, -0.09433269500732422, 0.11904317140579224, 0.016957808285951614, 0.07694736868143082, -0.00901754666119814, 0.01634920760989189, -0.0949113592505455, 0.05941762775182724, 0.0028815646655857563, 0.049786265939474106, -0.02554730325937271, -0.0939357727766037, 0.02265213243663311, 0.02061600051820278, -0.03595573455095291, -0.17454466223716736, -0.08279232680797577, 0.17065806686878204, 0.09129563719034195, 0.11262870579957962, -0.05944570153951645, 0.034294649958610535, -0.0873003676533699, -0.04283670336008072, -0.09754738956689835, -0.002146529732272029, -0.13453362882137299, 0.056330494582653046, -0.1580726057291031, -0.07661224901676178, -0.10915596783161163, 0.040342699736356735, -0.025173624977469444, -0.09011604636907578, 0.07478861510753632, -0.03149207681417465, -0.02115858718752861, 0.05027860403060913, 0.06028537079691887, 0.061505191028118134, -0.03982328251004219, -0.09257877618074417, 0.09645166993141174, -0.04317513480782509, -0.1317605823278427, -0.05914894863963127, 0.1176510751247406, 0.18066108226776123, 0.05103222653269768, -0.1600513905286789, 0.10795293748378754, 0.07947758585214615, -0.05204535648226738, -0.18270450830459595, 0.08501002192497253, 0.18955513834953308, -0.16653156280517578, -0.03818473964929581, 0.02755374275147915, -0.05473481863737106, 0.08349520713090897, -0.21231219172477722, -0.08521001785993576, -0.15607638657093048, 0.0500144399702549, -0.05710865929722786, 0.01804564706981182, 0.02496652863919735, -0.004843608476221561, -0.09352754056453705, -0.033026836812496185, 0.16404251754283905, 0.05380511283874512, -0.04921150207519531, -0.05546530336141586, -0.19372650980949402, 0.018175436183810234, 0.00734695652499795, -0.233490452170372, 0.028684688732028008, -0.16659490764141083, 0.0657404363155365, -0.052358441054821014, -0.07236341387033463, 0.003747959155589342, -0.026800386607646942, 0.0329885296523571, 0.12065071612596512, 0.04813077673316002, -0.0774528980255127, 0.10859493911266327, -0.01009615883231163, 0.047825634479522705, -0.0531659796833992, -0.06404503434896469, -0.015065857209265232, -0.08506719768047333, -0.18946878612041473, -0.014455675147473812, -0.08087579905986786, -0.1032659038901329, -0.0017665036721155047, 0.0175639521330595, 0.043108291923999786, 0.057968974113464355, 0.04662694036960602, -0.0659305676817894, 0.08105900883674622, -0.011283550411462784, -0.09809727221727371, -0.013193818740546703, -0.1311730146408081, 0.09125763922929764, 0.0448463000357151, 0.15155401825904846, 0.01638058014214039, 0.02175581455230713, 0.08742722868919373, -0.08348066359758377, -0.05383969843387604, -0.026150671765208244, -0.07602409273386002, -0.07616496831178665, 0.051742516458034515, -0.02764967828989029, -0.047120437026023865, -0.03317956253886223, 0.03647366538643837, -0.013285435736179352, -0.12558729946613312, 0.03952895849943161, 0.0010822545737028122, -0.052849989384412766, -0.07219722121953964, 0.059248413890600204, 0.056946661323308945, 0.02343793958425522, 0.05617931857705116, -0.013030513189733028, -0.0655679777264595, -0.01815629191696644, 0.01479974202811718, -0.049998585134744644, 0.10956057161092758, 0.013645263388752937, -0.07629088312387466, -0.022790538147091866, -0.12385479360818863, -0.0048979767598211765, 0.0041781882755458355, 0.04973848909139633, -0.1311015486717224, 0.04379449039697647, 0.04198167845606804, -0.07519081234931946, -0.0831398144364357, -0.06769121438264847, -0.02237711474299431, 0.09423723816871643, -0.06902291625738144, -0.027239827439188957, 0.1113477274775505, -0.14411981403827667, -0.03103378601372242, -0.08593666553497314, 0.03631472587585449, -0.019984183833003044, 0.03516868129372597, -0.02291034534573555, -0.16630451381206512, -0.004609180148690939, 0.017361154779791832, 0.09480493515729904, 0.01930762082338333, -0.06872889399528503, 0.047866955399513245, 0.06233813986182213, -0.014416096732020378, -0.04518586024641991, 0.012112155556678772, 0.025876808911561966, 0.04804471507668495, -0.15403372049331665, -0.09844553470611572, 0.035555507987737656, -0.06035472825169563, -0.05515725165605545, 0.0010604793205857277, -0.018312061205506325, 0.17274455726146698, 0.01843777671456337, -0.028170105069875717, -0.050173673778772354, -0.007935470901429653, -0.047071974724531174, -0.025407593697309494, 0.04529717564582825, 0.019638244062662125, -0.05526001378893852, -0.05239693447947502, 0.11726082116365433, 0.04381667077541351, -0.0046334899961948395, -0.010014347732067108, -0.02693139761686325, -0.06598231196403503, -0.0886460617184639, -0.06958279758691788, 0.014484108425676823, -0.08996111899614334, 0.0415511392056942, 0.11384447664022446, -0.058480944484472275, -0.015411864966154099, 0.08684930205345154, 0.03538653627038002, 0.028510751202702522, 0.00717649981379509, -0.04592188820242882, -0.026843702420592308, -0.11090452969074249, -0.05579155310988426, 0.015108618885278702, 0.04349499195814133, -0.1293065994977951, 0.005962274502962828, 0.08837860077619553, 0.07128763943910599, 0.022219233214855194, 0.172760471701622, 0.13211606442928314, -0.0669320821762085, -0.14355406165122986, -0.13987202942371368, 0.10799296200275421, -0.06052282825112343, 0.01850402168929577, 0.09657640010118484, 0.06056622788310051, -0.16405634582042694, -0.10715996474027634, -0.09814124554395676, -0.027766192331910133, -0.0634637326002121, 0.044212061911821365, 0.14083752036094666, 0.05769788473844528, -0.007863735780119896, -0.017026197165250778, -0.0563369058072567, -0.01088426262140274, -0.009099645540118217, 0.07123404741287231, -0.11135166138410568, 1.987076575460378e-05, -0.053889837116003036, -0.005048252642154694, -0.000267338240519166, -0.05673279985785484, 0.011316369287669659, 0.05194804072380066, 0.005596986506134272, -0.031238945201039314, 0.0722072571516037, 0.08096416294574738, 0.02811301127076149, -0.04533175751566887, 0.16549302637577057, -0.031300630420446396, -0.12165546417236328, 0.08767597377300262, -0.05150485411286354, -0.05231459438800812, 0.04210815578699112, 0.08861036598682404, 0.05476808920502663, -0.09586327522993088, -0.019214902073144913, -0.016485201194882393, -0.01527505274862051, 0.020617101341485977, -0.03497017174959183, -0.014268472790718079, 0.03181739151477814, 0.07146669924259186, -0.06694786250591278, -0.0655931755900383, -0.02684931457042694, 0.11373092979192734, 0.18650570511817932, -0.0240053478628397, -0.09470691531896591, 0.08638623356819153, 0.05143861100077629, 0.002585814567282796, 0.14991255104541779, 0.007390827406197786, 0.0743662416934967, -0.13584716618061066, 0.04081510007381439, -0.048542570322752, 0.093893863260746, 0.08341091126203537, -0.014826595783233643, -0.09484878927469254, 0.08072318881750107, -0.006492228712886572, -0.11107116937637329, -0.14909079670906067, 0.05333307757973671, -0.03848356753587723, 0.05080437287688255, 0.032935161143541336, 0.008180082775652409, 0.024029474705457687, 0.026960238814353943, -0.15829037129878998, 0.03941724821925163, -0.03464213013648987, 0.0005908994935452938, -0.08439411222934723, 0.15615397691726685, 0.10376163572072983, 0.15198804438114166, -0.055254481732845306, -0.04561978951096535, 0.1053326427936554, 0.034618306905031204, -0.01544228009879589, 0.06295479834079742, 0.04835948348045349, -0.05208267644047737, -0.05272247642278671, -0.14997804164886475, -0.04179954156279564, 0.01236018817871809, 0.01826205663383007, -0.07174043357372284, -0.021004807204008102, -0.02682000957429409, -0.14166973531246185, -0.02500140480697155, 0.018647465854883194, 0.035021014511585236, 0.09027472883462906, 0.001803317223675549, -0.0120705496519804, 0.09830216318368912, -0.05298352986574173, 0.03710251301527023, -0.06362829357385635, -0.05128457397222519, -0.04421910643577576, -0.14712344110012054, -0.08114073425531387, -0.09808886796236038, 0.13928252458572388, -0.1312006264925003, 0.06341993063688278, 0.1838836967945099, 0.1617455631494522, -0.018200041726231575, -0.0780886858701706, 0.028078049421310425, -0.048232853412628174, -0.10096344351768494, -0.053459249436855316, -0.063735730946064, -0.015547176823019981, -0.033137451857328415, 0.16794545948505402, -0.11415554583072662, -0.1458132266998291, -0.20653337240219116, -0.025836214423179626, -0.07449299097061157, 0.07811003923416138, -0.047815952450037, 0.1332579255104065, 0.04204967990517616, -0.06382100284099579, 0.07390392571687698, 0.07318223267793655, -0.011656785383820534, -0.016165656968951225, 0.01499195583164692, -0.11631293594837189, 0.010171203874051571, 0.07795047014951706, -0.04842137545347214, -0.03666367009282112, -0.10823717713356018, -0.13285382091999054, -0.02911098301410675, 0.02151261456310749, 0.04922587424516678, -0.012463702820241451, -0.027043508365750313, -0.043572019785642624, 0.02190648578107357, 0.022624805569648743, -0.02736406773328781, -0.0711638554930687, 0.00625474052503705, -0.14656752347946167, -0.05491463094949722, 0.11766832321882248, 0.05202784389257431, -0.02568843588232994, 0.04073060303926468, -0.09848248213529587, -0.07478369027376175, -0.002339072758331895, -0.04465900734066963, -0.044955234974622726, 0.03325914219021797, -0.09706311672925949, -0.05941462144255638, -0.1812666654586792, 0.04448731616139412, -0.12878559529781342, 0.10461431741714478, 0.06982970982789993, -0.013062138110399246, -0.022156905382871628, 0.0011530144838616252, -0.0457354299724102, 0.12492462992668152, 0.005180509760975838, 0.03461087867617607, -0.04641544073820114, -0.08050322532653809, 0.01725018210709095, 0.09061881899833679, -0.03868749737739563, -0.11095984280109406, -0.06327877938747406, -0.13225455582141876, -0.016634585335850716, -0.030031375586986542, -0.16456115245819092, -0.006486004684120417, -0.02397298440337181, 0.04928280785679817, 0.0884498730301857, -0.062004752457141876, 0.0003174875455442816, -0.07026330381631851, -0.09528782963752747, -0.020033149048686028, -0.05760057270526886, 0.08597078919410706, -0.048260800540447235, 0.15648408234119415, -0.029748598113656044, 0.04303901642560959, 0.009021935053169727, 0.0673351138830185, -0.06826823204755783, -0.03736305981874466, -0.03894059732556343, -0.11422150582075119, -0.07317592948675156, -0.012950656935572624, -0.0032668584026396275, 0.08718361705541611, 0.042955536395311356, 0.10470914840698242, -0.017008740454912186, 0.011604816652834415, -0.02397656813263893, 0.15226507186889648, 0.024567829445004463, 0.02236693724989891, -0.006303677335381508, -0.017945008352398872, -0.07357218116521835, 0.1475050300359726, 0.0651477575302124, 0.07457214593887329, 0.04809416085481644, 0.08208262175321579, 0.05477212369441986, 0.012189777567982674, 0.034634094685316086, 0.004709440749138594, -0.018965350463986397, 0.06696806102991104, 0.02911752089858055, -0.07272180914878845, -0.11723318696022034, -0.016499051824212074, 0.13750556111335754, -0.08935936540365219, -0.03433391824364662, -0.016896454617381096, 0.10036146640777588, 0.10179836302995682, 0.0416303351521492, -0.16881270706653595, 0.00023425414110533893, 0.038306303322315216, -0.002194201573729515, 0.01753721944987774, 0.12168822437524796, 0.10049676895141602, -0.05140534043312073, 0.07521293312311172, 0.04846808314323425, -0.06114885210990906, 0.07946792244911194, -0.01047610118985176, 0.04346727952361107, -0.022388393059372902, -0.09270595014095306, -0.011973174288868904, -0.053088005632162094, 0.08021293580532074, 0.07371647655963898, -0.025583159178495407, -0.06804508715867996, -0.16853272914886475, -0.1275034099817276, -0.10614801943302155, -0.053075142204761505, 0.11807248741388321, 0.005063022021204233, -0.08429089188575745, -0.057949911803007126, -0.02137150801718235, -0.0004177374648861587, -0.14344966411590576, -0.15552066266536713, 0.05126915127038956, -0.017065221443772316, -0.026671461760997772, 0.014080108143389225, -0.023211808875203133, -0.004110973794013262, -0.09765791147947311, 0.14529438316822052, 0.042810238897800446, 0.03463844209909439, -0.03161352127790451, -0.0641864463686943, 0.09251873195171356, 0.13075312972068787, 0.021355047821998596, 0.05013369023799896, 0.055907439440488815, -0.030510300770401955, 0.14161597192287445, 0.012395278550684452, 0.09452646970748901, 0.04109290614724159, -0.08932796120643616, 0.02193734049797058, -0.03715931624174118, 0.12434149533510208, -0.16153036057949066, -0.08874349296092987, 0.017937282100319862, -0.0356978215277195, 0.03329526633024216, -0.05742330104112625, 0.04414362460374832, 0.0014687867369502783, 0.05096154287457466, -0.031215544790029526, 0.1080288216471672, -0.037342917174100876, 0.05915127322077751, -0.026004865765571594, 0.06896258145570755, 0.1629897952079773, 0.05130356550216675, -0.113637275993824, 0.09090592712163925, 0.05812496319413185, -0.0329727865755558, -0.005299842916429043, -0.008368401788175106, 0.02442309446632862, 0.08653251826763153, -0.013378494419157505, -0.07560661435127258, -0.1118616983294487, -0.12252824008464813, -0.09492544829845428, -0.013483228161931038, -0.07654460519552231, -0.08939284086227417, -0.053839925676584244, -0.1716805249452591, 0.14097711443901062, -0.05577006936073303, 0.003849726403132081, 0.025513745844364166, 0.03174819052219391, -0.09309621900320053, -0.042358189821243286, 0.18709149956703186, 0.0625409409403801, 0.054897159337997437, 0.12366806715726852, 0.0022784110624343157, 0.06026599183678627, 0.13114775717258453, 0.035814058035612106, -0.020169254392385483, 0.01784690096974373, 0.003714418038725853, -0.03300517797470093, -0.07199631631374359, 0.12711898982524872, 0.028722763061523438, 0.1002030223608017, -0.03345192223787308, -0.002711513079702854, -0.1447158306837082, 0.12328442186117172, 0.00929389800876379, 0.15240585803985596, 0.07946037501096725, -0.09902980178594589, 0.018715977668762207, 0.006569796707481146, -0.07999324053525925, -0.032266248017549515, -0.06682932376861572, 0.17306245863437653, -0.08984047174453735, 0.01589452289044857, -0.15309837460517883, -0.019315006211400032, -0.05890306085348129, -0.10740423202514648, -0.006061128806322813, 0.0787663534283638, -0.04055849835276604, 0.022146835923194885, -0.08367052674293518, 0.043144576251506805, 0.001017286442220211, -0.008260317146778107, 0.05265916511416435, 0.035974837839603424, -0.0774676725268364, 0.0873933658003807, -0.01873200200498104, -0.15841402113437653, 0.014443134889006615, 0.12175378203392029, 0.05901751294732094, 0.13391242921352386, 0.07445445656776428, -0.14593085646629333, -0.0533401258289814, 0.03906307369470596, -0.015949955210089684, -0.08524496853351593, -0.0011188543867319822, 0.044525593519210815, 0.07379769533872604, 0.007205430418252945, 0.028152775019407272, 0.008210615254938602, -0.06719464808702469, 0.032800305634737015, 0.012210585176944733, 0.0836787223815918, 0.011472843587398529, -0.0026649502106010914, 0.09819579124450684, -0.07592005282640457, -0.004063284490257502, -0.07742102444171906, -0.01825694926083088, -0.01966574229300022, 0.11928349733352661, -0.04273610562086105, 0.05922003462910652, -0.1185784712433815, -0.09841667115688324, 0.04949890449643135, -0.01971854455769062, -0.0418442003428936, 0.13506336510181427, 0.05214466527104378, 0.0186696145683527, 0.033675000071525574, 0.12370460480451584, -0.14323671162128448, 0.06949710845947266, 0.05613493546843529, 0.099062979221344, 0.09562885761260986, -0.009936845861375332, -0.05972956866025925, -0.03700230270624161, -0.028400912880897522, -0.16433945298194885, 0.010477752424776554, 0.05461303889751434, -0.05072921887040138, 0.05904686450958252, -0.027860652655363083, 0.012518109753727913, -0.017635010182857513, -0.12546320259571075, -0.11832696199417114, 0.049880772829055786, -0.03201455995440483, 0.06382434815168381, -0.0603071004152298, -0.09228493273258209, 0.06761378794908524, 0.069643035531044, 0.0016087200492620468, -0.06359688192605972, 0.005697907414287329, -0.03370235860347748, 0.0738668441772461, -0.029930712655186653, -0.07357423007488251, -0.03491879254579544, 0.13639412820339203, -0.07689707726240158, 0.09312134236097336, 0.05156714841723442, -0.015562882646918297, 0.022519662976264954, -0.025125013664364815, -0.0015279143117368221, -0.05636204406619072, -0.07162453979253769, -0.0044247787445783615, -0.1042945459485054, -0.02489357255399227, 0.04975169152021408, 0.08547696471214294, 0.030846519395709038, -0.04107809066772461, -0.06743083149194717, -0.024977872148156166, -0.021865174174308777, 0.033986520022153854, 0.10984443128108978, 0.04018060863018036, -0.059257183223962784, 0.14156432449817657, -0.10068709403276443, -0.0971238985657692, -0.052687812596559525, -0.06804440170526505, -0.17213323712348938, -0.0052813319489359856, -0.03888733312487602, 0.15950244665145874, 0.09605154395103455, -0.019001489505171776, -0.0414346344769001, 0.12576013803482056, -0.0005574107635766268, 0.16201995313167572, -0.030713055282831192, 0.09348231554031372, 0.06402745842933655, 0.08895720541477203, 0.06577996909618378, -0.10260741412639618, 0.10283612459897995, 0.019884807989001274, -0.056486353278160095, 0.004210314713418484, 0.042959313839673996, -0.0758017748594284, 0.12783460319042206, 0.005616805981844664, -0.06779825687408447, 0.01849529705941677, -0.09307968616485596, 0.06490606814622879, 0.011120885610580444, 0.025418739765882492, 0.18264517188072205, -0.02772369422018528, 0.013131659477949142, -0.08081647008657455, -0.02697114460170269, 0.05025482550263405, 0.12264678627252579, -0.038425710052251816, 0.014778482727706432, 0.04263706132769585, -0.02542879618704319, -0.045830320566892624, -0.025898568332195282, -0.09383183717727661, -0.05551711469888687, -0.04272867366671562, 0.02437993697822094, 0.008577370084822178, -0.003502428764477372, 0.05010112747550011, 0.024970024824142456, 0.02130097895860672, -0.05140460282564163, -0.12499064207077026, -0.027677109465003014, 0.08143831044435501, 0.09217716008424759, 0.02530360035598278, -0.19674700498580933, -0.0025741029530763626, 0.03627633675932884, -0.007099848240613937, 0.06500237435102463, 0.07669210433959961, 0.0696786567568779, -0.0322226881980896, 0.1355106085538864, 0.06739300489425659, 0.02120821923017502, 0.0007089085411280394, -0.010674151591956615, 0.10306722670793533, -0.05296449363231659, 0.057548124343156815, -0.08256669342517853, -0.010684897191822529, -0.02750522457063198, 0.05363727733492851, 0.15093761682510376, -0.013871674425899982, -0.14933866262435913, 0.0006946793873794377, -0.050535935908555984, -0.01681017130613327, 0.01199558936059475, -0.025786377489566803, 0.015558244660496712, 0.04844661056995392, 0.05497285723686218, -0.08372765779495239, 0.044036902487277985, -0.0034615532495081425, -0.03747209906578064, 0.059637412428855896, 0.0009058842551894486, 0.028917677700519562, -0.001423687906935811, -0.1205170601606369, -0.008890075609087944, 0.07656016945838928, 0.05856259912252426, 0.025133982300758362, -0.08805675804615021, -0.06533227115869522, 0.046113211661577225, 0.03478396683931351, 0.047291334718465805, 0.03892822563648224, 0.11018142849206924, 0.003685186617076397, -0.04188448563218117, 0.14006292819976807, 0.048823270946741104, 0.06969822943210602, -0.09880635887384415, 0.03018944524228573, 0.021619271486997604, -0.08200301229953766, 0.012212835252285004, -0.031686488538980484, 0.034972719848155975, 0.02397635206580162, 0.06989387422800064, -0.08806608617305756, 0.02033310756087303, -0.09855899214744568, 0.026854652911424637, 0.02706923522055149, 0.03866195306181908, -0.01976100355386734, -0.12433774024248123, -0.033295780420303345, -0.06670785695314407, -0.1562381386756897, -0.019295647740364075, 0.07866310328245163, 0.009999126195907593, 0.16774523258209229, -0.040836527943611145, 0.060578979551792145, -0.023892300203442574, 0.14952696859836578, 0.0008515168447047472, 0.047235313802957535, 0.019890740513801575, -0.15881337225437164, 0.06579885631799698, 0.009456652216613293, -0.09164661169052124, -0.036714788526296616, -0.06989167630672455, -0.11883886903524399, -0.13798071444034576, -0.03451383858919144, -0.045426640659570694, -0.006601986940950155, 0.10928551107645035, 0.10621515661478043, -0.09920476377010345, -0.051972270011901855, -0.17077773809432983, 0.05167455971240997, 0.08887835592031479, -0.050960879772901535, 0.05703310668468475, 0.0051273563876748085, 0.07994770258665085, 0.05494283512234688, -0.05661247298121452, 0.1693083941936493, -0.0980694517493248, -0.004617162048816681, -0.042843833565711975, -0.03460429981350899, 0.02797088585793972, -0.007004658691585064, -0.014767633751034737, -0.09580790996551514, 0.03417063131928444, -0.026597069576382637, -0.12131702899932861, -0.03295133635401726, -0.03575139492750168, -0.05098261311650276, 0.03761360049247742, -0.0807998850941658, -0.037637483328580856, -0.02023431845009327, 0.08985923230648041, 0.09698980301618576, 0.09703650325536728, -0.035484444350004196, -0.040479425340890884, -0.0005779345519840717, -0.10276951640844345, 0.012903846800327301, 0.023167487233877182, 0.028308341279625893, 0.06245457008481026, -0.08953475952148438, -0.04262828081846237, -0.08983788639307022, 0.053464893251657486, -0.055872462689876556, 0.024469386786222458, 0.0007135903579182923, 0.08166133612394333, 0.10152073204517365, 0.03968880698084831, -0.15074822306632996, 0.0686858594417572, -0.029726650565862656, 0.1285599172115326, -0.01858929544687271, 0.06536572426557541, -0.1262800246477127, -0.09127622097730637, -0.07845903187990189, 0.009698011912405491, 0.009136322885751724, 0.1168900802731514, 0.07606630027294159, -0.02147083170711994, -0.06885068118572235, 0.037545621395111084, -0.014558123424649239, 0.037688422948122025, 0.06003594398498535, -0.0982438400387764, -0.17283481359481812, 0.061984844505786896, -0.005476226098835468, -0.014933479949831963, 0.09191522747278214, -0.07346929609775543, 0.04424874112010002, -0.007842814549803734, -0.12624673545360565, 0.012889114208519459, 0.05511939525604248, -0.13643106818199158, 0.03449516370892525, 0.07582101225852966, -0.04709842428565025, -0.052608318626880646, 0.0910666286945343, -0.015517108142375946, -0.010657631792128086, 0.09255298972129822, 0.041147131472826004, -0.019695548340678215, -0.002477614674717188, 0.11247599869966507, -0.09577412903308868, 0.07165393978357315, -0.033796846866607666, -0.023924272507429123, -0.002211036393418908, 0.027578389272093773, 0.03421305865049362, -0.14334703981876373, 0.056011613458395004, 0.1383967101573944, -0.09794799983501434, 0.11543750017881393, 0.09262937307357788, 0.008019662462174892, 0.10021615028381348, 0.031099636107683182, -0.0941135436296463, -0.024808496236801147, -0.13516895473003387, -0.12986306846141815, 0.08167587965726852, -0.10790839046239853, -0.06947498768568039, -0.11691839247941971, -0.18552030622959137, -0.12400796264410019, -0.09127505868673325, 0.002198562491685152, 0.10497719049453735, -0.11702390760183334, 0.03723632171750069, -0.1041770875453949, 0.09351911395788193, -0.0533599890768528, 0.09326983988285065, -0.01931525580585003, 0.14509578049182892, -0.07428406924009323, -0.1406847983598709, -0.04578814655542374, -0.03360620141029358, 0.07911112159490585, -0.0012973733246326447, 0.06699725240468979, -0.04851476103067398, -0.1093384325504303, -0.10082584619522095, -0.060083433985710144, -0.04775264859199524, 0.021965941414237022, 0.020036885514855385, 0.03756861761212349, 0.043865542858839035, -0.12009603530168533, -0.01108499988913536, -0.03393299877643585, 0.10324221849441528, -0.060596875846385956, 0.02488599717617035, -0.06219321861863136, 0.15715017914772034, 0.1408705860376358, 0.06227969750761986, -0.005747766233980656, -0.030660640448331833, -0.1216878592967987, 0.07817667722702026, -0.021775489673018456, 0.08895015716552734, 0.012728092260658741, -0.03303138539195061, -0.051158927381038666, -0.07603966444730759, 0.07127963751554489, 0.055838268250226974, 0.055240824818611145, 0.011913340538740158, 0.0056773885153234005, 0.0036803968250751495, 0.02516486495733261, 0.06849236786365509, -0.042384661734104156, -0.004513926804065704, 0.09820421040058136, 0.06172652170062065, 0.08213463425636292, -0.06213866546750069, -0.044294074177742004, 0.04367442801594734, 0.010073005221784115, -0.030047520995140076, 0.02070966549217701, -0.05000712350010872, -0.16090525686740875, -0.10019953548908234, 0.08680745214223862, 0.046070490032434464, 0.1637149304151535, -0.026634400710463524, 0.016642827540636063, 0.15833711624145508, 0.015084486454725266, -0.03069521300494671, -0.0694638192653656, -0.1624296009540558, -0.05604289844632149, -0.0540182925760746, -0.16188694536685944, -0.038672998547554016, 0.10976435989141464, -0.0809251070022583, 0.033108361065387726, -0.027548616752028465, 0.051716357469558716, 0.12925244867801666, -0.20091266930103302, 0.0877121314406395, 0.02736794576048851, 0.15114520490169525, 0.021639738231897354, 0.05928800627589226, 0.06071382388472557, 0.06104634329676628, -0.10528965294361115, 0.005203716456890106, 0.0074714068323373795, -0.045596085488796234, 0.044407203793525696, 0.05057164281606674, 0.11941131204366684, -0.04202069342136383, -0.005176113918423653, -0.022658227011561394, -0.02856633812189102, 0.04143434762954712, 0.08875337988138199, -0.0692337155342102, 0.05506889522075653, -0.05739519000053406, -0.06872119754552841, 0.020995866507291794, -0.0875626727938652, 0.1344701051712036, 0.07292802631855011, 0.08259856700897217, -0.12622344493865967, 0.17914432287216187, 0.17489828169345856, 0.06638044863939285, -0.11457855999469757, 0.13383135199546814, 0.012376716360449791, 0.17716291546821594, -0.044655054807662964, 0.07164352387189865, -0.1785186231136322, 0.003146341536194086, 0.16874895989894867, -0.12813694775104523, 0.10313557088375092, 0.0710831880569458, -0.005093140061944723, -0.05490321293473244, -0.021036231890320778, 0.12066977471113205, -0.0327649787068367, -0.10829707980155945, -0.05901522561907768, 0.03774639219045639, -0.011251838877797127, 0.09851422905921936, 0.03232334926724434, -0.025780273601412773, -0.10551702231168747, -0.15621411800384521, 0.013592179864645004, -0.009228612296283245, 0.009247160516679287, -0.1075865775346756, -0.014575512148439884, -0.0013065889943391085, -0.06765419244766235, 0.1382240206003189, 0.04908113554120064, -0.042911216616630554, -0.04738239943981171, 0.11497446149587631, -0.0884510800242424, -0.07986147701740265, -0.15754283964633942, 0.03484617546200752, 0.03746863082051277, -0.08359873294830322, -0.06581692397594452, 0.1038108840584755, -0.12025701254606247, -0.1900838166475296, -0.15492714941501617, 0.009465004317462444, 0.007842517457902431, 0.09453510493040085, -0.1252007782459259, 0.038129422813653946, 0.043046556413173676, -0.11743603646755219, -0.019847815856337547, 0.18425817787647247, 0.04147673770785332, -0.011463928036391735, -0.004548648372292519, 0.008098275400698185, -0.0472351610660553, 0.046815015375614166, 0.11527884751558304, -0.038124121725559235, -0.07473411411046982, -0.030063671991229057, -0.05039624869823456, 0.04405684024095535, 0.06694366037845612, 0.029630519449710846, 0.02393435500562191, -0.060984641313552856, 0.04903777688741684, 0.05918160825967789, -0.08573105186223984, 0.10579013079404831, -0.11324097216129303, 0.009135500527918339, 0.08800123631954193, 0.0499550923705101, -0.13411611318588257, 0.14026601612567902, -0.1272543966770172, -0.05087155103683472, -0.0102147301658988, 0.030244100838899612, 0.11382909119129181, -0.009207742288708687, -0.02306908741593361, -0.14451315999031067, 0.02492489293217659, 0.11117062717676163, -0.010324168018996716, 0.032116156071424484, 0.042710740119218826, -0.05720655620098114, 0.006428405176848173, 0.014154358766973019, -0.05790559574961662, 0.014536779373884201, 0.012051478028297424, -0.049611520022153854, -0.03212398290634155, 0.0648140236735344, -0.025256754830479622, 0.023117003962397575, 0.05856582522392273, -0.025375675410032272, 0.038415491580963135, -0.062443457543849945, 0.018276479095220566, 0.03379978612065315, -0.03585353493690491, 0.055979371070861816, 0.015628717839717865, 0.060428958386182785, 0.03318125009536743, 0.10111206769943237, -0.15550357103347778, -0.024854091927409172, -0.041714321821928024, -0.036470621824264526, 0.06258964538574219, 0.18437282741069794, -0.023765098303556442, -0.01582339219748974, 0.030302096158266068, -0.029317563399672508, 0.14508843421936035, -0.030134057626128197, 0.010614652186632156, 0.06140238791704178, 0.13635514676570892, 0.06463523954153061, -0.10532481223344803, 0.05504799634218216, -0.05626017972826958, -0.05302512273192406, -0.053119197487831116, -0.13619230687618256, -0.1450144201517105, 0.06278659403324127, -0.0019895490258932114, 0.11135704070329666, -0.0476248674094677, -0.022366991266608238, 0.10161703824996948, -0.017917336896061897, 0.04019604250788689, -0.01292797178030014, -0.012415949255228043, 0.02947981469333172, -0.035409584641456604, 0.036398403346538544, 0.015454432927072048, 0.04121468588709831, -0.024581758305430412, -0.15575434267520905, 0.07407206296920776, 0.08376429229974747, -0.06422494351863861, 0.07704010605812073, -0.15273377299308777, -0.14415673911571503, -0.10126399993896484, 0.12044673413038254, 0.09921430796384811, 0.007556282915174961, -0.10522419959306717, -0.06232383847236633, 0.028393033891916275, 0.10116370022296906, -0.013767904601991177, -0.026272224262356758, -0.13101302087306976, 0.029348718002438545, -0.05074770748615265, 0.017521632835268974, -0.05953052639961243, -0.05913808196783066, 0.07331204414367676, -0.07130061835050583, 0.05920407176017761, -0.013670512475073338, 0.03014867752790451, -0.018776582553982735, 0.1843303143978119, 0.03747780993580818, 0.05470193177461624, 0.1239631325006485, 0.00983431376516819, 0.1057412177324295, 0.06905796378850937, -0.176805317401886, 0.025461221113801003, 0.048159919679164886, 0.09358378499746323, -0.06653108447790146, 0.07570122927427292, 0.04422438144683838, -0.08058028668165207, -0.058970097452402115, 0.033030930906534195, -0.08533983677625656, -0.023373544216156006, 0.013590224087238312, 0.048982471227645874, -0.1500101238489151, 0.030979007482528687, -0.011862348765134811, -0.018578575924038887, 0.1260613203048706, 0.10906648635864258, 0.026809409260749817, -0.011263394728302956, 0.04798435792326927, -0.08054846525192261, -0.11715730279684067, -0.016224870458245277, 0.09086514264345169, 0.10957811027765274, 0.014936880208551884, 0.019171351566910744, -0.054365258663892746, 0.1325143575668335, -0.12940405309200287, -0.1184980496764183, 0.025248242542147636, -0.05188265070319176, 0.15077520906925201, 0.09688035398721695, 0.03308144211769104, 0.06875520199537277, -0.07413066178560257, 0.017008328810334206, -0.07413969933986664, 0.0031529287807643414, 0.13019533455371857, -0.08348415046930313, -0.06000317260622978, -0.10522738099098206, 0.00719843152910471, 0.03693435713648796, -0.030197611078619957, 0.12097267806529999, 0.06553265452384949, -0.049623649567365646, 0.0017046112334355712, -0.018511619418859482, 0.004474107176065445, -0.14936994016170502, -0.050479430705308914, 0.03466792404651642, -0.035727955400943756, -0.11630772799253464, 0.13727962970733643, 0.1346912682056427, 0.12695878744125366, 0.15024897456169128, -0.1081741452217102, 0.09489528089761734, -0.03468765318393707, 0.17364493012428284, 0.0193319208920002, -0.05742314085364342, -0.04443630203604698, -0.04207342118024826, 0.12068068981170654, 0.13726100325584412, 0.0024199315812438726, 0.17967097461223602, 0.032606106251478195, -0.07200782001018524, 0.1534050554037094, 0.03291723504662514, 0.1509171426296234, 0.006658799480646849, -0.14568661153316498, 0.08201746642589569, 0.13291119039058685, -0.0032787437085062265, -0.06532022356987, -0.08328219503164291, 0.004926348105072975, -0.0979187861084938, 0.1596430093050003, -0.10110162943601608, 0.0674210786819458, -0.04171018302440643, -0.018371816724538803, 0.0908270925283432, 0.016264379024505615, -0.04351819306612015, 0.00920060370117426, -0.04555170238018036, -0.1611398607492447, 0.01117105595767498, 0.10117115825414658, 0.08658287674188614, -0.02358270063996315, -0.04696424677968025, -0.016832835972309113, 0.043340053409338, 0.04028365761041641, -0.09889490157365799, -0.09783587604761124, 0.05588060989975929, -0.015524872578680515, 0.014855384826660156, 0.10572285205125809, 0.02697709947824478, 0.051120273768901825, 0.03432505950331688, 0.10892225056886673, -0.19090868532657623, -0.0378018394112587, 0.028100285679101944, 0.037372689694166183, -0.11564422398805618, -0.059159550815820694, 6.988004315644503e-05, -0.013252494856715202, 0.11158895492553711, 0.07567791640758514, 0.15641741454601288, -0.08894447982311249, -0.07334669679403305, 0.022561360150575638, -0.05463170260190964, 0.013281340710818768, -0.008625994436442852, 0.07022546976804733, -0.11201731860637665, -0.0688517689704895, 0.017497317865490913, -0.034256476908922195, 0.012196965515613556, 0.050217628479003906, 0.174241304397583, 0.07100940495729446, -0.04164430499076843, -0.07711610198020935, 0.0123700350522995, -0.040730953216552734, 0.0838518962264061, -0.1694200038909912, 0.08543044328689575, -0.005581569392234087, 0.13359801471233368, 0.1709367036819458, 0.000712415378075093, -0.06426642835140228, 0.16475343704223633, 0.06643930077552795, 0.050972599536180496, 0.07686872035264969, 0.07193818688392639, -0.1316186785697937, -0.012124846689403057, -0.038951463997364044, 0.08852536231279373, -0.01703161559998989, 0.03169482946395874, -0.10136408358812332, 0.05236401781439781, 0.022630440071225166, -0.06014654412865639, 0.09642080217599869, 0.14154189825057983, -0.12842994928359985, -0.09541741758584976, -0.036631301045417786, -0.054302044212818146, 0.07368408888578415, 0.0549759604036808, -0.022686008363962173, 0.11579394340515137, 0.08318085968494415, 0.015330122783780098, -0.02196170575916767, 0.07749997079372406, -0.1087481901049614, 0.11750226467847824, -0.028110744431614876, 0.012095817364752293, -0.06642978638410568, -0.07879140973091125, -0.12221159785985947, -0.0755840614438057, -0.1352609544992447, -0.08906552940607071, -0.14932073652744293, 0.028929738327860832, -0.08035853505134583, -0.002444677287712693, 0.03517260402441025, 0.1259971261024475, -0.04561138153076172, -0.007730986922979355, 0.001681359251961112, 0.07533577084541321, 0.15986935794353485, 0.035881366580724716, -0.02118621952831745, -0.05425874516367912, -0.023863090202212334, 0.09577517211437225, -0.039121489971876144, 0.10733704268932343, -0.06471259891986847, -0.03426701948046684, 0.08144623786211014, -0.08129195868968964, -0.00450622383505106, -0.08189289271831512, -6.14815071457997e-05, -0.009914057329297066, -0.08861113339662552, -0.08152085542678833, -0.044835641980171204, 0.08427242189645767, -0.1830504834651947, 0.017701294273138046, 0.17281033098697662, 0.03714669868350029, -0.07829141616821289, -0.14628387987613678, 0.03709305077791214, -0.041599515825510025, 0.14115552604198456, 0.09245214611291885, -0.007997828535735607, 0.08240589499473572, 0.07529257982969284, 0.14969268441200256, 0.00222890917211771, -0.11208529025316238, 0.08197832852602005, 0.12010807543992996, -0.09706241637468338, -0.04994383081793785, 0.021029092371463776, -0.010151209309697151, -0.04456716030836105, 0.14023646712303162, 0.12576718628406525, -0.0053093587048351765, 0.02630550041794777, -0.1381336748600006, 0.11287946254014969, -0.057274047285318375, -0.05041878670454025, -0.05412886291742325, -0.025604983791708946, -0.05254029482603073, -0.08607130497694016, -0.12246744334697723, 0.003379874862730503, 0.012358047999441624, 0.0801452025771141, -0.02734431065618992, -0.1114954873919487, -0.043084751814603806, 0.031160859391093254, 0.0696740448474884, 0.13741211593151093, -0.03639020025730133, 0.10437803715467453, -0.005212513264268637, 0.10121170431375504, 0.07287868857383728, 0.01803559996187687, -0.0505341999232769, -0.08327432721853256, -0.022177310660481453, -0.06638983637094498, -0.025434419512748718, -0.06254832446575165, 0.03732544183731079, 0.006545244716107845, 0.06812401115894318, 0.11235328763723373, 0.15961705148220062, 0.005247552413493395, -0.0017827972769737244, 0.029195306822657585, -0.1409437358379364, 0.016001932322978973, -0.09535440057516098, -0.009286453947424889, 0.03438974544405937, -0.11366624385118484, 0.0031235136557370424, -0.034455377608537674, -0.09375496208667755, -0.03734709694981575, -0.04798923432826996, -0.09756188094615936, 0.0661289319396019, -0.1700648069381714, -0.035273246467113495, 0.07570116221904755, -0.06859191507101059, -0.07517221570014954, 0.009939285926520824, 0.03801855072379112, -0.0737140029668808, -0.03606491908431053, 0.10952461510896683, -0.010569563135504723, 0.06919900327920914, -0.06172439828515053, 0.03487890958786011, -0.086640864610672, 0.08976515382528305, -0.007448786869645119, 0.05503524839878082, -0.016310840845108032, -0.03323610872030258, -0.0489489883184433, 0.13874880969524384, -0.060262493789196014, -0.10113119333982468, -0.03646694868803024, 0.1634606271982193, 0.11976681649684906, -0.10408414900302887, -0.10143537074327469, 0.04812220111489296, -0.03486569598317146, -0.10879968106746674, -0.17066003382205963, -0.10626937448978424, -0.034736961126327515, -0.11000464856624603, 0.003729079384356737, 0.11011400073766708, 0.03618466109037399, 0.15617141127586365, -0.08179327845573425, 0.029911912977695465, 0.16493123769760132, -0.01925475522875786, -0.04535438492894173, -0.06970445066690445, -0.05040984973311424, 0.08706679195165634, -0.09117542952299118, -0.12565292418003082, 0.15218284726142883, 0.012295054271817207, -0.10791265219449997, 0.02225181832909584, 0.0905841812491417, 0.15237896144390106, -0.07341235876083374, -0.07955463975667953, 0.09294069558382034, 0.033815350383520126, 0.03532547131180763, -0.0025102398358285427, -0.057246994227170944, -0.004367609973996878, 0.05068684741854668, -0.029792381450533867, 0.15052123367786407, -0.023301994428038597, -0.11651269346475601, 0.010719392448663712, 0.10515119880437851, -0.033441632986068726, -0.003271702444180846, 0.02206752635538578, 0.04297076538205147, 0.08891841024160385, -0.08510288596153259, -0.14224393665790558, -0.07806888967752457, 0.046099644154310226, -0.04058583825826645, -0.02945307269692421, -0.015413260087370872, -0.15243598818778992, 0.11185774952173233, -0.023983685299754143, -0.07066947966814041, -0.09427392482757568, -0.02898687683045864, -0.06038644164800644, -0.027786320075392723, -0.024467602372169495, -0.06862227618694305, -0.06767728179693222, 0.06354670226573944, 0.029103843495249748, 0.0893402174115181, -0.04082970321178436, 0.033075664192438126, -0.1548858880996704, -0.018245985731482506, 0.04060676321387291, 0.10932254791259766, 0.02788992039859295, 0.018431225791573524, -0.03408218175172806, -0.020924989134073257, 0.002393557922914624, 0.06851399689912796, 0.04064060375094414, 0.026738597080111504, -0.004522361792623997, 0.09510935097932816, -0.07904854416847229, -0.008394058793783188, 0.010460236109793186, -0.09553749859333038, 0.006876503583043814, 0.022835778072476387, 0.09350115805864334, -0.02256019227206707, 0.041073478758335114, 0.001267374842427671, 0.016014160588383675, 0.08016190677881241, -0.05630593001842499, 0.017452115193009377, 0.006421263329684734, -0.04745606705546379, 0.00729926535859704, 0.045847244560718536, 0.028798364102840424, 0.015237265266478062, 0.047667618840932846, 0.025165453553199768, 0.04686756804585457, -0.05062754452228546, -0.05440814793109894, 0.0206950381398201, 0.03353641554713249, 0.11415328830480576, -0.05652102082967758, -0.045751411467790604, -0.020831026136875153, 0.03619520738720894, 0.00258724857121706, -0.029584599658846855, -0.1244194284081459, 0.026314079761505127, -0.01706533506512642, 0.023948529735207558, -0.0008935777004808187, 0.06423237174749374, 0.12323088943958282, -0.1128658577799797, -0.020332349464297295, -0.09585349261760712, 0.08531365543603897, 0.10440415143966675, -0.13143964111804962, 0.03322670981287956, 0.11568517237901688, 0.20964685082435608, -0.03965340927243233, -0.11680196970701218, 0.11123886704444885, -0.052659131586551666, -0.06250763684511185, -0.08996880799531937, -0.021519990637898445, -0.0030182187911123037, 0.18505267798900604, 0.03753846138715744, -0.0865648165345192, 0.08180300146341324, -0.002453325316309929, 0.0450262650847435, 0.09189143776893616, 0.014102932065725327, 0.1931230127811432, -0.07994859665632248, -0.01472416054457426, 0.10843215137720108, 0.08918897807598114, 0.10267499089241028, -0.006575379054993391, -0.08796495199203491, 0.04818744212388992, 0.12193883210420609, 0.00918393675237894, 0.1231154128909111, -0.15681132674217224, -0.08250623196363449, -0.037611544132232666, 0.1007855013012886, 0.08703278005123138, -0.011979429982602596, -0.08858953416347504, 0.0016662620473653078, 0.023603403940796852, -0.10411831736564636, -0.08552241325378418, 0.10950861871242523, 0.03243803232908249, -0.1334359049797058, -0.017160668969154358, 0.14693941175937653, -0.03293342515826225, -0.07409755140542984, 0.02242264337837696, 0.023424182087183, 0.09055960178375244, 0.057071540504693985, -0.007233223877847195, -0.018902089446783066, -0.044169314205646515, -0.03784813731908798, -0.07894303649663925, 0.08836069703102112, -0.03151644766330719, -0.017575746402144432, 0.1319165676832199, 0.03848038613796234, -0.016598928719758987, 0.0668247640132904, 0.0598611980676651, 0.030726680532097816, -0.008800971321761608, 0.15223337709903717, -0.12973585724830627, 0.004881903529167175, 0.09910187125205994, -0.17465080320835114, 0.02040524035692215, 0.12798228859901428, 0.014892647042870522, -0.02581855282187462, 0.12139080464839935, -0.012259019538760185, -0.04199619218707085, -0.09711970388889313, 0.01583936996757984, -0.0024564790073782206, -0.021148523315787315, 0.004212972708046436, 0.005988639313727617, 0.07578623294830322, -0.05968882516026497, 0.023564040660858154, -0.017283514142036438, 0.031177381053566933, -0.1048436388373375, -0.17465387284755707, -0.029062004759907722, 0.07229869067668915, 0.08869171887636185, -0.005212750285863876, 0.013518277555704117, 0.09335728734731674, -0.04270269349217415, 0.14456534385681152, 0.08944062143564224, 0.029897291213274002, 0.09147774428129196, -0.05287347733974457, -0.05875808000564575, 0.11978635936975479, 0.031577758491039276, -0.1341281682252884, -0.08123104274272919, 0.10957127064466476, -0.027072641998529434, -0.04911910742521286, -0.0211395975202322, -0.10198687016963959, 0.03490641340613365, 0.039924923330545425, 0.020534440875053406, 0.15564453601837158, -0.004922749474644661, 0.10676790028810501, -0.04374802112579346, 0.14695662260055542, -0.11039703339338303, -0.11695011705160141, -0.12732923030853271, -0.12349124252796173, 0.0104692867025733, 0.009693615138530731, 0.07669243216514587, 0.014677388593554497, -0.13818174600601196, -0.011353655718266964, 0.060600560158491135, -0.07447001338005066, 0.07410953938961029, 0.021769346669316292, -0.02087179198861122, -0.008281750604510307, 0.0030956370756030083, 0.032731134444475174, -0.1234695315361023, -0.07701236754655838, 0.03328568488359451, 0.011185993440449238, 0.026021834462881088, -0.08663376420736313, 0.036234207451343536, 0.007395790424197912, 0.08384484052658081, 0.045662857592105865, -0.22044570744037628, -0.02445361576974392, 0.007398469839245081, 0.02251240983605385, -0.08425731956958771, 0.08659868687391281, 0.05771355703473091, -0.00445785466581583, 0.09847363084554672, -0.04730968177318573, 0.14657051861286163, 0.10967783629894257, -0.2279922366142273, 0.02464783750474453, 0.009872050024569035, 0.14313693344593048, -0.040699686855077744, -0.04754149168729782, -0.0998191237449646, -0.06780291348695755, -0.09592799842357635, -0.07844763249158859, -0.012364936992526054, -0.042208462953567505, 0.14070892333984375, -0.1654183566570282, -0.18816976249217987, -0.13390377163887024, -0.08136524260044098, -0.11232104897499084, -0.13549302518367767, -0.0691915974020958, 0.003985728602856398, 0.10719909518957138, 0.029455453157424927, 0.058407217264175415, 0.030215945094823837, 0.047249000519514084, -0.030385255813598633, 0.08296718448400497, 0.07134569436311722, 0.05151527374982834, -0.0879950001835823, -0.010683702304959297, -0.13317841291427612, 0.0388784185051918, -0.1436123251914978, 0.1507468819618225, -0.08082736283540726, -0.031244060024619102, -0.10186072438955307, 0.0555567741394043, 0.037804704159498215, 0.08512118458747864, 0.03806157410144806, 0.12004636228084564, -0.06712283194065094, -0.022561030462384224, -0.005808549467474222, -0.011069030500948429, -0.001888976083137095, -0.010384107008576393, -0.018293064087629318, 0.017052674666047096, 0.007483093533664942, -0.08042724430561066, -0.08736754953861237, 0.09327441453933716, 0.15074193477630615, 0.13087815046310425, -0.019621556624770164, -0.04163317009806633, -0.14865891635417938, -0.011831818148493767, -0.06240006536245346, 0.017713971436023712, 0.07227911055088043, -0.06699064373970032, -0.1133028119802475, 0.06636564433574677, -0.0025477453600615263, 0.013390697538852692, -0.05281807854771614, -0.0013768604258075356, -0.13680702447891235, -0.14545154571533203, 0.06792302429676056, -0.07154042273759842, -0.10308531671762466, 0.15428979694843292, -0.07103253901004791, -0.027550384402275085, -0.09829746186733246, -0.014417706988751888, 0.034160926938056946, -0.13065198063850403, -0.023229993879795074, -0.07025033235549927, 0.08564580976963043, -0.015226301737129688, -0.08111849427223206, 0.06998197734355927, -0.042579904198646545, -0.027238929644227028, 0.0538061298429966, -0.04800710454583168, -0.035972174257040024, -0.0899505615234375, -0.08818913996219635, -0.10781411826610565, 0.01688014157116413, 0.07965078949928284, -0.11018991470336914, -0.025805102661252022, -0.013479397632181644, 0.010416397824883461, 0.10165008157491684, -0.0838780403137207, -0.023592393845319748, 0.10847768187522888, 0.0024344604462385178, -0.006508053280413151, 0.06405408680438995, 0.05914399027824402, 0.08639708906412125, -0.023221049457788467, -0.09145300090312958, 0.033526577055454254, -0.12447406351566315, -0.04570707306265831, 0.12611132860183716, 0.046079013496637344, 0.0045271688140928745, -0.017224766314029694, 0.06243596971035004, -0.0675823912024498, 0.13166803121566772, 0.015947379171848297, 0.045139942318201065, 0.02771594561636448, 0.021416984498500824, 0.0393303707242012, -0.07649821043014526, -0.095221146941185, -0.017932968214154243, 0.16944336891174316, -0.021257326006889343, -0.04645339772105217, -0.08905120939016342, 0.014911029487848282, -0.06003763526678085, 0.026088720187544823, -0.021720396354794502, -0.16698986291885376, 0.061135269701480865, 0.09446655958890915, -0.02377626672387123, 0.016827529296278954, -0.007827619090676308, -0.08874864131212234, 0.0899772047996521, -0.059066493064165115, -0.12017477303743362, 0.11069602519273758, 0.04249965026974678, 0.08351531624794006, 0.07090089470148087, 0.07707516103982925, -0.1266050785779953, 0.07675208151340485, -0.14218802750110626, -0.030539920553565025, -0.010175061412155628, -0.01712051033973694, 0.03262270614504814, -0.09666372835636139, 0.022576503455638885, -0.018645038828253746, -0.035873498767614365, -0.040760114789009094, 0.0011415197513997555, -0.0020727075170725584, 0.10316235572099686, 0.026783576235175133, 0.0002980336139444262, -0.0022916626185178757, 0.02828838676214218, 0.16517455875873566, -0.11618442088365555, -0.023878302425146103, -0.06566938757896423, 0.06236012652516365, -0.004758674185723066, -0.043952248990535736, 0.04220088571310043, 0.059955012053251266, 0.02346721477806568, -0.14288951456546783, 0.05148008465766907, -0.09829064458608627, -0.11109495162963867, 0.09985796362161636, 0.04259859025478363, -0.09247788041830063, -0.12320654094219208, -0.015364493243396282, -0.02589632384479046, 0.0366160087287426, 0.07248137891292572, -0.06612838059663773, 0.023293187841773033, 0.058487702161073685, 0.030663635581731796, 0.052252836525440216, -0.04635243117809296, -0.02869684062898159, 0.011132793501019478, -0.03430276736617088, -0.07618304342031479, 0.019011151045560837, 0.015859253704547882, 0.007656419184058905, 0.0034778155386447906, 0.048685334622859955, -0.006708309520035982, -0.006027052644640207, -0.013229867443442345, 0.05497363954782486, -0.0708601176738739, 0.0035365645308047533, -0.059540823101997375, 0.024133356288075447, -0.046230752021074295, -0.07155860215425491, 0.04773299768567085, 0.05041228607296944, 0.1289229393005371, -0.018525097519159317, 0.10241961479187012, 0.20295745134353638, 0.026720182970166206, -0.06904749572277069, -0.004164631944149733, -0.028917450457811356, 0.14743395149707794, 0.07141739875078201, -0.14108797907829285, 0.0025665934663265944, -0.11622897535562515, 0.13070981204509735, -0.011967460624873638, 0.061390042304992676, 0.06539221107959747, -0.05247077718377113, 0.13708317279815674, 0.11795161664485931, -0.015800854191184044, 0.11704520136117935, 0.02618151530623436, 0.03951244056224823, -0.028465786948800087, -0.06781791150569916, 0.02063545025885105, 0.10849912464618683, -0.061876825988292694, 0.010989527218043804, -0.07704977691173553, 0.011609291657805443, -0.11716648936271667, -0.03615729883313179, 0.04526446759700775, -0.014819682575762272, -0.07654117047786713, -0.014312240295112133, -0.08663889020681381, -0.02657463029026985, -0.05456331744790077, -0.07007555663585663, -0.13323192298412323, 0.050582267343997955, 0.03056362457573414, 0.10091271996498108, -0.09018931537866592, 0.10546702891588211, -0.027046339586377144, 0.0621882826089859, 0.023341068997979164, -0.07106614112854004, -0.08757486194372177, 0.039223190397024155, -0.02156880684196949, 0.07836229354143143, -0.029414210468530655, 0.037486352026462555, -0.08080515265464783, -0.11186128109693527, 0.0687296912074089, -0.023491276428103447, 0.11321302503347397, -0.1373099833726883, 0.05113819241523743, 0.039307285100221634, -0.0646490603685379, 0.013076645322144032, -0.027131861075758934, 0.17283549904823303, 0.034042663872241974, 0.07553678005933762, -0.0717257410287857, -0.13657809793949127, -0.03551306948065758, 0.03252542018890381, 0.015514223836362362, -0.027806611731648445, -0.10348135977983475, -0.011943305842578411, 0.07312282919883728, -0.12532784044742584, 0.10199648886919022, -0.04344082251191139, 0.0181083083152771, -0.03142751380801201, 0.07011330127716064, -0.10179506242275238, 0.011790262535214424, -0.13698641955852509, -0.03778567165136337, 0.08995926380157471, 0.11107080429792404, -0.0004160215612500906, -0.07278259098529816, -0.04202856495976448, 0.01691978983581066, -0.15677203238010406, 0.04403270035982132, -0.02891557663679123, 0.2349649965763092, -0.02695540525019169, 0.08659782260656357, 0.010970672592520714, 0.08979128301143646, -0.03273559361696243, 0.0673670694231987, -0.03452058136463165, -0.027124088257551193, 0.0011241304455325007, -0.03617803007364273, -0.044937487691640854, 0.005258105229586363, 0.07639774680137634, 0.11903954297304153, -0.013825447298586369, 0.0816437155008316, 0.05479459464550018, -0.12256010621786118, 0.10971345752477646, 0.07529677450656891, 0.07296222448348999, -0.08147037029266357, 0.06997127085924149, -0.05256564915180206, 0.1121395006775856, 0.0373365543782711, -0.047813814133405685, 0.049029361456632614, -0.10160020738840103, -0.04231099411845207, -0.005983411800116301, -0.052319854497909546, 0.09968596696853638, -0.027233071625232697, 0.13432414829730988, -0.05608479306101799, -0.07691448926925659, -0.042224492877721786, -0.11545306444168091, 0.17839567363262177, -0.08060138672590256, -0.020133791491389275, 0.037521667778491974, -0.016871429979801178, 0.03282895311713219, 0.08355635404586792, 0.1388728767633438, -0.03434520587325096, -0.08593074977397919, -0.01292468886822462, -0.04769916832447052, 0.021457813680171967, 0.05955885723233223, 0.026866577565670013, -0.037889089435338974, -0.014575282111763954, -0.10878617316484451, -0.0634080097079277, -0.019521858543157578, 0.08453264087438583, 0.13977544009685516, 0.060853272676467896, -0.08723682910203934, -0.012212920933961868, -0.0017023972468450665, 0.07924539595842361, 0.06434810906648636, -0.030323127284646034, 0.02448750101029873, -0.05297137051820755, -0.048802152276039124, -0.11140432953834534, -0.04306822270154953, -0.12325286120176315, -0.1256355345249176, 0.1728614717721939, 0.09254344552755356, 0.044140078127384186, 0.02956390380859375, -0.08922704309225082, -0.046201590448617935, 0.17608977854251862, -0.12213046103715897, -0.061616040766239166, 0.09791366010904312, -0.007054470479488373, 0.03493716940283775, -0.028728891164064407, 0.07108056545257568, -0.11426155269145966, -0.0020430355798453093, -0.03191118314862251, -0.12462988495826721, 0.0037095833104103804, -0.0014942244160920382, -0.020837940275669098, -0.036439746618270874, 0.08810637146234512, -0.0066616469994187355, -0.03668917715549469, 0.14617423713207245, 0.10687598586082458, 0.07828554511070251, 0.099245086312294, -0.0014083792921155691, 0.030711622908711433, 0.00981729943305254, -0.06382633000612259, -0.008750432170927525, -0.06033143028616905, 0.1442902386188507, -0.061011239886283875, -0.06300735473632812, -0.027869556099176407, -0.1018780842423439, 0.00184127246029675, 0.10107210278511047, -0.013015396893024445, -0.07872418314218521, 0.17632132768630981, 0.07122267782688141, -0.09311748296022415, 0.019619815051555634, 0.01238112710416317, -0.0162248145788908, -0.04552411288022995, -0.08921139687299728, 0.03747662156820297, -9.625325765227899e-05, 0.0010073934681713581, 0.08981351554393768, 0.03946072235703468, -0.03784671798348427, 0.13762104511260986, 0.004056950565427542, -0.0667845830321312, 0.029192522168159485, -0.07361714541912079, 0.03609978407621384, -0.014593120664358139, -0.017517482861876488, 0.05921708792448044, -0.147335022687912, -0.015066662803292274, -0.0696457102894783, 0.06282597780227661, -0.019030915573239326, 0.07747844606637955, -0.021434592083096504, -0.07797106355428696, -0.02580612152814865, 0.05797489359974861, 0.02148663066327572, -0.11807484924793243, 0.12134040892124176, -0.0116215068846941, -0.02209003083407879, -0.1655108481645584, 0.0021600998006761074, -0.04336336627602577, -0.025679554790258408, -0.1367146372795105, -0.13588708639144897, -0.057162363082170486, -0.12347888201475143, -0.10676324367523193, -0.02984277717769146, -0.11491674184799194, 0.0634961649775505, -0.12646479904651642, 0.06915388256311417, -0.13061074912548065, -0.03073386661708355, 0.08243189752101898, 0.04629475623369217, -0.02018107660114765, 0.06454842537641525, -0.05424359813332558, -0.08531536161899567, -0.007208851631730795, 0.028347494080662727, 0.07711754739284515, -0.01797081157565117, -0.10737214237451553, 0.03847464546561241, 0.17363694310188293, -0.005129021592438221, -0.10072924941778183, -0.015902888029813766, -0.09572155773639679, -0.011061271652579308, 0.09633974730968475, -0.005724507849663496, 0.12029726803302765, -0.07827392220497131, 0.09008663147687912, -0.009749026969075203, 0.017469730228185654, 0.05580262467265129, -0.00164158851839602, -0.07036426663398743, -0.020564012229442596, -0.09190881252288818, 0.17944134771823883, 0.028535006567835808, 0.05636166036128998, -0.10978183895349503, -0.08495418727397919, -0.015120654366910458, -0.08661063760519028, -0.04371391981840134, -0.12024036049842834, 0.03413133695721626, 0.06260655075311661, -0.034250106662511826, -0.020152239128947258, 0.06636657565832138, -0.0894090086221695, -0.08602973818778992, 0.04164480045437813, 0.07821555435657501, -0.03167443349957466, -0.05060090497136116, -0.17737233638763428, -0.06862261891365051, -0.06166316196322441, 0.019033852964639664, -0.08680480718612671, -0.03934937343001366, 0.12711061537265778, -0.12950608134269714, 0.003097543492913246, -0.033821143209934235, 0.05123437941074371, 0.02707141824066639, 0.042455170303583145, -0.11082590371370316, -0.11494015157222748, 0.07322050631046295, -0.038980498909950256, -0.0525636151432991, -0.033956386148929596, -0.007038974668830633, -0.12885326147079468, 0.11913938820362091, -0.06546458601951599, -0.10364613682031631, -0.007300273980945349, 0.06392452865839005, 0.006053343880921602, 0.10555920749902725, 0.008448352105915546, -0.007792823947966099, -0.10134474188089371, -0.10357579588890076, -0.12497024983167648, 0.03873046115040779, 0.045618198812007904, 0.015363931655883789, -0.0007795207784511149, -0.0774887353181839, 0.03269835188984871, 0.12069026380777359, -0.021677616983652115, 0.08927565068006516, 0.07225847989320755, 0.0943986177444458, 0.009142393246293068, 0.05771854147315025, 0.14924658834934235, -0.0032959585078060627, -0.14864052832126617, -0.05400596559047699, -0.10804492235183716, -0.07442434132099152, -0.018133442848920822, 0.0412098690867424, -0.05094008520245552, -0.015531971119344234, 0.0550212599337101, -0.04822520539164543, -0.0731569454073906, -0.1492355316877365, -0.01819053664803505, -0.05341273918747902, 0.045319318771362305, 0.08494076877832413, -0.09448625892400742, 0.009005159139633179, -0.013372503221035004, 0.06589076668024063, -0.060973625630140305, 0.06350843608379364, -0.03619590774178505, -0.17113065719604492, 0.004568854812532663, 0.1302829533815384, -0.07770475000143051, -0.01743069849908352, 0.02675345540046692, 0.07241743803024292, 0.052492279559373856, -0.006937696132808924, -0.014400766231119633, 0.006044918671250343, 0.09202884137630463, 0.048717986792325974, 0.14936833083629608, -0.07938476651906967, -0.02507934719324112, -0.14805711805820465, -0.19716794788837433, 0.03615434467792511, -0.1347367912530899, -0.12064240872859955, 0.049142684787511826, -0.013291018083691597, -0.013883043080568314, -0.07352685928344727, -0.004110485780984163, 0.12279485166072845, -0.10041806846857071, -0.07441472262144089, -0.04542294889688492, 0.0639256164431572, 0.19589237868785858, 0.01937839388847351, 0.22218140959739685, -0.09872518479824066, 0.010372118093073368, 0.11486842483282089, 0.04666958749294281, -0.0033765286207199097, -0.024502169340848923, -0.048899076879024506, 0.13145147264003754, -0.0024514049291610718, 0.1419343501329422, -0.05382239818572998, -0.08681867271661758, -0.026925066486001015, -0.07073988765478134, -0.179878368973732, 0.15782968699932098, 0.05467436462640762, -0.06561312824487686, -0.15046904981136322, -0.10937877744436264, -0.0050337775610387325, -0.0090639628469944, 0.10487665981054306, 0.00923175923526287, 0.01902451552450657, -0.10584014654159546, -0.07514435052871704, 0.09197111427783966, -0.019981825724244118, 0.038066912442445755, -0.040392082184553146, 0.05256674066185951, -0.1926175057888031, -0.03394148498773575, -0.0742349773645401, 0.03388043865561485, -0.03733116015791893, 0.005100583657622337, -0.11643733084201813, -0.03246042877435684, -0.051276128739118576, -0.09472247213125229, -0.08058392256498337, 0.07756507396697998, 0.09643689543008804, -0.12595444917678833, -0.13405874371528625, -0.09207376092672348, 0.10068017989397049, 0.011605121195316315, -0.0500759594142437, -0.13949304819107056, -0.07489945739507675, 0.046490926295518875, 0.18444374203681946, -0.149394690990448, -0.08072488754987717, -0.014081032946705818, -0.010643410496413708, -0.15122584998607635, 0.026451893150806427, 0.1845504641532898, 0.04220648109912872, 0.05769568681716919, 0.11446879059076309, -0.015651851892471313, -0.02666586823761463, -0.001135178841650486, -0.06472449749708176, 0.04874391481280327, -0.016236716881394386, 0.04309197887778282, 0.043866630643606186, -0.0005109348567202687, 0.12164400517940521, -0.07149206101894379, -0.16617882251739502, 0.08116792887449265, 0.06144169345498085, 0.08837950974702835, -0.09834074974060059, 0.0370403416454792, 0.05704960972070694, 0.03372952342033386, -0.07736989110708237, -0.1499868631362915, -0.01902257651090622, -0.025673892349004745, 0.04502463340759277, 0.05189400911331177, -0.0008258651942014694, 0.07590463012456894, -0.0300662349909544, 0.12143510580062866, 0.03012183867394924, 0.13004979491233826, 0.08492690324783325, 0.04570004343986511, 0.1376403421163559, 0.06638313084840775, 0.0032540219835937023, -0.02758932113647461, -0.03500642254948616, -0.13227126002311707, -0.15994702279567719, 0.10667748749256134, 0.10643283277750015, 0.19649019837379456, -0.1300361603498459, -0.10738158971071243, 0.15589134395122528, -0.008281566202640533, 0.14403045177459717, 0.018863564357161522, 0.012832720763981342, 0.020201699808239937, -0.022663477808237076, 0.09252257645130157, -0.06638477742671967, 0.018175465986132622, 0.12538555264472961, -0.2053099125623703, -0.016133319586515427, 0.047483790665864944, 0.052552610635757446, 0.08160165697336197, -0.17658434808254242, 0.18950146436691284, -0.13748468458652496, 0.03525159880518913, 0.041934117674827576, -0.04107114300131798, 0.10743772238492966, 0.08250536769628525, -0.02799307554960251, -0.0663917288184166, -0.11863952875137329, -0.20086486637592316, -0.08499199151992798, -0.056385576725006104, -0.02916969545185566, 0.04153565317392349, -0.10907154530286789, 0.1546379029750824, 0.0779767856001854, -0.09074211865663528, 0.11265989392995834, -0.02613208442926407, 0.05702478066086769, 0.01777595467865467, 0.10998404026031494, -0.09922776371240616, 0.1665419638156891, 0.025911293923854828, -0.03242812678217888, -0.005685758776962757, 0.10686135292053223, 0.17908036708831787, 0.008254085667431355, 0.045826736837625504, -0.004791035782545805, -0.010171604342758656, -0.05436365306377411, 0.12562569975852966, 0.1144179180264473, -0.08842305094003677, 0.07302442938089371, 0.03513867408037186, 0.0745360255241394, -0.11487062275409698, 0.021441828459501266, 0.047835011035203934, 0.1445889174938202, 0.011689356528222561, -0.12960144877433777, 0.0905676856637001, -0.10184753686189651, -0.023520398885011673, 0.1285168081521988, -0.07567407190799713, -0.1714017540216446, 0.002820876194164157, 0.007092053070664406, -0.1087556779384613, -0.01264081709086895, 0.029820721596479416, 0.1615477353334427, 0.1725163608789444, 0.1507778763771057, -0.05930660665035248, -0.1451210230588913, -0.15445993840694427, 0.03908701241016388, 0.03421522676944733, -0.1790958046913147, -0.06532091647386551, -0.09572941064834595, -0.10221300274133682, -0.020106524229049683, 0.07557087391614914, -0.13776655495166779, -0.12949371337890625, -0.05413449555635452, -0.05803289636969566, 0.025648104026913643, -0.05855178087949753, -0.12351640313863754, 0.09552861005067825, -0.033813055604696274, 0.15127144753932953, -0.028446989133954048, 0.103721022605896, 0.06709001958370209, -0.0701027512550354, 0.05218658968806267, -0.04782595485448837, -0.12289160490036011, 0.0735219419002533, -0.1826000064611435, -0.0834413543343544, -0.11297789216041565, -0.179090678691864, -0.08045843243598938, -0.023936303332448006, 0.02768435701727867, -0.056431546807289124, 0.10018927603960037, -0.1318846046924591, -0.10316673666238785, 0.07147736102342606, -0.042897675186395645, -0.04962604492902756, 0.12961377203464508, 0.03945956751704216, 0.16614936292171478, 0.106788769364357, 0.029972746968269348, 0.0931396558880806, -0.08982671797275543, -0.03426467254757881, -0.15701265633106232, 0.1353691667318344, -0.05122637748718262, 0.12860743701457977, 0.06799986958503723, -0.05081840977072716, -0.04431159049272537, -0.046942390501499176, -0.010257845744490623, -0.04267007112503052, 0.018525781109929085, -0.058929942548274994, -0.05651547759771347, -0.0360541045665741, 0.004282685462385416, -0.03930812329053879, 0.14317353069782257, 0.04093238711357117, -0.0009556676959618926, -0.07316087931394577, 0.08234670013189316, -0.019010955467820168, 0.06713078916072845, -0.1346876472234726, 0.07057451456785202, -0.08031973987817764, 0.11166635900735855, 0.055842552334070206, 0.13801565766334534, 0.10008072853088379, 0.038603827357292175, -0.06483517587184906, -0.04200593754649162, -0.09343660622835159, -0.02302323654294014, 0.09287706017494202, -0.0137613695114851, 0.025578737258911133, -0.04210713133215904, 0.04568938538432121, 0.09553876519203186, -0.05753588303923607, -0.0670517235994339, 0.08238029479980469, -0.028110703453421593, -0.06390419602394104, 0.15354740619659424, -0.03002900816500187, 0.038267601281404495, 0.04543424770236015, 0.002672357251867652, -0.0809270516037941, -0.06056173890829086, 0.1210293248295784, -0.1630857139825821, 0.03653883561491966, -0.04357168450951576, 0.028654418885707855, -0.022086208686232567, 0.005438216961920261, -0.006082057487219572, 0.00033173884730786085, 0.13451431691646576, 0.0021202517673373222, 0.05378630757331848, 0.019246578216552734, 0.07893292605876923, 0.12316174805164337, 0.004887983202934265, -0.0578339509665966, -0.05079541727900505, 0.01020693127065897, -0.01060874667018652, -0.03270183131098747, 0.016428111121058464, -0.014131620526313782, 0.10073034465312958, -0.053194064646959305, 0.013347026892006397, -0.0737748071551323, 0.119199238717556, 0.00018337168148718774, -0.008600013330578804, 0.05233015865087509, 0.07559097558259964, 0.010964586399495602, 0.07385515421628952, -0.046712540090084076, 0.033726759254932404, -0.003956934437155724, 0.02119925245642662, 0.005154833197593689, 0.005665163975208998, 0.13763722777366638, -0.015651743859052658, 0.006241392344236374, 0.07160656899213791, 0.003282454563304782, 0.008353081531822681, -0.04137951508164406, -0.17487798631191254, 0.1852463036775589, -0.03916049748659134, 0.03948047757148743, -0.041579604148864746, 0.07574910670518875, -0.02102327160537243, -0.05193283408880234, 0.03562266752123833, -0.09875719994306564, -0.09402882307767868, 0.12800848484039307, 0.011840646155178547, 0.08438096940517426, 0.012919685803353786, 0.023482678458094597, -0.11690263450145721, 0.08990858495235443, 0.06714983284473419, -0.10594752430915833, 0.05082542449235916, 0.15784050524234772, -0.07207349687814713, 0.17688366770744324, 0.05720246210694313, 0.0948374792933464, -0.015282653272151947, 0.03928489610552788, -0.06473123282194138, -0.044952213764190674, -0.042419832199811935, 0.16577669978141785, 0.05203874036669731, 0.125972718000412, 0.18400956690311432, 0.019749199971556664, -0.014256943948566914, 0.07519101351499557, -0.07191340625286102, -0.07282595336437225, -0.07176321744918823, 0.00850292295217514, 0.017997313290834427, 0.005841206759214401, -0.04700503498315811, -0.12579326331615448, 0.07358308136463165, 0.18766295909881592, 0.03964175283908844, 0.06526176631450653, -0.08043231070041656, 0.0640055313706398, -0.09897608309984207, -0.005922479089349508, 0.07239025831222534, 0.03658733144402504, 0.124180369079113, -0.00616954592987895, -0.042073920369148254, -0.030649574473500252, 0.024265097454190254, -0.14061303436756134, 0.08381444215774536, -0.10731671750545502, -0.024139588698744774, -0.0034314561635255814, 0.024410925805568695, 0.06871408224105835, 0.13955599069595337, -0.04427963122725487, -0.05881166830658913, -0.04209219664335251, -0.059139005839824677, 0.01750548742711544, 0.0351833775639534, 0.048618290573358536, 0.0029527137521654367, 0.14198674261569977, -0.00018606452795211226, 0.12175232172012329, -0.12079689651727676, 0.04616843909025192, 0.054628100246191025, 0.011304237879812717, 0.09352996200323105, 0.05294971913099289, -0.01829962432384491, 0.07922078669071198, 0.042987920343875885, -0.14054208993911743, 0.09796689450740814, 0.04507755860686302, -0.0533444918692112, 0.0029986498411744833, -0.014712673611938953, -0.09182324260473251, 0.14430376887321472, 0.011125820688903332, -0.10836854577064514, 0.03266998007893562, -0.002308750059455633, 0.00862379651516676, 0.05233833193778992, 0.14639754593372345, -0.05222407355904579, 0.08524251729249954, -0.011935672722756863, 0.1489066481590271, 0.05447631701827049, 0.06347187608480453, -0.0985611230134964, 0.008548971265554428, 0.00348508614115417, 0.07626323401927948, -0.01608196645975113, -0.10400854051113129, 0.15422901511192322, -0.10223671793937683, -0.006908615585416555, -0.10719228535890579, 0.10826640576124191, -0.011118551716208458, 0.1044645607471466, 0.012855795212090015, -0.022034432739019394, 0.08887721598148346, 0.04413912445306778, 0.032757192850112915, -0.05122413858771324, -0.060851600021123886, -0.09013430029153824, 0.02087310142815113, 0.07767263054847717, 0.014221505261957645, 0.04750429093837738, 0.03471476212143898, -0.04839455708861351, -0.07156272232532501, 0.12927192449569702, -0.062276676297187805, -0.17610009014606476, 0.06151681765913963, -0.07121570408344269, -0.0068749370984733105, 0.01611277647316456, 0.09797464311122894, -0.029669517651200294, -0.05546333268284798, 0.002806406468153, 0.01181736495345831, 0.11026931554079056, -0.03662564605474472, -0.07944116741418839, 0.17766587436199188, -0.08674325048923492, 0.18077301979064941, -0.09438823908567429, -0.01056936290115118, -0.10773254930973053, 0.04046352207660675, -0.11011358350515366, -0.020292818546295166, 0.023579159751534462, 0.23751823604106903, -0.09306511282920837, -0.030496658757328987, -0.20177991688251495, -0.19808794558048248, 0.05576691776514053, 0.0038179843686521053, 0.1466059386730194, 0.16519491374492645, 0.10412083566188812, -0.02373279444873333, -0.07687442749738693, -0.09452114254236221, -0.1469719409942627, -0.0037566323298960924, 0.015865111723542213, 0.018788961693644524, -0.13301360607147217, -0.010588603094220161, -0.10027947276830673, 0.018800746649503708, -0.06533961743116379, -0.019774457439780235, -0.08478447794914246, -0.12916556000709534, -0.04737259820103645, -0.02967141382396221, 0.00036997199640609324, 0.038476064801216125, 0.03612225130200386, -0.04929976165294647, 0.10345328599214554, -0.09531889855861664, 0.03412934020161629, -0.03633476793766022, 0.0030381353572010994, 0.12957234680652618, 0.05166823789477348, -0.05477260425686836, 0.03242829814553261, 0.03739490732550621, -0.008888822048902512, 0.07616650313138962, -0.036902692168951035, -0.08141645044088364, 0.05083600431680679, 0.15191490948200226, 0.008465143851935863, -0.05935179069638252, 0.0954766720533371, 0.16647973656654358, -0.079464390873909, -0.04979958385229111, 0.11320817470550537, 0.01460203155875206, 0.01398855447769165, -0.05463066324591637, -0.052226122468709946, -0.21636895835399628, 0.134346604347229, 0.1515943855047226, 0.06411410868167877, 0.13836130499839783, -0.0025771420914679766, -0.07558634132146835, -0.04803547263145447, -0.020114339888095856, 0.05954757332801819, 0.010233954526484013, -0.02124340832233429, -0.054712697863578796, -0.008057099767029285, -0.05869380384683609, -0.07841785997152328, 0.034410420805215836, 0.07951921224594116, 0.1112150251865387, -0.08499918133020401, -0.08462639153003693, 0.06639645248651505, 0.017655204981565475, -0.06069890782237053, -0.06688021123409271, -0.04559484124183655, 0.062391769140958786, -0.05422587692737579, -0.03328433632850647, 0.02542547881603241, -0.045195069164037704, -0.14049923419952393, 0.10040926933288574, 0.0723794549703598, 0.05385491997003555, 0.03863822668790817, -0.07888033986091614, 0.009525541216135025, 0.08507765829563141, 0.005269418470561504, 0.21041029691696167, 0.00620503444224596, -0.020072566345334053, 0.02903939038515091, -0.05140455812215805, -0.02477327175438404, -0.13642583787441254, 0.02402927540242672, -0.14261727035045624, 0.07324790209531784, 0.0536234974861145, 0.14054493606090546, 0.0008692785049788654, -0.03985027223825455, -0.02253405749797821, -0.06659568846225739, 0.051348187029361725, -0.03616482391953468, -0.05613254755735397, 0.01598597690463066, 0.03320664167404175, 0.06135087087750435, -0.11392360180616379, -0.013262667693197727, -0.0015166690573096275, 0.09528155624866486, -0.07014559954404831, -0.09821568429470062, 0.06247005984187126, -0.10232749581336975, -0.1038694679737091, -0.04553129896521568, -0.07600704580545425, 0.05708695203065872, 0.05984477326273918, 0.17558468878269196, 0.13659805059432983, 0.15632270276546478, -0.06321508437395096, -0.08775604516267776, -0.060769014060497284, -0.05611713230609894, 0.012730909511446953, -0.028186913579702377, -0.14243337512016296, -0.006043737288564444, 0.07309453934431076, -0.04445049539208412, 0.028181876987218857, 0.10449393838644028, 0.08040844649076462, 0.0033396766521036625, 0.09666041284799576, 0.009224101901054382, -0.11629629880189896, -0.028649676591157913, -0.03374270722270012, 0.091275155544281, -0.0026143821887671947, 0.039469681680202484, 0.0014593349769711494, -0.08243367075920105, 0.03656025975942612, 0.07320275902748108, -0.040894538164138794, 0.04374902695417404, -0.02581528201699257, 0.009601850993931293, -0.12396949529647827, 0.16793406009674072, 0.0609370693564415, 0.05253772437572479, -0.058116622269153595, -0.017390424385666847, -0.08413268625736237, -0.12994349002838135, 0.0640600323677063, -0.01216408982872963, 0.06669781357049942, -0.12038902938365936, 0.03989730402827263, 0.07240884751081467, -0.08092894405126572, -0.1577974259853363, -0.06668493896722794, 0.06465697288513184, 0.006596479099243879, 0.01989465206861496, -0.009832579642534256, -0.0294455848634243, 0.025781868025660515, 0.04665850102901459, -0.10154406726360321, 0.032928381115198135, -0.0026669397484511137, 0.05793417990207672, 0.067571260035038, -0.10976282507181168, -0.04142265021800995, -0.08376581221818924, 0.10891114175319672, 0.0030635823495686054, -0.09925873577594757, -0.06343629956245422, -0.0009720232919789851, 0.033257946372032166, 0.005100445356220007, -0.10564485192298889, 0.09271711856126785, 0.1406407505273819, 0.10492852330207825, -0.2062411904335022, -0.06589128822088242, -0.16488711535930634, -0.050660040229558945, -0.13542994856834412, -0.0040108757093548775, 0.058360952883958817, 0.12355722486972809, 0.003234238363802433, -0.0660664439201355, 0.1155150830745697, -0.05095602944493294, 0.12320913374423981, -0.07492952793836594, -0.03742096573114395, 0.0684482529759407, 0.05914967134594917, -0.021584047004580498, -0.026382384821772575, 0.052810218185186386, -0.10462988168001175, -0.05122370645403862, 0.07475000619888306, 0.08968193084001541, 0.14618755877017975, 0.03919016942381859, -0.01966022327542305, -0.08251387625932693, -0.06196247786283493, -0.05362571403384209, 0.040759745985269547, -0.06697621196508408, 0.0015446494799107313, -0.08271964639425278, 0.18749721348285675, -0.024931417778134346, 0.0030621758196502924, 0.1715724915266037, -0.004832380451261997, -0.09388043731451035, 0.09927075356245041, -0.060164980590343475, 0.04637414962053299, 0.00967582780867815, 0.035526908934116364, -0.04124229773879051, -0.11019428074359894, -0.13508565723896027, -0.030015399679541588, 0.06998450309038162, -0.14953385293483734, 0.023481793701648712, -0.018428847193717957, -0.12915268540382385, -0.018630851060152054, -0.11972115933895111, 0.049803972244262695, 0.10827653855085373, 0.10488307476043701, -0.0027417829260230064, -0.155516117811203, 0.03495597094297409, -0.06386176496744156, 0.013043456710875034, 0.12736201286315918, -0.009396836161613464, 0.005621413234621286, 0.09425265341997147, 0.006577020511031151, -0.06521518528461456, -0.06451515108346939, -0.0036057785619050264, 0.03631306439638138, 0.0019337518606334925, -0.011655210517346859, 0.031427934765815735, -0.013351392932236195, -0.10699328035116196, -0.06847717612981796, 0.1119447574019432, -0.020451271906495094, -0.07024227827787399, -0.019087865948677063, 0.06695925444364548, -0.10733765363693237, 0.08946193009614944, 0.09984838962554932, 0.021565202623605728, 0.11438317596912384, -0.019664399325847626, 0.11197452247142792, 0.06526660174131393, -0.04213649779558182, -0.00010619263775879517, -0.056418340653181076, 0.12158150225877762, -0.11530372500419617, -0.10079406946897507, 0.06636780500411987, 0.05122772604227066, -0.08312347531318665, 0.07416845113039017, -0.04663856327533722, 0.10760077834129333, -0.0913216769695282, 0.11002428084611893, 0.017160063609480858, 0.049067962914705276, 0.02363474853336811, 0.026734063401818275, 0.11311442404985428, -0.002528600627556443, -0.05627041682600975, -0.01284194365143776, 0.0913640633225441, -0.002197369933128357, 0.004085770342499018, 0.08463884145021439, -0.10473717004060745, -0.0021873731166124344, 0.06036658585071564, 0.12791812419891357, -0.004315296653658152, 0.05834351107478142, -0.023211807012557983, 0.08904027193784714, -0.15828773379325867, 0.04699099808931351, 0.08639580011367798, 0.026883281767368317, 0.12732888758182526, 0.05545029044151306, 0.0027989393565803766, -0.02941008284687996, -0.09227276593446732, -0.10079746693372726, 0.00848415307700634, 0.06624540686607361, -0.02918686904013157, -0.13108117878437042, 0.04126425087451935, 0.005403005518019199, 0.10335821658372879, -0.12112255394458771, 0.02902201935648918, -0.0874369889497757, 0.06265060603618622, -0.08858264237642288, -0.020449386909604073, -0.0912087932229042, 0.01114827673882246, -0.056007642298936844, 0.0362212136387825, -0.04233679175376892, 0.005983497016131878, -0.045381322503089905, -0.058170389384031296, -0.07168330997228622, -0.025241408497095108, 0.08018166571855545, -0.11529159545898438, -0.1404409408569336, 0.018550720065832138, -0.027407174929976463, -0.14342719316482544, 0.003713346319273114, 0.10068628937005997, -0.10127747058868408, -0.015863588079810143, 0.024604802951216698, -0.0901903510093689, -0.007970297709107399, -0.033373259007930756, -0.015615647658705711, 0.00421610102057457, -0.023823045194149017, -0.03648946061730385, -0.10537376254796982, 0.20242799818515778, -0.020284704864025116, 0.029643870890140533, -0.0889270231127739, 0.06261806935071945, 0.019965315237641335, 0.0066827451810240746, -0.015825146809220314, -0.009987919591367245, 0.06455188989639282, -0.0968313217163086, -0.054081991314888, 0.03088132105767727, 0.06212640926241875, 0.018725477159023285, -0.024229496717453003, 0.009488238021731377, -0.08138365298509598, -0.10320387780666351, 0.06894171237945557, 0.15885664522647858, -0.0071767461486160755, 0.07970987260341644, -0.04638829827308655, 0.13336984813213348, 0.1330808699131012, -0.049635425209999084, -0.055026862770318985, -0.016775155439972878, -0.044636473059654236, 0.10393685102462769, -0.06093872711062431, 0.02727022022008896, -0.08594479411840439, 0.05045127496123314, 0.10540852695703506, 0.06778844445943832, -0.1356654018163681, -0.033281419426202774, 0.03009471297264099, 0.11233463138341904, 0.018483841791749, -0.0758269727230072, -0.08736066520214081, 0.013639134354889393, -0.03374838829040527, 0.024598142132163048, -0.009002349339425564, -0.08227439224720001, -0.04711243882775307, -0.025516944006085396, 0.045307837426662445, -0.10110948234796524, -0.060870274901390076, -0.0163080096244812, -0.08301559835672379, 0.10884419828653336, -0.004632978234440088, -0.05337613448500633, -0.14531287550926208, 0.024070316925644875, 0.030579498037695885, 0.00549857784062624, 0.060810383409261703, -0.021458659321069717, 0.12512445449829102, 0.11093083769083023, -0.06785399466753006, 0.028959279879927635, -0.09967034310102463, 0.08646095544099808, 0.124709852039814, -0.046673569828271866, 0.1585211455821991, 0.009378715418279171, 0.021703505888581276, -0.04510040581226349, -0.10374102741479874, 0.0715537816286087, -0.11030583828687668, -0.004345265217125416, 0.0744442567229271, -0.08153542876243591, -0.011739385314285755, 0.035452235490083694, 0.08725439012050629, 0.1241578459739685, 0.054830003529787064, -0.03013652376830578, 0.0967298075556755, -0.07385268062353134, -0.02296444959938526, 0.07135996967554092, -0.04161377251148224, -0.021843932569026947, -0.15719722211360931, -0.044310200959444046, 0.0160223338752985, -0.026129569858312607, 0.04763926938176155, -0.02486550249159336, -0.04435919597744942, -0.09902559965848923, 0.1627628058195114, -0.05785558745265007, 0.060727495700120926, -0.013786669820547104, -0.10473993420600891, 0.1676383912563324, 0.021885957568883896, -0.024065149948000908, 0.2011716663837433, -0.11390108615159988, -0.09686990827322006, 0.10213416814804077, 0.07920011878013611, 0.05558925122022629, 0.03944183140993118, -0.041986651718616486, -0.12190181016921997, 0.008189300075173378, 0.11493067443370819, 0.07290152460336685, -0.10101710259914398, 0.03227362036705017, -0.017001265659928322, -0.009096263907849789, -0.08762694150209427, 0.0036754540633410215, 0.10825663805007935, -0.055426035076379776, -0.14574134349822998, -0.08069223165512085, -0.10468211770057678, -0.1415596455335617, -0.11680009216070175, 0.1334858238697052, -0.06248478218913078, 0.11209321767091751, -0.17791278660297394, -0.009160189889371395, -0.09003015607595444, -0.10365455597639084, -0.005550070200115442, -0.030315730720758438, 0.11701275408267975, 0.004573062993586063, 0.05953185632824898, 0.0276203490793705, 0.1085302084684372, 0.13529528677463531, 0.0018512820824980736, 0.10860799252986908, 0.028139950707554817, 0.012815913185477257, 0.06753568351268768, -0.027577735483646393, -0.11566002666950226, -0.060063716024160385, -0.029515862464904785, 0.019883615896105766, 0.08478235453367233, 0.14252017438411713, 0.0745784193277359, 0.019644714891910553, -0.10865174978971481, 0.01164339017122984, -0.0705065056681633, 0.06156390532851219, -0.06834226846694946, -0.08408966660499573, 0.06088142469525337, -0.1066412627696991, 0.0676669105887413, -0.0920223742723465, 0.05898038670420647, -0.03986195847392082, 0.052523449063301086, -0.016316164284944534, -0.0709533542394638, 0.01890268176794052, -0.030759358778595924, -0.0774918720126152, 0.036693159490823746, -0.03726080805063248, 0.03645738586783409, 0.08808185905218124, 0.020277392119169235, -0.08295851200819016, 0.0647675022482872, 0.029658243060112, -0.05136288329958916, -0.000355354743078351, -0.1153627261519432, 0.05428813397884369, 0.05042983219027519, 0.07428514957427979, 0.027227120473980904, 0.04976201429963112, 0.017613161355257034, -0.12132750451564789, -0.0613739900290966, -0.10489051043987274, -0.18531398475170135, 0.06989558041095734, 0.004714203532785177, -0.10831447690725327, -0.11172312498092651, -0.029202379286289215, -0.008940153755247593, 0.04481552541255951, 0.04551912099123001, 0.04764020815491676, 0.049905236810445786, 0.15344390273094177, 0.057436369359493256, -0.0610630065202713, -0.07840094715356827, 0.15813113749027252, 0.039533138275146484, -0.044720739126205444, -0.021349526941776276, 0.11368881911039352, -0.1700713187456131, 0.06661110371351242, 0.03622427582740784, -0.007157648913562298, 0.001993646612390876, -0.11041312664747238, 0.13498768210411072, 0.02303093485534191, -0.029913146048784256, 0.04163352772593498, 0.08759923279285431, 0.0936979129910469, 0.008995397947728634, 0.11181945353746414, -0.05781247839331627, 0.034513674676418304, 0.06095157191157341, 0.018744710832834244, -0.0325285866856575, 0.0038025849498808384, -0.08716018497943878, 0.0028127983678132296, 0.02389199659228325, 0.14633044600486755, 0.04592929407954216, 0.04932466149330139, 0.09832129627466202, 0.06287575513124466, 0.006849153432995081, -0.14534784853458405, -0.023809801787137985, -0.038298871368169785, -0.020839961245656013, 0.08664348721504211, -0.08581564575433731, -0.10531029850244522, 0.03027670457959175, -0.07951460778713226, 0.03157256916165352, -0.05979226902127266, 0.16064326465129852, -0.12727220356464386, 0.0441952645778656, -0.015278460457921028, 0.0081788906827569, 0.05547899380326271, -1.389943736285204e-05, -0.11399027705192566, -0.10408507287502289, 0.09385230392217636, -0.07771393656730652, 0.000996131799183786, 0.07139520347118378, -0.06901706010103226, 0.13545498251914978, -0.10698551684617996, 0.09302575141191483, 0.03814128413796425, -0.13731221854686737, 0.06163047254085541, 0.1585947722196579, -0.0028323086444288492, -0.04436303675174713, -0.021255571395158768, 0.0458182692527771, 0.027784841135144234, 0.003815475618466735, -0.11357687413692474, -0.08135772496461868, -0.029867002740502357, 0.09285711497068405, 0.11615941673517227, 0.03705286234617233, 0.10753478854894638, 0.05162996053695679, -0.002012777142226696, 0.10263565927743912, 0.0761462152004242, -0.04249769076704979, 0.11783543974161148, 0.004342212807387114, 0.10499542206525803, 0.08401834964752197, 0.016918335109949112, -0.052548229694366455, -0.007420756854116917, -0.001884346711449325, -0.01126098819077015, -0.07673735171556473, -0.0014267060905694962, 0.11308134347200394, -0.07945426553487778, -0.04951763525605202, -0.09274877607822418, 0.0069813975133001804, 0.023380063474178314, 0.11953128129243851, 0.03295532613992691, 0.1173303946852684, -0.07708058506250381, -0.030629517510533333, 0.04832161217927933, 0.14742425084114075, -0.02337486855685711, -0.02254030480980873, -0.05893735587596893, -0.05394282191991806, -0.08325493335723877, -0.0014544069999828935, 0.060388386249542236, -0.043081820011138916, -0.024293333292007446, -0.09666938334703445, -0.12919165194034576, 0.06419230252504349, -0.03790442645549774, 0.08256232738494873, -0.16451290249824524, 0.06051540747284889, 0.07788323611021042, 0.10554587095975876, -0.055876027792692184, 0.07879379391670227, -0.16933108866214752, 0.08702202886343002, 0.061495374888181686, 0.0640811026096344, 0.024591930210590363, 0.12870565056800842, -0.016594337299466133, -0.0002227235963800922, -0.07077018171548843, -0.029034610837697983, 0.18783408403396606, -0.06976643204689026, 0.10933976620435715, 0.0692683756351471, -0.02576322853565216, -0.10267846286296844, -0.1271125078201294, 0.027000760659575462, -0.04994289577007294, 0.026231227442622185, -0.046105459332466125, -0.07605442404747009, 0.05752061679959297, 0.20271994173526764, -0.021834054961800575, 0.040855541825294495, 0.06959100812673569, -0.06532935798168182, -0.016872642561793327, -0.07951077818870544, 0.00044780070311389863, 0.023638172075152397, 0.03293667361140251, -0.09461550414562225, -0.039346564561128616, 0.11384743452072144, -0.1436971127986908, 0.10590322315692902, 0.08393379300832748, -0.010855011641979218, 0.1428205370903015, -0.07652748376131058, 0.004095481242984533, 0.020356925204396248, 0.11873369663953781, -0.11102468520402908, -0.0029153795912861824, 0.01455981470644474, 0.09923774749040604, 0.005075007677078247, -0.14125733077526093, 0.12924619019031525, -0.09652785956859589, 0.009803966619074345, 0.015514614060521126, -0.07339365780353546, -0.13617943227291107, -0.12455421686172485, 0.08558443933725357, -0.15723763406276703, 0.15195612609386444, -0.037449683994054794, -0.07639589160680771, -0.08338408917188644, -0.14509567618370056, -0.06763473153114319, -0.014593048952519894, 0.03792313113808632, -0.07955486327409744, 0.145893856883049, -0.09791550040245056, 0.024705879390239716, -0.026810970157384872, 0.05416077747941017, -0.028755633160471916, -0.08596832305192947, -0.08492153882980347, -0.07939129322767258, 0.027268292382359505, 0.1252896636724472, -0.14396053552627563, 0.041785161942243576, -0.10710729658603668, 0.11152683198451996, -0.07548949122428894, -0.02565140277147293, 0.021873081102967262, -0.04908991977572441, -0.14972949028015137, 0.02271539904177189, 0.06424223631620407, 0.11737484484910965, 0.047228142619132996, 0.046477559953927994, -0.057799678295850754, -0.07676903903484344, 0.04338693618774414, -0.09224718809127808, 0.0577082559466362, -0.05551447346806526, -0.044196054339408875, -0.04020621255040169, 0.1865054965019226, -0.07079203426837921, 0.005084429867565632, 0.0007306097541004419, -0.075838603079319, 0.04519373178482056, -0.05031914263963699, 0.03906543552875519, -0.04972074553370476, -0.1141485869884491, -0.10046114027500153, -0.0048001669347286224, 0.0366743728518486, -0.06415097415447235, 0.040538910776376724, -0.01952819898724556, -0.036363501101732254, 0.050559405237436295, -0.0608784481883049, -0.1012851819396019, -0.10446023941040039, 0.012449923902750015, -0.07558505237102509, -0.10243657976388931, -0.14418132603168488, -0.09996956586837769, -0.014588959515094757, 0.04396619275212288, 0.08794260025024414, 0.07824409008026123, -0.09832776337862015, 0.042597439140081406, 0.036602433770895004, -0.042546067386865616, 0.035049546509981155, -0.05026699975132942, -0.06802069395780563, -0.003085105447098613, 0.008603610098361969, -0.05516493692994118, 0.016682149842381477, -0.03749849274754524, 0.024971483275294304, 0.08045617491006851, -0.055293064564466476, 0.007576053962111473, 0.03584714233875275, -0.147278293967247, -0.05278700962662697, 0.02843203768134117, -0.17876605689525604, -0.1009485200047493, 0.11603303998708725, 0.15775173902511597, -0.023001842200756073, 0.03838218003511429, -0.10252810269594193, -0.044629763811826706, 0.05378241837024689, -0.044950149953365326, 0.06442777067422867, -0.02580573409795761, 0.05501871928572655, -0.022362120449543, -0.07983562350273132, 0.022032415494322777, 0.04140166565775871, 0.028701957315206528, -0.01487454678863287, -0.059095580130815506, 0.01591513119637966, 0.07529903948307037, -0.011746492236852646, -0.07361499965190887, 0.12909850478172302, -0.11744032800197601, 0.09372618049383163, -0.01686236821115017, 0.060430992394685745, -0.06504681706428528, -0.11061602085828781, -0.1294209063053131, 0.04710456728935242, 0.0053189401514828205, 0.03476671874523163, 0.07703282684087753, -0.10854532569646835, 0.021374259144067764, 0.03904677927494049, -0.08293452113866806, -0.04564540460705757, -0.11511608213186264, -0.054978761821985245, 0.10809015482664108, -0.04819584637880325, 0.058668654412031174, -0.09409291297197342, 0.045663151890039444, -0.009891063906252384, -0.09665931761264801, 0.0942826047539711, -0.07447193562984467, 0.0934402272105217, 0.15128487348556519, -0.08029547333717346, -0.008818215690553188, -0.007943742908537388, -0.07293733209371567, -0.2048150897026062, 0.09383510798215866, 0.0024748065043240786, 0.002593028824776411, 0.04993363842368126, 0.07280127704143524, -0.061483483761548996, -0.02691732347011566, 0.16430291533470154, 0.08730584383010864, -0.08217597007751465, 0.10820355266332626, -0.04460044950246811, 0.06822065263986588, 0.01882869191467762, 0.019227106124162674, -0.12287527322769165, 0.14150729775428772, -0.10287266224622726, 0.08730582892894745, -0.048524804413318634, 0.03995835408568382, 0.02670091576874256, -0.016375571489334106, -0.12898103892803192, -0.0357024222612381, 0.013480544090270996, -0.037085048854351044, 0.051766522228717804, -0.09979090094566345, 0.021515056490898132, -0.08669870346784592, -0.0963997021317482, -0.05212685838341713, 0.004096679855138063, 0.07746231555938721, -0.10928414016962051, -0.04124009236693382, 0.029081273823976517, 0.08534564077854156, -0.07135307788848877, 0.012276671826839447, -0.009671482257544994, 0.10605623573064804, 0.16224375367164612, -0.09477316588163376, 0.020454298704862595, -0.06003750488162041, 0.03639540076255798, -0.003621152136474848, -0.00793302059173584, -0.13043172657489777, -0.12898099422454834, 0.05359816178679466, 0.07682032883167267, -0.022124962881207466, -0.04662338271737099, -0.012201206758618355, 0.012662622146308422, 0.05340223014354706, 0.15369592607021332, -0.07454684376716614, -0.02106470987200737, 0.05346044898033142, -0.03971550613641739, -1.2406115956764552e-06, -0.02265465073287487, 0.12935121357440948, -0.03253979608416557, 0.06033247336745262, -0.008493933826684952, -0.05546019226312637, 0.09041204303503036, -0.026771895587444305, 0.036446381360292435, -0.010002982802689075, 0.037065424025058746, 0.1075843945145607, 0.021527964621782303, 0.13407693803310394, -0.016633206978440285, -0.12719228863716125, 0.004134550224989653, 0.03332620859146118, -0.05896668881177902, -0.12924915552139282, 0.031618621200323105, 0.06609389930963516, -0.06136675179004669, 0.08913592994213104, -0.0006579909240826964, -0.14159876108169556, -0.010412793606519699, 0.1512942761182785, 0.02641884610056877, 0.056609321385622025, 0.09536009281873703, -0.10011515021324158, 0.09599506109952927, 0.1441124677658081, 0.06151784956455231, 0.07991176098585129, 0.11659663170576096, 0.20254041254520416, 0.019172323867678642, -0.011922856792807579, -0.11368604749441147, -0.15699335932731628, -0.17339952290058136, -0.060158759355545044, 0.0128469942137599, 0.03780978545546532, -0.07805196940898895, 0.15999720990657806, -0.0990569144487381, 0.16426458954811096, -0.04879968985915184, 0.013718711212277412, 0.02687051147222519, 0.08637814223766327, 0.11970006674528122, -0.055263347923755646, -0.045423321425914764, -0.0013252391945570707, 0.018613051623106003, -0.01077040284872055, 0.15759722888469696, -0.04058181121945381, 0.04738558456301689, 0.1269921362400055, 0.029550718143582344, -0.06919191032648087, -0.03813161328434944, -0.17420867085456848, 0.04124928638339043, 0.1239234060049057, -0.0007930376450531185, -0.12368427962064743, 0.0654485747218132, 0.14895185828208923, 0.07672347128391266, 0.009583027102053165, 0.07472765445709229, 0.08760792016983032, -0.08936911821365356, -0.013944660313427448, 0.03927122429013252, -0.11207278817892075, 0.1895073801279068, 0.037036243826150894, 0.08482784032821655, -0.18686510622501373, -0.12472096085548401, -0.07511898130178452, -0.09137887507677078, 0.11021660268306732, -0.018040994182229042, -0.13736559450626373, -0.03355216234922409, 0.1101691871881485, -0.1374119520187378, -0.000239299944951199, -0.10761779546737671, -0.11438671499490738, 0.08042913675308228, -0.10847314447164536, -0.031699638813734055, -0.04713361710309982, -0.06394816190004349, -0.04370277374982834, -0.07045210897922516, -0.005476192571222782, 0.14965146780014038, 0.06773661822080612, -0.08813567459583282, 0.026338286697864532, -0.06558118015527725, 0.15319742262363434, 0.016801942139863968, -0.1675226390361786, -0.004935408942401409, -0.059909772127866745, -0.006126026622951031, -0.04332612827420235, 0.1263861358165741, -0.06044387072324753, -0.06097082048654556, 0.0010875812731683254, 0.12031655013561249, -0.013886482454836369, -0.03300844877958298, -0.009841089136898518, -0.06729508936405182, -0.02852982096374035, -0.007772426120936871, 0.11643115431070328, -0.008984645828604698, -0.08737597614526749, 0.027896517887711525, 0.01671683043241501, -0.07416131347417831, 0.07966570556163788, -0.18787910044193268, 0.029781460762023926, 0.13520674407482147, 0.011549861170351505, -0.06386780738830566, -0.13881701231002808, 0.060532331466674805, 0.04288233444094658, -0.2017498016357422, 0.1637788861989975, -0.05213724821805954, -0.0008811114821583033, 0.0435417965054512, -0.03277699276804924, -0.10338366031646729, 0.06780135631561279, -0.04868350923061371, 0.03428054600954056, -0.09909966588020325, -0.10750231891870499, -0.09703697264194489, -0.029149558395147324, -0.14627794921398163, -0.15826940536499023, 0.04069146513938904, -0.010456006042659283, -0.029327163472771645, 0.014428747817873955, -0.1127476692199707, -0.0008756744209676981, 0.06877346336841583, 0.044101886451244354, -0.18405362963676453, 0.1445782631635666, -0.042903486639261246, -0.13261087238788605, 0.07972389459609985, -0.1277763545513153, 0.06787851452827454, -0.022440707311034203, 0.027383461594581604, -0.17486944794654846, 0.09219446033239365, -0.05562397465109825, 0.04958917573094368, 0.05735631287097931, 0.09393565356731415, 0.03933580964803696, 0.1037362590432167, 0.1814013123512268, -0.061312850564718246, -0.05313047766685486, -0.14371973276138306, -0.030138133093714714, 0.16433103382587433, -0.017222335562109947, 0.12249072641134262, 0.08260607719421387, -0.008096171543002129, -0.05657562240958214, -0.1341635286808014, -0.01129503920674324, 0.1021486446261406, 0.006231305655092001, 0.05418453738093376, 0.0559266097843647, 0.025615829974412918, -0.009781181812286377, 0.04245273768901825, 0.0201707910746336, 0.09055987745523453, 0.017711248248815536, 0.07533815503120422, -0.006102445535361767, -0.020713161677122116, 0.10934913158416748, 0.09706036001443863, 0.10483783483505249, 0.08498869091272354, -0.07574581354856491, 0.043285973370075226, -0.05785070359706879, 0.0467454195022583, -0.07400018721818924, -0.01616741344332695, 0.18392424285411835, -0.052062466740608215, 0.04739690572023392, 0.05101634934544563, 0.070471853017807, -0.0024651752319186926, 0.030223017558455467, -0.02813967876136303, -0.04881512373685837, -0.13131769001483917, 0.014623391442000866, 0.011986639350652695, -0.022711148485541344, -0.08656338602304459, -0.006704983301460743, -0.007167311385273933, -0.023766441270709038, 0.18746314942836761, 0.08661011606454849, -0.09472262114286423, -0.044170960783958435, -0.013059734366834164, 0.10719309747219086, 0.04750552400946617, -0.12086037546396255, -0.05152469873428345, 0.03424213454127312, -0.05090227723121643, 0.011411458253860474, 0.03963812068104744, -0.07099232077598572, -0.10418370366096497, -7.647696475032717e-05, 0.010191946290433407, -0.006110952235758305, -0.040367357432842255, -0.17883892357349396, 0.02462286874651909, -0.03573768585920334, -0.13572198152542114, -0.11208664625883102, -0.055467527359724045, 0.11951933801174164, 0.07834755629301071, -0.10952608287334442, 0.07754291594028473, 0.09861724823713303, 0.04942622035741806, -0.07600413262844086, -0.09106669574975967, -0.11588993668556213, 0.07415225356817245, -0.0939783900976181, 0.07649962604045868, 0.08540420234203339, -0.17814326286315918, -0.015914004296064377, -0.010018064640462399, -0.03722139075398445, -0.07607243955135345, 0.027001826092600822, 0.013816912658512592, 0.10095471888780594, -0.10267650336027145, -0.05988398566842079, -0.020719332620501518, -0.010373045690357685, -0.06144396960735321, -0.03315750136971474, 0.04747094213962555, 0.04477726295590401, -0.0674615129828453, 0.007819090038537979, -0.09983307123184204, 0.04075970500707626, -0.05028150975704193, -0.0593804232776165, -0.016719894483685493, 0.018490126356482506, -0.1579740196466446, 0.08515047281980515, 0.023091722279787064, -0.056164681911468506, -0.11975796520709991, -0.004201472271233797, -0.08639846742153168, 0.061239808797836304, 0.1033153235912323, -0.1424495279788971, 0.025264229625463486, -0.06268365681171417, 0.0770886018872261, -0.07497692853212357, -0.03999854996800423, -0.0666910782456398, -0.09322614222764969, -0.0012335454812273383, 0.11863178759813309, 0.12054873257875443, 0.16208672523498535, -0.02798067033290863, -0.1035413071513176, 0.07456322014331818, -0.022980736568570137, 0.05734111741185188, -0.006302857771515846, -0.09343445301055908, 0.013022420927882195, -0.07277701795101166, 0.08712862432003021, -0.014869371429085732, 0.028515411540865898, -0.026772664859890938, -0.02318723313510418, 0.01998390257358551, -0.00317721557803452, 0.10573349893093109, 0.06729868799448013, 0.00582425482571125, 0.005307041108608246, -0.03967655450105667, 0.08097289502620697, -0.009362823329865932, 0.008960315957665443, 0.1857011914253235, -0.002946901135146618, 0.004465153440833092, 0.09085464477539062, -0.01658581756055355, -0.17045222222805023, 0.10455989837646484, -0.0776180550456047, 0.0967533066868782, -0.08885060995817184, -0.02518567256629467, -0.1631200909614563, 0.09079450368881226, -0.01639040932059288, -0.07580732554197311, 0.05351299047470093, -0.11352603137493134, 0.014980182982981205, -0.07622215896844864, 0.08092639595270157, -0.16021648049354553, 0.09885671734809875, -0.11281640082597733, 0.09197121858596802, 0.028209777548909187, 0.11436126381158829, -0.06397832930088043, 0.03679199889302254, 0.050256382673978806, -0.1337689906358719, -0.036517102271318436, -0.15320390462875366, -0.04599394649267197, -0.0219277236610651, -0.06745753437280655, 0.06267193704843521, 0.009433564729988575, -0.11037459224462509, 0.010443865321576595, -0.010525093413889408, 0.08267594128847122, 0.07874681800603867, 0.06357287615537643, -0.04149311035871506, -0.16818246245384216, 0.005117453169077635, -0.009934388101100922, -0.19584472477436066, -0.04567669332027435, 0.05732100456953049, 0.020319854840636253, -0.13262981176376343, -0.01580103114247322, 0.12394993007183075, 0.18548870086669922, 0.04725030064582825, 0.04531817138195038, -0.038991522043943405, -0.03273797407746315, 0.07615912705659866, -0.02882835827767849, 0.11775749921798706, 0.06237295642495155, -0.024624725803732872, 0.1438809484243393, 0.06393400579690933, -0.12205582112073898, -0.03447346389293671, -0.1544777899980545, -0.0213191956281662, -0.1492069661617279, -0.004197871312499046, -0.07130826264619827, -0.11560776829719543, 0.08925949782133102, 0.08002318441867828, -0.030170029029250145, 0.05898798629641533, -0.1556193232536316, -0.04186936840415001, 0.022451626136898994, 0.029401998966932297, 0.072276771068573, 0.023102372884750366, -0.05675341561436653, -0.13532230257987976, -0.021109316498041153, -0.11882444471120834, 0.020928623154759407, -0.02708771638572216, 0.06203121691942215, -0.19710654020309448, -0.10417146235704422, -0.036062657833099365, 0.07499682903289795, -0.11646506190299988, -0.09919524937868118, -0.03698107600212097, 0.032748881727457047, 0.12363732606172562, 0.008346956223249435, -0.13441121578216553, -0.07753574848175049, 0.08514095842838287, -0.11319885402917862, 0.10889601707458496, 0.08926663547754288, 0.07658375054597855, 0.0747065395116806, -0.0765867531299591, 0.16492576897144318, -0.10773921757936478, 0.03784867376089096, -0.07954520732164383, -0.013049162924289703, -0.0905923917889595, 0.07677187770605087, 0.03555852174758911, -0.05946419760584831, -0.048227936029434204, 0.04006795585155487, -0.1311664879322052, -0.06466660648584366, -0.12043137103319168, -0.016351347789168358, 0.02970740757882595, -0.14416100084781647, 0.003341338597238064, -0.09241200238466263, 0.07186461985111237, -0.030057309195399284, -0.03506825119256973, 0.09826002269983292, -0.00197670073248446, -0.11352869868278503, 0.04819314554333687, 0.02580033615231514, -0.05680176243185997, 0.019678782671689987, -0.07371775060892105, 0.06461109220981598, 0.0030493303202092648, -0.10924448072910309, -0.024270251393318176, -0.014533638022840023, 0.10345609486103058, 0.03900741785764694, -0.011375096626579762, -0.07060056924819946, 0.10046295076608658, -0.047735560685396194, 0.13747647404670715, -0.014004196971654892, 0.03410487249493599, -0.047984059900045395, -0.1471836268901825, -0.05688856914639473, 0.06592686474323273, 0.11457772552967072, 0.004006044007837772, -0.12382127344608307, -0.09835910052061081, 0.114292673766613, 0.004455891903489828, -0.0060401191003620625, -0.012153367511928082, -0.15747413039207458, 0.11814001202583313, 0.03298332914710045, 0.023430516943335533, 0.04403601959347725, -0.002180773764848709, -0.05972404032945633, 0.0003989946562796831, 0.0018184426007792354, 0.11675825715065002, -0.03759206831455231, -0.007210491690784693, 0.11311933398246765, -0.008916025049984455, -0.05234268307685852, -0.1053069457411766, -0.13293375074863434, -0.014446090906858444, -0.003448079340159893, 0.11559492349624634, 0.08192599564790726, 0.10922983288764954, -0.03499235957860947, -0.039198681712150574, -0.017603352665901184, 0.0013007769593968987, 0.10185409337282181, 0.062296561896800995, -0.09166223555803299, -0.03285801038146019, 0.03484249487519264, 0.005544496234506369, -0.032081905752420425, -0.15106220543384552, -0.000545275688637048, -0.06564130634069443, -0.11021456122398376, -0.05059557408094406, -0.08079647272825241, -0.03156052902340889, -0.0156150683760643, 0.05137248709797859, 0.07391489297151566, -0.10703251510858536, -0.10201582312583923, -0.045886263251304626, 0.061238452792167664, -0.014338825829327106, 0.031038975343108177, -0.053148604929447174, -0.14621680974960327, -0.04169625788927078, -0.08913038671016693, -0.06588302552700043, 0.06972003728151321, -0.041126564145088196, -0.04037676751613617, 0.020059023052453995, -0.10840731114149094, 0.1447782963514328, -0.04801476374268532, -0.09365606307983398, 0.16217653453350067, -0.1368212103843689, 0.017841065302491188, -0.16400359570980072, -0.02704891934990883, -0.11290141940116882, -0.07152966409921646, 0.0854855328798294, -0.13797172904014587, 0.04090849310159683, 0.030451864004135132, -0.19583354890346527, 0.01370983012020588, 0.11020488291978836, -0.08030367642641068, 0.0526689812541008, -0.019562900066375732, -0.001526329549960792, -0.029226070269942284, 0.00956791639328003, 0.024742940440773964, -0.08243606239557266, 0.05697254091501236, 0.0722508653998375, 0.08428318798542023, 0.06862983852624893, -0.1512518972158432, 0.07949459552764893, 0.021395470947027206, 0.04716271907091141, -0.012781411409378052, -0.13761287927627563, 0.10310827195644379, -0.010146654210984707, 0.014618349261581898, -0.005387399345636368, -0.016801878809928894, -0.002369492081925273, 0.03534417971968651, 0.09136532992124557, -0.017594723030924797, 0.1774260401725769, -0.06240875646471977, 0.06089230626821518, 0.07920457422733307, 0.09062601625919342, -0.06345110386610031, 0.09735406935214996, -0.07631746679544449, 0.1265755593776703, -0.04915957525372505, 0.1383192390203476, 0.07968474179506302, -0.10498961806297302, -0.07451830804347992, -0.10146668553352356, 0.006405406165868044, -0.013339990749955177, -0.08928048610687256, -0.01999088004231453, 0.13342882692813873, -0.07730208337306976, 0.07623771578073502, 0.10408420860767365, -0.041369564831256866, 0.04422738403081894, 0.0017209796933457255, 0.04403543844819069, -0.030504999682307243, 0.04477722570300102, 0.11250509321689606, 0.015079428441822529, -0.07689785212278366, -0.0736929401755333, -0.0731360986828804, -0.01865156553685665, 0.0209610965102911, -0.014648359268903732, -0.0728614553809166, 0.01262661162763834, -0.07421623170375824, 0.1197224110364914, -0.06768756359815598, 0.09714634716510773, -0.003791916649788618, -0.12222699075937271, 0.061851274222135544, 0.02375918999314308, 0.03188011795282364, -0.0014997696271166205, 0.06764306128025055, 0.04502701014280319, 0.11777263134717941, 0.12558625638484955, -0.003953766077756882, 0.07282126694917679, 0.04765595495700836, -0.033865418285131454, 0.02508563920855522, -0.014764232560992241, 0.08387009799480438, -0.0016841882606968284, 0.02573161944746971, -0.11735802888870239, 0.05527340620756149, -0.09678041934967041, -0.08472266793251038, 0.07320595532655716, 0.08962175250053406, -0.04910482093691826, 0.028887499123811722, 0.08542415499687195, -0.055093102157115936, -0.0449444055557251, -0.0059007033705711365, 0.07786541432142258, -0.02848014049232006, 0.01484835334122181, 0.020534776151180267, 0.004698533099144697, 0.08022770285606384, 0.018512776121497154, -0.05556655675172806, 0.09515505284070969, 0.08175495266914368, -0.10158738493919373, -0.022048085927963257, -0.04460275545716286, -0.0936443880200386, -0.04638051986694336, 0.011696923524141312, 0.057250816375017166, 0.06435157358646393, 0.10350105166435242, 0.18576562404632568, 0.09505601972341537, 0.11767926067113876, -0.011313114315271378, 0.00020245015912223607, 0.06867604702711105, 0.03747698664665222, -0.04129577428102493, 0.10907774418592453, -0.008159885182976723, 0.01637815684080124, 0.039124730974435806, 0.1260388046503067, 0.004400298465043306, -0.08256294578313828, 0.017528731375932693, -0.11569028347730637, 0.002353225601837039, 0.12326613813638687, -0.0507199689745903, -0.08555164933204651, 0.0324203222990036, 0.07007574290037155, 0.014373133890330791, 0.016999822109937668, -0.16943632066249847, -0.00650525139644742, -0.04766596108675003, 0.05181388556957245, -0.0904107391834259, -0.03128407523036003, -0.060483988374471664, -0.15459108352661133, 0.0687621682882309, 0.0010347680654376745, 0.09669362753629684, 0.007004806771874428, 0.172896146774292, -0.03355282172560692, -0.12830662727355957, 0.0659247413277626, -0.015465137548744678, 0.016747601330280304, 0.0162180345505476, -0.06552977114915848, 0.032807204872369766, 0.033873651176691055, -0.17467467486858368, 0.04232333227992058, -0.13426664471626282, -0.014588146470487118, 0.18457303941249847, -0.06107720360159874, -0.032642971724271774, 0.099704310297966, 0.007568900473415852, 0.018962299451231956, -0.050662580877542496, -0.15425704419612885, 0.0021255637984722853, 0.03981980308890343, -0.1117100939154625, -0.0030257173348218203, -0.0162306260317564, 0.07872205972671509, -0.03426330164074898, 0.016897263005375862, 0.028483062982559204, 0.01733105443418026, -0.007792756427079439, 0.1088196411728859, -0.0022698482498526573, 0.07535124570131302, -0.0233704075217247, -0.013362300582230091, 0.06793367117643356, 0.03193166106939316, 0.10944868624210358, 0.01936500146985054, -0.10600105673074722, -0.1657821387052536, -0.009074348956346512, -0.025000443682074547, -0.014474762603640556, 0.02844410575926304, -0.02669699862599373, 0.09887096285820007, 0.16807003319263458, 0.03961522877216339, -0.03129518777132034, 0.1368507742881775, 0.10156570374965668, 0.06960314512252808, 0.0856560543179512, 0.12976275384426117, -0.017297303304076195, -0.0410175584256649, -0.12312421947717667, 0.16518521308898926, -0.06637120246887207, -0.1474452167749405, 0.018109066411852837, -0.007305456325411797, -0.09127817302942276, -0.1272953301668167, 0.0776965320110321, 0.027290554717183113, -0.1071278303861618, 0.016671735793352127, 0.10458880662918091, -0.07395035773515701, 0.06775195896625519, -0.05605224892497063, 0.09068994224071503, 0.12428832054138184, -0.07762082666158676, -0.1261645257472992, -0.015152999199926853, 0.0004298351122997701, -0.010187828913331032, -0.048215169459581375, -0.06371235847473145, -0.12974587082862854, -0.04818003252148628, -0.04190937057137489, -0.038118477910757065, -0.18088585138320923, 0.06797367334365845, -0.06815536320209503, 0.12284358590841293, 0.08094994723796844, -0.17308184504508972, -0.008231116458773613, -0.17685958743095398, 0.11759316921234131, -0.07161226868629456, 0.0584733784198761, 0.07855972647666931, -0.12917859852313995, 0.12987108528614044, 0.09576412290334702, 0.11712158471345901, 0.07131823897361755, 0.029993895441293716, 0.007429879158735275, 0.012296515516936779, 0.08362177759408951, 0.09925498813390732, 0.007851843722164631, 0.012070456519722939, 0.02236779034137726, 0.13850371539592743, 0.12411579489707947, 0.042326465249061584, -0.00979434885084629, -0.1170581579208374, -0.07742684334516525, -0.04437895119190216, 0.11123903095722198, 0.10034775733947754, -0.027638789266347885, -0.11591378599405289, 0.1906101107597351, -0.03465358167886734, -0.16580355167388916, -0.03422144055366516, 0.022906148806214333, -0.06717339903116226, -0.07018144428730011, -0.025692101567983627, -0.054120153188705444, 0.010185077786445618, -0.07005779445171356, -0.08854510635137558, 0.0028287603054195642, -0.1406157910823822, -0.09330552816390991, 0.09751210361719131, 0.04362333565950394, 0.09477425366640091, -0.0022553729359060526, 0.12220051139593124, -0.10158233344554901, -0.004989071283489466, -0.09425430744886398, 0.019385457038879395, -0.002439794596284628, -0.08953575044870377, 0.06479054689407349, -0.04958483576774597, 0.06760923564434052, -0.14746807515621185, -0.02424270659685135, 0.16456013917922974, 0.05626289173960686, 0.09667743742465973, 0.1431276649236679, 0.059594813734292984, -0.09545038640499115, -0.07440929859876633, -0.07812166959047318, 0.10324332118034363, 0.12194611877202988, 0.08544343709945679, 0.0775165855884552, -0.0024763746187090874, -0.13240858912467957, -0.012853018008172512, -0.12435564398765564, 0.05821472406387329, -0.1259142905473709, -0.01585250347852707, 0.01488952524960041, 0.025687547400593758, -0.03670329600572586, 0.06267032772302628, 0.011070814915001392, 0.0684075877070427, 0.02010010927915573, -0.16850028932094574, -0.064358189702034, 0.04256979748606682, 0.07712121307849884, 0.07026736438274384, 0.026680806651711464, 0.14905285835266113, 0.023530082777142525, -0.04898649454116821, -0.0994873195886612, 0.03328797221183777, -0.048072341829538345, 0.05873260647058487, -0.14368487894535065, -0.05146969482302666, -0.04265487566590309, -0.04112643003463745, -0.11120963096618652, -0.04018658027052879, -0.009246245957911015, -0.027846908196806908, 0.02204406075179577, 0.004855109378695488, 0.002618337282910943, -0.060302022844552994, 0.06958691775798798, 0.05434095486998558, -0.05115343630313873, 0.12285864353179932, -0.043184030801057816, -0.029443271458148956, 0.07172048091888428, -0.08151379972696304, 0.013030054047703743, 0.06800054758787155, 0.019407710060477257, -0.04151239991188049, -0.037831466645002365, -0.023008642718195915, 0.20654229819774628, 0.003121516667306423, -0.13657201826572418, 0.03772462531924248, -0.04925026744604111, -0.10961252450942993, 0.03110596351325512, -0.015065512619912624, 0.003551120636984706, -0.0713958591222763, -0.10754222422838211, 0.024362362921237946, 0.14601276814937592, 0.04144373536109924, 0.06497171521186829, -0.14201240241527557, -0.09692994505167007, -0.04166819527745247, 0.012145813554525375, 0.01205688901245594, -0.06522240489721298, 0.04530659690499306, 0.041231438517570496, 0.007258280646055937, 0.01336564403027296, -0.05817651376128197, 0.022406110540032387, -0.029081445187330246, -0.04677525535225868, -0.09154703468084335, -0.1512303203344345, -0.08328309655189514, -0.08954455703496933, -0.03303223475813866, -0.021595485508441925, 0.09322994202375412, 0.044210031628608704, 0.1072203665971756, -0.06982865184545517, -0.07709308713674545, -0.06907379627227783, 0.04782775416970253, 0.0981273427605629, 0.07701850682497025, -0.03473559021949768, 0.0051850806921720505, 0.003884268458932638, -0.10153976827859879, -0.15172383189201355, -0.013505836017429829, 0.044130511581897736, -0.0742485299706459, 0.019760336726903915, -0.0068628257140517235, -0.04441607743501663, -0.0007175240898504853, 0.06876899302005768, 0.09619377553462982, -0.03953586891293526, 0.03427155688405037, 0.01567915640771389, 0.0738714411854744, -0.0969448909163475, 0.05899443104863167, 0.012367337010800838, -0.024704964831471443, 0.017570070922374725, 0.010814146138727665, 0.11225790530443192, 0.011250154115259647, 0.016669832170009613, -0.05565647408366203, 0.06370336562395096, 0.07850577682256699, -0.1090974286198616, 0.022974403575062752, 0.042623795568943024, 0.01643630489706993, -0.04506778344511986, 0.14559721946716309, -0.06450340896844864, -0.015216723084449768, 0.036896757781505585, 0.08370548486709595, 0.08618711680173874, -0.08506665378808975, 0.023906627669930458, 0.049033183604478836, 0.0609888955950737, 0.021386289969086647, -0.08402542024850845, 0.1010296642780304, -0.013829384930431843, 0.1177232638001442, 0.09773560613393784, 0.0008926939335651696, -0.05571729689836502, -0.007445687428116798, 0.024579109624028206, -0.02591131068766117, -0.04050040617585182, -0.01999417506158352, -0.057520050555467606, 0.01246771588921547, -0.059376027435064316, 0.017008529976010323, 0.00442573893815279, 0.009923072531819344, -0.14421683549880981, 0.023676665499806404, 0.11124039441347122, 0.019888397306203842, 0.0006666199187748134, 0.005459840875118971, -0.029238905757665634, 0.003785397857427597, 0.07468483597040176, 0.07978029549121857, -0.10413234680891037, 0.019420703873038292, 0.010906011797487736, 0.008800199255347252, -0.02985900640487671, -0.07022882252931595, 0.006109634414315224, -0.028505105525255203, -0.009493621066212654, 0.09359332919120789, 0.052317194640636444, -0.1344958394765854, 0.12451391667127609, 0.03621123731136322, 0.07281174510717392, 0.03290596231818199, -0.03618598356842995, -0.0008702133782207966, -0.1114712804555893, 0.05508638545870781, -0.06339336186647415, -0.07560816407203674, -0.04514747112989426, -0.05587738752365112, -0.009807344526052475, -0.1930205076932907, 0.16106799244880676, -0.031701866537332535, -0.1356530487537384, -0.011370230466127396, 0.08914598822593689, 0.05048329755663872, -0.14725083112716675, 0.00014428239956032485, 0.1165047138929367, -0.09318646043539047, -0.02902236022055149, 0.09784046560525894, -0.10418245941400528, -0.0284121036529541, -0.07131945341825485, -0.16914069652557373, 0.06742624938488007, 0.02543291077017784, 0.07757546752691269, 0.06259623169898987, -0.034341443330049515, -0.11513294279575348, 0.012460539117455482, -0.03701406344771385, 0.16028620302677155, -0.1490153670310974, -0.011394042521715164, 0.12275063246488571, 0.01618882827460766, 0.02190907672047615, 0.00839611142873764, 0.004111714195460081, 0.035266708582639694, 0.12144014984369278, -0.056895602494478226, -0.02138219028711319, 0.03848725184798241, 0.09943837672472, 0.06672776490449905, -0.06364596635103226, 0.040811266750097275, -0.09506919234991074, 0.07489535957574844, -0.10087315738201141, 0.002593735698610544, -0.019449952989816666, -0.04375309497117996, -0.06530924141407013, 0.09460606426000595, 0.004034983925521374, -0.07005204260349274, 0.040089622139930725, 0.06702456623315811, -0.000865618814714253, -0.06301241368055344, -0.03235309198498726, -0.03727000579237938, 0.09151404350996017, -0.09209020435810089, -0.09662497788667679, 0.018352894112467766, 0.01471024565398693, 0.03083750046789646, 0.0558246374130249, 0.13917756080627441, -0.0977671891450882, 0.038263313472270966, -0.028696687892079353, 0.1016315221786499, 0.010107050649821758, -0.016904210671782494, 0.13062907755374908, -0.00797133520245552, -0.021777020767331123, 0.012483708560466766, -0.008573654107749462, -0.06314324587583542, 0.04871140047907829, -0.14625459909439087, 0.10601155459880829, -0.12476017326116562, -0.013547319918870926, -0.10786519944667816, -0.02092880569398403, -0.014413542114198208, -0.02474486082792282, 0.07942687720060349, 0.05230848118662834, 0.003965041134506464, -0.030059929937124252, 0.1441033035516739, 0.06644023954868317, -0.00877296831458807, -0.023695118725299835, -0.1002851277589798, -0.07912463694810867, -0.06686617434024811, 0.005246620159596205, -0.048491742461919785, -0.01687770150601864, -0.09327587485313416, -0.05390661954879761, -0.06783124059438705, 0.026553945615887642, 0.04491584375500679, 0.03193371370434761, 0.08035551756620407, 0.02583577297627926, -0.06425683200359344, -0.04699457809329033, -0.06160067766904831, 0.008980761282145977, 0.10065068304538727, 0.07270267605781555, -0.012256830930709839, 0.020907387137413025, -0.12305431813001633, 0.15685869753360748, 0.07269778102636337, -0.05148448050022125, 0.004340702667832375, -0.14948366582393646, 0.05932885408401489, 0.005934195127338171, -0.020358093082904816, -0.020269811153411865, 0.09574896842241287, 0.08740932494401932, 0.049680426716804504, -0.0020087347365915775, 0.025156356394290924, -0.04339654743671417, 0.02334359847009182, 0.02531745843589306, -0.023631589487195015, 0.10289343446493149, -0.21048279106616974, -0.06152556091547012, 0.004285045433789492, 0.07993730902671814, -0.1487826406955719, 0.13177607953548431, 0.10767877846956253, 0.10206647217273712, 0.1079118400812149, 0.08564421534538269, -0.13277125358581543, -0.08799587190151215, -0.13093461096286774, 0.09590749442577362, 0.00509243831038475, 0.150482177734375, 0.11283528059720993, -0.03037532977759838, 0.09472731500864029, 0.03545152768492699, -0.13293489813804626, -0.02439475804567337, 0.054058145731687546, 0.061715058982372284, 0.15682488679885864, 0.0712517648935318, 0.08406198769807816, 0.026659686118364334, 0.051126688718795776, 0.045624006539583206, 0.09497526288032532, 0.1548849195241928, 0.06817464530467987, 0.11098373681306839, -0.03513580933213234, -0.09944459050893784, -0.06825239956378937, -0.04230284318327904, -0.009370296262204647, 0.028341079130768776, 0.05082020163536072, 0.008908460848033428, 0.025263456627726555, 0.06075545772910118, -0.010357453487813473, 0.033201705664396286, 0.03292052075266838, 0.003455335972830653, -0.0016037424793466926, -0.0011263072956353426, -0.10282681882381439, -0.02754948101937771, 0.04018424078822136, -0.07638055831193924, -0.051363326609134674, -0.01968148536980152, -0.018705585971474648, 0.17318104207515717, 0.10753236711025238, -0.08707714825868607, -0.09833309799432755, 0.001061906456016004, 0.05773353949189186, -0.09590541571378708, -0.028950154781341553, -0.080292247235775, 0.0791889876127243, 0.003656970802694559, 0.042695049196481705, -0.06647240370512009, -0.11477530002593994, -0.11589525640010834, -0.010306955315172672, 0.009585716761648655, 0.009685607627034187, -0.095586396753788, -0.10087481886148453, 0.017489511519670486, -0.009474799036979675, 0.10246293246746063, -0.0455528162419796, -0.07365083694458008, -0.03413281589746475, -0.11725755035877228, -0.049251992255449295, 0.03785811364650726, 0.09836437553167343, -0.03725190833210945, -0.06010041385889053, 0.05673730745911598, -0.004611372482031584, 0.06058886647224426, 0.06859297305345535, 0.04115760698914528, -0.020902421325445175, -0.11751651763916016, -0.032686199992895126, -0.007594580762088299, -0.0459052138030529, 0.006138192489743233, 0.018715031445026398, 0.034319281578063965, -0.051126837730407715, 0.05383850634098053, 0.025482118129730225, 0.002047951566055417, 0.13860830664634705, 0.005837708245962858, -0.0009589272667653859, 0.017269214615225792, -0.03787891939282417, -0.05593731254339218, -0.008892573416233063, 0.017117200419306755, 0.17851510643959045, 0.0259647686034441, -0.11289221048355103, -0.15220534801483154, -0.09342554956674576, 0.028425782918930054, -0.08504223823547363, -0.017702709883451462, 0.007767427712678909, 0.17902594804763794, -0.12296350300312042, -0.12821510434150696, -0.015957145020365715, -0.000846276932861656, 0.08177454024553299, -0.06967247277498245, 0.08473576605319977, 0.025098664686083794, 0.03915604576468468, -0.10343252122402191, -0.04447571560740471, 0.15514104068279266, -0.09360607713460922, -0.0496239997446537, 0.027500184252858162, -0.13580885529518127, 0.012920099310576916, 0.20553314685821533, -0.014496678486466408, 0.06706127524375916, -0.09627030789852142, 0.0873359888792038, -0.09486991167068481, -0.017558211460709572, 0.08462034165859222, -0.08086646348237991, -0.07138019800186157, 0.03318331390619278, -0.054114773869514465, 0.12993614375591278, -0.12221362441778183, 0.023401370272040367, -0.1210826188325882, -0.021004870533943176, 0.1324579119682312, -0.06189464032649994, -0.04056314751505852, 0.13961006700992584, 0.12644349038600922, 0.04577909782528877, 0.04094821959733963, 0.1239156499505043, 0.062429510056972504, 0.01916733756661415, 0.05462706834077835, -0.09240591526031494, -0.026575829833745956, 0.008369235321879387, -0.048371538519859314, 0.08844674378633499, 0.008354270830750465, -0.008357054553925991, 0.014990304596722126, 0.058780819177627563, 0.0054448614828288555, -0.03831227868795395, 0.0266867708414793, 0.10338130593299866, 0.009527565911412239, -0.034327391535043716, -0.0860605239868164, -0.01445433497428894, -0.08647248148918152, 0.06308888643980026, -0.01909242384135723, -0.017349446192383766, 0.007714283652603626, -0.048550497740507126, -0.04050610587000847, -0.034860387444496155, 0.05259289965033531, -0.12497895210981369, 0.05083543807268143, 0.09112381935119629, 0.05349013954401016, -0.07400526851415634, 0.07520447671413422, -0.11424711346626282, 0.060810402035713196, -0.03600599989295006, -0.11065749824047089, 0.14865180850028992, 0.10612423717975616, -0.07120714336633682, -0.01708364300429821, 0.06413682550191879, -0.023057643324136734, -0.01952163688838482, -0.049337420612573624, -0.07107464224100113, 0.004775915294885635, -0.049879010766744614, -0.03249684348702431, -0.08209116011857986, -0.044894859194755554, 0.01576032117009163, -0.007130607031285763, -0.09876904636621475, 0.03260855749249458, 0.029047813266515732, -0.048006217926740646, 0.0814710259437561, 0.11032911390066147, -0.08096776902675629, 0.018779059872031212, 0.13029125332832336, -0.15009477734565735, 0.1101398766040802, 0.04567554593086243, 0.05328022688627243, -0.09385833889245987, -0.10476163774728775, 0.030913151800632477, -0.055076032876968384, 0.03845676779747009, -0.020682403817772865, -0.08727304637432098, -0.04703319072723389, -0.04234996810555458, 0.0009001981234177947, -0.08091694116592407, 0.017248371616005898, 0.08609949797391891, 0.09801526367664337, 0.11423178017139435, 0.06614555418491364, 0.016008196398615837, 0.015957584604620934, 0.0488266721367836, 0.0166774969547987, 0.12303721904754639, 0.17397670447826385, 0.0008321048808284104, 0.1423267424106598, 0.014136023819446564, -0.0077396719716489315, 0.13362403213977814, -0.034873686730861664, -0.02124069444835186, 0.049419380724430084, -0.07558821141719818, 0.12178805470466614, -0.12379872053861618, -0.03645592927932739, -0.16430431604385376, -0.0341535359621048, 0.11110007762908936, 0.03613878786563873, 0.046665117144584656, -0.033524300903081894, 0.019695209339261055, 0.060725435614585876, -0.07683366537094116, 0.11740460991859436, 0.10062671452760696, 0.08675267547369003, 0.019395846873521805, 0.03662190958857536, -0.17901434004306793, -0.09858759492635727, -0.06838167458772659, -0.0007995915366336703, 0.011454382911324501, -0.017686104401946068, 0.10514518618583679, -0.0783446729183197, 0.07570008933544159, -0.13720189034938812, 0.07829401642084122, -0.1700236052274704, 0.06582991778850555, -0.05657600238919258, 0.06509283930063248, -0.012725292704999447, -0.17622336745262146, 0.03519546240568161, 0.03723348304629326, -0.11714676767587662, -0.05573008209466934, -0.019868750125169754, 0.08167696744203568, 0.026701370254158974, 0.02951224148273468, -0.029647476971149445, 0.12773261964321136, -0.0701320618391037, 0.16488084197044373, -0.01691848412156105, -0.009953060187399387, -0.10866021364927292, -0.12211975455284119, -0.12965326011180878, -0.04239068925380707, -0.02943364903330803, 0.1074279323220253, 0.05448918044567108, 0.017501015216112137, -0.009119927883148193, -0.02062625251710415, -0.06139697879552841, 0.035036150366067886, -0.05179344490170479, 0.1443837583065033, -0.10052327811717987, 0.03273959085345268, -0.013263938948512077, 0.08898010849952698, 0.01128361001610756, -0.0024997571017593145, -0.0429304800927639, -0.027359768748283386, -0.1325187385082245, 0.026961930096149445, 0.03469252958893776, 0.04039520397782326, -0.03776468709111214, -0.022381072863936424, -0.08864834159612656, -0.03492915257811546, 0.06962097436189651, 0.10393237322568893, -0.08436640352010727, 0.08374876528978348, 0.02806733548641205, -0.058884397149086, 0.08097843825817108, 0.024250630289316177, 0.07073058187961578, -0.00833568349480629, -0.02870023623108864, 0.033216848969459534, -0.01595352590084076, 0.04270397871732712, 0.02284405007958412, 0.010455156676471233, 0.0754571408033371, -0.00919779296964407, -0.03817569836974144, 0.07712555676698685, -0.058279212564229965, -0.07007166743278503, 0.03409595787525177, 0.018851717934012413, -0.0037197519559413195, 0.010448167100548744, 0.021095983684062958, 0.007413890678435564, -0.005927360616624355, 0.10915309190750122, -0.049494095146656036, -0.10279413312673569, 0.04008739814162254, 0.010697206482291222, 0.1332748681306839, -0.020950883626937866, -0.14757679402828217, 0.01102595217525959, -0.12202247232198715, -0.05661845579743385, -0.10378552228212357, 0.11618848145008087, 0.1597795933485031, 0.05028891935944557, -0.004422574304044247, -0.13306467235088348, 0.002872956683859229, 0.02652287483215332, 0.0241631381213665, -0.05137709900736809, 0.0341627299785614, 0.039561424404382706, 0.06197541952133179, -0.03322591632604599, -0.12983134388923645, 0.05703907087445259, 0.09575993567705154, 0.029737941920757294, 0.05304805934429169, -0.09485553950071335, -0.14339667558670044, -0.060135334730148315, 0.014779139310121536, 0.03755756467580795, 0.0483529269695282, 0.0857524499297142, -0.08186368644237518, -0.12871100008487701, 0.04128431901335716, -0.12217067927122116, -0.01096549816429615, -0.06964930891990662, 0.050911154597997665, -0.06854479014873505, -0.11034825444221497, -0.029220663011074066, -0.06254059821367264, 0.06914584338665009, -0.09307386726140976, -0.027638059109449387, -0.009788488037884235, -0.037454187870025635, 0.04209135100245476, 0.055076245218515396, 0.03968527540564537, -0.13346879184246063, 0.04059334099292755, -0.06582796573638916, -0.09701910614967346, 0.010227620601654053, 0.0655050054192543, -0.0623919703066349, 0.043602753430604935, -0.11018649488687515, 0.0032201376743614674, -0.150824636220932, 0.036744773387908936, -0.10939409583806992, 0.007096440531313419, 0.0640711560845375, -0.0528872050344944, 0.05712087079882622, -0.058726273477077484, 4.10433676734101e-05, 0.05176219344139099, -0.10651437193155289, -0.05572035163640976, -0.03849385678768158, 0.08571060746908188, 0.10491806268692017, -0.0383652038872242, -0.09371548891067505, -0.07010383158922195, -0.08790671080350876, 0.08723592013120651, -0.15798966586589813, 0.05857608839869499, -0.00512018334120512, 0.11086546629667282, 0.1073508933186531, 0.11714321374893188, -0.06231001392006874, 0.055000435560941696, -0.05248570442199707, 0.04052320867776871, -0.11331531405448914, -0.007585075683891773, 0.0489884577691555, -0.02624327689409256, 0.10375369340181351, 0.10418885946273804, 0.0031922587659209967, 0.0559810996055603, -0.016026780009269714, -0.016201740130782127, -0.07027425616979599, -0.03793959692120552, -0.020318273454904556, 0.0892048105597496, -4.558597720460966e-05, -0.02061888761818409, 0.02380729839205742, -0.03607243299484253, -0.017284341156482697, 0.012270867824554443, 0.04644111171364784, -0.06092542037367821, -0.10464523732662201, -0.011168763041496277, 0.06899143010377884, 0.1402629315853119, 0.03588547930121422, 0.06265199929475784, 0.0630844309926033, -0.002499964088201523, 0.010407297872006893, 0.010172218084335327, -0.06856150925159454, 0.01657775044441223, -0.014301215298473835, -0.0023488958831876516, 0.026798145845532417, 0.0479622520506382, 0.04975399374961853, 0.09225160628557205, 0.029217446222901344, -0.10645677149295807, 0.08698977530002594, -0.0761180967092514, -0.01645638234913349, -0.10651252418756485, 0.01583469845354557, 0.025090016424655914, -0.027852771803736687, 0.026531971991062164, -0.17436273396015167, -0.09116225689649582, -0.04191756248474121, -0.15641571581363678, 0.17819175124168396, -0.13829801976680756, 0.15603326261043549, -0.027883682399988174, -0.11912766098976135, 0.08065594732761383, -0.013772792182862759, -0.024783603847026825, -0.08052922040224075, -0.09186827391386032, -0.02467874065041542, 0.016157004982233047, 0.000998491421341896, 0.06553222239017487, -0.012130007147789001, -0.09530533105134964, -0.030511904507875443, -0.1290782243013382, 0.04508129879832268, 0.09100852906703949, 0.07942050695419312, -0.14523978531360626, -0.029375577345490456, 0.07339908182621002, 0.07161235064268112, 0.025628628209233284, 0.05162828415632248, -0.056650593876838684, 0.03935166075825691, 0.02704382874071598, 0.10018714517354965, -0.04588800668716431, 0.05012613907456398, -0.151906356215477, -0.02414836920797825, -0.016164474189281464, 0.03047969937324524, -0.010232907719910145, -0.08317672461271286, -0.011190651915967464, 0.0045074294321238995, 0.09694147855043411, 0.06588537245988846, -0.014319839887320995, 0.10349079221487045, 0.08828873187303543, -0.048350684344768524, 0.015993041917681694, 0.08277691900730133, -0.027214258909225464, -0.1452893614768982, 0.0056531052105128765, -0.1073751375079155, -0.14609278738498688, 0.08944172412157059, 0.018514864146709442, -0.07785797119140625, -0.07335977256298065, -0.02484281174838543, -0.07266955822706223, -0.014730186201632023, 0.012588681653141975, 0.08228544145822525, 0.019175788387656212, 0.038697294890880585, -0.001081904279999435, 0.06391464918851852, -0.13602042198181152, 0.0684969425201416, 0.018266938626766205, -0.05695929378271103, -0.06110343337059021, -0.042844656854867935, -0.06096149608492851, 0.15035615861415863, 0.05534574016928673, -0.1227801963686943, 0.12515981495380402, 0.1055079773068428, 0.0407165102660656, -0.06706030666828156, -0.0018203036161139607, 0.09761987626552582, -0.005791274830698967, -0.09710706770420074, 0.00883009098470211, -0.07472490519285202, 0.07471342384815216, -0.15668877959251404, -0.007052564062178135, -0.12710049748420715, 0.04231436178088188, -0.11527319997549057, 0.09385278820991516, -0.10402995347976685, -0.04032410681247711, 0.037951283156871796, 0.03166618198156357, 0.060089290142059326, 0.12738245725631714, 0.038864538073539734, 0.06023989990353584, -0.028756095096468925, 0.08617588132619858, -0.054194219410419464, -0.09723781049251556, 0.09785433858633041, -0.01829819194972515, -0.04885467141866684, -0.010064098984003067, 0.026717346161603928, -0.06310965865850449, 0.05964711681008339, 0.029207561165094376, -0.058145564049482346, 0.04335515946149826, -0.07756666094064713, -0.09184377640485764, 0.10471251606941223, 0.0780758485198021, -0.06368420273065567, -0.015083571895956993, 0.01769365556538105, -0.12331244349479675, 0.0641547441482544, -0.06716478615999222, -0.10182837396860123, -0.06694027781486511, -0.11497671157121658, -0.08188168704509735, 0.17723038792610168, 0.08472086489200592, 0.08698136359453201, 0.014479408040642738, 0.10860805213451385, 0.005699174012988806, -0.20210137963294983, 0.18281139433383942, 0.04226945340633392, -0.12770581245422363, 0.057836830615997314, -0.15470753610134125, 0.08078131079673767, -0.012105228379368782, 0.046585939824581146, 0.08751506358385086, -0.02983189933001995, -0.1151171401143074, 0.09230490028858185, -0.10288731753826141, 0.028753727674484253, 0.052646204829216, -0.001654404099099338, 0.06969446688890457, -0.14713700115680695, -0.10336258262395859, 0.02222246117889881, 0.08580564707517624, 0.12407974153757095, 0.039874330163002014, 0.08171848952770233, -0.08087106049060822, -0.03142721578478813, 0.07681585103273392, 0.04946174845099449, -0.1975659281015396, 0.05746559426188469, -0.09147932380437851, 0.11278216540813446, -0.07437381893396378, 0.03751233220100403, 0.05770063400268555, -0.1547585427761078, 0.1667402982711792, 0.006983598694205284, 0.11253122985363007, 0.03301278501749039, 0.07189112901687622, 0.016312848776578903, -0.09191547334194183, 0.09655514359474182, 0.04025785252451897, 0.036468736827373505, -0.13151033222675323, -0.09893959015607834, 0.08336345851421356, 0.025232907384634018, -0.02317645773291588, -0.12077941000461578, 0.0328410379588604, 0.0048287962563335896, 0.03717749938368797, 0.062424436211586, 0.055102091282606125, -0.0031943507492542267, -0.14173592627048492, 0.06437205523252487, 0.10222257673740387, 0.07514375448226929, -0.01918705366551876, 0.07214996218681335, -0.10394622385501862, 0.053791165351867676, -0.0721229538321495, -0.042907148599624634, 0.03916230425238609, -0.06844078749418259, 0.010786252096295357, -0.08190616965293884, 0.05234831944108009, 0.033403802663087845, -0.0338217057287693, 0.047032430768013, 0.1455508917570114, -0.015129334293305874, 0.020937005057930946, -0.08321353048086166, -0.04982748255133629, 0.032503996044397354, -0.035764239728450775, -0.042757295072078705, -0.038658659905195236, -0.09331727772951126, 0.004141621757298708, 0.040672335773706436, -0.08014729619026184, -0.0010042379144579172, 0.0854630321264267, -0.014417327009141445, 0.014062948524951935, 0.05383175238966942, -0.03243463486433029, -0.004386286251246929, -0.15142954885959625, 0.030294207856059074, -0.010601475834846497, 0.06061089038848877, -0.10588611662387848, -0.11489362269639969, -0.11283136904239655, -0.03404611349105835, 0.03097967989742756, 0.019958363845944405, 0.02089592069387436, -0.05388948321342468, -0.043388836085796356, 0.061091117560863495, 0.08166556060314178, -0.006662124767899513, -0.010739984922111034, -0.06984836608171463, 0.00301593285985291, -0.021094264462590218, 0.021804455667734146, 0.023317785933613777, 0.15873806178569794, -0.17427405714988708, 0.03842628002166748, -0.08524738997220993, -0.11231079697608948, 0.03635625168681145, -0.0447622686624527, 0.12237296998500824, 0.07020459324121475, 0.0643603727221489, 0.08673062920570374, 0.006091979332268238, -0.03208283707499504, -0.08473838120698929, -0.10958930104970932, 0.014659014530479908, 0.10956186056137085, -0.004051670897752047, 0.10317996889352798, 0.001382728572934866, 0.03973129391670227, 0.09591832756996155, -0.015480509959161282, -0.09723488986492157, 0.04618056118488312, 0.06693265587091446, 0.11418118327856064, 0.20055532455444336, -0.10907725989818573, -0.03971485421061516, -0.044949691742658615, -0.14070799946784973, 0.013476134277880192, -0.1634347289800644, -0.006190784275531769, 0.09970380365848541, -0.018687507137656212, 0.11492052674293518, 0.028228867799043655, 0.0535648949444294, 0.007578865624964237, -0.059933871030807495, 0.05284631997346878, -0.014171135611832142, 0.049766138195991516, 0.008039349690079689, 0.06679130345582962, 0.13425834476947784, -0.06813152134418488, 0.010762728750705719, 0.001740916632115841, -0.020308420062065125, -0.03544863313436508, -0.028158893808722496, -0.049463339149951935, -0.029958805069327354, -0.09958375990390778, -0.059198200702667236, -0.15043896436691284, 0.15969012677669525, -0.06238538771867752, -0.11915872246026993, 0.07886315137147903, 0.11128643155097961, 0.0033809314481914043, 0.06441166996955872, -0.027112338691949844, 0.09101271629333496, 0.022441167384386063, 0.19982750713825226, -0.027516871690750122, -0.03474922850728035, 0.1079077497124672, -0.023512691259384155, 0.06393672525882721, 0.11420023441314697, -0.03571053594350815, -0.02002222277224064, -0.11511155962944031, 0.14483699202537537, -0.020600778982043266, -0.11538222432136536, -0.009762533940374851, 0.022028136998414993, 0.036378540098667145, 0.026130888611078262, 0.1420179307460785, -0.11959441006183624, 0.08574745804071426, -0.12117172032594681, -0.03386590629816055, -0.03366360813379288, -0.08084964752197266, 0.1323648989200592, -0.1043834239244461, -0.024874011054635048, 0.030370935797691345, 0.14584922790527344, -0.04819580167531967, 0.07287028431892395, 0.1073523685336113, -0.03709698095917702, -3.885531623382121e-05, -0.07385765016078949, -0.10055641829967499, -0.030837496742606163, -0.07718156278133392, -0.01826504059135914, -0.13233140110969543, 0.032990310341119766, 0.03717988729476929, 0.03483361005783081, 0.04926346242427826, -0.06207185611128807, -0.04766787588596344, -0.05707566812634468, -0.016998659819364548, 0.0753941759467125, 0.06072108447551727, -0.022256316617131233, 0.08745386451482773, 0.05789446085691452, 0.05949901416897774, -0.030724333599209785, 0.0831865668296814, 0.033441998064517975, -0.05137490853667259, -0.14336854219436646, 0.1016751080751419, 0.16905374825000763, -0.019380096346139908, 0.17081083357334137, -0.07532760500907898, 0.01790374331176281, -0.10933215916156769, -0.04030635207891464, 0.08596167713403702, 0.018614066764712334, 0.0969916433095932, 0.00978181604295969, 0.16126248240470886, -0.06635504961013794, -0.04120836779475212, 0.06217287480831146, -0.0790378674864769, -0.03462075814604759, -0.07445339858531952, -0.05723999813199043, -0.09609627723693848, 0.04204940423369408, -0.03850631043314934, 0.06836763024330139, -0.056793730705976486, -0.03677324578166008, 0.009841633029282093, 0.05538000166416168, 0.0012588220415636897, -0.01429527997970581, -0.15913532674312592, 0.045772187411785126, 0.028152186423540115, 0.10303273051977158, 0.09097442030906677, 0.10098757594823837, -0.021126002073287964, -0.03132801875472069, -0.08314003050327301, 0.03920980915427208, 0.05765564739704132, 0.09762260317802429, 0.03262520954012871, -0.040362533181905746, 0.07080995291471481, 0.01169177982956171, 0.03484684228897095, 0.03598082810640335, 0.08651409298181534, 0.02898228168487549, 0.10318278521299362, 0.04991861805319786, 0.0493537075817585, 0.14492419362068176, 0.020268099382519722, 0.0011483769631013274, -0.17860063910484314, -0.04255951941013336, -0.12642106413841248, 0.033521927893161774, 0.022716958075761795, 0.13156841695308685, 0.10506442189216614, 0.05672786012291908, 0.09348767250776291, 0.09269741177558899, 0.0421895757317543, -0.011060086078941822, 0.03532043844461441, -0.03314647078514099, 0.07145488262176514, -0.026115579530596733, 0.03311203047633171, -0.03764414042234421, 0.005175813566893339, 0.04712235927581787, -0.07902874797582626, -0.008331160061061382, -0.032716330140829086, -0.009310007095336914, -0.0738535150885582, -0.04480581358075142, -0.06612350791692734, 0.14859135448932648, 0.06737912446260452, 0.015565086156129837, -0.08019452542066574, -0.005820978432893753, -0.1332825869321823, -0.0587184838950634, -0.015458805486559868, -0.05969942733645439, 0.038803327828645706, 0.08177913725376129, -0.09809976071119308, -0.01500131469219923, -0.06081492081284523, -0.14082325994968414, 0.0337219163775444, -0.024463502690196037, -0.026091691106557846, -0.05985618755221367, 0.019348300993442535, -0.06847765296697617, -0.03653707727789879, 0.10467510670423508, 0.07431997358798981, -0.10249540209770203, 0.05200153589248657, 0.09280136972665787, -0.0054178847931325436, 0.08734781295061111, 0.13844619691371918, 0.06802333146333694, -0.03611841797828674, -0.06993967294692993, 0.09484165161848068, -0.0006067825015634298, -0.16280505061149597, -0.0240059494972229, 0.012996608391404152, -0.02858656272292137, -0.06504766643047333, -0.09833374619483948, -0.06200166791677475, 0.11450932174921036, 0.06885624676942825, -0.08225886523723602, 0.12678395211696625, 0.050598885864019394, -0.00687422975897789, -0.08106973767280579, -0.19649481773376465, -0.14259691536426544, -0.017925167456269264, -0.11526595801115036, -0.15730330348014832, -0.06924022734165192, 0.0060430169105529785, 0.034168656915426254, -0.13157197833061218, 0.1177862361073494, -0.04006653279066086, -0.028077464550733566, -0.172889843583107, -0.01741841621696949, -0.03751587122678757, 0.14173275232315063, 0.000757956353481859, 0.06226323917508125, 0.13605321943759918, -0.15488311648368835, -0.08793386816978455, -0.047006525099277496, 0.05308551341295242, 0.147721529006958, -0.0209036972373724, 0.003361879847943783, 0.028461463749408722, -0.03466484323143959, -0.08963579684495926, -0.07100854814052582, 0.06872439384460449, 0.003837945871055126, 0.024742798879742622, 0.05338367447257042, -0.04754398763179779, -0.06302232295274734, -0.024423571303486824, 0.1607923060655594, -0.05753679201006889, 0.024469105526804924, 0.054550010710954666, -0.04964271932840347, 0.1126852035522461, -0.061634842306375504, 0.024505985900759697, -0.01747719757258892, -0.050259992480278015, -0.003044650424271822, 0.025058498606085777, -0.04943878576159477, 0.09225188940763474, 0.0806061252951622, 0.06694789975881577, -0.01607312262058258, -0.06183725968003273, 0.002484249183908105, 0.019907813519239426, -0.02874770015478134, 0.008945530280470848, 0.13456958532333374, 0.028959641233086586, -0.08036213368177414, 0.07152801752090454, -0.10100936144590378, -0.0013362092431634665, -0.11217653006315231, -0.13424216210842133, 0.12883779406547546, 0.06357813626527786, 0.026623452082276344, 0.07034418731927872, 0.09777899086475372, 0.042021673172712326, -0.1581864058971405, 0.11163952946662903, 0.013208495453000069, 0.04286913201212883, 0.08718351274728775, -0.05289483815431595, 0.07479538768529892, -0.1011553555727005, -0.007353371009230614, 0.07034686952829361, -0.05860492214560509, 0.012856746092438698, 0.04451572522521019, -0.11547499895095825, -0.07950180023908615, 0.012553145177662373, -0.01983579248189926, 0.027286451309919357, 0.04316695034503937, -0.13333259522914886, 0.04509932920336723, 0.061217598617076874, 0.028058182448148727, 0.012071640230715275, 0.0776451975107193, 0.0329098105430603, 0.10659817606210709, 0.0646175742149353, -0.08269321173429489, 0.16840851306915283, 0.0019320695428177714, -0.11262015998363495, 0.03194139525294304, -0.05190544202923775, 0.043619852513074875, 0.10817936807870865, -0.04050580412149429, 0.0242400411516428, 0.026039250195026398, 0.17047466337680817, -0.0028275626245886087, 0.019925156608223915, -0.0241371002048254, 0.0706285610795021, -0.08793239295482635, 0.07154486328363419, -0.0877772644162178, 0.014560161158442497, 0.0380365252494812, -0.13395537436008453, 0.03269658237695694, -0.03986402973532677, 0.005019813776016235, -0.015109552070498466, -0.010632333345711231, 0.1348908394575119, -0.10999171435832977, -0.03345847874879837, -0.03675456345081329, -0.04877880960702896, -0.03214668110013008, 0.017919426783919334, -0.018988369032740593, 0.06533373147249222, 0.06848136335611343, -0.11757141351699829, 0.02774270623922348, 0.17147405445575714, -0.06132776662707329, -0.14228862524032593, 0.05503907799720764, 0.11853473633527756, -0.01507668849080801, 0.11409594118595123, -0.06288706511259079, 0.08347996324300766, 0.13541118800640106, -0.11596525460481644, -0.07218170911073685, -0.10665048658847809, 0.08437298238277435, -0.08084959536790848, 0.06892114877700806, -0.04123605042695999, 0.06488422304391861, -0.037553951144218445, 0.02495761774480343, -0.07239769399166107, 0.13435044884681702, 0.07331464439630508, 0.03711283579468727, -0.13463625311851501, 0.07540097087621689, 7.983278919709846e-05, -0.0021515381522476673, 0.059516098350286484, 0.0774381011724472, 0.03372522443532944, 0.058802925050258636, 0.06426471471786499, -0.0834609791636467, -0.11264866590499878, -0.12260834872722626, -0.05617938190698624, 0.01630290597677231, 0.024882320314645767, -0.07990283519029617, -0.10670352727174759, -0.10216787457466125, 0.0545184463262558, -0.05180078372359276, -0.0008692364790476859, -0.0956275537610054, -0.04422614723443985, 0.08939714729785919, 0.0854862630367279, 0.03696482628583908, 0.0214161965996027, 0.07179374247789383, 0.07077275216579437, 0.042849116027355194, -0.00661800941452384, 0.07923339307308197, 0.012952139601111412, -0.019937222823500633, 0.06409355998039246, -0.028917940333485603, 0.002007104456424713, 0.0691971704363823, 0.007490161806344986, 0.04606939107179642, -0.07628265023231506, 0.015440062619745731, 0.036881472915410995, -0.12621653079986572, 0.09398303925991058, -0.01765473559498787, 0.05370677635073662, 0.05397113785147667, -0.07074646651744843, 0.03848285600543022, 0.08591410517692566, -0.026826957240700722, 0.016148803755640984, -0.011761793866753578, 0.014712665230035782, 0.02403700165450573, -0.1106305941939354, -0.02456274814903736, 0.04017054662108421, 0.08769259601831436, -0.1442420482635498, 0.00703161908313632, 0.14084745943546295, 0.0016956707695499063, 0.020007595419883728, -0.08511859178543091, 0.10866984724998474, 0.10033266991376877, 0.04405654966831207, 0.018232950940728188, 0.05310997739434242, 0.07639108598232269, -0.16376729309558868, -0.15499502420425415, -0.06880366057157516, -0.03974688798189163, 0.07297559827566147, -0.008576941676437855, 0.06552278250455856, 0.028651446104049683, -0.07702748477458954, -0.10414276272058487, 0.03229575231671333, 0.1459815949201584, -0.03711819276213646, -0.010069496929645538, 0.08953823894262314, 0.06341612339019775, -0.030316682532429695, -0.04343852773308754, 0.0720270499587059, 0.07671081274747849, -0.08442480862140656, -0.05555274710059166, -0.05702929571270943, 0.12678717076778412, -0.1547669619321823, 0.051707878708839417, -0.023622289299964905, -0.052364472299814224, -0.013605429790914059, 0.09810040146112442, 0.1226491704583168, -0.037536539137363434, -0.10540337860584259, -0.1672942340373993, 0.0028591463342309, 0.030805367976427078, -0.11136198043823242, 0.1386203020811081, -0.0603625625371933, 0.12007009983062744, -0.07252825796604156, -0.13245302438735962, -0.08408909291028976, -0.17412169277668, 0.11881493777036667, 0.030064843595027924, -0.05983626842498779, 0.026860402897000313, -0.029897965490818024, 0.04114275798201561, 0.09112401306629181, -0.026792611926794052, -0.030366916209459305, -0.016320185735821724, -0.09385490417480469, -0.06423762440681458, -0.07972480356693268, 0.08913668990135193, -0.08656799048185349, 0.08482945710420609, 0.04038730263710022, -0.12335821986198425, -0.06019451469182968, 0.11148297041654587, 0.02600966766476631, -0.05309569835662842, -0.010221264325082302, -0.05853026732802391, -0.06690696626901627, 0.04598958045244217, -0.10719456523656845, 0.12291619181632996, 0.11138129234313965, 0.031196409836411476, 0.029842862859368324, -0.12171763926744461, 0.0629831925034523, 0.09563522785902023, 0.008741607889533043, -0.0496809221804142, 0.146162211894989, 0.018190573900938034, 0.10318206250667572, 0.0502101294696331, -0.046566180884838104, 0.03570081666111946, 0.12690503895282745, 0.1267656534910202, 0.09467983990907669, -0.01593617908656597, 0.0002482811105437577, -0.06521885842084885, 0.021156543865799904, 0.13188347220420837, -0.041290439665317535, 0.002517065266147256, 0.044749803841114044, -0.02976362220942974, 0.0010835607536137104, 0.05079719424247742, 0.004178725648671389, -0.036064956337213516, 0.10007432848215103, 0.043476399034261703, 0.07645124197006226, 0.04253612831234932, 0.05481705814599991, -0.04941606521606445, 0.09062875062227249, -0.052606597542762756, 0.06565510481595993, -0.042673517018556595, -0.017979437485337257, -0.07347571104764938, 0.002632385352626443, 0.11512293666601181, -0.08161171525716782, 0.1462835818529129, 0.021308965981006622, -0.1145145371556282, -0.03241065889596939, -0.06320289522409439, 0.06659461557865143, -0.049300938844680786, 0.061352066695690155, 0.10402104258537292, -0.035281162708997726, -0.03134501352906227, 0.05752725154161453, -0.03419346362352371, 0.041575491428375244, -0.0382528193295002, 0.01376382540911436, -0.000262372283032164, 0.004861580207943916, -0.0019299298292025924, -0.04454540088772774, 0.07615794986486435, -0.04547107219696045, -0.003285069949924946, 0.01655370183289051, -0.006271038670092821, 0.05295800790190697, -0.14037936925888062, -0.006783057935535908, -0.0635155439376831, -0.0013649759348481894, -0.028319796547293663, 0.04731537029147148, 0.022198084741830826, 0.01891765370965004, 0.0233398899435997, 0.027013370767235756, 0.050511762499809265, 0.03508870676159859, -0.09140840172767639, 0.06767769157886505, -0.051706451922655106, 0.0482398197054863, -0.02340254932641983, 0.16070611774921417, 0.14444947242736816, -0.06058119982481003, 0.011403733864426613, 0.04153682291507721, 0.041940879076719284, -0.16285961866378784, -0.08620218187570572, -0.06264210492372513, -0.07657270133495331, -0.0390847846865654, 0.06200077757239342, 0.16817085444927216, 0.13934044539928436, 0.03331514447927475, -0.05700423941016197, 0.000241835048655048, -0.12808702886104584, 0.09719443321228027, 0.04039367288351059, 0.040088146924972534, 0.10946841537952423, -0.04727412760257721, 0.10005227476358414, 0.041428565979003906, -0.08863852173089981, 0.09624814242124557, -0.08023283630609512, 0.07175745069980621, 0.09589377045631409, 0.09557300806045532, 0.055239275097846985, 0.04993758723139763, -0.08651560544967651, -0.020468082278966904, -0.027951756492257118, 0.014560912735760212, -0.09670985490083694, -0.08808381855487823, 0.022945638746023178, 0.00685488898307085, 0.09429240971803665, -0.11246761679649353, 0.04780421406030655, -0.03886428102850914, -0.04034595564007759, 0.09444089233875275, 0.061504822224378586, -0.04230043664574623, -0.09292180091142654, -0.027533739805221558, 0.035897236317396164, -0.09641892462968826, -0.10015439987182617, 0.05321082845330238, -0.1515706181526184, 0.1153581291437149, -0.0005922174896113575, 0.01766563206911087, -0.10052114725112915, -0.016063759103417397, 0.0749283879995346, -0.019901541993021965, -0.009044589474797249, -0.12423477321863174, -0.08816928416490555, -0.038784775882959366, 0.12436328828334808, -0.15101097524166107, -0.07047947496175766, -0.04153997823596001, 0.06283197551965714, 0.11790882796049118, 0.07279085367918015, -0.059994399547576904, 0.011624103412032127, -0.09314730018377304, -0.08290950953960419, 0.10935096442699432, 0.08837757259607315, 0.04230159521102905, -0.03200946003198624, 0.04354808107018471, 0.07624894380569458, -0.0351116843521595, -0.03641895949840546, 0.04686002805829048, 0.05159754306077957, 0.07834546267986298, -0.034069355577230453, 0.044589463621377945, -0.10345210134983063, 0.002947271103039384, -0.0720440074801445, -0.049235280603170395, -0.009488147683441639, -0.09682515263557434, 0.11127331107854843, -0.01626446843147278, -0.026474855840206146, 0.026273904368281364, -0.02381915971636772, -0.06506337970495224, 0.00014206604100763798, 0.015236644074320793, 0.107479028403759, 0.05999612808227539, 0.013113410212099552, 0.03947027400135994, -0.08943983912467957, -0.007702437229454517, 0.08605960756540298, -0.0906030684709549, -0.09411554783582687, 0.09924355894327164, 0.12961435317993164, 0.02318749390542507, 0.04434613510966301, 0.03127161040902138, -0.09290861338376999, -0.0235942043364048, 0.14273785054683685, 0.007477120961993933, -0.006217127200216055, 0.05304843932390213, -0.07757540792226791, -0.0814143568277359, -0.0003325233410578221, -0.03907783329486847, 0.05221979692578316, -0.11642414331436157, -0.14115160703659058, 0.17892996966838837, 0.08622372150421143, 0.06000255048274994, 0.03909263759851456, 0.12146808207035065, 0.04403062164783478, 0.003036358393728733, -0.028810517862439156, -0.02192094549536705, -9.599294571671635e-05, 0.006083681248128414, 0.021007129922509193, 0.10572820156812668, 0.04654023051261902, -0.0066243382170796394, -0.018498748540878296, -0.056323498487472534, -0.022048702463507652, 0.08566416054964066, 0.09753744304180145, 0.07614113390445709, -0.09632693231105804, 0.025271045044064522, 0.07540736347436905, 0.1436525136232376, 0.025193454697728157, -0.009040115401148796, -0.08299502730369568, 0.13644780218601227, 0.04212450608611107, -0.10876750200986862, -0.05837471783161163, 0.16287578642368317, -0.0492541529238224, 0.005173537880182266, 0.06512908637523651, -0.02523120678961277, -0.05749610438942909, -0.05591250956058502, 0.034252703189849854, 0.011608251370489597, 0.054257187992334366, 0.03661365807056427, 0.0912587121129036, -0.0011360589414834976, -0.07636117935180664, 0.08637500554323196, 0.05145258083939552, 0.05231260880827904, -0.06817515194416046, -0.06691823154687881, 0.1405823975801468, -0.11658964306116104, -0.09102344512939453, 0.07335685193538666, 0.021357547491788864, 0.026898745447397232, -0.11279159039258957, -0.01790807768702507, -0.0685630664229393, -0.030971311032772064, 0.14884009957313538, 0.00889650546014309, 0.05603839084506035, -0.06921717524528503, 0.009115740656852722, 0.12154915928840637, -0.025352196767926216, -0.007387007586658001, -0.09016403555870056, 0.15373946726322174, -0.035428307950496674, 0.00666123116388917, -0.07693517208099365, 0.03566619008779526, 0.0682181641459465, 0.04688692465424538, 0.02738182060420513, -0.00040329198236577213, -0.06979202479124069, 0.05254725366830826, 0.10691642016172409, 0.021399354562163353, 0.021917106583714485, 0.007846901193261147, 0.03300808370113373, 0.08229149132966995, 0.12915781140327454, -0.01960202120244503, 0.011008947156369686, -0.06013074889779091, -0.08082141727209091, 0.06452349573373795, 0.0055122217163443565, 0.03505927324295044, -0.1029273197054863, -0.006094879005104303, 0.0018018062692135572, 0.04042502120137215, 0.08459440618753433, -0.026218650862574577, 0.0251463633030653, 0.0727253407239914, 0.05845892056822777, 0.06919356435537338, -0.054297853261232376, 0.114726722240448, -0.029698330909013748, 0.08989622443914413, 0.09735576063394547, -0.003581203753128648, 0.03169543296098709, 0.024793241173028946, -0.0915454551577568, -0.017351575195789337, -0.07405374944210052, 0.11212816834449768, 0.08471494168043137, -0.031089551746845245, -0.041163086891174316, 0.09464846551418304, 0.11329443752765656, -0.0007782845059409738, -0.08868084847927094, -0.024274179711937904, 0.07018310576677322, 0.11370984464883804, -0.014713486656546593, 0.0053967684507369995, -0.15287494659423828, -0.09393806010484695, 0.10233321040868759, -0.008077905513346195, -0.12030334770679474, -0.09220096468925476, 0.11966311186552048, 0.004639949183911085, 0.17209836840629578, -0.11284002661705017, 0.13628412783145905, 0.07709849625825882, 0.09321790188550949, -0.103153295814991, -0.07535439729690552, 0.004417307209223509, -0.05091645568609238, 0.06782063841819763, 0.1267814189195633, 0.021669840440154076, 0.012005957774817944, -0.044999901205301285, 0.07585648447275162, -0.0038694993127137423, 0.06403931230306625, -0.13986915349960327, 0.11880499124526978, 0.0582469217479229, 0.07044953107833862, 0.0368504635989666, -0.07248412072658539, -0.11079291999340057, 0.16888946294784546, -0.059218935668468475, -0.05603257566690445, -0.046682268381118774, -0.047887373715639114, -0.02216845378279686, -0.10200347751379013, -0.05514519289135933, 0.18820545077323914, -0.009498517960309982, 0.08182521164417267, -0.039965156465768814, -0.04857082664966583, 0.015000415034592152, -0.025266315788030624, 0.011914805509150028, 0.07459201663732529, 0.0474080927670002, 0.0549909733235836, -0.10440854728221893, -0.13960610330104828, -0.008618374355137348, -0.12249636650085449, -0.01208422239869833, -0.00807954277843237, 0.014689749106764793, -0.10166417807340622, 0.20268376171588898, 0.10301756858825684, -0.02804102748632431, 0.05969652906060219, -0.002977700438350439, -0.1026080921292305, -0.04198278486728668, 0.07407347112894058, -0.08586516231298447, -0.012967290356755257, 0.16600525379180908, -0.05410641059279442, -0.012676441110670567, 0.009632747620344162, 0.09556993097066879, 0.10582316666841507, 0.04913652315735817, 0.060247696936130524, -0.0318886935710907, -0.13231684267520905, -0.055836912244558334, 0.13767144083976746, 0.10926257818937302, -0.0394720695912838, 0.08335026353597641, -0.06968462467193604, -0.04905489459633827, 0.011802100576460361, -0.03180946782231331, 0.04495268315076828, 0.03665028512477875, 0.04664967581629753, 0.018804069608449936, 0.03653200343251228, 0.12334052473306656, 0.14702440798282623, 0.0002925453591160476, -0.07225802540779114, 0.07901200652122498, -0.0362660177052021, -0.0011406276607885957, -0.04644199088215828, -0.14402726292610168, 0.1337190568447113, 0.0569637306034565, 0.04456642270088196, -0.04964299127459526, -0.03267263248562813, 0.0013199999229982495, -0.01673760823905468, -0.051481228321790695, 0.017322443425655365, -0.03737218305468559, -0.01620924286544323, 0.08229321241378784, 0.06053515896201134, 0.08414414525032043, 0.16239915788173676, 0.06060042977333069, 0.12354017794132233, 0.050441399216651917, 0.02683325484395027, -0.08016593009233475, -0.031054478138685226, -0.03528173267841339, 0.04184612259268761, 0.036083489656448364, -0.10734466463327408, -0.007245059125125408, -0.01773485541343689, 0.08818456530570984, -0.09539411216974258, 0.014945171773433685, -0.07551810145378113, -0.06132744625210762, -0.055413275957107544, -0.02039286121726036, -0.12725934386253357, 0.057391922920942307, -0.026917649433016777, 0.10751037299633026, -0.01167015079408884, -0.022551285102963448, 0.19660647213459015, -0.1590937227010727, 0.016909154132008553, -0.049524467438459396, 0.08693074434995651, -0.025846248492598534, 0.14214453101158142, 0.07603498548269272, -0.11778844147920609, -0.07421024888753891, -0.08715697377920151, -0.09076687693595886, 0.008847326040267944, 0.07241296023130417, -0.05158843845129013, 0.009297192096710205, 0.047017794102430344, -0.023960910737514496, -0.03316427767276764, 0.12798908352851868, 0.02499520406126976, -0.025737883523106575, -0.08208464086055756, 0.015713026747107506, 0.06641121208667755, 0.08376479148864746, -0.1522471010684967, -0.05912374332547188, -0.12591831386089325, 0.1061222031712532, 0.016192933544516563, -0.15228967368602753, 0.006428267806768417, -0.031570203602313995, -0.04919803887605667, -0.07632236182689667, 0.015426507219672203, 0.0072632343508303165, 0.104793481528759, 0.03255052864551544, 0.17210565507411957, -0.15715542435646057, 0.039529360830783844, 0.024156197905540466, 0.027257870882749557, 0.04641953110694885, 0.07580253481864929, -0.0435173436999321, -0.0037535387091338634, 0.11363136768341064, -0.03776314854621887, -0.012806165963411331, -0.00012765088467858732, -0.01323375292122364, -0.09407910704612732, -0.0754907950758934, 0.04834824427962303, -0.07820626348257065, -0.003205342683941126, 0.0525510348379612, -0.02460133470594883, -0.013324597850441933, -0.07119684666395187, -0.06392163038253784, 0.05442770570516586, 0.07301317155361176, -0.019188206642866135, 0.09981303662061691, -0.01278828363865614, 0.01174475159496069, 0.03471579775214195, -0.08646173775196075, -0.03645296022295952, -0.033413805067539215, 0.019228294491767883, 0.09530723094940186, 0.02814382314682007, -0.015815068036317825, -0.10693689435720444, 0.04950233921408653, 0.0062632509507238865, 0.11439170688390732, 0.039633918553590775, 0.11732488870620728, 0.1008751317858696, -0.12681689858436584, 0.06174968555569649, -0.08676231652498245, 0.009605375118553638, -0.07384471595287323, 0.049247510731220245, -0.07524877786636353, -0.02020120993256569, -0.03217592462897301, 0.0073498026467859745, 0.014127385802567005, 0.11540091037750244, -0.09234508872032166, 0.0786835253238678, 0.035106394439935684, 0.06796819716691971, -0.03443004935979843, -0.09824744611978531, -0.01689549721777439, 0.15295907855033875, -0.02849552221596241, -0.08189567178487778, -0.04000101611018181, 0.09855049103498459, -0.09766081720590591, 0.03799600899219513, 0.028427729383111, -0.07568664848804474, -0.09064880013465881, 0.1450818032026291, 0.028867807239294052, 0.005381912924349308, -0.04375961422920227, 0.025410480797290802, 0.04824887588620186, -0.10000895708799362, -0.045711860060691833, -0.04376639053225517, -0.012033081613481045, 0.13572260737419128, -0.11297006905078888, 0.07258065044879913, 0.11396171152591705, 0.15179097652435303, -0.05083225294947624, 0.002934259595349431, -0.040516823530197144, 0.026973271742463112, 0.13071642816066742, -0.10852176696062088, 0.07661204785108566, 0.07152111083269119, 0.07520398497581482, 0.013549646362662315, -0.11884797364473343, 0.1644110232591629, -0.03252929076552391, -0.18841633200645447, -0.11529374867677689, -0.12322055548429489, -0.10894032567739487, 0.046048037707805634, 0.03645089268684387, -0.02604939229786396, -0.10219025611877441, -0.004763530567288399, -0.00584802683442831, -0.02567698433995247, 0.007458568550646305, 0.0836002454161644, -0.13812030851840973, -0.003153765806928277, 0.13519006967544556, 0.07209613919258118, 0.023344149813055992, -0.059215325862169266, -0.01777559146285057, 0.013332710601389408, 0.11595041304826736, 0.0010356939164921641, 0.09692563861608505, -0.05136040970683098, 0.0005305567174218595, -0.018919052556157112, 0.00984831154346466, -0.02435651421546936, -0.053291816264390945, 0.021738504990935326, -0.0790158361196518, 0.01801486313343048, 0.03612719848752022, -0.017548739910125732, 0.04086989536881447, 0.057341814041137695, -0.08525782823562622, 0.11539018154144287, 0.17220939695835114, 0.06644023209810257, -0.058557260781526566, 0.09585044533014297, 0.06836912035942078, 0.0213729590177536, -0.11261302977800369, 0.02055017091333866, 0.1006278544664383, 0.04780357703566551, 0.043359655886888504, -0.07847759872674942, -0.004112068563699722, -0.16443423926830292, -0.02212994545698166, 0.1043965294957161, -0.06936381012201309, -0.08216299116611481, -0.03911888971924782, 0.15226203203201294, -0.04181868955492973, 0.028525423258543015, 0.033784374594688416, -0.08681665360927582, -0.12443020939826965, 0.013391965068876743, 0.06827010959386826, -0.009642049670219421, -0.016588006168603897, -0.03722679987549782, 0.009514573961496353, -0.008350696414709091, -0.057571329176425934, -0.06051865220069885, -0.00046194327296689153, 0.1132398322224617, -0.042635299265384674, 0.008935478515923023, 0.05204358696937561, -0.0006646699621342123, 0.029815301299095154, -0.15042543411254883, 0.058667100965976715, -0.07108307629823685, 0.0013100317446514964, -0.09431014209985733, -0.07427900284528732, -0.12536945939064026, 0.006786531303077936, -0.018252059817314148, 0.03967389091849327, 0.026101283729076385, 0.1253845989704132, 0.005523103289306164, 0.009626159444451332, 0.015163082629442215, 0.10468879342079163, -0.05336829647421837, -0.12299773842096329, -0.08313100785017014, 0.09938187152147293, 0.04644741490483284, -0.07975168526172638, 0.03871266171336174, 0.03715093061327934, -0.021782981231808662, -0.005963967181742191, 0.0446612685918808, -0.13844378292560577, 0.10435446351766586, 0.07768566906452179, -0.042321428656578064, -0.04315231367945671, -0.06071125715970993, 0.05483453720808029, 0.1372060477733612, 0.031184440478682518, 0.004924459382891655, 0.059776026755571365, 0.032417889684438705, -0.009189093485474586, 0.07609817385673523, -0.08591678738594055, -0.16152195632457733, 0.05888468027114868, -0.0747244581580162, 0.02331388182938099, 0.1697523295879364, 0.12029194086790085, 0.04255184903740883, 0.050594720989465714, 0.041155993938446045, 0.048920854926109314, -0.08812049776315689, 0.020778432488441467, -0.0004716859548352659, 0.0016251991037279367, 0.023023679852485657, 0.023378636687994003, 0.14126910269260406, -0.05266518518328667, 0.006020138505846262, 0.02755073644220829, -0.046725064516067505, 0.004626151639968157, 0.14735223352909088, -0.09833875298500061, -0.09277674555778503, -0.00014027928409632295, 0.14647632837295532, 0.035282790660858154, -0.04009689763188362, 0.010066286660730839, 0.1053820475935936, -0.16244247555732727, 0.10879965871572495, 0.005016268230974674, 0.14529214799404144, -0.05355525761842728, 0.05068431794643402, 0.07073280960321426, -0.0837913453578949, 0.07966981828212738, 0.012897583656013012, 0.07385957986116409, -0.03289782628417015, -0.03693924471735954, -0.033271968364715576, -0.004954165779054165, 0.08944626152515411, -0.007443232461810112, 0.05727342143654823, 0.09895641356706619, 0.08532276004552841, -0.09321791678667068, 0.10866943001747131, 0.07529725879430771, 0.0555318184196949, -0.09248995780944824, 0.020713597536087036, -0.012058229185640812, 0.06083124503493309, -0.02607654221355915, -0.13105066120624542, 0.053376663476228714, -0.034033264964818954, 0.06328072398900986, 0.11434514820575714, -0.10299596190452576, -0.023711232468485832, -0.012858233414590359, -0.06263919174671173, 0.06815800070762634, -0.036789845675230026, -0.013585655950009823, 0.047194696962833405, 0.0512101836502552, 0.040445007383823395, -0.05981134995818138, -0.01746583916246891, 0.15394115447998047, 0.06670122593641281, 0.04110925272107124, -0.0823856070637703, -0.041219066828489304, -0.01807841844856739, -0.13055679202079773, 0.02610856667160988, 0.04957438260316849, -0.04882141202688217, 0.012438623234629631, -0.03465788811445236, 0.024538228288292885, -0.15333802998065948, 0.07674486190080643, 0.039589397609233856, -0.004391502123326063, 0.06568422168493271, 0.07282663881778717, -0.0009247955167666078, 0.07112371176481247, 0.005049028433859348, -0.014795620925724506, 0.03184101730585098, 0.03042737767100334, -0.0978313609957695, -0.10928787291049957, 0.010793635621666908, -0.017169568687677383, -0.011129036545753479, -0.08535920083522797, 0.010926532559096813, -0.007764121051877737, 0.03662736713886261, -0.061268873512744904, -0.05728136748075485, 0.05190466716885567, -0.03480187803506851, -0.0258239284157753, -0.005001661367714405, -0.04687650501728058, 0.02244286984205246, 0.06495574861764908, 0.008809009566903114, 0.03197772055864334, 0.07905342429876328, 0.05218879133462906, 0.008302071131765842, -0.1279193013906479, 0.01474031899124384, 0.03769215568900108, -0.11104569584131241, -0.18460920453071594, 0.123938649892807, 0.033354733139276505, -0.010701981373131275, 0.10150254517793655, -0.14788441359996796, -0.18878421187400818, 0.10847711563110352, -0.08671682327985764, -0.06958765536546707, -0.040775492787361145, -0.14927218854427338, 0.09460626542568207, -0.012962749227881432, -0.03400491178035736, 0.021500900387763977, -0.08966521173715591, -0.0525398813188076, -0.03974307328462601, 0.14026600122451782, -0.03531515970826149, -0.11522603034973145, 0.0355515219271183, -0.04339313507080078, -0.17002317309379578, 0.059132304042577744, -0.14609350264072418, 0.019424324855208397, -0.06696894019842148, -0.054559994488954544, -0.06312624365091324, -0.0753837376832962, 0.13298189640045166, 0.03368503227829933, -0.10733205825090408, 0.07919325679540634, -0.024358920753002167, 0.1293489784002304, 0.0713782086968422, 0.10839909315109253, -0.133306086063385, 0.05624869838356972, 0.04965094476938248, 0.09082408994436264, 0.060973212122917175, 0.11232728511095047, -0.029355067759752274, -0.16666990518569946, -0.06342265754938126, 0.14973074197769165, -0.02339847944676876, -0.07458548247814178, -0.002686611609533429, 0.011022486723959446, -0.014081954956054688, -0.0784681886434555, 0.07875236123800278, 0.04778609052300453, 0.04970734938979149, -0.0441574864089489, 0.03716965392231941, -0.05839665234088898, -0.10969465970993042, -0.0481923408806324, -0.16116049885749817, -0.08621177822351456, -0.11141373962163925, 0.07108656316995621, 0.11969054490327835, -0.0008222254691645503, 0.033812493085861206, -0.0756123960018158, -0.019064148887991905, 0.010298701003193855, -0.01010551955550909, 0.06472358107566833, 0.004201486706733704, -0.16376720368862152, 0.11472880095243454, -0.04296255484223366, 0.10375398397445679, -0.06405385583639145, -0.013627086766064167, 0.04329489544034004, 0.06252343207597733, -0.03895812854170799, -0.07366412878036499, 0.14663662016391754, -0.01707334630191326, 0.03280647471547127, -0.005005827639251947, 0.13299967348575592, -0.0031553918961435556, 0.05008425563573837, -0.020447054877877235, -0.02023986726999283, -0.08012134581804276, -0.05876928195357323, 0.02428792417049408, -0.09808335453271866, 0.03340756520628929, 0.03435537591576576, 0.1503520905971527, 0.011585626751184464, -0.06527179479598999, -0.04461237043142319, -0.17111897468566895, -0.026434820145368576, 0.09339846670627594, -0.009224514476954937, -0.0024674979504197836, -0.14843712747097015, -0.06700348854064941, -0.03650051727890968, -0.13726021349430084, 0.03898925706744194, -0.06872867047786713, 0.1329890936613083, -0.010317236185073853, 0.03927827626466751, -0.04728691279888153, 0.06144098564982414, 0.04251231625676155, -0.024409782141447067, -0.07092694938182831, -0.11331304907798767, -0.10797649621963501, 0.14216655492782593, 0.11451093852519989, -0.02711665630340576, -0.09703785181045532, -0.015935951843857765, 0.0984310433268547, 0.03579036891460419, 0.02346924878656864, 0.011503350920975208, 0.14273333549499512, -0.01139939296990633, -0.10011246800422668, -0.060699574649333954, 0.012583981268107891, -0.09627138823270798, 0.15128493309020996, -0.08640962839126587, 0.052489232271909714, 0.15758046507835388, -0.11375376582145691, 0.13189974427223206, -0.057961128652095795, -0.05511605367064476, -0.07234090566635132, 0.09996066242456436, -0.04117380082607269, -0.07933394610881805, -0.1760634332895279, 0.0879732146859169, -0.052206117659807205, 0.036401718854904175, -0.04536333680152893, -0.010596165433526039, -0.09019644558429718, -0.08750800788402557, -0.03894361853599548, -0.07513368874788284, 0.030088627710938454, 0.11597539484500885, 0.030573109164834023, 0.08030541986227036, -0.05234159156680107, 0.023838991299271584, -0.06474117189645767, -0.034544799476861954, 0.03656287491321564, 0.04544903710484505, 0.005715969484299421, 0.07214169949293137, -0.0856495052576065, -0.12233465909957886, -0.06815347075462341, -0.022065866738557816, -0.08752582222223282, 0.08645948022603989, -0.006845816969871521, 0.054278381168842316, 0.07503731548786163, 0.08485739678144455, 0.10012324899435043, 0.010082977823913097, 0.02393990568816662, 0.010528866201639175, 0.13283051550388336, -0.090297169983387, -0.017984561622142792, -0.05760154500603676, 0.10255096852779388, -0.061543721705675125, -0.04037236049771309, 0.041410140693187714, -0.00884433276951313, -0.03659424930810928, -0.08046547323465347, 0.005117030348628759, 0.027961011976003647, -0.06741397082805634, -0.016897154971957207, 0.07107751071453094, 0.0009322216501459479, -0.0450744703412056, 0.07306120544672012, -0.09820715337991714, -0.048531774431467056, 0.02073897048830986, 0.04321486875414848, 0.06863506138324738, 0.00614424841478467, -0.1238401010632515, 0.049279890954494476, -0.046682920306921005, -0.011134744621813297, -0.011107783764600754, 0.018129223957657814, 0.07006923109292984, 0.13096332550048828, -0.10414589941501617, 0.08241482079029083, -0.07619169354438782, 0.05601368471980095, -0.058271363377571106, 0.08189672231674194, 0.04860735684633255, 0.06788951903581619, 0.14459756016731262, -0.10480499267578125, -0.05335022136569023, -0.03684955835342407, -0.03563900664448738, -0.06440045684576035, 0.07797274738550186, -0.11853679269552231, 0.006616358179599047, 0.10846370458602905, 0.07507237046957016, -0.08805326372385025, 0.0187901109457016, -0.05030888319015503, 0.0567292794585228, -0.019335348159074783, 0.007478051353245974, -0.060783278197050095, 0.02112816832959652, -0.04023125395178795, 0.05119508132338524, -0.03864562511444092, -0.00981812085956335, 0.002639475977048278, 0.03970736637711525, -0.028182512149214745, 0.036579664796590805, -0.012547149322926998, -0.028235143050551414, -0.014287253841757774, 0.1801965832710266, 0.0030023474246263504, 0.04261583462357521, -0.006382990628480911, -0.0076840841211378574, -0.07292994856834412, 0.002991784829646349, 0.02854297310113907, -0.027576008811593056, 0.13946856558322906, 0.0819387137889862, -0.06028912216424942, 0.024896685034036636, -0.03481728583574295, 0.0878698006272316, 0.012195474468171597, 0.03887100890278816, 0.007668285630643368, -0.15571331977844238, -0.04629673808813095, 0.1803881675004959, -0.07401116192340851, -0.0442831851541996, -0.053945671766996384, 0.02659555897116661, -0.016245799139142036, 0.06581059098243713, 0.013500360772013664, -0.1630914956331253, 0.046929895877838135, -0.07514149695634842, 0.10024170577526093, 0.051881857216358185, -0.004213716834783554, 0.11000259220600128, 0.01652115397155285, 0.1356322020292282, 0.12307100743055344, -0.01245031040161848, 0.18670298159122467, -0.03519807755947113, -0.07243413478136063, -0.027588574215769768, 0.10891143232584, 0.08453898131847382, -0.16116756200790405, 0.08867029845714569, 0.022113369777798653, 0.0008662578766234219, 0.08175143599510193, 0.05909031257033348, 0.03886225074529648, 0.07623668015003204, -0.1463034749031067, 0.05449815094470978, -0.09945013374090195, 0.0007278429693542421, -0.09565744549036026, 0.10481926798820496, 0.08251996338367462, -0.003114072373136878, -0.06082245334982872, -0.08043583482503891, 0.044642623513936996, -0.0024772000033408403, -0.01850062981247902, 0.01213847752660513, -0.026050683110952377, -0.11194681376218796, -0.05556501820683479, 0.03494376689195633, -0.083450548350811, -0.020261894911527634, 0.017128216102719307, 0.1564893275499344, -0.05513811856508255, -0.10250728577375412, -0.027919841930270195, -0.08059488236904144, -0.04112209752202034, 0.1020478680729866, 0.03020685538649559, -0.024845687672495842, 0.09605850279331207, 0.0367959626019001, -0.059799566864967346, -0.03409690782427788, -0.007014136295765638, -0.17060211300849915, -0.03528859466314316, 0.048394881188869476, 0.09763944894075394, 0.041125450283288956, 0.05136117711663246, -0.04372197762131691, -0.004880725406110287, 0.03059968538582325, 0.052103932946920395, -0.11985383182764053, -0.06250914931297302, -0.13435333967208862, -0.07182269543409348, -0.028445592150092125, -0.033746007829904556, -0.011181425303220749, 0.060914281755685806, -0.009890826418995857, -0.06003553792834282, 0.009663950651884079, 0.03310287743806839, -0.052269767969846725, 0.08676527440547943, 0.040595538914203644, -5.778405466116965e-05, -0.14129993319511414, 0.06391937285661697, -0.029631948098540306, -0.03988640382885933, -0.014879635535180569, 0.12018027156591415, -0.020000601187348366, -0.13050034642219543, 0.08915960043668747, -0.014174222014844418, -0.03153850510716438, -0.01651984266936779, -0.15113544464111328, 0.003649139776825905, -0.09906228631734848, -0.05020846053957939, -0.10668972879648209, 0.0779295414686203, -0.11633685231208801, -0.037201255559921265, -0.013656261377036572, 0.0850565955042839, 0.08386107534170151, -0.04343486577272415, 0.13309933245182037, -0.16630589962005615, -0.02786211296916008, -0.19318978488445282, -0.002248364733532071, 0.11404495686292648, 0.06247827410697937, -0.03306477144360542, -0.1034487783908844, -0.024838166311383247, -0.11940325796604156, 0.024035340175032616, -0.05967004597187042, 0.0401637889444828, -0.03485345095396042, -0.05869408696889877, 0.03784002363681793, 0.010337874293327332, 0.04442678764462471, 0.023440547287464142, -0.11006943136453629, -0.11612483859062195, 0.16542509198188782, -0.03755813464522362, 0.12434449046850204, -0.037432990968227386, -0.13628388941287994, 0.09234178066253662, -0.0048130592331290245, 0.03399789705872536, -0.012689082883298397, -0.12451006472110748, 0.04018380492925644, 0.009071774780750275, -0.01357862539589405, -0.052920859307050705, 0.04667748138308525, 0.0298174936324358, -0.016691777855157852, 0.03804821893572807, 0.061024416238069534, -0.04309387505054474, 0.025080541148781776, 0.12720701098442078, 0.02141457237303257, 0.005038782022893429, -0.04545650631189346, 0.028343897312879562, 0.007975173182785511, 0.049472060054540634, 0.049975309520959854, 0.06428413838148117, -0.023467937484383583, 0.006366144400089979, -0.051163576543331146, -0.04405883327126503, 0.10826868563890457, -0.07539279758930206, -0.061713073402643204, 0.1424831748008728, 0.08108991384506226, -0.02487262710928917, -0.07375571131706238, 0.06278356164693832, 0.1771208941936493, 0.05421946197748184, -0.0519978329539299, -0.057580750435590744, -0.04714483767747879, -0.05677226930856705, 0.020176036283373833, 0.06637351959943771, 0.044696468859910965, 0.10010626167058945, -0.034799594432115555, -0.038465097546577454, -0.018706828355789185, -0.06129742041230202, -0.16120480000972748, 0.1200336292386055, -0.006908442359417677, 0.04999365285038948, -0.10218550264835358, 0.00987833458930254, 0.039581023156642914, -0.10533710569143295, 0.040990930050611496, -0.07521315664052963, 0.050717052072286606, 0.041984811425209045, 0.022155586630105972, -0.0833311453461647, 0.046394288539886475, 0.051626335829496384, 0.03169742599129677, 0.020739618688821793, 0.04581180587410927, -0.023367686197161674, 0.09572348743677139, -0.05511957034468651, 0.007152047473937273, 0.13471978902816772, -0.11107011139392853, -0.10643325746059418, -0.005013895221054554, -0.034184519201517105, -0.007098277099430561, 0.060729771852493286, 0.11844480782747269, 0.000441197887994349, -0.04396086186170578, 0.009364640340209007, -0.003637022338807583, -0.1668626368045807, 0.07976724207401276, 0.017996957525610924, -0.052831802517175674, 0.1314355731010437, -0.10646384209394455, -0.0268024280667305, 0.08574379235506058, -0.00470260065048933, -0.18461252748966217, -0.08649822324514389, 0.030136479064822197, -0.0318402424454689, 0.061892613768577576, -0.04413708299398422, -0.019134147092700005, -0.19878162443637848, -0.06646005064249039, -0.016861308366060257, -0.12215038388967514, 0.07574915140867233, 0.04075022041797638, 0.11353123933076859, 0.05432865396142006, -0.05740680918097496, 0.06659243255853653, -0.08067359775304794, 0.08166598528623581, 0.029207907617092133, 0.07300110906362534, 0.034836217761039734, -0.01601540297269821, 0.04325224831700325, 0.0023537003435194492, -0.14672155678272247, 0.003355150343850255, -0.025897111743688583, 0.06006639450788498, 0.04921795427799225, 0.09358561784029007, -0.04101727530360222, 0.04617087543010712, -0.10872046649456024, -0.0052834004163742065, -0.08228728175163269, -0.013137922622263432, -0.015868056565523148, -0.08078140765428543, -0.07782454043626785, 0.041541170328855515, 0.04487490653991699, -0.03412456437945366, 0.015850039198994637, -0.03787378966808319, 0.05123697593808174, -0.022725306451320648, 0.0438867025077343, 0.07853325456380844, -0.1129603385925293, -0.08962719887495041, -0.013643267564475536, 0.07040349394083023, -0.17273171246051788, -0.09363500773906708, -0.0819883644580841, 0.04703228920698166, 0.01014931034296751, 0.13718196749687195, 0.023631058633327484, 0.0538620688021183, -0.005385276861488819, 0.11497800052165985, 0.07961619645357132, 0.030097322538495064, 0.08195469528436661, -0.04976554214954376, -0.05159351974725723, -0.11468221247196198, -0.07965223491191864, -0.010883374139666557, -0.03338203206658363, 0.14218223094940186, -0.04934129863977432, -0.02232489548623562, -0.11836034804582596, 0.014544609002768993, 0.08441430330276489, 0.11432263255119324, -0.025964396074414253, -0.11998476833105087, 0.055154986679553986, 0.1041175052523613, -0.07874864339828491, -0.0123501131311059, 0.11835993826389313, -0.020136304199695587, -0.009703001007437706, 0.039734479039907455, 0.03210063651204109, 0.08690152317285538, -0.07745780795812607, -0.08419908583164215, 0.07286582142114639, 0.14486084878444672, -0.12756484746932983, -0.07060308754444122, 0.05250563845038414, 0.06429335474967957, 0.0960497111082077, -0.05624896660447121, 0.039957378059625626, -0.1287689357995987, -0.05949138104915619, -0.08781164139509201, -0.003970160614699125, -0.019093459472060204, 0.030318189412355423, -0.08972757309675217, -0.0013744046445935965, -0.08253507316112518, -0.10075338184833527, -0.02809378132224083, -0.022338831797242165, -0.036480601876974106, 0.025602741166949272, 0.037831127643585205, -0.005462297238409519, -0.10037370771169662, -0.023450272157788277, -0.03355282545089722, 0.022704873234033585, 0.04006575420498848, 0.10025661438703537, -0.07113100588321686, -0.0280916690826416, 0.03763088583946228, -0.07576863467693329, 0.1365191638469696, -0.03252951428294182, 0.060408808290958405, 0.05117281526327133, 0.028475239872932434, 0.10420366376638412, -0.1889144480228424, 0.11526043713092804, -0.007796836085617542, 0.01680537685751915, 0.09433364123106003, 0.16395629942417145, 0.03644122555851936, -0.04161791130900383, -0.03244761377573013, 0.03628286346793175, -0.015637515112757683, 0.05552605912089348, -0.08785051107406616, -0.022581208497285843, 0.02298741042613983, -0.009215201251208782, -0.044684287160634995, -0.11264979839324951, 0.09077606350183487, 0.01712336204946041, 0.07194779068231583, -0.005417582578957081, -0.15505975484848022, 0.02352392114698887, -0.12275843322277069, 0.00524586346000433, -0.12311007082462311, 0.11796460300683975, -0.024994613602757454, -0.018554486334323883, -0.07384423911571503, -0.15949039161205292, -0.004527019336819649, -0.004841267596930265, 0.007862881757318974, 0.06615311652421951, -0.12975521385669708, -0.012800774537026882, -0.0910312756896019, -0.028072288259863853, 0.017160264775156975, -0.07065223157405853, 0.12181705981492996, 0.10104148834943771, 0.1424984484910965, 0.003917520400136709, -0.14426763355731964, -0.1331261396408081, 0.08521641790866852, 0.03639112040400505, 0.11302327364683151, 0.018418829888105392, -0.12640486657619476, 0.014179731719195843, 0.037505727261304855, 0.08779802918434143, -0.007147963624447584, 0.10918653011322021, 0.03254435583949089, -0.003405157243832946, 0.03042793832719326, -0.03277815133333206, 0.045651935040950775, -0.06621662527322769, 0.03462928533554077, -0.07320844382047653, 0.00444922735914588, 0.04554871469736099, 0.0608619749546051, 0.01793740876019001, -0.007100183051079512, 0.019167644903063774, 0.09668892621994019, 0.0785784050822258, -0.09798464924097061, -0.00879024900496006, 0.15544798970222473, -0.027349436655640602, 0.04474795609712601, -0.09476353973150253, -0.0149879464879632, -0.049688246101140976, 0.02635529823601246, -0.08922982960939407, -0.015521980822086334, -0.10870262235403061, -0.062433354556560516, 0.02758433297276497, 0.04222845658659935, -0.02463187277317047, 0.04187497869133949, -0.021558456122875214, -0.15975669026374817, 0.00218430208042264, 0.027496682479977608, -0.026409713551402092, 0.03419813886284828, -0.016261542215943336, -0.03448029235005379, 0.04449637979269028, -0.039942968636751175, -0.11829712986946106, 0.031317468732595444, -0.08911701291799545, 0.008277714252471924, -0.007790741045027971, 0.062026821076869965, 0.04664371907711029, -0.03310460224747658, 0.06411387771368027, 0.06602003425359726, 0.08354661613702774, 0.05766524747014046, -0.02303265780210495, 0.0022357970010489225, 0.11482397466897964, 0.05714353546500206, 0.013729781843721867, -0.05109228193759918, -0.06201145797967911, -0.052715715020895004, 0.010292889550328255, -0.016282033175230026, -0.14500835537910461, -0.017264433205127716, 0.009832813404500484, 0.06671279668807983, 0.07197107374668121, -0.05650491267442703, -0.12177842855453491, 0.15911710262298584, -0.0710662230849266, -0.17572176456451416, 0.009766854345798492, 0.12631745636463165, -0.07617320865392685, -0.13085190951824188, 0.10875804722309113, 0.11284703016281128, -0.09665357321500778, -0.08014838397502899, -0.07468786090612411, -0.02720525860786438, 0.1414920836687088, 0.038607630878686905, 0.05258168652653694, 0.02355501614511013, 0.029644856229424477, 0.007954454980790615, -0.0472988560795784, -0.05205191671848297, 0.039868395775556564, 0.15053966641426086, -0.016144199296832085, -0.10593561828136444, 0.056259822100400925, -0.09613178670406342, 0.06528889387845993, 0.0576477125287056, 0.017258338630199432, -0.03086451254785061, 0.06847003847360611, -0.10114660114049911, -0.018994662910699844, 0.0009996903827413917, 0.018618477508425713, 0.0676332339644432, 0.07216391712427139, -0.029659027233719826, -0.10284030437469482, 0.07097315788269043, -0.09752713143825531, -0.021305322647094727, -0.07631846517324448, 0.056831683963537216, -0.05274514853954315, -0.030191143974661827, -0.003062916686758399, 0.01700432226061821, -0.09130819886922836, 0.15630558133125305, -0.03152332082390785, 0.11427962779998779, 0.08695363253355026, 0.10869574546813965, 0.011961662210524082, -0.009192686527967453, 0.09621115773916245, -0.08466434478759766, 0.005902696400880814, -0.042910218238830566, 0.059331636875867844, 0.013755406253039837, -0.009418352507054806, 0.07878557592630386, 0.14145812392234802, 0.02058027684688568, -0.07183143496513367, 0.1311197131872177, -0.08473862707614899, -0.020639613270759583, 0.005529683083295822, -0.00023175154638011009, -0.0027941404841840267, 0.05530291795730591, -0.04387767240405083, 0.016849840059876442, -0.05071621388196945, 0.05003909021615982, -0.08748199045658112, 0.08494827896356583, -0.1118689551949501, 0.01052101794630289, 0.00034602684900164604, 0.09150462597608566, -0.06323286890983582, 0.05586885288357735, -0.06707672774791718, -0.009557439014315605, -0.09842223674058914, -0.05220087245106697, 0.015589562244713306, 0.02954975888133049, -0.08397030085325241, -0.053739722818136215, 0.12726034224033356, 0.07823240756988525, -0.033111460506916046, -0.07471700012683868, -0.10648088157176971, 0.017116667702794075, 0.07904466241598129, -0.06456659734249115, -0.14021237194538116, -0.040502648800611496, 0.038379792124032974, 0.0386744849383831, 0.1001744344830513, -0.018507760018110275, -0.003357990412041545, -0.1269659548997879, 0.06768637895584106, -0.03249065577983856, 0.036384373903274536, 0.04242992028594017, 0.05263868346810341, 0.00875394232571125, -0.0049928403459489346, -0.0017610040958970785, 0.05205851048231125, 0.055169641971588135, -0.015674225986003876, 0.00519853550940752, 0.04531478136777878, -0.08467172086238861, -0.11424095928668976, -0.008011150173842907, 0.03472282737493515, -0.014125770889222622, 0.021368592977523804};
-
-const int8_t layer_3_weights_zero = 0;
-const float layer_3_weights_scale = 0.0019162629032507539;
-
-const int8_t layer_3_zero = 77;
-const float layer_3_scale = 0.3325134217739105;
-
-const int8_t layer_3_weights8[1440] = {-12, -45, 45, -54, -12, -59, 9, -55, -7, -13, -44, 13, 0, 60, 13, 57, 58, -21, -33, 6, -24, -15, 34, 47, -27, 2, 9, -23, -23, -62, 63, -21, -41, 4, 30, 21, -7, 20, -19, 1, 39, 19, -99, -88, -61, -6, -15, -34, -48, 23, 60, -5, -8, 46, -55, -53, -16, -63, 25, 47, -23, -67, -6, -89, 18, -93, 3, 62, -44, 67, 9, -29, -43, -10, -66, -48, -12, -100, 33, -8, -48, 60, 21, 29, 10, -51, 32, -44, 6, -4, 60, -28, 69, -23, -32, -9, 46, -15, 29, -96, -21, -80, 8, 11, -85, -105, -60, -75, 6, -13, -34, 20, -65, -68, -1, -31, 9, -31, 41, 27, -18, -118, -95, -8, 10, 70, -87, -77, 3, 53, 54, -69, 33, -4, -12, -86, 0, 50, 73, -13, -12, 33, -54, -12, 30, 48, -6, 4, -108, 83, -106, -80, -95, -59, 9, -20, -60, -73, 50, -101, 26, 5, -27, 62, -25, -52, -39, -84, -40, 7, -86, -91, -98, -29, -40, -43, 63, 7, -94, -36, -34, 55, 83, 8, -104, -79, -23, -101, 65, -94, -47, -94, -61, -42, 17, 13, -22, 22, 4, -93, -55, 37, -50, 81, 12, -68, 43, -23, -82, -94, -50, 16, 59, 43, -52, -40, -77, 16, 2, 60, -32, -17, -7, 60, 21, -48, -53, 22, -34, 3, -87, -58, -122, -69, -18, 4, -104, -53, -44, -49, -66, 47, -98, -32, 64, -66, 32, 16, -82, -23, -10, 48, 36, -106, -43, 74, 69, -5, -103, -32, -8, -63, 17, 46, -28, -18, 46, -82, 6, 69, 45, -48, -13, -62, 6, -23, -39, -38, -76, 3, 50, -35, -36, -44, -33, 3, -34, 34, -22, -95, -39, -93, 52, -28, 22, -80, -56, -8, -36, -10, -33, -18, -111, -5, -27, -56, -41, 11, -20, -28, 23, 46, 46, -20, -82, -66, -62, 52, 88, -28, 5, -20, 6, -50, 37, 25, 54, -21, 18, -53, -71, 17, -92, 2, 14, -23, -79, -10, 77, -42, -60, -67, -120, -7, 81, 65, -27, 33, -69, -8, -39, -31, 60, 68, -13, -87, 5, -58, -22, -47, -14, 32, -9, -22, -77, 29, 20, 1, 36, -69, -84, -43, -20, -56, -3, 18, -60, 5, -5, 12, -25, 30, -38, -79, -34, 72, -8, -44, 35, -81, 6, -33, -36, -6, -24, -59, -27, 1, 61, 7, -95, -45, -43, 26, -93, -57, 22, -101, -69, -16, -4, 16, 41, -39, 19, -76, -12, -89, -37, 57, -85, -29, -59, -55, -51, -23, 43, -85, -66, -2, -71, 25, 70, 11, 1, -43, -31, -17, 10, 84, -10, -81, -87, 23, 20, 56, 0, -8, -40, 38, 26, 25, 22, -55, 10, 60, -43, 46, -10, 4, -32, -2, -3, 18, 36, 11, -60, -22, -40, 58, -31, 14, -20, -64, 98, -37, -33, 65, -16, -67, -41, -16, -93, -103, -66, -26, -65, -63, 6, 33, -19, 5, -39, -57, -6, -53, 12, -15, 16, -65, -47, -13, 4, -13, -109, -5, -14, -14, 3, -57, -40, 57, 40, -60, -116, -15, 6, 49, 14, 1, -60, 61, 0, -96, -18, -57, 22, 28, -65, -58, -99, 41, -24, -19, 87, 43, 54, -13, 3, -69, -34, -52, -28, 52, -38, -48, -77, -25, 78, 47, -80, 23, 100, 11, 1, 18, 13, -30, -69, -21, 46, 20, 45, -74, -108, 4, -42, -67, -18, 18, -94, 11, -86, 80, -25, -87, 62, -98, -4, 49, 22, -20, 51, -47, 36, 33, -19, 75, 32, -49, -21, 2, -14, -28, 54, 41, 4, -120, -9, 3, -17, -75, 1, -30, -66, 51, 51, -47, -56, -10, -54, 4, -43, -31, -24, 33, 25, -38, -89, 47, 69, -5, -56, 14, -1, -28, -19, -32, 90, -75, -45, 45, -71, -4, -90, -97, -27, 23, -21, 37, -47, -21, -101, 20, -36, -57, 25, -90, -16, -13, 16, 50, 15, -55, -4, 6, 26, -54, 90, -58, -76, -21, -71, -13, -74, 65, -12, -117, -39, -52, -37, -9, -30, -5, -65, 20, -63, 19, 43, 40, 75, 19, -75, 9, 29, -16, 26, -87, -86, -17, 58, 79, -31, 44, -102, -73, 15, 62, 19, 52, -20, 10, -9, 64, 20, 31, 7, -35, -8, -9, 14, -18, -77, -19, -22, -85, 48, -68, -114, 44, -33, -19, -8, 53, -35, -20, -91, -39, -46, -14, -16, 44, 105, 35, 53, -115, -48, -5, -71, -78, -49, 14, -44, 43, -82, 22, -9, -10, 54, 17, 11, -102, 2, -27, -17, -59, 5, -8, -48, 34, -34, 38, -43, 48, -98, -14, 34, -9, -44, 27, -48, 0, -57, -64, -14, -32, -36, 23, -51, -67, 48, -33, -26, 34, -11, 11, 77, 59, 33, 8, -24, -43, 6, -4, 14, -38, -55, -1, -33, -108, 14, 85, -6, -11, 49, 76, 1, 24, 72, -25, 37, -113, 19, -53, -95, 5, -83, -99, 13, 31, 6, -8, 68, -44, -71, 43, -96, -65, -9, 37, -53, 25, -38, -65, -15, -5, 50, -41, 74, 29, -26, -57, 62, 1, -10, -48, 35, 5, -1, -25, 25, -31, -32, 42, 58, 54, 26, -12, 6, -49, -49, -15, -23, -6, -16, -4, -97, -106, -22, 27, -27, -3, -95, -56, -14, -56, -33, -40, 36, 40, -60, 32, 4, 72, 29, 13, -31, 31, -36, -104, -2, -34, 5, -70, 0, -30, -59, 54, -56, -50, -31, 3, -102, -42, -58, -14, -22, 50, -27, -97, -26, -60, -92, 44, 42, -34, -102, -27, -43, 8, -72, 53, -43, 83, -43, 55, -39, -33, -105, 79, 53, 13, 1, 49, -36, -51, -19, 19, -26, -96, 7, 51, -4, -45, 93, -8, -11, -8, -13, -8, 1, -52, -52, -5, -73, 14, 15, -43, -89, 62, 87, -14, 29, -7, -14, 7, 33, 43, -5, -48, -15, 97, -8, 63, -3, -16, 7, -49, -67, -84, -55, -22, 5, 1, -6, -17, -70, 15, 57, -11, -62, -42, -28, -11, 30, -110, 71, -45, -17, 56, -82, -9, 19, -19, -109, -21, 56, -95, 38, -38, -89, -9, 20, 6, 18, -51, 1, -58, 23, -22, -38, -11, -21, 2, -35, 2, 19, -98, 1, -3, -5, -29, 85, 13, 45, 26, -33, 0, -47, 90, -82, 16, -33, 43, 83, -80, -13, -36, -40, -71, -72, 25, 34, -2, 3, 45, 8, -64, 14, -47, 41, -54, -60, 29, 10, -28, 10, -25, -47, 63, -67, -62, 15, -5, -61, -56, -121, -60, -62, -22, 40, 21, -104, -54, 79, -22, -18, 23, -50, -15, 24, -23, -18, -58, -12, 3, -10, 27, -85, -35, -5, 100, -29, 1, -1, 13, 49, 24, -41, 17, 26, -57, -5, 28, -23, -40, 6, 65, 29, -23, -44, -98, -86, 35, -10, -40, -34, -10, -10, -21, -34, -91, -7, 64, -46, 55, -128, 20, -50, 80, -40, 23, 24, 70, 40, -15, -12, 7, 37, -38, -97, -56, -106, 14, 35, -9, 54, 2, 4, 50, 8, 41, 7, -17, -34, -62, 55, 13, 18, 48, -14, -52, 60, -62, -67, -17, 16, 15, -43, 1, -37, 51, 5, -39, -36, 12, -79, -14, -63, -77, -20, -78, -29, -92, -52, -20, 4, 3, -17, -84, 4, -64, -82, -85, -42, 22, 4, 39, 15, -18, -6, -95, -5, 6, -54, 21, 26, 64, 4, 48, 24, -32, -59, -27, -23, -40, -43, -41, 13, 79, -17, -25, -39, -45, -43, 6, -61, 47, -2, 47, 0, 4, 61, -69, 4, -6, -76, -48, -82, 65, -81, 73, -23, -13, 2, -83, 26, 30, 47, 61, -50, 26, -58, -19, 27, -42, 25, -87, -96, -37, -56, -46, -34, -85, 44, -91, -73, -36, -52, -81, 46, -28, 3, 32, -5, 38, -41, -4, 18, -14, -22, -42, 10, 47, 65, 33, -3, -56, -68, -67, 51, -104, -31, -30, 49, -14, 17, -75, -50, -97, -61, 53, -69, -42, -35, -53, -1, -5, -23, -18, 48, -82, -54, 64, -3, 35, -35, -39, -75, 27, -49, -31, -49, 46, -30, -81, -11, -27, 27, -45, -10, -40, 12, -102, 56, -34, -53, 79, -62, -6, -10, 58, 42, 14, -56, 36, -19, -22, 76, 54, 22, 88, 76, -1, -11, 74, 21, -8, -62, -106, 7, -34, -81, -9, 28, 19, -73, 8, -113, 35, -82, 70, 82, -28, 63, -3, 47, -5, -14, 74, -29, 2, -112, -27, -98, -21, 35, -13, 10, -16, -87, 46, -37, -54, -25, -118, -36, -49, -22, -107, -67, -14, 64, 5, -104, -55, -39, -66, 85, -11, -13, -36, -35, -31, -27, 30, -17, -56, -4, 21, 19, -31, -73, -4, -38, 23, -71, -6, -10, 44};
-
-const int16_t layer_3_weights16[1440] = {-12, -45, 45, -54, -12, -59, 9, -55, -7, -13, -44, 13, 0, 60, 13, 57, 58, -21, -33, 6, -24, -15, 34, 47, -27, 2, 9, -23, -23, -62, 63, -21, -41, 4, 30, 21, -7, 20, -19, 1, 39, 19, -99, -88, -61, -6, -15, -34, -48, 23, 60, -5, -8, 46, -55, -53, -16, -63, 25, 47, -23, -67, -6, -89, 18, -93, 3, 62, -44, 67, 9, -29, -43, -10, -66, -48, -12, -100, 33, -8, -48, 60, 21, 29, 10, -51, 32, -44, 6, -4, 60, -28, 69, -23, -32, -9, 46, -15, 29, -96, -21, -80, 8, 11, -85, -105, -60, -75, 6, -13, -34, 20, -65, -68, -1, -31, 9, -31, 41, 27, -18, -118, -95, -8, 10, 70, -87, -77, 3, 53, 54, -69, 33, -4, -12, -86, 0, 50, 73, -13, -12, 33, -54, -12, 30, 48, -6, 4, -108, 83, -106, -80, -95, -59, 9, -20, -60, -73, 50, -101, 26, 5, -27, 62, -25, -52, -39, -84, -40, 7, -86, -91, -98, -29, -40, -43, 63, 7, -94, -36, -34, 55, 83, 8, -104, -79, -23, -101, 65, -94, -47, -94, -61, -42, 17, 13, -22, 22, 4, -93, -55, 37, -50, 81, 12, -68, 43, -23, -82, -94, -50, 16, 59, 43, -52, -40, -77, 16, 2, 60, -32, -17, -7, 60, 21, -48, -53, 22, -34, 3, -87, -58, -122, -69, -18, 4, -104, -53, -44, -49, -66, 47, -98, -32, 64, -66, 32, 16, -82, -23, -10, 48, 36, -106, -43, 74, 69, -5, -103, -32, -8, -63, 17, 46, -28, -18, 46, -82, 6, 69, 45, -48, -13, -62, 6, -23, -39, -38, -76, 3, 50, -35, -36, -44, -33, 3, -34, 34, -22, -95, -39, -93, 52, -28, 22, -80, -56, -8, -36, -10, -33, -18, -111, -5, -27, -56, -41, 11, -20, -28, 23, 46, 46, -20, -82, -66, -62, 52, 88, -28, 5, -20, 6, -50, 37, 25, 54, -21, 18, -53, -71, 17, -92, 2, 14, -23, -79, -10, 77, -42, -60, -67, -120, -7, 81, 65, -27, 33, -69, -8, -39, -31, 60, 68, -13, -87, 5, -58, -22, -47, -14, 32, -9, -22, -77, 29, 20, 1, 36, -69, -84, -43, -20, -56, -3, 18, -60, 5, -5, 12, -25, 30, -38, -79, -34, 72, -8, -44, 35, -81, 6, -33, -36, -6, -24, -59, -27, 1, 61, 7, -95, -45, -43, 26, -93, -57, 22, -101, -69, -16, -4, 16, 41, -39, 19, -76, -12, -89, -37, 57, -85, -29, -59, -55, -51, -23, 43, -85, -66, -2, -71, 25, 70, 11, 1, -43, -31, -17, 10, 84, -10, -81, -87, 23, 20, 56, 0, -8, -40, 38, 26, 25, 22, -55, 10, 60, -43, 46, -10, 4, -32, -2, -3, 18, 36, 11, -60, -22, -40, 58, -31, 14, -20, -64, 98, -37, -33, 65, -16, -67, -41, -16, -93, -103, -66, -26, -65, -63, 6, 33, -19, 5, -39, -57, -6, -53, 12, -15, 16, -65, -47, -13, 4, -13, -109, -5, -14, -14, 3, -57, -40, 57, 40, -60, -116, -15, 6, 49, 14, 1, -60, 61, 0, -96, -18, -57, 22, 28, -65, -58, -99, 41, -24, -19, 87, 43, 54, -13, 3, -69, -34, -52, -28, 52, -38, -48, -77, -25, 78, 47, -80, 23, 100, 11, 1, 18, 13, -30, -69, -21, 46, 20, 45, -74, -108, 4, -42, -67, -18, 18, -94, 11, -86, 80, -25, -87, 62, -98, -4, 49, 22, -20, 51, -47, 36, 33, -19, 75, 32, -49, -21, 2, -14, -28, 54, 41, 4, -120, -9, 3, -17, -75, 1, -30, -66, 51, 51, -47, -56, -10, -54, 4, -43, -31, -24, 33, 25, -38, -89, 47, 69, -5, -56, 14, -1, -28, -19, -32, 90, -75, -45, 45, -71, -4, -90, -97, -27, 23, -21, 37, -47, -21, -101, 20, -36, -57, 25, -90, -16, -13, 16, 50, 15, -55, -4, 6, 26, -54, 90, -58, -76, -21, -71, -13, -74, 65, -12, -117, -39, -52, -37, -9, -30, -5, -65, 20, -63, 19, 43, 40, 75, 19, -75, 9, 29, -16, 26, -87, -86, -17, 58, 79, -31, 44, -102, -73, 15, 62, 19, 52, -20, 10, -9, 64, 20, 31, 7, -35, -8, -9, 14, -18, -77, -19, -22, -85, 48, -68, -114, 44, -33, -19, -8, 53, -35, -20, -91, -39, -46, -14, -16, 44, 105, 35, 53, -115, -48, -5, -71, -78, -49, 14, -44, 43, -82, 22, -9, -10, 54, 17, 11, -102, 2, -27, -17, -59, 5, -8, -48, 34, -34, 38, -43, 48, -98, -14, 34, -9, -44, 27, -48, 0, -57, -64, -14, -32, -36, 23, -51, -67, 48, -33, -26, 34, -11, 11, 77, 59, 33, 8, -24, -43, 6, -4, 14, -38, -55, -1, -33, -108, 14, 85, -6, -11, 49, 76, 1, 24, 72, -25, 37, -113, 19, -53, -95, 5, -83, -99, 13, 31, 6, -8, 68, -44, -71, 43, -96, -65, -9, 37, -53, 25, -38, -65, -15, -5, 50, -41, 74, 29, -26, -57, 62, 1, -10, -48, 35, 5, -1, -25, 25, -31, -32, 42, 58, 54, 26, -12, 6, -49, -49, -15, -23, -6, -16, -4, -97, -106, -22, 27, -27, -3, -95, -56, -14, -56, -33, -40, 36, 40, -60, 32, 4, 72, 29, 13, -31, 31, -36, -104, -2, -34, 5, -70, 0, -30, -59, 54, -56, -50, -31, 3, -102, -42, -58, -14, -22, 50, -27, -97, -26, -60, -92, 44, 42, -34, -102, -27, -43, 8, -72, 53, -43, 83, -43, 55, -39, -33, -105, 79, 53, 13, 1, 49, -36, -51, -19, 19, -26, -96, 7, 51, -4, -45, 93, -8, -11, -8, -13, -8, 1, -52, -52, -5, -73, 14, 15, -43, -89, 62, 87, -14, 29, -7, -14, 7, 33, 43, -5, -48, -15, 97, -8, 63, -3, -16, 7, -49, -67, -84, -55, -22, 5, 1, -6, -17, -70, 15, 57, -11, -62, -42, -28, -11, 30, -110, 71, -45, -17, 56, -82, -9, 19, -19, -109, -21, 56, -95, 38, -38, -89, -9, 20, 6, 18, -51, 1, -58, 23, -22, -38, -11, -21, 2, -35, 2, 19, -98, 1, -3, -5, -29, 85, 13, 45, 26, -33, 0, -47, 90, -82, 16, -33, 43, 83, -80, -13, -36, -40, -71, -72, 25, 34, -2, 3, 45, 8, -64, 14, -47, 41, -54, -60, 29, 10, -28, 10, -25, -47, 63, -67, -62, 15, -5, -61, -56, -121, -60, -62, -22, 40, 21, -104, -54, 79, -22, -18, 23, -50, -15, 24, -23, -18, -58, -12, 3, -10, 27, -85, -35, -5, 100, -29, 1, -1, 13, 49, 24, -41, 17, 26, -57, -5, 28, -23, -40, 6, 65, 29, -23, -44, -98, -86, 35, -10, -40, -34, -10, -10, -21, -34, -91, -7, 64, -46, 55, -128, 20, -50, 80, -40, 23, 24, 70, 40, -15, -12, 7, 37, -38, -97, -56, -106, 14, 35, -9, 54, 2, 4, 50, 8, 41, 7, -17, -34, -62, 55, 13, 18, 48, -14, -52, 60, -62, -67, -17, 16, 15, -43, 1, -37, 51, 5, -39, -36, 12, -79, -14, -63, -77, -20, -78, -29, -92, -52, -20, 4, 3, -17, -84, 4, -64, -82, -85, -42, 22, 4, 39, 15, -18, -6, -95, -5, 6, -54, 21, 26, 64, 4, 48, 24, -32, -59, -27, -23, -40, -43, -41, 13, 79, -17, -25, -39, -45, -43, 6, -61, 47, -2, 47, 0, 4, 61, -69, 4, -6, -76, -48, -82, 65, -81, 73, -23, -13, 2, -83, 26, 30, 47, 61, -50, 26, -58, -19, 27, -42, 25, -87, -96, -37, -56, -46, -34, -85, 44, -91, -73, -36, -52, -81, 46, -28, 3, 32, -5, 38, -41, -4, 18, -14, -22, -42, 10, 47, 65, 33, -3, -56, -68, -67, 51, -104, -31, -30, 49, -14, 17, -75, -50, -97, -61, 53, -69, -42, -35, -53, -1, -5, -23, -18, 48, -82, -54, 64, -3, 35, -35, -39, -75, 27, -49, -31, -49, 46, -30, -81, -11, -27, 27, -45, -10, -40, 12, -102, 56, -34, -53, 79, -62, -6, -10, 58, 42, 14, -56, 36, -19, -22, 76, 54, 22, 88, 76, -1, -11, 74, 21, -8, -62, -106, 7, -34, -81, -9, 28, 19, -73, 8, -113, 35, -82, 70, 82, -28, 63, -3, 47, -5, -14, 74, -29, 2, -112, -27, -98, -21, 35, -13, 10, -16, -87, 46, -37, -54, -25, -118, -36, -49, -22, -107, -67, -14, 64, 5, -104, -55, -39, -66, 85, -11, -13, -36, -35, -31, -27, 30, -17, -56, -4, 21, 19, -31, -73, -4, -38, 23, -71, -6, -10, 44};
-
-const float layer_3_weights[1440] = {-0.023152869194746017, -0.08573342114686966, 0.08570065349340439, -0.10294434428215027, -0.02321958914399147, -0.1137811467051506, 0.017618628218770027, -0.10586075484752655, -0.013895834796130657, -0.024333927780389786, -0.08425599336624146, 0.025004668161273003, -0.00035198440309613943, 0.11572765558958054, 0.025036145001649857, 0.10848268866539001, 0.11098825186491013, -0.039685677736997604, -0.06303257495164871, 0.011330894194543362, -0.046125754714012146, -0.028547098860144615, 0.06442279368638992, 0.08947864919900894, -0.05260247364640236, 0.003178850980475545, 0.017465833574533463, -0.04389631003141403, -0.04342910274863243, -0.11928660422563553, 0.1213531643152237, -0.04119487851858139, -0.0789269357919693, 0.006956418976187706, 0.05717524141073227, 0.04056590050458908, -0.01374200452119112, 0.03751320764422417, -0.03696085885167122, 0.0014876534696668386, 0.07558870315551758, 0.036450184881687164, -0.18989121913909912, -0.16954860091209412, -0.11675965785980225, -0.011262974701821804, -0.02824469842016697, -0.06595371663570404, -0.0914188027381897, 0.044181108474731445, 0.11472669243812561, -0.010336378589272499, -0.014598418027162552, 0.08850318938493729, -0.10588526725769043, -0.10119622945785522, -0.030274460092186928, -0.12031484395265579, 0.04824773222208023, 0.08934902399778366, -0.04470813646912575, -0.12790578603744507, -0.01193000003695488, -0.17136108875274658, 0.03457621484994888, -0.1777811348438263, 0.006347573362290859, 0.11865818500518799, -0.0834956169128418, 0.12892235815525055, 0.01708848401904106, -0.05632505565881729, -0.0829697996377945, -0.01864059828221798, -0.12638500332832336, -0.09180036187171936, -0.02251794934272766, -0.192519873380661, 0.06368745118379593, -0.015698028728365898, -0.09206395596265793, 0.11449437588453293, 0.03982426971197128, 0.05598079413175583, 0.019334424287080765, -0.09683211892843246, 0.061628859490156174, -0.08392129093408585, 0.011503463611006737, -0.007401176728308201, 0.11543211340904236, -0.05314788967370987, 0.13166452944278717, -0.04353174939751625, -0.06194296479225159, -0.017781170085072517, 0.08813026547431946, -0.028965556994080544, 0.055208150297403336, -0.1835709810256958, -0.04002789407968521, -0.15406765043735504, 0.015766726806759834, 0.021964913234114647, -0.16256514191627502, -0.20038017630577087, -0.11551922559738159, -0.14413140714168549, 0.01084529422223568, -0.023965414613485336, -0.06486630439758301, 0.03834777697920799, -0.12437046319246292, -0.1294550597667694, -0.002541244262829423, -0.059481602162122726, 0.01720372401177883, -0.058772481977939606, 0.07786140590906143, 0.05198054388165474, -0.03440506011247635, -0.22519174218177795, -0.18118861317634583, -0.01602771505713463, 0.020049655809998512, 0.13374345004558563, -0.16636845469474792, -0.14720399677753448, 0.00548799941316247, 0.10238198935985565, 0.1036284789443016, -0.13228102028369904, 0.06367035210132599, -0.008213624358177185, -0.023114271461963654, -0.16384483873844147, 0.00014153189840726554, 0.09650549292564392, 0.13977093994617462, -0.024520788341760635, -0.02221752516925335, 0.06336097419261932, -0.1034669429063797, -0.023146821185946465, 0.057683445513248444, 0.09108175337314606, -0.012273228727281094, 0.0070770010352134705, -0.20627422630786896, 0.1581731140613556, -0.20365571975708008, -0.15354831516742706, -0.1826566755771637, -0.11292514950037003, 0.016488898545503616, -0.03772258758544922, -0.11470554023981094, -0.13915158808231354, 0.09574070572853088, -0.1927683800458908, 0.0497148260474205, 0.009332878515124321, -0.051321808248758316, 0.11968441307544708, -0.0469682402908802, -0.09915491193532944, -0.07379992306232452, -0.16156388819217682, -0.07577012479305267, 0.012547563761472702, -0.16546504199504852, -0.17509450018405914, -0.18710340559482574, -0.05510827153921127, -0.07617419213056564, -0.08190606534481049, 0.12048976868391037, 0.012482897378504276, -0.1798386424779892, -0.06810032576322556, -0.06423848122358322, 0.10572556406259537, 0.1587381809949875, 0.01628061570227146, -0.19935117661952972, -0.15181714296340942, -0.044485848397016525, -0.1940920650959015, 0.12491454184055328, -0.17986933887004852, -0.08972255885601044, -0.18075692653656006, -0.1177271381020546, -0.08078908920288086, 0.031953416764736176, 0.024058857932686806, -0.043084386736154556, 0.04242674261331558, 0.008043079636991024, -0.17832650244235992, -0.10517193377017975, 0.07100645452737808, -0.09545562416315079, 0.15612642467021942, 0.023439498618245125, -0.13048115372657776, 0.08224856853485107, -0.043582431972026825, -0.1563260555267334, -0.17988304793834686, -0.0950578823685646, 0.03132379800081253, 0.11293017119169235, 0.08153354376554489, -0.09914814680814743, -0.07685603201389313, -0.14781157672405243, 0.030672917142510414, 0.003534771967679262, 0.11567938327789307, -0.06223633885383606, -0.033481501042842865, -0.014038503170013428, 0.11407849192619324, 0.04108375310897827, -0.09169838577508926, -0.10216307640075684, 0.041708048433065414, -0.06540887802839279, 0.004976524971425533, -0.1671280562877655, -0.11033406108617783, -0.23311416804790497, -0.13304072618484497, -0.03353661671280861, 0.008471948094666004, -0.19848646223545074, -0.10179974883794785, -0.0851341038942337, -0.09409542381763458, -0.12558965384960175, 0.08979365229606628, -0.18807131052017212, -0.061017464846372604, 0.1232273131608963, -0.12627172470092773, 0.061989594250917435, 0.03137269616127014, -0.15650641918182373, -0.043390657752752304, -0.019359992817044258, 0.09148860722780228, 0.06898202747106552, -0.204079732298851, -0.08223986625671387, 0.14269928634166718, 0.13265512883663177, -0.008681119419634342, -0.19760455191135406, -0.061579879373311996, -0.016022251918911934, -0.1207134947180748, 0.032287511974573135, 0.08885161578655243, -0.05449802428483963, -0.03535044193267822, 0.0874984934926033, -0.15734165906906128, 0.011304500512778759, 0.13232232630252838, 0.08717551082372665, -0.0912407860159874, -0.0240828525274992, -0.11830216646194458, 0.010754995048046112, -0.044470809400081635, -0.07459058612585068, -0.07360897958278656, -0.145448237657547, 0.006650030147284269, 0.0962216705083847, -0.06802474707365036, -0.06827274709939957, -0.08418017625808716, -0.06377457082271576, 0.00641437666490674, -0.06534342467784882, 0.06497810035943985, -0.04218803718686104, -0.18192222714424133, -0.07438203692436218, -0.17857572436332703, 0.09941940754652023, -0.05436541140079498, 0.04261569678783417, -0.15247322618961334, -0.1067601814866066, -0.015258152037858963, -0.06809253245592117, -0.019473791122436523, -0.062334802001714706, -0.03444259613752365, -0.2123938947916031, -0.009814159944653511, -0.052594926208257675, -0.10645533353090286, -0.078435018658638, 0.021403878927230835, -0.037785373628139496, -0.053202707320451736, 0.043793849647045135, 0.08864178508520126, 0.08723317831754684, -0.038227226585149765, -0.15708497166633606, -0.1255171149969101, -0.11838330328464508, 0.09883782267570496, 0.16907437145709991, -0.05452125146985054, 0.010422357358038425, -0.039245180785655975, 0.012011025100946426, -0.09503903239965439, 0.07098167389631271, 0.04778686910867691, 0.1042724996805191, -0.040983449667692184, 0.035402312874794006, -0.10189056396484375, -0.13565610349178314, 0.0327066145837307, -0.17694522440433502, 0.003678265493363142, 0.026554716750979424, -0.04454483091831207, -0.1520971655845642, -0.019289858639240265, 0.14792518317699432, -0.08058067411184311, -0.11567851155996323, -0.12854203581809998, -0.22931617498397827, -0.013597093522548676, 0.1552511602640152, 0.12502248585224152, -0.05177127569913864, 0.06386902928352356, -0.1331106722354889, -0.01534239575266838, -0.0738174319267273, -0.05926501378417015, 0.11482357233762741, 0.13111640512943268, -0.02399565652012825, -0.1666194200515747, 0.009442615322768688, -0.11117181181907654, -0.042514171451330185, -0.08972598612308502, -0.026525426656007767, 0.06143392622470856, -0.016568895429372787, -0.04208628088235855, -0.14723511040210724, 0.05568389594554901, 0.03737396001815796, 0.0013127608690410852, 0.06894537806510925, -0.13294383883476257, -0.16049893200397491, -0.08180921524763107, -0.03826163709163666, -0.10734224319458008, -0.005457466933876276, 0.034111861139535904, -0.11568937450647354, 0.010151016525924206, -0.009310921654105186, 0.02288707345724106, -0.04751633107662201, 0.057625662535429, -0.07375308871269226, -0.15131421387195587, -0.06598559021949768, 0.13788190484046936, -0.015604913234710693, -0.08434703946113586, 0.06637801975011826, -0.15516242384910583, 0.011803661473095417, -0.06355240195989609, -0.06927496194839478, -0.012345385737717152, -0.045258741825819016, -0.11290279775857925, -0.05234217643737793, 0.0023274263367056847, 0.11715440452098846, 0.014219503849744797, -0.1829061210155487, -0.0866665467619896, -0.08274506032466888, 0.04966271296143532, -0.17816786468029022, -0.11001961678266525, 0.04274508357048035, -0.19324088096618652, -0.13257916271686554, -0.029907122254371643, -0.007916318252682686, 0.030347129330039024, 0.07917989790439606, -0.07472268491983414, 0.03647748380899429, -0.1447521299123764, -0.022673100233078003, -0.17068152129650116, -0.07028651982545853, 0.10832113772630692, -0.16268663108348846, -0.05635131895542145, -0.113202765583992, -0.10504431277513504, -0.09814799576997757, -0.04356590285897255, 0.08163999021053314, -0.1620001196861267, -0.1259327381849289, -0.003063245676457882, -0.13546112179756165, 0.048620760440826416, 0.13420289754867554, 0.020272331312298775, 0.0022147251293063164, -0.08230676501989365, -0.05923657491803169, -0.03203415498137474, 0.019369782879948616, 0.16108174622058868, -0.019948678091168404, -0.15429005026817322, -0.16601063311100006, 0.04448185861110687, 0.037501730024814606, 0.10785138607025146, -1.110978610086022e-05, -0.014895450323820114, -0.07583305239677429, 0.07230856269598007, 0.04896416887640953, 0.04730740934610367, 0.041303008794784546, -0.1049494668841362, 0.01921733468770981, 0.11464545130729675, -0.08297689259052277, 0.08766258507966995, -0.01955464668571949, 0.008531671017408371, -0.0620487704873085, -0.0037402729503810406, -0.0062614320777356625, 0.033538833260536194, 0.06880414485931396, 0.021327197551727295, -0.11581188440322876, -0.04236910492181778, -0.0774102658033371, 0.11152908951044083, -0.059922803193330765, 0.027291718870401382, -0.03827323019504547, -0.12238093465566635, 0.18771646916866302, -0.07087697833776474, -0.062300167977809906, 0.12385489791631699, -0.03135457634925842, -0.12771423161029816, -0.07817235589027405, -0.03158347308635712, -0.17769229412078857, -0.19707785546779633, -0.12695693969726562, -0.04952887445688248, -0.12535707652568817, -0.11989983916282654, 0.011981700547039509, 0.06320986151695251, -0.036231812089681625, 0.010163374245166779, -0.07556325197219849, -0.10860888659954071, -0.011727496050298214, -0.1010347530245781, 0.022970080375671387, -0.028316643089056015, 0.031096165999770164, -0.12363944947719574, -0.08960928022861481, -0.024608870968222618, 0.006715888623148203, -0.02487729676067829, -0.20839694142341614, -0.009933887980878353, -0.027495605871081352, -0.027779754251241684, 0.005217712838202715, -0.10874052345752716, -0.0771704763174057, 0.10829021781682968, 0.07705271989107132, -0.11495140194892883, -0.2214517891407013, -0.029456429183483124, 0.012043336406350136, 0.09330486506223679, 0.026866378262639046, 0.001577175920829177, -0.11587291210889816, 0.11618130654096603, -0.0005824873805977404, -0.18390506505966187, -0.03543306887149811, -0.10889065265655518, 0.043087370693683624, 0.053894102573394775, -0.12524612247943878, -0.11089427024126053, -0.19063854217529297, 0.07921148091554642, -0.04627923667430878, -0.036238159984350204, 0.16576752066612244, 0.08310313522815704, 0.10291409492492676, -0.025182358920574188, 0.005158526357263327, -0.13280166685581207, -0.06570987403392792, -0.09898239374160767, -0.05458281934261322, 0.10040751099586487, -0.07336483895778656, -0.09145786613225937, -0.1478549689054489, -0.04733962193131447, 0.14932988584041595, 0.0892263799905777, -0.15364687144756317, 0.044221583753824234, 0.19150179624557495, 0.021215569227933884, 0.001874192152172327, 0.03447479009628296, 0.024820130318403244, -0.05805788189172745, -0.13203537464141846, -0.03951196372509003, 0.08778969943523407, 0.03851354494690895, 0.08562211692333221, -0.14240892231464386, -0.2063976526260376, 0.006809215992689133, -0.08112294971942902, -0.12893830239772797, -0.03374693915247917, 0.034300435334444046, -0.17965158820152283, 0.021672537550330162, -0.16563360393047333, 0.1541711986064911, -0.048767779022455215, -0.16625042259693146, 0.11916831880807877, -0.1874721348285675, -0.006712323520332575, 0.09317883104085922, 0.04160694405436516, -0.03744986653327942, 0.0970105230808258, -0.08970186859369278, 0.0691678375005722, 0.06302168220281601, -0.03704257681965828, 0.14368128776550293, 0.061086177825927734, -0.09309994429349899, -0.03978610038757324, 0.004638419020920992, -0.027291439473628998, -0.05319918319582939, 0.10433556884527206, 0.07895220816135406, 0.007572420872747898, -0.23086071014404297, -0.01811719499528408, 0.004825131967663765, -0.033206116408109665, -0.14354334771633148, 0.002532094717025757, -0.057253796607255936, -0.12626348435878754, 0.09688450396060944, 0.09797603636980057, -0.09060227870941162, -0.10770194232463837, -0.019359294325113297, -0.10416654497385025, 0.0075421822257339954, -0.08269823342561722, -0.05887468531727791, -0.04597177356481552, 0.06331617385149002, 0.048760786652565, -0.07269743829965591, -0.17029184103012085, 0.09095855057239532, 0.13287870585918427, -0.010227641090750694, -0.10736912488937378, 0.025949807837605476, -0.0018809239845722914, -0.053302280604839325, -0.03549424931406975, -0.06177663803100586, 0.17165306210517883, -0.14383932948112488, -0.0869370847940445, 0.08655896782875061, -0.13552865386009216, -0.008173291571438313, -0.17330530285835266, -0.18665148317813873, -0.05193735286593437, 0.044138312339782715, -0.04100814089179039, 0.07035398483276367, -0.09007023274898529, -0.039535876363515854, -0.1944548338651657, 0.03923898935317993, -0.06821197271347046, -0.11010400205850601, 0.048795588314533234, -0.17207492887973785, -0.030846020206809044, -0.024974655359983444, 0.030440714210271835, 0.09565409272909164, 0.029468625783920288, -0.10601754486560822, -0.007534850854426622, 0.011974678374826908, 0.049318667501211166, -0.10429346561431885, 0.17166590690612793, -0.11194384843111038, -0.14635725319385529, -0.04087505489587784, -0.1361706703901291, -0.02583468146622181, -0.14222504198551178, 0.12542226910591125, -0.02244892716407776, -0.22357653081417084, -0.07493368536233902, -0.0996386930346489, -0.0716036781668663, -0.01674029231071472, -0.0581655278801918, -0.009845878928899765, -0.12443047016859055, 0.03760430961847305, -0.12055496126413345, 0.03692729026079178, 0.08201470226049423, 0.07746268063783646, 0.14392240345478058, 0.036420855671167374, -0.14387324452400208, 0.01736600138247013, 0.05538196489214897, -0.031247973442077637, 0.04919573292136192, -0.16746382415294647, -0.16536399722099304, -0.033378180116415024, 0.11115765571594238, 0.15208424627780914, -0.06010203808546066, 0.08441147208213806, -0.19467587769031525, -0.14007657766342163, 0.02887524478137493, 0.11803396791219711, 0.0370045080780983, 0.10004470497369766, -0.03868989273905754, 0.01904713734984398, -0.017232386395335197, 0.12329786270856857, 0.03912137821316719, 0.058668382465839386, 0.013971680775284767, -0.06776811182498932, -0.01594202220439911, -0.016468530520796776, 0.025977693498134613, -0.03456515073776245, -0.1474447399377823, -0.03620104491710663, -0.041546955704689026, -0.16284973919391632, 0.09221302717924118, -0.13103416562080383, -0.21811595559120178, 0.08382249623537064, -0.06330149620771408, -0.03603719547390938, -0.014725183136761189, 0.10063754767179489, -0.06648479402065277, -0.038748521357774734, -0.17389893531799316, -0.07421079277992249, -0.08902467787265778, -0.027162831276655197, -0.03035035915672779, 0.08369263261556625, 0.20076531171798706, 0.06684976071119308, 0.1018676906824112, -0.2208576798439026, -0.09252449125051498, -0.008749693632125854, -0.1365826427936554, -0.15030212700366974, -0.09394194930791855, 0.026881840080022812, -0.08420457690954208, 0.08283842355012894, -0.15631452202796936, 0.041711948812007904, -0.017338143661618233, -0.01874297298491001, 0.10355935245752335, 0.03232091665267944, 0.021628350019454956, -0.19636523723602295, 0.003422608133405447, -0.051670677959918976, -0.03297615423798561, -0.11285299807786942, 0.008879348635673523, -0.016100745648145676, -0.09143490344285965, 0.06587435305118561, -0.06423954665660858, 0.07312153279781342, -0.08276642858982086, 0.09113958477973938, -0.18755227327346802, -0.026530925184488297, 0.06421037018299103, -0.017905807122588158, -0.08379173278808594, 0.051871463656425476, -0.09280731528997421, 0.0005717385793104768, -0.10919742286205292, -0.12222728878259659, -0.027283918112516403, -0.062037013471126556, -0.06913439184427261, 0.04328785836696625, -0.09791484475135803, -0.12811307609081268, 0.09283963590860367, -0.06249988079071045, -0.04921748861670494, 0.06538841873407364, -0.02082422934472561, 0.02180499956011772, 0.14834469556808472, 0.11349336057901382, 0.06269188225269318, 0.015191690996289253, -0.045080892741680145, -0.08265279233455658, 0.011805146932601929, -0.007868007756769657, 0.02682894468307495, -0.0722857341170311, -0.10507890582084656, -0.0028364507015794516, -0.06291841715574265, -0.20680944621562958, 0.02772746980190277, 0.1622796505689621, -0.010967768728733063, -0.020242605358362198, 0.09317167103290558, 0.14651860296726227, 0.002780812792479992, 0.04509180039167404, 0.1374865174293518, -0.04882881045341492, 0.07078525424003601, -0.21671539545059204, 0.036681268364191055, -0.1022174283862114, -0.18197721242904663, 0.009281115606427193, -0.15830223262310028, -0.1902623474597931, 0.025693953037261963, 0.05910872295498848, 0.011328039690852165, -0.014999013394117355, 0.13027483224868774, -0.08403084427118301, -0.1354631930589676, 0.08149804174900055, -0.1839314103126526, -0.12548516690731049, -0.016561489552259445, 0.07034371793270111, -0.10251064598560333, 0.04848421365022659, -0.07205741852521896, -0.12479174882173538, -0.029523389413952827, -0.008882461115717888, 0.09558867663145065, -0.07944615930318832, 0.14258034527301788, 0.05609705671668053, -0.050481293350458145, -0.10852674394845963, 0.11798696964979172, 0.0012458357959985733, -0.01835254579782486, -0.09141802787780762, 0.0672646313905716, 0.009869868867099285, -0.002665609121322632, -0.04783487692475319, 0.04737318679690361, -0.05947801470756531, -0.060561321675777435, 0.0808091014623642, 0.1119491457939148, 0.10347536206245422, 0.05014340206980705, -0.02276746742427349, 0.010806551203131676, -0.09406571835279465, -0.09365733712911606, -0.02927987091243267, -0.044665008783340454, -0.011717035435140133, -0.030010920017957687, -0.006711460184305906, -0.1858510673046112, -0.2023571878671646, -0.04238177090883255, 0.05145836994051933, -0.052633725106716156, -0.005490818526595831, -0.18210378289222717, -0.10637401044368744, -0.02633388713002205, -0.10801854729652405, -0.06336567550897598, -0.07665372639894485, 0.06935960054397583, 0.07602209597826004, -0.11465300619602203, 0.06106124073266983, 0.0070571391843259335, 0.13742496073246002, 0.05630148574709892, 0.025460554286837578, -0.05992184579372406, 0.0595557875931263, -0.06849110126495361, -0.19881823658943176, -0.004167914390563965, -0.06505709886550903, 0.00927941408008337, -0.13405698537826538, 0.0008673691772855818, -0.05719166249036789, -0.11224275827407837, 0.10295867919921875, -0.10667946189641953, -0.09569456428289413, -0.059469595551490784, 0.004795421846210957, -0.19574497640132904, -0.08125203847885132, -0.11147025972604752, -0.02709297463297844, -0.04238814860582352, 0.09519129246473312, -0.051795344799757004, -0.18554241955280304, -0.049056701362133026, -0.11471156775951385, -0.1755918264389038, 0.08347596228122711, 0.08095318078994751, -0.06523466855287552, -0.19638310372829437, -0.05178924649953842, -0.08175435662269592, 0.016216272488236427, -0.13720323145389557, 0.10173045098781586, -0.08306420594453812, 0.15991011261940002, -0.08182964473962784, 0.1050986647605896, -0.07451684772968292, -0.0625503659248352, -0.2018769234418869, 0.15091019868850708, 0.10104253888130188, 0.024251095950603485, 0.0022491745185106993, 0.09482631832361221, -0.06959335505962372, -0.09793516993522644, -0.037006936967372894, 0.036229077726602554, -0.049326445907354355, -0.1839207261800766, 0.012458231300115585, 0.0969548225402832, -0.006766051519662142, -0.08624455332756042, 0.1789478212594986, -0.01565525121986866, -0.021719615906476974, -0.015264786779880524, -0.025387641042470932, -0.015658171847462654, 0.0026560111436992884, -0.09955424815416336, -0.09995073080062866, -0.0088978735730052, -0.1397593915462494, 0.026980586349964142, 0.027863910421729088, -0.08181815594434738, -0.1699773073196411, 0.11914078146219254, 0.16669489443302155, -0.026134436950087547, 0.05558367446064949, -0.013685096986591816, -0.026942726224660873, 0.013017028570175171, 0.0630907192826271, 0.081523597240448, -0.009317634627223015, -0.09198588877916336, -0.02923952415585518, 0.18557587265968323, -0.01565573178231716, 0.1205320805311203, -0.006562109105288982, -0.030865587294101715, 0.013767387717962265, -0.09482372552156448, -0.12869785726070404, -0.16175250709056854, -0.10501894354820251, -0.04275971278548241, 0.009981991723179817, 0.000996419694274664, -0.01170317456126213, -0.032562341541051865, -0.13417494297027588, 0.028548387810587883, 0.10951431095600128, -0.02028166875243187, -0.11829495429992676, -0.08065460622310638, -0.05299763008952141, -0.02085651271045208, 0.05754512548446655, -0.21065840125083923, 0.1357608139514923, -0.08659953624010086, -0.031784772872924805, 0.10685205459594727, -0.15639637410640717, -0.016733640804886818, 0.03582671284675598, -0.035891491919755936, -0.2097359299659729, -0.04084903001785278, 0.10705672949552536, -0.18262790143489838, 0.07208411395549774, -0.07320922613143921, -0.1706492304801941, -0.01707085594534874, 0.03867332637310028, 0.01104766596108675, 0.03483814746141434, -0.09822066873311996, 0.0018547363579273224, -0.11121739447116852, 0.04431673511862755, -0.041652340441942215, -0.07256419211626053, -0.021434111520648003, -0.039611052721738815, 0.004640830680727959, -0.06726958602666855, 0.0034429109655320644, 0.03681357949972153, -0.18686610460281372, 0.0014963940484449267, -0.006380792707204819, -0.00900032464414835, -0.05466544255614281, 0.16198082268238068, 0.024065561592578888, 0.0870218351483345, 0.05011088401079178, -0.06307301670312881, 9.98190080281347e-06, -0.09043937176465988, 0.17306776344776154, -0.15652793645858765, 0.030507013201713562, -0.06408519297838211, 0.08201643079519272, 0.1581440567970276, -0.15325675904750824, -0.025041488930583, -0.06897950172424316, -0.07625948637723923, -0.1351315975189209, -0.1383247673511505, 0.04874783009290695, 0.06590951234102249, -0.0039051843341439962, 0.005767768248915672, 0.08544699847698212, 0.014377515763044357, -0.12202917039394379, 0.026483317837119102, -0.09011100232601166, 0.07898569107055664, -0.10308075696229935, -0.11413616687059402, 0.0560690313577652, 0.01952209323644638, -0.05417447164654732, 0.019107088446617126, -0.048758819699287415, -0.09027883410453796, 0.12167505919933319, -0.12803001701831818, -0.1193796768784523, 0.028654249384999275, -0.009316633455455303, -0.11733148992061615, -0.10712185502052307, -0.23205460608005524, -0.11546887457370758, -0.1179405078291893, -0.042138561606407166, 0.07592117786407471, 0.04041418805718422, -0.19983330368995667, -0.10335163027048111, 0.15212465822696686, -0.04181952029466629, -0.03456953167915344, 0.04399297758936882, -0.09593066573143005, -0.0289034191519022, 0.045069579035043716, -0.04328809306025505, -0.03371424600481987, -0.11069083213806152, -0.023058896884322166, 0.006604233756661415, -0.01981942169368267, 0.05171319097280502, -0.16309569776058197, -0.06674834340810776, -0.01021519023925066, 0.1909092664718628, -0.05575551837682724, 0.0015594138531014323, -0.0013680510455742478, 0.02554180473089218, 0.09461086988449097, 0.0465334989130497, -0.07909079641103745, 0.032074034214019775, 0.050486139953136444, -0.10833210498094559, -0.00952006783336401, 0.054217129945755005, -0.04317076876759529, -0.07676005363464355, 0.010976176708936691, 0.1238539069890976, 0.055995967239141464, -0.043518535792827606, -0.08479152619838715, -0.18771156668663025, -0.16464634239673615, 0.06630560010671616, -0.018504247069358826, -0.07666679471731186, -0.06438090652227402, -0.019596092402935028, -0.019110018387436867, -0.03995154798030853, -0.06572587043046951, -0.17460918426513672, -0.013803763315081596, 0.12217571586370468, -0.08849775046110153, 0.10607842355966568, -0.2443235218524933, 0.039177097380161285, -0.095128633081913, 0.1537603884935379, -0.07618799060583115, 0.0439162403345108, 0.045873917639255524, 0.13318577408790588, 0.07711365073919296, -0.029327666386961937, -0.02270926535129547, 0.013465172611176968, 0.0713958591222763, -0.0733705684542656, -0.18604466319084167, -0.10746362805366516, -0.203301340341568, 0.027248140424489975, 0.0664692297577858, -0.01815810427069664, 0.10305880010128021, 0.0036096712574362755, 0.007596002891659737, 0.09517687559127808, 0.01502657774835825, 0.07897205650806427, 0.013579239137470722, -0.03350996971130371, -0.0655604749917984, -0.11811627447605133, 0.10499164462089539, 0.024241596460342407, 0.034041877835989, 0.09132255613803864, -0.027153031900525093, -0.10045082867145538, 0.11588764190673828, -0.11897159367799759, -0.1291646808385849, -0.0323059968650341, 0.030341625213623047, 0.028451768681406975, -0.08264132589101791, 0.0024085601326078176, -0.07162091881036758, 0.09686055779457092, 0.009381614625453949, -0.07411187887191772, -0.06834443658590317, 0.023327786475419998, -0.15114672482013702, -0.027125373482704163, -0.11979854851961136, -0.147525355219841, -0.03831230849027634, -0.15022513270378113, -0.05503858998417854, -0.17648540437221527, -0.1005624532699585, -0.037555526942014694, 0.008430060930550098, 0.0064668734557926655, -0.033472590148448944, -0.16149473190307617, 0.006995340809226036, -0.12341144680976868, -0.15663059055805206, -0.16333161294460297, -0.08083172887563705, 0.04254563897848129, 0.008072301745414734, 0.07522478699684143, 0.029470408335328102, -0.03375287726521492, -0.011046258732676506, -0.182152658700943, -0.00971970334649086, 0.012097731232643127, -0.10295011103153229, 0.03956485539674759, 0.050420574843883514, 0.12246394157409668, 0.008435101248323917, 0.09290296584367752, 0.04582015797495842, -0.06161726638674736, -0.11302834749221802, -0.05091146007180214, -0.0443534329533577, -0.07591444253921509, -0.08295506983995438, -0.07925624400377274, 0.024364376440644264, 0.1504552811384201, -0.032941099256277084, -0.0476217083632946, -0.07430572807788849, -0.08527839183807373, -0.08304042369127274, 0.01144036091864109, -0.11667262017726898, 0.0909351333975792, -0.004096629563719034, 0.09085775911808014, 0.000631687231361866, 0.006787691731005907, 0.11653584241867065, -0.13160540163516998, 0.007917544804513454, -0.011560522951185703, -0.1463339626789093, -0.09196944534778595, -0.15808911621570587, 0.12387131154537201, -0.15526454150676727, 0.1400132179260254, -0.04407850280404091, -0.024465814232826233, 0.003500299761071801, -0.15996454656124115, 0.04974736273288727, 0.058291662484407425, 0.09003625065088272, 0.1172584518790245, -0.09515830874443054, 0.04897862300276756, -0.11080951243638992, -0.03552938252687454, 0.051730625331401825, -0.08029724657535553, 0.048714350908994675, -0.16643355786800385, -0.18483687937259674, -0.07022182643413544, -0.10729911178350449, -0.08739227801561356, -0.06586059182882309, -0.16228176653385162, 0.08369975537061691, -0.17347238957881927, -0.139584481716156, -0.06986234337091446, -0.09992071986198425, -0.1555572897195816, 0.08894374966621399, -0.054266925901174545, 0.00557386688888073, 0.06056095287203789, -0.009703653864562511, 0.07225975394248962, -0.07951395958662033, -0.007817991077899933, 0.03427407145500183, -0.02768608182668686, -0.04280136153101921, -0.07959435880184174, 0.018703747540712357, 0.08947791904211044, 0.12436840683221817, 0.06409700959920883, -0.005866909399628639, -0.1082361713051796, -0.12972718477249146, -0.12791769206523895, 0.09814774990081787, -0.19844485819339752, -0.059710919857025146, -0.057880498468875885, 0.09439828991889954, -0.02611820213496685, 0.032949622720479965, -0.14382971823215485, -0.09635338932275772, -0.18578900396823883, -0.1178082525730133, 0.10084910690784454, -0.13308106362819672, -0.08125364780426025, -0.06743818521499634, -0.10200877487659454, -0.0016168721485882998, -0.01032173540443182, -0.04434579983353615, -0.033919114619493484, 0.09283726662397385, -0.15632010996341705, -0.10275454819202423, 0.12172022461891174, -0.006257725413888693, 0.06776340305805206, -0.06784215569496155, -0.07496291399002075, -0.14393602311611176, 0.05204739421606064, -0.09347589313983917, -0.05851583927869797, -0.09467685967683792, 0.0880105122923851, -0.05790405347943306, -0.15498152375221252, -0.02054663747549057, -0.05190572515130043, 0.051949113607406616, -0.08679129928350449, -0.018631599843502045, -0.07647032290697098, 0.023805882781744003, -0.1948181390762329, 0.10738784074783325, -0.06477218121290207, -0.10230709612369537, 0.1519855111837387, -0.11892472207546234, -0.010567428544163704, -0.01878543011844158, 0.11155437678098679, 0.08134562522172928, 0.027657780796289444, -0.1081775575876236, 0.06890616565942764, -0.03675764799118042, -0.043027643114328384, 0.145949587225914, 0.1033926010131836, 0.0413358137011528, 0.1680525243282318, 0.14519977569580078, -0.001106210402213037, -0.021717196330428123, 0.14257287979125977, 0.04070592671632767, -0.01457920204848051, -0.11888933926820755, -0.20305772125720978, 0.013711672276258469, -0.06572610139846802, -0.15589205920696259, -0.01688293367624283, 0.05382546782493591, 0.036145154386758804, -0.1392892301082611, 0.014386028982698917, -0.21586444973945618, 0.06703849136829376, -0.1574627161026001, 0.1334356963634491, 0.15637537837028503, -0.05276687070727348, 0.12055759131908417, -0.00568980211392045, 0.09085849672555923, -0.008909675292670727, -0.026834089308977127, 0.1420205533504486, -0.055666908621788025, 0.003039100905880332, -0.21433642506599426, -0.051507387310266495, -0.18725238740444183, -0.03961622714996338, 0.06648863106966019, -0.025352653115987778, 0.018253745511174202, -0.03126673400402069, -0.16734562814235687, 0.08776415139436722, -0.07094337046146393, -0.10443379729986191, -0.04761176556348801, -0.22663664817810059, -0.06872387230396271, -0.09477421641349792, -0.04295797646045685, -0.20594917237758636, -0.12760910391807556, -0.02636084146797657, 0.1229517012834549, 0.009883210062980652, -0.19974225759506226, -0.10614404082298279, -0.07516421377658844, -0.12664544582366943, 0.1636704057455063, -0.021379495039582253, -0.024869920685887337, -0.06893430650234222, -0.06680907309055328, -0.06002071127295494, -0.05226924270391464, 0.058400046080350876, -0.03288491815328598, -0.10685815662145615, -0.007970469072461128, 0.03988901525735855, 0.036722902208566666, -0.05878209322690964, -0.13994991779327393, -0.008430679328739643, -0.07321757078170776, 0.04339300096035004, -0.13690611720085144, -0.011805982328951359, -0.018735423684120178, 0.08466266840696335};
-
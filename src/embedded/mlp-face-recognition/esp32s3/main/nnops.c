@@ -1,6 +1,7 @@
 #include <math.h>
 #include <nnops.h>
 #include <stdint.h>
+#include <string.h>
 #include <esp_dsp.h>
 
 float mac(const float *x, const float *y, int size) {
@@ -12,43 +13,394 @@ float mac(const float *x, const float *y, int size) {
     return acc;
 }
 
-int16_t mac8(const int8_t *x, const int8_t *y, int size) {
-    int16_t acc = 0;
+int32_t mac8(const int8_t *x, const int8_t *y, int size) {
+    int32_t acc = 0;
 
     for (int i = 0; i < size; i++)
-        acc += (((int16_t)x[i] * (int16_t)y[i]));
+        acc += (((int32_t)x[i] * (int32_t)y[i]));
 
     return acc;
 }
 
-void mvm(const float *M, const float *v, float *out, int nrows, int ncols) {
+// Four dot products against the same weight row, so each weight is
+// loaded once and reused by every sample in the group.
+static void mac_x4(const float *w, const float *x, int ldx, float *acc, int size) {
+    float acc0 = 0.0, acc1 = 0.0, acc2 = 0.0, acc3 = 0.0;
+
+    for (int i = 0; i < size; i++) {
+        float wi = w[i];
+        acc0 += (wi * x[i]);
+        acc1 += (wi * x[ldx + i]);
+        acc2 += (wi * x[2*ldx + i]);
+        acc3 += (wi * x[3*ldx + i]);
+    }
+
+    acc[0] = acc0;
+    acc[1] = acc1;
+    acc[2] = acc2;
+    acc[3] = acc3;
+}
+
+static inline int32_t requantize(int32_t acc, const struct requant *rq) {
+    int total_shift = 31 - rq->shift;
+    int32_t out;
+
+    out = (int32_t)(((int64_t)acc * rq->multiplier + (1LL << (total_shift - 1))) >> total_shift);
+    out += rq->zero;
+
+    if (out < rq->min)
+        return rq->min;
+    if (out > rq->max)
+        return rq->max;
+    return out;
+}
+
+static int32_t mac8_zero(const int8_t *w, const int8_t *x, int8_t x_zero, int size) {
+    int32_t acc = 0;
+
+    for (int i = 0; i < size; i++)
+        acc += ((int32_t)w[i] * ((int32_t)x[i] - x_zero));
+
+    return acc;
+}
+
+static void mac8_zero_x4(const int8_t *w, const int8_t *x, int ldx, int8_t x_zero, int32_t *acc, int size) {
+    int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+
+    for (int i = 0; i < size; i++) {
+        int32_t wi = w[i];
+        acc0 += (wi * ((int32_t)x[i] - x_zero));
+        acc1 += (wi * ((int32_t)x[ldx + i] - x_zero));
+        acc2 += (wi * ((int32_t)x[2*ldx + i] - x_zero));
+        acc3 += (wi * ((int32_t)x[3*ldx + i] - x_zero));
+    }
+
+    acc[0] = acc0;
+    acc[1] = acc1;
+    acc[2] = acc2;
+    acc[3] = acc3;
+}
+
+void mvm(const float *M, const float *bias, const float *v, float *out, int nrows, int ncols) {
     int row;
 
     for (row = 0; row < nrows; row++)
-        out[row] = mac(&M[row*ncols], v, ncols);
+        out[row] = bias[row] + mac(&M[row*ncols], v, ncols);
 }
 
-void mvmx(const float *M, const float *v, float *out, int nrows, int ncols) {
+void mvmx(const float *M, const float *bias, const float *v, float *out, int nrows, int ncols) {
+    float dot;
     int row;
 
-    for (row = 0; row < nrows; row++)
-        dsps_dotprod_f32_aes3(&M[row*ncols], v, &out[row], ncols);
+    for (row = 0; row < nrows; row++) {
+        dsps_dotprod_f32_aes3(&M[row*ncols], v, &dot, ncols);
+        out[row] = bias[row] + dot;
+    }
+}
+
+void mvm8(const int8_t *M, const int32_t *bias, const int8_t *v, int32_t *out, int8_t v_zero, int nrows, int ncols) {
+    int stride = STRIDE8(ncols);
+
+    for (int row = 0; row < nrows; row++)
+        out[row] = bias[row] + mac8_zero(&M[row*stride], v, v_zero, ncols);
+}
+
+void mmm(const float *M, const float *bias, const float *V, float *out, int nrows, int ncols, int nbatch) {
+    float acc[4];
+    int row, b;
+
+    for (row = 0; row < nrows; row++) {
+        for (b = 0; b + 4 <= nbatch; b += 4) {
+            mac_x4(&M[row*ncols], &V[b*ncols], ncols, acc, ncols);
+            for (int i = 0; i < 4; i++)
+                out[(b+i)*nrows + row] = bias[row] + acc[i];
+        }
+
+        for (; b < nbatch; b++)
+            out[b*nrows + row] = bias[row] + mac(&M[row*ncols], &V[b*ncols], ncols);
+    }
+}
+
+void mmmx(const float *M, const float *bias, const float *V, float *out, int nrows, int ncols, int nbatch) {
+    float dot;
+    int row, b;
+
+    // the weight row stays in cache while it is swept across the batch
+    for (row = 0; row < nrows; row++) {
+        for (b = 0; b < nbatch; b++) {
+            dsps_dotprod_f32_aes3(&M[row*ncols], &V[b*ncols], &dot, ncols);
+            out[b*nrows + row] = bias[row] + dot;
+        }
+    }
+}
+
+void mmm8(const int8_t *M, const int32_t *bias, const int8_t *V, int32_t *out, int8_t v_zero, int nrows, int ncols, int nbatch) {
+    int32_t acc[4];
+    int stride = STRIDE8(ncols);
+    int row, b;
+
+    for (row = 0; row < nrows; row++) {
+        for (b = 0; b + 4 <= nbatch; b += 4) {
+            mac8_zero_x4(&M[row*stride], &V[b*ncols], ncols, v_zero, acc, ncols);
+            for (int i = 0; i < 4; i++)
+                out[(b+i)*nrows + row] = bias[row] + acc[i];
+        }
+
+        for (; b < nbatch; b++)
+            out[b*nrows + row] = bias[row] + mac8_zero(&M[row*stride], &V[b*ncols], v_zero, ncols);
+    }
+}
+
+// Folds the input zero point into the bias: sum(w * (v - zero)) + bias
+// == sum(w * v) + (bias - zero * sum(w)), so the vector kernel can
+// multiply raw int8 activations.
+void fold_zero8(const int8_t *M, const int32_t *bias, int8_t v_zero, int32_t *out, int nrows, int ncols) {
+    int stride = STRIDE8(ncols);
+
+    for (int row = 0; row < nrows; row++) {
+        int32_t sum = 0;
+        for (int col = 0; col < ncols; col++)
+            sum += M[row*stride + col];
+        out[row] = bias[row] - v_zero * sum;
+    }
+}
+
+void mvm8x(const int8_t *M, const int32_t *bias, const int8_t *v, int32_t *out, int nrows, int ncols) {
+    for (int row = 0; row < nrows; row++)
+        out[row] = bias[row];
+
+    mvm8x_acc(M, v, out, nrows, ncols);
+}
+
+void mvm8x_acc(const int8_t *M, const int8_t *v, int32_t *out, int nrows, int ncols) {
+    int stride = STRIDE8(ncols);
+    int8_t vbuf[(ncols + MVM8X_CHUNK - 1) / MVM8X_CHUNK * MVM8X_CHUNK] __attribute__((aligned(16)));
+
+    // aligned copy of v, zero-padded like the weight rows
+    memcpy(vbuf, v, ncols);
+    memset(&vbuf[ncols], 0, sizeof(vbuf) - ncols);
+
+    // one chunk of v stays in vector registers while every row passes
+    for (int col = 0; col < stride; col += MVM8X_CHUNK) {
+        int nvec = (stride - col) / 16;
+        mvm8_rows_aes3(&M[col], stride, &vbuf[col], out, nrows, nvec < MVM8X_CHUNK/16 ? nvec : MVM8X_CHUNK/16);
+    }
+}
+
+// Groups of up to four samples share each pass over M: a chunk of a
+// weight row stays in vector registers while the group's samples pass
+// under it, so every weight is read once per group, as in mac8_zero_x4.
+void mmm8x(const int8_t *M, const int32_t *bias, const int8_t *V, int32_t *out, int nrows, int ncols, int nbatch) {
+    int stride = STRIDE8(ncols);
+    int8_t vbuf[4*stride] __attribute__((aligned(16)));
+    int8_t wbuf[MVM8X_CHUNK] __attribute__((aligned(16)));
+    int32_t acc[4];
+
+    for (int b = 0; b < nbatch; b += 4) {
+        int n = nbatch - b < 4 ? nbatch - b : 4;
+
+        // aligned copies of the samples, zero-padded like the weight rows
+        memset(vbuf, 0, n*stride);
+        for (int i = 0; i < n; i++)
+            memcpy(&vbuf[i*stride], &V[(b+i)*ncols], ncols);
+
+        for (int row = 0; row < nrows; row++) {
+            const int8_t *w = &M[row*stride];
+
+            for (int i = 0; i < n; i++)
+                acc[i] = bias[row];
+
+            for (int col = 0; col < stride; col += MVM8X_CHUNK) {
+                int nvec = (stride - col) / 16;
+
+                // the kernel loads a whole chunk, which a short last one
+                // of the row would take from past its end
+                if (nvec < MVM8X_CHUNK/16) {
+                    memset(wbuf, 0, sizeof(wbuf));
+                    memcpy(wbuf, &w[col], stride - col);
+                    mvm8_rows_aes3(&vbuf[col], stride, wbuf, acc, n, nvec);
+                } else {
+                    mvm8_rows_aes3(&vbuf[col], stride, &w[col], acc, n, MVM8X_CHUNK/16);
+                }
+            }
+
+            for (int i = 0; i < n; i++)
+                out[(b+i)*nrows + row] = acc[i];
+        }
+    }
+}
+
+void mvm_bsr(const struct bsr *M, const float *bias, const float *v, float *out, int nrows, int ncols) {
+    const float *values = M->values;
+
+    for (int row = 0; row < nrows; row++) {
+        float acc = 0.0;
+
+        // in column order, so the sum is mvm's with the zeros skipped
+        for (int i = M->rows[row]; i < M->rows[row + 1]; i++) {
+            const float *w = &values[i*BSR_BLOCK];
+            const float *x = &v[M->cols[i]];
+            int n = ncols - M->cols[i];
+
+            // the last block may reach past v
+            if (n >= BSR_BLOCK) {
+                for (int c = 0; c < BSR_BLOCK; c++)
+                    acc += (w[c] * x[c]);
+            } else {
+                for (int c = 0; c < n; c++)
+                    acc += (w[c] * x[c]);
+            }
+        }
+
+        out[row] = bias[row] + acc;
+    }
+}
+
+void fold_zero8_bsr(const struct bsr *M, const int32_t *bias, int8_t v_zero, int32_t *out, int nrows) {
+    const int8_t *values = M->values;
+
+    for (int row = 0; row < nrows; row++) {
+        int32_t sum = 0;
+        for (int i = M->rows[row]*BSR_BLOCK; i < M->rows[row + 1]*BSR_BLOCK; i++)
+            sum += values[i];
+        out[row] = bias[row] - v_zero * sum;
+    }
+}
+
+void mvm8_bsr(const struct bsr *M, const int32_t *bias, const int8_t *v, int32_t *out, int8_t v_zero, int nrows, int ncols) {
+    const int8_t *values = M->values;
+    int tail = ncols - ncols % BSR_BLOCK;
+
+    for (int row = 0; row < nrows; row++) {
+        int i = M->rows[row], end = M->rows[row + 1];
+        int32_t acc = 0;
+
+        // blocks are in column order, so only the last one can stop short
+        // of BSR_BLOCK columns
+        if (end > i && M->cols[end - 1] == tail) {
+            end--;
+            acc = mac8_zero(&values[end*BSR_BLOCK], &v[tail], v_zero, ncols - tail);
+        }
+
+        for (; i < end; i++) {
+            const int8_t *w = &values[i*BSR_BLOCK];
+            const int8_t *x = &v[M->cols[i]];
+
+            // kept a loop: gcc vectorizes it better than its full unroll
+#pragma GCC unroll 1
+            for (int c = 0; c < BSR_BLOCK; c++)
+                acc += ((int32_t)w[c] * ((int32_t)x[c] - v_zero));
+        }
+
+        out[row] = bias[row] + acc;
+    }
+}
+
+void mvm8x_bsr(const struct bsr *M, const int32_t *bias, const int8_t *v, int32_t *out, int nrows, int ncols) {
+    const int8_t *values = M->values;
+    int first = M->rows[0];
+    int8_t vbuf[STRIDE8(ncols)] __attribute__((aligned(16)));
+
+    // aligned copy of v, zero-padded to the end of the last block
+    memcpy(vbuf, v, ncols);
+    memset(&vbuf[ncols], 0, sizeof(vbuf) - ncols);
+
+    for (int row = 0; row < nrows; row++)
+        out[row] = bias[row];
+
+    mvm8_bsr_aes3(&values[first*BSR_BLOCK], M->rows, &M->cols[first], vbuf, out, nrows);
+}
+
+// sign-extended int4 weight of column col of a packed row
+static inline int32_t nibble(const uint8_t *w, int col) {
+    return (int32_t)((uint32_t)w[col/2] << (col % 2 ? 24 : 28)) >> 28;
+}
+
+static int32_t mac4(const uint8_t *w, const int8_t *x, int size) {
+    const uint32_t *words = (const uint32_t *)w;
+    int32_t acc = 0;
+    int col;
+
+    // column col + i sits in bits 4i..4i+3 of a little-endian word
+    for (col = 0; col + 8 <= size; col += 8) {
+        uint32_t word = *words++;
+
+        acc += ((int32_t)(word << 28) >> 28) * x[col];
+        acc += ((int32_t)(word << 24) >> 28) * x[col + 1];
+        acc += ((int32_t)(word << 20) >> 28) * x[col + 2];
+        acc += ((int32_t)(word << 16) >> 28) * x[col + 3];
+        acc += ((int32_t)(word << 12) >> 28) * x[col + 4];
+        acc += ((int32_t)(word << 8) >> 28) * x[col + 5];
+        acc += ((int32_t)(word << 4) >> 28) * x[col + 6];
+        acc += ((int32_t)word >> 28) * x[col + 7];
+    }
+
+    for (; col < size; col++)
+        acc += nibble(w, col) * x[col];
+
+    return acc;
+}
+
+void fold_zero4(const uint8_t *M, const int32_t *bias, int8_t v_zero, int32_t *out, int nrows, int ncols) {
+    int stride = STRIDE4(ncols);
+
+    for (int row = 0; row < nrows; row++) {
+        int32_t sum = 0;
+        for (int col = 0; col < ncols; col++)
+            sum += nibble(&M[row*stride], col);
+        out[row] = bias[row] - v_zero * sum;
+    }
 }
 
-void mvm8(const int8_t *M, int8_t *v, int16_t *out, int8_t v_zero, int nrows, int ncols) {
-    for (int i = 0; i < ncols; i++)
-        v[i] = (v[i] - v_zero);
+void mvm4(const uint8_t *M, const int32_t *bias, const int8_t *v, int32_t *out, int nrows, int ncols) {
+    int stride = STRIDE4(ncols);
 
     for (int row = 0; row < nrows; row++)
-        out[row] = mac8(&M[row*ncols], v, ncols);
+        out[row] = bias[row] + mac4(&M[row*stride], v, ncols);
+}
+
+void mvm8_requant(const int8_t *M, const int32_t *bias, const int8_t *v, int8_t v_zero, const struct requant *rq, int8_t *out, int nrows, int ncols) {
+    int stride = STRIDE8(ncols);
+
+    for (int row = 0; row < nrows; row++)
+        out[row] = requantize(bias[row] + mac8_zero(&M[row*stride], v, v_zero, ncols), rq);
+}
+
+void mmm8_requant(const int8_t *M, const int32_t *bias, const int8_t *V, int8_t v_zero, const struct requant *rq, int8_t *out, int nrows, int ncols, int nbatch) {
+    int32_t acc[4];
+    int stride = STRIDE8(ncols);
+    int row, b;
+
+    for (row = 0; row < nrows; row++) {
+        for (b = 0; b + 4 <= nbatch; b += 4) {
+            mac8_zero_x4(&M[row*stride], &V[b*ncols], ncols, v_zero, acc, ncols);
+            for (int i = 0; i < 4; i++)
+                out[(b+i)*nrows + row] = requantize(bias[row] + acc[i], rq);
+        }
+
+        for (; b < nbatch; b++)
+            out[b*nrows + row] = requantize(bias[row] + mac8_zero(&M[row*stride], &V[b*ncols], v_zero, ncols), rq);
+    }
 }
 
-void mvm16(const int16_t *M, int16_t *v, int16_t *out, int16_t v_zero, int nrows, int ncols) {
-    for (int i = 0; i < ncols; i++)
-        v[i] = (v[i] - v_zero);
+void requantize8(const int32_t *x, const struct requant *rq, int8_t *out, int size) {
+    for (int i = 0; i < size; i++)
+        out[i] = requantize(x[i], rq);
+}
+
+void requantize8_rows(const int32_t *x, const struct row_scale *rs, const struct requant *rq, int8_t *out, int nrows) {
+    struct requant row_rq = *rq;
+
+    for (int row = 0; row < nrows; row++) {
+        row_rq.multiplier = rs[row].multiplier;
+        row_rq.shift = rs[row].shift;
+        out[row] = requantize(x[row], &row_rq);
+    }
+}
 
+void dequantize_rows(const int32_t *x, const struct row_scale *rs, float *out, int nrows) {
     for (int row = 0; row < nrows; row++)
-        dsps_dotprod_s16_ae32(&M[row*ncols], v, &out[row], ncols, 15);
+        out[row] = x[row] * rs[row].scale;
 }
 
 void relu(const float *x, float *out, int size) {
@@ -69,24 +421,35 @@ int argmax(const float *x, int size) {
     return i_max;
 }
 
-void quantize8(const float *x, float scale, int8_t zero, int8_t *out, int size) {
-    for (int i = 0; i < size; i++)
-        out[i] = (int8_t)(round(x[i] / scale) + zero);
-}
+int argmax32(const int32_t *x, int size) {
+    int i, i_max = 0;
 
-void quantize16(const float *x, float scale, int16_t zero, int16_t *out, int size) {
-    for (int i = 0; i < size; i++)
-        out[i] = (int16_t)(round(x[i] / scale) + zero);
+    for (i = 1; i < size; i++) {
+        if (x[i] > x[i_max]) {
+            i_max = i;
+        }
+    }
+
+    return i_max;
 }
 
-void dequantize16(const struct qlayer *qlayer, const int16_t *x, float *out, int size) {
-    float mvm_scale;
+// Round half away from zero in single precision; round() works on
+// doubles, which the S3 FPU has to emulate.
+static inline int32_t round_scaled(float x, float inv_scale) {
+    float v = x * inv_scale;
+    return (int32_t)(v >= 0.0f ? v + 0.5f : v - 0.5f);
+}
 
-    // TODO pre-calculate this value during compile-time
-    mvm_scale = (qlayer->input.scale * qlayer->weights.scale);
+void quantize8(const float *x, float scale, int8_t zero, int8_t *out, int size) {
+    float inv_scale = 1.0f / scale;
 
     for (int i = 0; i < size; i++) {
-        float temp = x[i] * mvm_scale;
-        out[i] = (temp - qlayer->output.zero) * qlayer->output.scale;
+        int32_t q = round_scaled(x[i], inv_scale) + zero;
+        out[i] = (int8_t)(q < INT8_MIN ? INT8_MIN : q > INT8_MAX ? INT8_MAX : q);
     }
 }
+
+void dequantize8(const int8_t *x, float scale, int8_t zero, float *out, int size) {
+    for (int i = 0; i < size; i++)
+        out[i] = (x[i] - zero) * scale;
+}
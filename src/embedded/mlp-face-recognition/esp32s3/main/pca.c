@@ -0,0 +1,28 @@
+#include <string.h>
+
+#include <nnops.h>
+#include <pca.h>
+
+void pca_begin(const struct pca *p, int32_t *acc) {
+    memcpy(acc, p->bias, p->ncomponents * sizeof(int32_t));
+}
+
+void pca_row(const struct pca *p, int row, const uint8_t *pixels, int32_t *acc) {
+    int8_t v[PCA_MAX_WIDTH];
+    const int8_t *block = &p->basis[row * p->ncomponents * STRIDE8(p->width)];
+
+    // pixel - 128, whose 128 * rowsum correction is part of the bias
+    for (int i = 0; i < p->width; i++)
+        v[i] = (int8_t)(pixels[i] ^ 0x80);
+
+    mvm8x_acc(block, v, acc, p->ncomponents, p->width);
+}
+
+void pca_output(const struct pca *p, const int32_t *acc, float *out) {
+    for (int i = 0; i < p->ncomponents; i++)
+        out[i] = acc[i] * p->scale;
+}
+
+void pca_output8(const struct pca *p, const int32_t *acc, int8_t *out) {
+    requantize8(acc, &p->rq, out, p->ncomponents);
+}
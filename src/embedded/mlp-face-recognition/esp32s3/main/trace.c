@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_cpu.h>
+
+#include <trace.h>
+
+#ifdef CONFIG_MLP_TRACE
+
+struct trace_record {
+    int mode;
+    uint32_t cycles[TRACE_NSTAGES];
+};
+
+// records[head] is the request in flight, the nrecords before it are kept
+static struct trace_record records[CONFIG_MLP_TRACE_DEPTH];
+static int head, nrecords;
+
+// one stage of every kept record, sorted by trace_stats
+static uint32_t samples[CONFIG_MLP_TRACE_DEPTH];
+
+uint32_t trace_cycles() {
+    return esp_cpu_get_cycle_count();
+}
+
+void trace_begin(int mode) {
+    memset(&records[head], 0, sizeof(records[head]));
+    records[head].mode = mode;
+}
+
+// In the pipelined batch mode core 1 adds inference stages while core 0
+// adds receive stages; the two never share a stage.
+void trace_add(int stage, uint32_t cycles) {
+    records[head].cycles[stage] += cycles;
+}
+
+void trace_end() {
+    head = (head + 1) % CONFIG_MLP_TRACE_DEPTH;
+    if (nrecords < CONFIG_MLP_TRACE_DEPTH)
+        nrecords++;
+}
+
+static int compare_cycles(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+int trace_stats(int mode, struct trace_stats *stats) {
+    int n = 0;
+
+    for (int stage = 0; stage < TRACE_NSTAGES; stage++) {
+        uint64_t sum = 0;
+
+        // kept records are the first nrecords, in any order
+        n = 0;
+        for (int i = 0; i < nrecords; i++) {
+            if (mode != TRACE_ALL_MODES && records[i].mode != mode)
+                continue;
+            samples[n++] = records[i].cycles[stage];
+            sum += records[i].cycles[stage];
+        }
+
+        if (n == 0) {
+            stats[stage] = (struct trace_stats) {0};
+            continue;
+        }
+
+        // nearest-rank percentile
+        qsort(samples, n, sizeof(samples[0]), compare_cycles);
+        stats[stage] = (struct trace_stats) {
+            .min = samples[0],
+            .mean = sum / n,
+            .p99 = samples[(99*n + 99) / 100 - 1],
+        };
+    }
+
+    return n;
+}
+
+#else
+
+uint32_t trace_cycles() {
+    return 0;
+}
+
+void trace_begin(int mode) {
+    (void)mode;
+}
+
+void trace_add(int stage, uint32_t cycles) {
+    (void)stage;
+    (void)cycles;
+}
+
+void trace_end() {
+}
+
+int trace_stats(int mode, struct trace_stats *stats) {
+    (void)mode;
+    memset(stats, 0, TRACE_NSTAGES * sizeof(*stats));
+    return 0;
+}
+
+#endif
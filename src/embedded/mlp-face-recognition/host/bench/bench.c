@@ -0,0 +1,366 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <nnops.h>
+#include <mlp.h>
+#include <fixture.h>
+
+#define MIN_DURATION_NS 200000000LL
+
+struct bench_case {
+    const char *name;
+    void (*fn)(int rows, int cols);
+    int rows, cols;
+    int batch;
+    int dtype;              // model the run_mlp* pipelines execute
+};
+
+float fin[BATCH_MAX*LAYER_INPUT_LEN], fout[BATCH_MAX*LAYER_1_LEN];
+int8_t in8[BATCH_MAX*LAYER_INPUT_LEN];
+int32_t out32[BATCH_MAX*LAYER_1_LEN];
+int labels[BATCH_MAX];
+
+static const float *weights_of(int rows) {
+    return rows == LAYER_1_LEN ? layer_1_weights : layer_3_weights;
+}
+
+static const int8_t *weights8_of(int rows) {
+    return rows == LAYER_1_LEN ? layer_1_weights8 : layer_3_weights8;
+}
+
+static const float *bias_of(int rows) {
+    return rows == LAYER_1_LEN ? layer_1_bias : layer_3_bias;
+}
+
+static const int32_t *bias32_of(int rows) {
+    return rows == LAYER_1_LEN ? layer_1_bias32 : layer_3_bias32;
+}
+
+static void bench_mvm(int rows, int cols) {
+    mvm(weights_of(rows), bias_of(rows), fin, fout, rows, cols);
+}
+
+static void bench_mvmx(int rows, int cols) {
+    mvmx(weights_of(rows), bias_of(rows), fin, fout, rows, cols);
+}
+
+static void bench_mvm8(int rows, int cols) {
+    mvm8(weights8_of(rows), bias32_of(rows), in8, out32, 0, rows, cols);
+}
+
+static void bench_mvm8x(int rows, int cols) {
+    mvm8x(weights8_of(rows), bias32_of(rows), in8, out32, rows, cols);
+}
+
+static void bench_mvm4(int rows, int cols) {
+    mvm4(rows == LAYER_1_LEN ? layer_1_weights4 : layer_3_weights4,
+         rows == LAYER_1_LEN ? layer_1_bias4 : layer_3_bias4, in8, out32, rows, cols);
+}
+
+static void bench_mmm(int rows, int cols) {
+    mmm(weights_of(rows), bias_of(rows), fin, fout, rows, cols, BATCH_MAX);
+}
+
+static void bench_mmmx(int rows, int cols) {
+    mmmx(weights_of(rows), bias_of(rows), fin, fout, rows, cols, BATCH_MAX);
+}
+
+static void bench_mmm8(int rows, int cols) {
+    mmm8(weights8_of(rows), bias32_of(rows), in8, out32, 0, rows, cols, BATCH_MAX);
+}
+
+static void bench_mmm8x(int rows, int cols) {
+    mmm8x(weights8_of(rows), bias32_of(rows), in8, out32, rows, cols, BATCH_MAX);
+}
+
+static void bench_quantize8(int rows, int cols) {
+    (void)rows;
+    quantize8(fin, input_scale, input_zero, in8, cols);
+}
+
+static void bench_dequantize8(int rows, int cols) {
+    (void)rows;
+    dequantize8(in8, input_scale, input_zero, fout, cols);
+}
+
+static void bench_pca_row(int rows, int cols) {
+    (void)rows; (void)cols;
+    pca_row(&mlp_pca, 0, (const uint8_t *)in8, out32);
+}
+
+static void bench_run_mlp(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp(fin);
+}
+
+static void bench_run_mlpx(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlpx(fin);
+}
+
+static void bench_run_mlp8(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp8(fin);
+}
+
+static void bench_run_mlp8x(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp8x(fin);
+}
+
+static void bench_run_mlp4(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp4(fin);
+}
+
+static void bench_run_mlp8q(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp8q(in8);
+}
+
+static void bench_run_mlp8xq(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp8xq(in8);
+}
+
+static void bench_run_mlp_batch(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp_batch(fin, labels, BATCH_MAX);
+}
+
+static void bench_run_mlpx_batch(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlpx_batch(fin, labels, BATCH_MAX);
+}
+
+static void bench_run_mlp8_batch(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp8_batch(fin, labels, BATCH_MAX);
+}
+
+static void bench_run_mlp8x_batch(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp8x_batch(fin, labels, BATCH_MAX);
+}
+
+static void bench_run_mlp4_batch(int rows, int cols) {
+    (void)rows; (void)cols;
+    run_mlp4_batch(fin, labels, BATCH_MAX);
+}
+
+// rows == 0 marks element-wise ops (throughput in elements, not MACs)
+static const struct bench_case cases[] = {
+    {"mvm",             bench_mvm,             LAYER_1_LEN, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm",             bench_mvm,             LAYER_3_LEN, LAYER_1_LEN, 0, MODEL_DTYPE_F32},
+    {"mvmx",            bench_mvmx,            LAYER_1_LEN, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"mvmx",            bench_mvmx,            LAYER_3_LEN, LAYER_1_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm8",            bench_mvm8,            LAYER_1_LEN, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm8",            bench_mvm8,            LAYER_3_LEN, LAYER_1_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm8x",           bench_mvm8x,           LAYER_1_LEN, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm8x",           bench_mvm8x,           LAYER_3_LEN, LAYER_1_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm4",            bench_mvm4,            LAYER_1_LEN, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"mvm4",            bench_mvm4,            LAYER_3_LEN, LAYER_1_LEN, 0, MODEL_DTYPE_F32},
+    {"mmm",             bench_mmm,             LAYER_1_LEN, LAYER_INPUT_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmm",             bench_mmm,             LAYER_3_LEN, LAYER_1_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmmx",            bench_mmmx,            LAYER_1_LEN, LAYER_INPUT_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmmx",            bench_mmmx,            LAYER_3_LEN, LAYER_1_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmm8",            bench_mmm8,            LAYER_1_LEN, LAYER_INPUT_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmm8",            bench_mmm8,            LAYER_3_LEN, LAYER_1_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmm8x",           bench_mmm8x,           LAYER_1_LEN, LAYER_INPUT_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"mmm8x",           bench_mmm8x,           LAYER_3_LEN, LAYER_1_LEN, BATCH_MAX, MODEL_DTYPE_F32},
+    {"quantize8",       bench_quantize8,       0, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"quantize8",       bench_quantize8,       0, LAYER_1_LEN, 0, MODEL_DTYPE_F32},
+    {"dequantize8",     bench_dequantize8,     0, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32},
+    {"pca_row",         bench_pca_row,         LAYER_INPUT_LEN, PCA_WIDTH, 0, MODEL_DTYPE_F32},
+    {"run_mlp",         bench_run_mlp,         0, 1, 0, MODEL_DTYPE_F32},
+    {"run_mlpx",        bench_run_mlpx,        0, 1, 0, MODEL_DTYPE_F32},
+    {"run_mlp8",        bench_run_mlp8,        0, 1, 0, MODEL_DTYPE_INT8},
+    {"run_mlp8x",       bench_run_mlp8x,       0, 1, 0, MODEL_DTYPE_INT8},
+    {"run_mlp4",        bench_run_mlp4,        0, 1, 0, MODEL_DTYPE_INT4},
+    {"run_mlp8q",       bench_run_mlp8q,       0, 1, 0, MODEL_DTYPE_INT8},
+    {"run_mlp8xq",      bench_run_mlp8xq,      0, 1, 0, MODEL_DTYPE_INT8},
+    {"run_mlp_batch",   bench_run_mlp_batch,   0, 1, BATCH_MAX, MODEL_DTYPE_F32},
+    {"run_mlpx_batch",  bench_run_mlpx_batch,  0, 1, BATCH_MAX, MODEL_DTYPE_F32},
+    {"run_mlp8_batch",  bench_run_mlp8_batch,  0, 1, BATCH_MAX, MODEL_DTYPE_INT8},
+    {"run_mlp8x_batch", bench_run_mlp8x_batch, 0, 1, BATCH_MAX, MODEL_DTYPE_INT8},
+    {"run_mlp4_batch",  bench_run_mlp4_batch,  0, 1, BATCH_MAX, MODEL_DTYPE_INT4},
+};
+
+static long long now_ns() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static double run_case(const struct bench_case *c) {
+    long long iters = 1, begin, elapsed;
+
+    // double the iteration count until one sample takes long enough
+    while (1) {
+        begin = now_ns();
+        for (long long i = 0; i < iters; i++)
+            c->fn(c->rows, c->cols);
+        elapsed = now_ns() - begin;
+
+        if (elapsed >= MIN_DURATION_NS)
+            break;
+        iters *= 2;
+    }
+
+    return (double)elapsed / iters;
+}
+
+static const double sparsities[] = {0.25, 0.5, 0.625, 0.75};
+
+static float *test_faces;
+static int *test_labels, ntest_faces;
+
+static void bench_layer_1(int rows, int cols) {
+    const struct graph_op *op = &mlp_graph.ops[1];
+
+    if (op->bsr.rows == NULL && op->in_dtype == GRAPH_F32)
+        mvmx(op->weights, op->bias, fin, fout, rows, cols);
+    else if (op->bsr.rows == NULL)
+        mvm8x(op->weights, op->bias8x, in8, out32, rows, cols);
+    else if (op->in_dtype == GRAPH_F32)
+        mvm_bsr(&op->bsr, op->bias, fin, fout, rows, cols);
+    else
+        mvm8x_bsr(&op->bsr, op->bias8x, in8, out32, rows, cols);
+}
+
+// faces of the test split the loaded model labels right
+static int correct() {
+    int int8 = mlp_model->dtype == MODEL_DTYPE_INT8, n = 0;
+
+    for (int b = 0; b < ntest_faces; b++) {
+        const float *face = &test_faces[b*LAYER_INPUT_LEN];
+        n += (int8 ? run_mlp8x(face) : run_mlpx(face)) == test_labels[b];
+    }
+
+    return n;
+}
+
+// layer 1 weight bytes of the loaded model
+static int layer_1_bytes() {
+    const struct graph_op *op = &mlp_graph.ops[1];
+    int value_size = op->in_dtype == GRAPH_F32 ? sizeof(float) : 1;
+    int nblocks;
+
+    if (op->bsr.rows == NULL)
+        return op->nrows * (value_size == 1 ? STRIDE8(op->ncols) : op->ncols * value_size);
+
+    nblocks = op->bsr.rows[op->nrows];
+    return nblocks * BSR_BLOCK * value_size + (op->nrows + 1 + nblocks) * 2;
+}
+
+// Layer 1 pruned like pack.py's prune_blocks and stored block-sparse:
+// its kernel time, flash size and the accuracy of the whole model on the
+// test split, against the dense layer in the first row.
+static void bench_sparse() {
+    const struct bench_case layer_1 = {"layer_1", bench_layer_1, LAYER_1_LEN, LAYER_INPUT_LEN, 0, MODEL_DTYPE_F32};
+    const struct bench_case mlpx = {"run_mlpx", bench_run_mlpx, 0, 1, 0, MODEL_DTYPE_F32};
+    const struct bench_case mlp8x = {"run_mlp8x", bench_run_mlp8x, 0, 1, 0, MODEL_DTYPE_INT8};
+
+    ntest_faces = read_faces(FACES_TEST_PATH, &test_faces, &test_labels);
+    if (ntest_faces < 0) {
+        printf("cannot read %s\n", FACES_TEST_PATH);
+        return;
+    }
+
+    printf("\nlayer 1 block-sparse (1x%d blocks), accuracy over %d test faces\n", BSR_BLOCK, ntest_faces);
+    printf("%-9s %-5s %7s %7s %10s %10s %10s\n", "sparsity", "dtype", "blocks", "bytes",
+           "layer ns", "model ns", "accuracy");
+
+    for (int i = -1; i < (int)(sizeof(sparsities)/sizeof(sparsities[0])); i++) {
+        struct model_header *f32 = i < 0 ? NULL : prune_model(model_f32, sparsities[i], 1);
+        struct model_header *int8 = i < 0 ? NULL : prune_model(model_int8, sparsities[i], 1);
+        const struct model_header *models[] = {f32 ? f32 : model_f32, int8 ? int8 : model_int8};
+        char sparsity[16];
+
+        if (i < 0)
+            snprintf(sparsity, sizeof(sparsity), "dense");
+        else
+            snprintf(sparsity, sizeof(sparsity), "%.3f", sparsities[i]);
+
+        for (int j = 0; j < 2; j++) {
+            const struct graph_op *op = &mlp_graph.ops[1];
+
+            use_model(models[j]);
+            printf("%-9s %-5s %7d %7d %10.1f %10.1f %7d/%d\n", j ? "" : sparsity, j ? "int8" : "f32",
+                   op->bsr.rows ? op->bsr.rows[op->nrows] : 0, layer_1_bytes(),
+                   run_case(&layer_1), run_case(j ? &mlp8x : &mlpx), correct(), ntest_faces);
+        }
+
+        free(f32);
+        free(int8);
+    }
+
+    free(test_faces);
+    free(test_labels);
+}
+
+int main(int argc, char *argv[]) {
+    const char *filter = argc > 1 ? argv[1] : NULL;
+
+    load_fixture();
+
+    srand(13);
+    for (int i = 0; i < BATCH_MAX*LAYER_INPUT_LEN; i++) {
+        fin[i] = (float)(rand() % 2000 - 1000) / 100.0f;
+        in8[i] = (int8_t)(rand() % 256 - 128);
+    }
+
+    use_model(model_f32);
+    printf("arena: %d bytes (float model)", mlp_graph.arena_size);
+    use_model(model_int8);
+    printf(", %d bytes (int8 model)", mlp_graph.arena_size);
+    use_model(model_int4);
+    printf(", %d bytes (int4 model)\n\n", mlp_graph.arena_size);
+
+    // batched cases report ns per sample so they compare directly
+    printf("%-16s %10s %12s %14s\n", "kernel", "shape", "ns/op", "throughput");
+
+    for (size_t i = 0; i < sizeof(cases)/sizeof(cases[0]); i++) {
+        const struct bench_case *c = &cases[i];
+        char shape[32];
+        double ns, work;
+        const char *unit;
+        int batch = c->batch ? c->batch : 1;
+
+        if (filter && strcmp(filter, c->name) != 0)
+            continue;
+
+        if (c->dtype == MODEL_DTYPE_INT4)
+            use_model(model_int4);
+        else
+            use_model(c->dtype == MODEL_DTYPE_INT8 ? model_int8 : model_f32);
+        ns = run_case(c) / batch;
+
+        if (c->rows) {
+            if (batch > 1)
+                snprintf(shape, sizeof(shape), "%dx%dx%d", c->rows, c->cols, batch);
+            else
+                snprintf(shape, sizeof(shape), "%dx%d", c->rows, c->cols);
+            work = (double)c->rows * c->cols;
+            unit = "MMAC/s";
+        } else if (c->cols > 1) {
+            snprintf(shape, sizeof(shape), "%d", c->cols);
+            work = c->cols;
+            unit = "Melem/s";
+        } else {
+            snprintf(shape, sizeof(shape), "x%d", batch);
+            work = 1;
+            unit = "Minf/s";
+        }
+
+        printf("%-16s %10s %12.1f %10.1f %s\n", c->name, shape, ns, work * 1e3 / ns, unit);
+    }
+
+    if (filter == NULL || strcmp(filter, "sparse") == 0)
+        bench_sparse();
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include <dualcore.h>
+
+// Portable stand-in for esp32s3/main/dualcore.c: jobs run on the calling
+// thread at submit time, so the row split is exercised but not timed.
+
+uint32_t dualcore_busy_cycles;
+uint32_t dualcore_wait_cycles;
+
+void dualcore_start() {
+}
+
+void dualcore_reset_stats() {
+    dualcore_busy_cycles = 0;
+    dualcore_wait_cycles = 0;
+}
+
+void dualcore_submit(void (*fn)(void *arg), void *arg) {
+    fn(arg);
+}
+
+void dualcore_wait() {
+}
+
+void dualcore_rows(rows_fn fn, const void *arg, int nrows) {
+    int half = nrows / 2;
+
+    fn(arg, half, nrows);
+    fn(arg, 0, half);
+}
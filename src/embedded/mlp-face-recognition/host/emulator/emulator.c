@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "emulator.h"
+
+// Runs the firmware's app_main (esp32s3/main/main.c) on the host build of
+// the kernels, with UART0 on a pseudo-terminal and the model partition
+// read from a blob file. Opening the pty boots the board and closing it
+// resets it, so clients talk to it exactly as to /dev/ttyUSB0:
+//
+//   ./build/emulator -l /tmp/esp32 ../esp32s3/model/mlp_int8.bin
+//   python -m src.python.device.loadgen --port /tmp/esp32 fxp fxp_simd+batch
+//
+// Reply cycle counts are nanoseconds of the host.
+
+// a FreeRTOS tick at the firmware's CONFIG_FREERTOS_HZ of 100
+#define TICK_US 10000
+
+void app_main(void);
+
+static void usage(const char *argv0) {
+    fprintf(stderr, "usage: %s [-b baud_rate] [-l link] [-T tick_us] model.bin\n"
+                    "  -b  hold transfers for their time on a UART at baud_rate\n"
+                    "  -l  symlink link to the pty\n"
+                    "  -T  microseconds per tick of the UART read timeouts (%d)\n", argv0, TICK_US);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+    const char *link_path = NULL, *pty;
+    int baud_rate = 0, tick_us = TICK_US, opt;
+
+    while ((opt = getopt(argc, argv, "b:l:T:")) != -1) {
+        switch(opt) {
+        case 'b':
+            baud_rate = atoi(optarg);
+            break;
+        case 'l':
+            link_path = optarg;
+            break;
+        case 'T':
+            tick_us = atoi(optarg);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (optind != argc - 1)
+        usage(argv[0]);
+
+    if (emulator_partition_load("model", argv[optind]) != 0) {
+        fprintf(stderr, "cannot read %s\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+
+    pty = emulator_uart_open(baud_rate, tick_us);
+    if (pty == NULL) {
+        perror("pty");
+        return EXIT_FAILURE;
+    }
+
+    if (link_path != NULL) {
+        unlink(link_path);
+        if (symlink(pty, link_path) != 0) {
+            perror(link_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // clients read the path from the first line
+    printf("%s\n", pty);
+    fflush(stdout);
+
+    for (;;) {
+        emulator_uart_wait_client();
+        if (setjmp(emulator_reset) == 0)
+            app_main();
+    }
+}
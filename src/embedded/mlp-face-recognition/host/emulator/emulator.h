@@ -0,0 +1,23 @@
+#ifndef __EMULATOR__
+#define __EMULATOR__
+
+#include <setjmp.h>
+
+// Creates the pseudo-terminal UART_NUM_0 is attached to and returns the
+// path of its slave side, which clients open like /dev/ttyUSB0, or NULL.
+// With baud_rate > 0 every transfer takes as long as its 8N1 frames would
+// on the wire; 0 runs as fast as the pty goes. Read timeouts count ticks
+// of tick_us microseconds.
+const char *emulator_uart_open(int baud_rate, int tick_us);
+
+// Blocks until a client opens the slave side, then gives it time to
+// configure the port before the board boots. A client closing the port
+// resets the board: the UART driver calls longjmp(emulator_reset, 1).
+void emulator_uart_wait_client(void);
+extern jmp_buf emulator_reset;
+
+// Backs the data partition label with the contents of the file at path.
+// Returns 0, or -1 if the file cannot be read.
+int emulator_partition_load(const char *label, const char *path);
+
+#endif // end of EMULATOR
@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_partition.h>
+#include <model.h>
+
+#include "emulator.h"
+
+static esp_partition_t partition;
+static void *partition_data;
+
+int emulator_partition_load(const char *label, const char *path) {
+    FILE *f = fopen(path, "rb");
+    long size;
+
+    if (f == NULL)
+        return -1;
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    free(partition_data);
+    partition_data = NULL;
+
+    // load_model needs the alignment a flash mapping has
+    if (size <= 0 || posix_memalign(&partition_data, MODEL_ALIGN, size) != 0 ||
+        fread(partition_data, 1, size, f) != (size_t)size) {
+        free(partition_data);
+        partition_data = NULL;
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+
+    partition.type = ESP_PARTITION_TYPE_DATA;
+    partition.subtype = ESP_PARTITION_SUBTYPE_ANY;
+    partition.size = size;
+    snprintf(partition.label, sizeof(partition.label), "%s", label);
+    return 0;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label) {
+    if (partition_data == NULL || type != partition.type)
+        return NULL;
+
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != partition.subtype)
+        return NULL;
+
+    if (label != NULL && strcmp(label, partition.label) != 0)
+        return NULL;
+
+    return &partition;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *p, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle) {
+    (void)memory;
+    if (p != &partition || offset > p->size || size > p->size - offset)
+        return ESP_ERR_NOT_FOUND;
+
+    *out_ptr = (const char *)partition_data + offset;
+    *out_handle = 0;
+    return ESP_OK;
+}
@@ -0,0 +1,218 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <driver/uart.h>
+
+#include "emulator.h"
+
+// time for the client to configure the port after opening it, as the
+// board takes to boot after the port's DTR line resets it
+#define BOOT_MS 50
+
+// 8N1: a start bit, 8 data bits and a stop bit per byte
+#define BITS_PER_BYTE 10
+
+jmp_buf emulator_reset;
+
+static int master = -1, closes = -1;
+static char slave_path[64];
+static int line_baud_rate, tick_us;
+
+// when the last byte received and sent left the wire
+static uint64_t rx_line, tx_line;
+
+static uint64_t now_ns() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void sleep_until(uint64_t t) {
+    struct timespec ts = { .tv_sec = t / 1000000000ULL, .tv_nsec = t % 1000000000ULL };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+// holds a transfer of n bytes that could start at begin for its time on the wire
+static void pace(uint64_t *line, uint64_t begin, size_t n) {
+    if (line_baud_rate <= 0 || n == 0)
+        return;
+
+    if (*line < begin)
+        *line = begin;
+    *line += n * BITS_PER_BYTE * 1000000000ULL / line_baud_rate;
+    sleep_until(*line);
+}
+
+static void hang_up() {
+    longjmp(emulator_reset, 1);
+}
+
+// the client may close and reopen the port before the master sees it
+// hang up, but not without leaving a close event
+static int drain_closes() {
+    char events[256];
+    int closed = 0;
+
+    while (read(closes, events, sizeof(events)) > 0)
+        closed = 1;
+
+    return closed;
+}
+
+// The kernel resets the slave's termios when its last user closes it,
+// but keeps what the master wrote for the previous client.
+static void reset_line() {
+    struct termios tio;
+    int slave = open(slave_path, O_RDWR | O_NOCTTY);
+
+    if (slave < 0)
+        return;
+    if (tcgetattr(slave, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(slave, TCSANOW, &tio);
+    }
+    tcflush(slave, TCIOFLUSH);
+    close(slave);
+}
+
+const char *emulator_uart_open(int baud_rate, int tick) {
+    int slave;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+        return NULL;
+
+    snprintf(slave_path, sizeof(slave_path), "%s", ptsname(master));
+
+    // once the slave has been opened and closed, the master reports
+    // POLLHUP until a client opens it
+    slave = open(slave_path, O_RDWR | O_NOCTTY);
+    if (slave < 0)
+        return NULL;
+    close(slave);
+
+    closes = inotify_init1(IN_NONBLOCK);
+    if (closes < 0 || inotify_add_watch(closes, slave_path, IN_CLOSE) < 0)
+        return NULL;
+
+    line_baud_rate = baud_rate;
+    tick_us = tick;
+    return slave_path;
+}
+
+void emulator_uart_wait_client(void) {
+    struct pollfd pfd = { .fd = master, .events = POLLIN };
+
+    for (;;) {
+        poll(&pfd, 1, 0);
+        if (!(pfd.revents & POLLHUP))
+            break;
+        usleep(10 * 1000);
+    }
+
+    reset_line();
+    usleep(BOOT_MS * 1000);
+    tcflush(master, TCIOFLUSH);
+    drain_closes();
+    rx_line = tx_line = 0;
+}
+
+esp_err_t uart_param_config(uart_port_t uart_num, const uart_config_t *uart_config) {
+    (void)uart_config;
+    return uart_num == UART_NUM_0 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t uart_set_pin(uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num, int cts_io_num) {
+    (void)tx_io_num;
+    (void)rx_io_num;
+    (void)rts_io_num;
+    (void)cts_io_num;
+    return uart_num == UART_NUM_0 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t uart_driver_install(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size,
+                              int queue_size, QueueHandle_t *uart_queue, int intr_alloc_flags) {
+    (void)rx_buffer_size;
+    (void)tx_buffer_size;
+    (void)queue_size;
+    (void)uart_queue;
+    (void)intr_alloc_flags;
+    return uart_num == UART_NUM_0 && master >= 0 ? ESP_OK : ESP_FAIL;
+}
+
+int uart_read_bytes(uart_port_t uart_num, void *buf, uint32_t length, TickType_t ticks_to_wait) {
+    uint64_t deadline = now_ns() + (uint64_t)ticks_to_wait * tick_us * 1000ULL;
+    uint64_t first = 0;
+    struct pollfd pfd[2] = { { .fd = master, .events = POLLIN }, { .fd = closes, .events = POLLIN } };
+    uint32_t got = 0;
+    ssize_t n;
+
+    // the pty stands in for every port
+    (void)uart_num;
+
+    while (got < length) {
+        uint64_t now = now_ns();
+
+        if (now >= deadline)
+            break;
+
+        if (poll(pfd, 2, (deadline - now + 999999) / 1000000) <= 0)
+            continue;
+
+        if ((pfd[1].revents & POLLIN) && drain_closes())
+            hang_up();
+
+        if (pfd[0].revents & POLLIN) {
+            n = read(master, (char *)buf + got, length - got);
+            if (n > 0) {
+                if (got == 0)
+                    first = now_ns();
+                got += n;
+                continue;
+            }
+            if (n < 0 && (errno == EINTR || errno == EAGAIN))
+                continue;
+        }
+
+        // the slave was closed: EIO on read, or POLLHUP once it is drained
+        hang_up();
+    }
+
+    pace(&rx_line, first, got);
+    return got;
+}
+
+int uart_write_bytes(uart_port_t uart_num, const void *src, size_t size) {
+    uint64_t begin = now_ns();
+    size_t sent = 0;
+    ssize_t n;
+
+    (void)uart_num;
+
+    if (drain_closes())
+        hang_up();
+
+    while (sent < size) {
+        n = write(master, (const char *)src + sent, size - sent);
+        if (n > 0)
+            sent += n;
+        else if (n < 0 && errno != EINTR && errno != EAGAIN)
+            hang_up();
+    }
+
+    pace(&tx_line, begin, size);
+    return size;
+}
@@ -0,0 +1,10 @@
+#include <time.h>
+
+#include <esp_cpu.h>
+
+uint32_t esp_cpu_get_cycle_count(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
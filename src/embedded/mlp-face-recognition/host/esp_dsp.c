@@ -0,0 +1,11 @@
+#include <esp_dsp.h>
+
+esp_err_t dsps_dotprod_f32_aes3(const float *src1, const float *src2, float *dest, int len) {
+    float acc = 0;
+
+    for (int i = 0; i < len; i++)
+        acc += src1[i] * src2[i];
+
+    *dest = acc;
+    return ESP_OK;
+}
@@ -0,0 +1,233 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <mlp.h>
+#include <fixture.h>
+
+const struct model_header *model_f32, *model_int8, *model_int4;
+
+const float *layer_1_weights, *layer_1_bias, *layer_3_weights, *layer_3_bias;
+const int8_t *layer_1_weights8, *layer_3_weights8;
+const int32_t *layer_1_bias32, *layer_3_bias32;
+const uint8_t *layer_1_weights4, *layer_3_weights4;
+const int32_t *layer_1_bias4, *layer_3_bias4;
+const struct row_scale *layer_1_scales4, *layer_3_scales4;
+
+int8_t input_zero, layer_1_zero, layer_3_zero;
+float input_scale, layer_1_weights_scale, layer_1_scale;
+
+struct requant l1_requant;
+
+const struct model_header *read_model(const char *path) {
+    FILE *f = fopen(path, "rb");
+    long size;
+    void *blob = NULL;
+
+    if (f == NULL)
+        return NULL;
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if (posix_memalign(&blob, MODEL_ALIGN, size) != 0 || fread(blob, 1, size, f) != (size_t)size) {
+        free(blob);
+        blob = NULL;
+    }
+
+    fclose(f);
+    return blob;
+}
+
+int read_faces(const char *path, float **faces, int **labels) {
+    FILE *f = fopen(path, "rb");
+    int32_t shape[2];
+    int ok;
+
+    if (f == NULL)
+        return -1;
+
+    ok = fread(shape, sizeof(shape), 1, f) == 1 && shape[0] > 0 && shape[1] == LAYER_INPUT_LEN;
+    if (ok) {
+        *faces = malloc(shape[0] * LAYER_INPUT_LEN * sizeof(float));
+        *labels = malloc(shape[0] * sizeof(int));
+        ok = fread(*faces, sizeof(float), shape[0] * LAYER_INPUT_LEN, f) == (size_t)shape[0] * LAYER_INPUT_LEN &&
+             fread(*labels, sizeof(int), shape[0], f) == (size_t)shape[0];
+        if (!ok) {
+            free(*faces);
+            free(*labels);
+        }
+    }
+
+    fclose(f);
+    return ok ? shape[0] : -1;
+}
+
+void use_model(const struct model_header *m) {
+    int err = load_model(m, m->size);
+
+    if (err != MODEL_OK) {
+        printf("load_model failed: %d\n", err);
+        exit(EXIT_FAILURE);
+    }
+}
+
+void load_fixture() {
+    const struct model_layer *l;
+
+    model_f32 = read_model(MODEL_F32_PATH);
+    model_int8 = read_model(MODEL_INT8_PATH);
+    model_int4 = read_model(MODEL_INT4_PATH);
+    if (model_f32 == NULL || model_int8 == NULL || model_int4 == NULL) {
+        printf("cannot read the model blobs in %s\n", MODEL_DIR);
+        exit(EXIT_FAILURE);
+    }
+
+    use_model(model_f32);
+    use_model(model_int4);
+    use_model(model_int8);
+    l = model_layers(model_int8);
+    if (model_int8->nlayers != 2 || l[0].ncols != LAYER_INPUT_LEN || l[0].nrows != LAYER_1_LEN || l[1].nrows != LAYER_3_LEN ||
+        mlp_pca.height != PCA_HEIGHT || mlp_pca.width != PCA_WIDTH) {
+        printf("unexpected model shape\n");
+        exit(EXIT_FAILURE);
+    }
+
+    l = model_layers(model_f32);
+    layer_1_weights = model_tensor(model_f32, l[0].weights);
+    layer_1_bias = model_tensor(model_f32, l[0].bias);
+    layer_3_weights = model_tensor(model_f32, l[1].weights);
+    layer_3_bias = model_tensor(model_f32, l[1].bias);
+
+    l = model_layers(model_int8);
+    layer_1_weights8 = model_tensor(model_int8, l[0].weights);
+    layer_1_bias32 = model_tensor(model_int8, l[0].bias);
+    layer_3_weights8 = model_tensor(model_int8, l[1].weights);
+    layer_3_bias32 = model_tensor(model_int8, l[1].bias);
+
+    l = model_layers(model_int4);
+    layer_1_weights4 = model_tensor(model_int4, l[0].weights);
+    layer_1_bias4 = model_tensor(model_int4, l[0].bias);
+    layer_1_scales4 = model_tensor(model_int4, l[0].scales);
+    layer_3_weights4 = model_tensor(model_int4, l[1].weights);
+    layer_3_bias4 = model_tensor(model_int4, l[1].bias);
+    layer_3_scales4 = model_tensor(model_int4, l[1].scales);
+
+    l = model_layers(model_int8);
+
+    input_zero = model_int8->input_zero;
+    input_scale = model_int8->input_scale;
+    layer_1_weights_scale = l[0].weights_scale;
+    layer_1_scale = l[0].scale;
+    layer_1_zero = l[0].zero;
+    layer_3_zero = l[1].zero;
+
+    l1_requant = (struct requant) {
+        .multiplier = l[0].multiplier,
+        .shift = l[0].shift,
+        .zero = l[0].zero,
+        .min = l[0].zero,
+        .max = INT8_MAX,
+    };
+}
+
+// columns of the block of layer weights starting at col
+static int block_width(int col, int ncols) {
+    return ncols - col < BSR_BLOCK ? ncols - col : BSR_BLOCK;
+}
+
+struct block_norm {
+    double norm;
+    int index;
+};
+
+// largest norm first, ties in block order like a stable sort
+static int compare_norms(const void *a, const void *b) {
+    const struct block_norm *x = a, *y = b;
+
+    if (x->norm != y->norm)
+        return x->norm < y->norm ? 1 : -1;
+    return x->index - y->index;
+}
+
+struct model_header *prune_model(const struct model_header *m, double sparsity, int block_sparse) {
+    const struct model_layer *l = model_layers(m);
+    int int8 = m->dtype == MODEL_DTYPE_INT8;
+    int value_size = int8 ? 1 : sizeof(float);
+    int stride = int8 ? STRIDE8(l->ncols) : l->ncols;
+    int nb = (l->ncols + BSR_BLOCK - 1) / BSR_BLOCK, nblocks = l->nrows * nb;
+    int nkept = (int)lround(nblocks * (1 - sparsity));
+    const uint8_t *weights = model_tensor(m, l->weights);
+    struct block_norm *norms = malloc(nblocks * sizeof(*norms));
+    uint8_t *kept = calloc(nblocks, 1);
+    uint32_t size = m->size, values_at, index_at;
+    struct model_header *p = NULL;
+    struct model_layer *pl;
+
+    for (int i = 0; i < nblocks; i++) {
+        int at = i / nb * stride + i % nb * BSR_BLOCK;
+        double sum = 0;
+
+        for (int c = 0; c < block_width(i % nb * BSR_BLOCK, l->ncols); c++) {
+            double w = int8 ? ((const int8_t *)weights)[at + c] : ((const float *)weights)[at + c];
+            sum += w * w;
+        }
+        norms[i] = (struct block_norm) {sqrt(sum), i};
+    }
+
+    qsort(norms, nblocks, sizeof(*norms), compare_norms);
+    for (int i = 0; i < nkept; i++)
+        kept[norms[i].index] = 1;
+
+    // the BSR tensors go after everything else, the dense ones stay unused
+    values_at = (size + MODEL_ALIGN - 1) & ~(MODEL_ALIGN - 1);
+    index_at = (values_at + nkept * BSR_BLOCK * value_size + MODEL_ALIGN - 1) & ~(MODEL_ALIGN - 1);
+    if (block_sparse)
+        size = index_at + (l->nrows + 1 + nkept) * 2;
+
+    if (posix_memalign((void **)&p, MODEL_ALIGN, size) != 0)
+        exit(EXIT_FAILURE);
+    memset(p, 0, size);
+    memcpy(p, m, m->size);
+    pl = (struct model_layer *)(p + 1);
+
+    if (block_sparse) {
+        uint8_t *values = (uint8_t *)p + values_at;
+        uint16_t *rows = (uint16_t *)((uint8_t *)p + index_at), *cols = rows + l->nrows + 1;
+        int n = 0;
+
+        for (int i = 0; i < nblocks; i++) {
+            int col = i % nb * BSR_BLOCK;
+
+            if (col == 0)
+                rows[i / nb] = n;
+            if (!kept[i])
+                continue;
+
+            memcpy(&values[n * BSR_BLOCK * value_size], &weights[(i / nb * stride + col) * value_size],
+                   block_width(col, l->ncols) * value_size);
+            cols[n++] = col;
+        }
+        rows[l->nrows] = n;
+
+        p->size = size;
+        pl->format = MODEL_LAYER_BSR;
+        pl->weights = values_at;
+        pl->index = index_at;
+    } else {
+        uint8_t *w = (uint8_t *)p + l->weights;
+
+        for (int i = 0; i < nblocks; i++) {
+            int col = i % nb * BSR_BLOCK;
+
+            if (!kept[i])
+                memset(&w[(i / nb * stride + col) * value_size], 0, block_width(col, l->ncols) * value_size);
+        }
+    }
+
+    free(norms);
+    free(kept);
+    return p;
+}
@@ -0,0 +1,7 @@
+#ifndef __DRIVER_GPIO_HOST__
+#define __DRIVER_GPIO_HOST__
+
+// Host stand-in for the ESP-IDF GPIO driver: main.c includes it but only
+// leaves the UART pins unchanged.
+
+#endif // end of DRIVER_GPIO_HOST
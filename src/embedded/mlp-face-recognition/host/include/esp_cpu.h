@@ -0,0 +1,11 @@
+#ifndef __ESP_CPU_HOST__
+#define __ESP_CPU_HOST__
+
+// Host stand-in for the ESP-IDF CPU cycle counter, which counts
+// nanoseconds here.
+
+#include <stdint.h>
+
+uint32_t esp_cpu_get_cycle_count(void);
+
+#endif // end of ESP_CPU_HOST
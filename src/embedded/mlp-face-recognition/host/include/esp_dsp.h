@@ -0,0 +1,13 @@
+#ifndef __ESP_DSP_HOST__
+#define __ESP_DSP_HOST__
+
+// Host stand-in for the subset of esp-dsp used by nnops.c. The fallbacks
+// follow the esp-dsp ANSI reference implementations.
+
+#include <stdint.h>
+
+#include <esp_err.h>
+
+esp_err_t dsps_dotprod_f32_aes3(const float *src1, const float *src2, float *dest, int len);
+
+#endif // end of ESP_DSP_HOST
@@ -0,0 +1,24 @@
+#ifndef __ESP_ERR_HOST__
+#define __ESP_ERR_HOST__
+
+// Host stand-in for the ESP-IDF error codes. ESP_ERROR_CHECK aborts with
+// the failing expression, as it does on the device.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NOT_FOUND 0x105
+
+#define ESP_ERROR_CHECK(x) do { \
+    esp_err_t err_rc_ = (x); \
+    if (err_rc_ != ESP_OK) { \
+        fprintf(stderr, "ESP_ERROR_CHECK failed: %s = %d at %s:%d\n", #x, err_rc_, __FILE__, __LINE__); \
+        abort(); \
+    } \
+} while (0)
+
+#endif // end of ESP_ERR_HOST
@@ -0,0 +1,33 @@
+#ifndef __ESP_PARTITION_HOST__
+#define __ESP_PARTITION_HOST__
+
+// Host stand-in for the ESP-IDF partition API. Partitions are files read
+// into memory by the emulator (see emulator/emulator.h), and mapping one
+// returns that memory.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <esp_err.h>
+
+typedef enum { ESP_PARTITION_TYPE_DATA = 1 } esp_partition_type_t;
+typedef enum { ESP_PARTITION_SUBTYPE_ANY = 0xff } esp_partition_subtype_t;
+typedef enum { ESP_PARTITION_MMAP_DATA = 0 } esp_partition_mmap_memory_t;
+
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label);
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle);
+
+#endif // end of ESP_PARTITION_HOST
@@ -0,0 +1,64 @@
+#ifndef __FIXTURE__
+#define __FIXTURE__
+
+#include <stdint.h>
+
+#include <nnops.h>
+#include <model.h>
+
+// The committed model blobs (esp32s3/model) as seen by the host tests and
+// benchmark: the float blob for the float pipelines, the int8 and int4
+// blobs for the int8 and int4 ones, with their tensors under the names
+// the exporter used.
+
+#define MODEL_F32_PATH  MODEL_DIR "/mlp_f32.bin"
+#define MODEL_INT8_PATH MODEL_DIR "/mlp_int8.bin"
+#define MODEL_INT4_PATH MODEL_DIR "/mlp_int4.bin"
+
+// the notebook's test split, PCA-projected (pack.pack_faces)
+#define FACES_TEST_PATH MODEL_DIR "/faces_test.bin"
+
+// shape of the committed model, checked by load_fixture
+#define LAYER_INPUT_LEN 132
+#define LAYER_1_LEN 96
+#define LAYER_3_LEN 15
+
+// downsampled face taken by the PCA stage of both blobs
+#define PCA_HEIGHT 48
+#define PCA_WIDTH 64
+
+extern const struct model_header *model_f32, *model_int8, *model_int4;
+
+extern const float *layer_1_weights, *layer_1_bias, *layer_3_weights, *layer_3_bias;
+extern const int8_t *layer_1_weights8, *layer_3_weights8;
+extern const int32_t *layer_1_bias32, *layer_3_bias32;
+extern const uint8_t *layer_1_weights4, *layer_3_weights4;
+extern const int32_t *layer_1_bias4, *layer_3_bias4;
+extern const struct row_scale *layer_1_scales4, *layer_3_scales4;
+
+extern int8_t input_zero, layer_1_zero, layer_3_zero;
+extern float input_scale, layer_1_weights_scale, layer_1_scale;
+
+// layer 1 of the int8 blob, ReLU fused into the requantization
+extern struct requant l1_requant;
+
+// reads a blob into 16-byte aligned memory, NULL if it cannot be read
+const struct model_header *read_model(const char *path);
+
+// Reads faces of LAYER_INPUT_LEN values and their subjects into memory
+// to free(); returns the face count, or -1 if the file cannot be read.
+int read_faces(const char *path, float **faces, int **labels);
+
+// reads the blobs and loads the int8 one; exits on any error
+void load_fixture();
+
+// makes m the model the run_mlp* pipelines execute
+void use_model(const struct model_header *m);
+
+// Copy of m with layer 1 pruned like pack.py's prune_blocks, ranking the
+// blocks of the blob's own weights: the pruned blocks are zeroed in
+// place, or with block_sparse the kept ones are stored as a
+// MODEL_LAYER_BSR layer. Free it with free().
+struct model_header *prune_model(const struct model_header *m, double sparsity, int block_sparse);
+
+#endif // end of FIXTURE
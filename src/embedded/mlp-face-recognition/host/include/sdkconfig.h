@@ -0,0 +1,9 @@
+#ifndef __SDKCONFIG_HOST__
+#define __SDKCONFIG_HOST__
+
+// Host stand-in for the header ESP-IDF generates from sdkconfig. Only
+// CONFIG_MLP_TRACE, CONFIG_MLP_TRACE_DEPTH and CONFIG_MLP_UART_BAUD_RATE
+// are read by the sources built here; the targets that need them define
+// them on the command line.
+
+#endif // end of SDKCONFIG_HOST
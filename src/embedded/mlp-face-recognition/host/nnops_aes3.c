@@ -0,0 +1,32 @@
+#include <nnops.h>
+
+// Portable stand-in for esp32s3/main/nnops_aes3.S.
+void mvm8_rows_aes3(const int8_t *M, int stride, const int8_t *v, int32_t *out, int nrows, int nvec) {
+    for (int row = 0; row < nrows; row++) {
+        int32_t acc = 0;
+
+        for (int i = 0; i < 16*nvec; i++)
+            acc += (int32_t)M[row*stride + i] * v[i];
+
+        out[row] += acc;
+    }
+}
+
+void mvm8_bsr_aes3(const int8_t *values, const uint16_t *rows, const uint16_t *cols, const int8_t *v, int32_t *out, int nrows) {
+    const int8_t *w = values;
+
+    for (int row = 0; row < nrows; row++) {
+        int32_t acc = 0;
+
+        for (int i = rows[row]; i < rows[row + 1]; i++, cols++, w += 16) {
+            const int8_t *x = &v[*cols];
+
+            // kept a loop: gcc vectorizes it better than its full unroll
+#pragma GCC unroll 1
+            for (int c = 0; c < 16; c++)
+                acc += (int32_t)w[c] * x[c];
+        }
+
+        out[row] += acc;
+    }
+}
@@ -0,0 +1,393 @@
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <nnops.h>
+#include <mlp.h>
+#include <fixture.h>
+
+// Smoke test of the UART protocol: boots the emulator (argv[1]) on the
+// int8 blob, talks to it over its pty with several requests in flight and
+// checks every reply against the same model run in-process.
+
+// requests written ahead of the replies read
+#define DEPTH 4
+
+// seconds to wait for a reply before giving up on the emulator
+#define REPLY_TIMEOUT 10
+
+// emulator ticks, so that a payload read times out after 2 s
+// (100000 ticks) instead of 1000 s
+#define TICK_US "20"
+
+#define CMD_INT8_ACCEL 0x09
+#define CMD_FLOAT 0x01
+#define CMD_BATCH 0x10
+#define CMD_INPUT_INT8 0x20
+#define CMD_DUAL_CORE 0x40
+#define CMD_INPUT_FRAME 0x80
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        failures++; \
+    } \
+} while (0)
+
+static float *faces;
+static int *expected;
+static int nfaces;
+
+static pid_t emulator;
+static char pty[64];
+
+static int read_exact(int fd, void *buf, int len) {
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    int got = 0, n;
+
+    while (got < len) {
+        if (poll(&pfd, 1, REPLY_TIMEOUT * 1000) <= 0)
+            return got;
+        n = read(fd, (char *)buf + got, len - got);
+        if (n <= 0)
+            return got;
+        got += n;
+    }
+
+    return got;
+}
+
+static void write_all(int fd, const void *buf, int len) {
+    int sent = 0, n;
+
+    while (sent < len) {
+        n = write(fd, (const char *)buf + sent, len - sent);
+        if (n <= 0)
+            return;
+        sent += n;
+    }
+}
+
+static int expect(int fd, const char *msg) {
+    char buf[32] = {0};
+    int len = strlen(msg);
+
+    if (read_exact(fd, buf, len) != len || memcmp(buf, msg, len) != 0) {
+        CHECK(0, "expected \"%.*s\", got \"%s\"", len - 1, msg, buf);
+        return 0;
+    }
+
+    return 1;
+}
+
+// like the board's ROM boot log, output of the previous session may precede Ready
+static int skip_to_ready(int fd) {
+    const char *ready = "Ready\n";
+    int matched = 0;
+    char c;
+
+    for (int n = 0; n < 4096 && ready[matched]; n++) {
+        if (read_exact(fd, &c, 1) != 1)
+            break;
+        matched = c == ready[matched] ? matched + 1 : (c == ready[0]);
+    }
+
+    return ready[matched] == 0;
+}
+
+static void start_emulator(const char *path, const char *blob) {
+    int out[2];
+    FILE *f;
+
+    if (pipe(out) != 0 || (emulator = fork()) < 0) {
+        perror("emulator");
+        exit(EXIT_FAILURE);
+    }
+
+    if (emulator == 0) {
+        dup2(out[1], STDOUT_FILENO);
+        close(out[0]);
+        execl(path, path, "-T", TICK_US, blob, (char *)NULL);
+        perror(path);
+        _exit(EXIT_FAILURE);
+    }
+
+    close(out[1]);
+    f = fdopen(out[0], "r");
+    if (fgets(pty, sizeof(pty), f) == NULL) {
+        printf("emulator did not start\n");
+        exit(EXIT_FAILURE);
+    }
+    pty[strcspn(pty, "\n")] = 0;
+    fclose(f);
+}
+
+static void stop_emulator() {
+    kill(emulator, SIGTERM);
+    waitpid(emulator, NULL, 0);
+}
+
+static int connect_board() {
+    int fd = open(pty, O_RDWR | O_NOCTTY);
+
+    CHECK(fd >= 0, "cannot open %s", pty);
+    if (fd < 0)
+        return -1;
+
+    if (!skip_to_ready(fd) || !expect(fd, "Waiting for input\n")) {
+        CHECK(0, "no Ready from %s", pty);
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// every face as a single request, DEPTH of them in flight
+static void test_pipelined(int fd) {
+    char request[1 + LAYER_INPUT_LEN*sizeof(float)];
+    int sent = 0, done = 0, reply[2];
+
+    request[0] = CMD_INT8_ACCEL;
+    while (done < nfaces) {
+        for (; sent < nfaces && sent - done < DEPTH; sent++) {
+            memcpy(&request[1], &faces[sent*LAYER_INPUT_LEN], LAYER_INPUT_LEN*sizeof(float));
+            write_all(fd, request, sizeof(request));
+        }
+
+        if (read_exact(fd, reply, sizeof(reply)) != sizeof(reply) || !expect(fd, "Waiting for input\n")) {
+            CHECK(0, "no reply to request %d", done);
+            return;
+        }
+        CHECK(reply[0] == expected[done], "face %d: label %d, expected %d", done, reply[0], expected[done]);
+        done++;
+    }
+}
+
+// a batch, then the same batch pipelined across both cores
+static void test_batch(int fd) {
+    unsigned char header[2] = { CMD_INT8_ACCEL | CMD_BATCH, BATCH_MAX };
+    int labels[BATCH_MAX + 4];
+
+    for (int dual = 0; dual < 2; dual++) {
+        int reply_len = (BATCH_MAX + 2 + 2*dual) * sizeof(int);
+
+        if (dual)
+            header[0] |= CMD_DUAL_CORE;
+        write_all(fd, header, sizeof(header));
+        write_all(fd, faces, BATCH_MAX*LAYER_INPUT_LEN*sizeof(float));
+
+        if (read_exact(fd, labels, reply_len) != reply_len || !expect(fd, "Waiting for input\n")) {
+            CHECK(0, "no reply to batch (dual %d)", dual);
+            return;
+        }
+        for (int i = 0; i < BATCH_MAX; i++)
+            CHECK(labels[i] == expected[i], "batch face %d (dual %d): label %d, expected %d",
+                  i, dual, labels[i], expected[i]);
+    }
+}
+
+static void test_input_int8(int fd) {
+    char request[1 + LAYER_INPUT_LEN];
+    int reply[2];
+
+    request[0] = CMD_INT8_ACCEL | CMD_INPUT_INT8;
+    quantize8(faces, mlp_input_qparams.scale, mlp_input_qparams.zero, (int8_t *)&request[1], LAYER_INPUT_LEN);
+    write_all(fd, request, sizeof(request));
+
+    if (read_exact(fd, reply, sizeof(reply)) != sizeof(reply) || !expect(fd, "Waiting for input\n")) {
+        CHECK(0, "no reply to an int8 face");
+        return;
+    }
+    CHECK(reply[0] == run_mlp8xq((int8_t *)&request[1]), "int8 face: label %d", reply[0]);
+}
+
+static void test_frame(int fd) {
+    unsigned char cmd = CMD_INT8_ACCEL | CMD_INPUT_FRAME;
+    uint8_t *frame = malloc(mlp_pca.height * mlp_pca.width);
+    int32_t acc[MLP_MAX_LEN];
+    int reply[3];
+
+    for (int i = 0; i < mlp_pca.height * mlp_pca.width; i++)
+        frame[i] = (i * 37 + i / mlp_pca.width) & 0xff;
+
+    write_all(fd, &cmd, 1);
+    write_all(fd, frame, mlp_pca.height * mlp_pca.width);
+
+    pca_begin(&mlp_pca, acc);
+    for (int row = 0; row < mlp_pca.height; row++)
+        pca_row(&mlp_pca, row, &frame[row * mlp_pca.width], acc);
+
+    if (read_exact(fd, reply, sizeof(reply)) != sizeof(reply) || !expect(fd, "Waiting for input\n"))
+        CHECK(0, "no reply to a frame");
+    else
+        CHECK(reply[0] == mlp_run_pca(acc, 1), "frame: label %d", reply[0]);
+
+    free(frame);
+}
+
+// a float request to an int8 blob, an empty batch and a face cut short
+// are answered Error alone, and the next request is served
+static void test_reject(int fd) {
+    char request[1 + LAYER_INPUT_LEN*sizeof(float)];
+    unsigned char empty[2] = { CMD_INT8_ACCEL | CMD_BATCH, 0 };
+    int reply[2];
+
+    request[0] = CMD_FLOAT;
+    memcpy(&request[1], faces, LAYER_INPUT_LEN*sizeof(float));
+    write_all(fd, request, sizeof(request));
+    CHECK(expect(fd, "Error\n") && expect(fd, "Waiting for input\n"), "float mode on an int8 blob");
+
+    write_all(fd, empty, sizeof(empty));
+    CHECK(expect(fd, "Error\n") && expect(fd, "Waiting for input\n"), "batch of 0 faces");
+
+    // the read times out with half the face
+    request[0] = CMD_INT8_ACCEL;
+    write_all(fd, request, 1 + LAYER_INPUT_LEN*sizeof(float)/2);
+    CHECK(expect(fd, "Error\n") && expect(fd, "Waiting for input\n"), "face cut short");
+
+    write_all(fd, request, sizeof(request));
+    CHECK(read_exact(fd, reply, sizeof(reply)) == sizeof(reply) && reply[0] == expected[0],
+          "no reply after an error");
+}
+
+// nothing more arrives within ms milliseconds
+static int quiet(int fd, int ms) {
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+    return poll(&pfd, 1, ms) == 0;
+}
+
+static int write_blob(char *path, const struct model_header *m) {
+    int fd = mkstemp(path);
+
+    if (fd < 0)
+        return 0;
+    write_all(fd, m, m->size);
+    close(fd);
+    return 1;
+}
+
+// A frame to a model without PCA, and any request without a valid model,
+// has a payload of unknown size: it is discarded and answered with a
+// single Error, not one per payload byte read as a command.
+static void test_unknown_payload(const char *path) {
+    char blob[] = "/tmp/test_emulator_XXXXXX";
+    char request[1 + LAYER_INPUT_LEN*sizeof(float)];
+    int frame_bytes = mlp_pca.height * mlp_pca.width;
+    char *frame = malloc(1 + frame_bytes);
+    struct model_header *m = malloc(model_int8->size);
+    int fd, reply[2];
+
+    request[0] = CMD_INT8_ACCEL;
+    memcpy(&request[1], faces, LAYER_INPUT_LEN*sizeof(float));
+    frame[0] = CMD_INT8_ACCEL | CMD_INPUT_FRAME;
+    for (int i = 1; i <= frame_bytes; i++)
+        frame[i] = i * 37;
+
+    memcpy(m, model_int8, model_int8->size);
+    m->pca = 0;
+    if (!write_blob(blob, m)) {
+        CHECK(0, "cannot write %s", blob);
+        return;
+    }
+
+    start_emulator(path, blob);
+    fd = connect_board();
+    if (fd >= 0) {
+        write_all(fd, frame, 1 + frame_bytes);
+        CHECK(expect(fd, "Error\n") && expect(fd, "Waiting for input\n") && quiet(fd, 200),
+              "frame to a model without PCA");
+
+        write_all(fd, request, sizeof(request));
+        CHECK(read_exact(fd, reply, sizeof(reply)) == sizeof(reply) && reply[0] == expected[0],
+              "no reply after a frame without PCA");
+        close(fd);
+    }
+    stop_emulator();
+
+    unlink(blob);
+    strcpy(blob + strlen(blob) - 6, "XXXXXX");
+    m->magic ^= 1;
+    if (!write_blob(blob, m)) {
+        CHECK(0, "cannot write %s", blob);
+        return;
+    }
+
+    start_emulator(path, blob);
+    fd = connect_board();
+    if (fd >= 0) {
+        for (int n = 0; n < 2; n++) {
+            write_all(fd, request, sizeof(request));
+            CHECK(expect(fd, "Error\n") && expect(fd, "Waiting for input\n") && quiet(fd, 200),
+                  "request %d without a model", n);
+        }
+        close(fd);
+    }
+    stop_emulator();
+
+    unlink(blob);
+    free(m);
+    free(frame);
+}
+
+int main(int argc, char **argv) {
+    int fd;
+
+    if (argc != 2) {
+        printf("usage: %s emulator\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    load_fixture();
+    use_model(model_int8);
+
+    nfaces = read_faces(FACES_TEST_PATH, &faces, &expected);
+    if (nfaces < BATCH_MAX) {
+        printf("cannot read %s\n", FACES_TEST_PATH);
+        return EXIT_FAILURE;
+    }
+    for (int i = 0; i < nfaces; i++)
+        expected[i] = run_mlp8x(&faces[i*LAYER_INPUT_LEN]);
+
+    start_emulator(argv[1], MODEL_INT8_PATH);
+
+    fd = connect_board();
+    if (fd >= 0) {
+        test_pipelined(fd);
+        test_batch(fd);
+        test_input_int8(fd);
+        if (mlp_pca.height > 0)
+            test_frame(fd);
+        test_reject(fd);
+        close(fd);
+    }
+
+    // closing the port resets the board
+    fd = connect_board();
+    CHECK(fd >= 0, "no Ready after reconnecting");
+    if (fd >= 0)
+        close(fd);
+
+    stop_emulator();
+
+    if (mlp_pca.height > 0)
+        test_unknown_payload(argv[1]);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,851 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nnops.h>
+#include <mlp.h>
+#include <fixture.h>
+
+#define NUM_VECTORS 512
+
+// minimum label agreement of the quantized modes with the float reference
+#define MIN_AGREEMENT_INT8 0.90
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        failures++; \
+    } \
+} while (0)
+
+static unsigned int rng_state = 13;
+
+// deterministic across platforms, unlike rand()
+static double next_uniform() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return ((rng_state >> 8) & 0xffffff) / (double)0x1000000;
+}
+
+static double next_gaussian() {
+    double u1 = next_uniform() + 1e-12, u2 = next_uniform();
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+// PCA components have decaying variance; keep samples inside the input
+// quantizer's int8 range so every mode sees the same information
+static void golden_input(float *x) {
+    float lo = (INT8_MIN - input_zero) * input_scale;
+    float hi = (INT8_MAX - input_zero) * input_scale;
+
+    for (int i = 0; i < LAYER_INPUT_LEN; i++) {
+        double v = next_gaussian() * 40.0 / sqrt(1.0 + i);
+        x[i] = v < lo ? lo : v > hi ? hi : v;
+    }
+}
+
+// straightforward double precision forward pass, independent of nnops
+static int reference_mlp(const float *x) {
+    double hidden[LAYER_1_LEN], out[LAYER_3_LEN];
+    int best = 0;
+
+    for (int r = 0; r < LAYER_1_LEN; r++) {
+        double acc = layer_1_bias[r];
+        for (int c = 0; c < LAYER_INPUT_LEN; c++)
+            acc += (double)layer_1_weights[r*LAYER_INPUT_LEN + c] * x[c];
+        hidden[r] = acc > 0 ? acc : 0;
+    }
+
+    for (int r = 0; r < LAYER_3_LEN; r++) {
+        double acc = layer_3_bias[r];
+        for (int c = 0; c < LAYER_1_LEN; c++)
+            acc += (double)layer_3_weights[r*LAYER_1_LEN + c] * hidden[c];
+        out[r] = acc;
+        if (out[r] > out[best])
+            best = r;
+    }
+
+    return best;
+}
+
+static void test_kernels() {
+    int8_t v8[LAYER_INPUT_LEN];
+    int32_t bias8x[LAYER_1_LEN], out8[LAYER_1_LEN], out8x[LAYER_1_LEN];
+    float x[LAYER_INPUT_LEN], out[LAYER_1_LEN], outx[LAYER_1_LEN];
+
+    golden_input(x);
+
+    mvm(layer_1_weights, layer_1_bias, x, out, LAYER_1_LEN, LAYER_INPUT_LEN);
+    mvmx(layer_1_weights, layer_1_bias, x, outx, LAYER_1_LEN, LAYER_INPUT_LEN);
+    for (int r = 0; r < LAYER_1_LEN; r++)
+        CHECK(fabsf(out[r] - outx[r]) <= 1e-3f * (1.0f + fabsf(out[r])),
+              "mvm/mvmx row %d: %f != %f", r, out[r], outx[r]);
+
+    // the vector kernel with a folded zero point is exact, on both the
+    // padded (132 -> 144) and the unpadded (96) layer
+    quantize8(x, input_scale, input_zero, v8, LAYER_INPUT_LEN);
+
+    mvm8(layer_1_weights8, layer_1_bias32, v8, out8, input_zero, LAYER_1_LEN, LAYER_INPUT_LEN);
+    fold_zero8(layer_1_weights8, layer_1_bias32, input_zero, bias8x, LAYER_1_LEN, LAYER_INPUT_LEN);
+    mvm8x(layer_1_weights8, bias8x, v8, out8x, LAYER_1_LEN, LAYER_INPUT_LEN);
+    for (int r = 0; r < LAYER_1_LEN; r++)
+        CHECK(out8[r] == out8x[r], "mvm8/mvm8x row %d: %d != %d", r, out8[r], out8x[r]);
+
+    mvm8(layer_3_weights8, layer_3_bias32, v8, out8, layer_1_zero, LAYER_3_LEN, LAYER_1_LEN);
+    fold_zero8(layer_3_weights8, layer_3_bias32, layer_1_zero, bias8x, LAYER_3_LEN, LAYER_1_LEN);
+    mvm8x(layer_3_weights8, bias8x, v8, out8x, LAYER_3_LEN, LAYER_1_LEN);
+    for (int r = 0; r < LAYER_3_LEN; r++)
+        CHECK(out8[r] == out8x[r], "layer 3 mvm8/mvm8x row %d: %d != %d", r, out8[r], out8x[r]);
+}
+
+static void test_requant() {
+    float x[LAYER_INPUT_LEN];
+    int8_t v8[LAYER_INPUT_LEN], out[LAYER_1_LEN], outb[4*LAYER_1_LEN];
+    static int8_t vb[4*LAYER_INPUT_LEN];
+    double real_multiplier = (double)l1_requant.multiplier * pow(2.0, l1_requant.shift - 31);
+    double expected_multiplier = (double)input_scale * layer_1_weights_scale / layer_1_scale;
+
+    CHECK(fabs(real_multiplier - expected_multiplier) <= 1e-6 * expected_multiplier,
+          "layer 1 multiplier %g != %g", real_multiplier, expected_multiplier);
+
+    golden_input(x);
+    quantize8(x, input_scale, input_zero, v8, LAYER_INPUT_LEN);
+    mvm8_requant(layer_1_weights8, layer_1_bias32, v8, input_zero, &l1_requant, out, LAYER_1_LEN, LAYER_INPUT_LEN);
+
+    for (int r = 0; r < LAYER_1_LEN; r++) {
+        long acc = layer_1_bias32[r];
+        double q;
+
+        for (int c = 0; c < LAYER_INPUT_LEN; c++)
+            acc += (long)layer_1_weights8[r*STRIDE8(LAYER_INPUT_LEN) + c] * (v8[c] - input_zero);
+
+        q = floor(acc * expected_multiplier + 0.5) + l1_requant.zero;
+        q = q < l1_requant.min ? l1_requant.min : q > l1_requant.max ? l1_requant.max : q;
+        CHECK(fabs(out[r] - q) <= 1, "mvm8_requant row %d: %d != %g", r, out[r], q);
+    }
+
+    // the batched kernel, with and without the 4-sample path
+    for (int b = 0; b < 4; b++)
+        memcpy(&vb[b*LAYER_INPUT_LEN], v8, sizeof(v8));
+
+    for (int n = 3; n <= 4; n++) {
+        mmm8_requant(layer_1_weights8, layer_1_bias32, vb, input_zero, &l1_requant, outb, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        for (int b = 0; b < n; b++)
+            CHECK(memcmp(&outb[b*LAYER_1_LEN], out, sizeof(out)) == 0, "mmm8_requant batch %d sample %d", n, b);
+    }
+}
+
+// every kernel adds bias[row] exactly once, in both its single and
+// batched form, checked with a synthetic bias of a distinct value per row
+static void test_bias() {
+    static float x[4*LAYER_INPUT_LEN], out[4*LAYER_1_LEN], outb[4*LAYER_1_LEN];
+    static int8_t v8[4*LAYER_INPUT_LEN];
+    static int32_t out32[4*LAYER_1_LEN], outb32[4*LAYER_1_LEN];
+    float fbias[LAYER_1_LEN];
+    int32_t bias32[LAYER_1_LEN];
+    static const float fzero[LAYER_1_LEN];
+    static const int32_t zero32[LAYER_1_LEN];
+
+    for (int r = 0; r < LAYER_1_LEN; r++) {
+        fbias[r] = (float)(next_uniform() * 8.0 - 4.0);
+        bias32[r] = (int32_t)(next_uniform() * 20000.0) - 10000;
+    }
+
+    for (int b = 0; b < 4; b++)
+        golden_input(&x[b*LAYER_INPUT_LEN]);
+    quantize8(x, input_scale, input_zero, v8, 4*LAYER_INPUT_LEN);
+
+    mvm(layer_1_weights, fzero, x, out, LAYER_1_LEN, LAYER_INPUT_LEN);
+    mvm(layer_1_weights, fbias, x, outb, LAYER_1_LEN, LAYER_INPUT_LEN);
+    for (int r = 0; r < LAYER_1_LEN; r++)
+        CHECK(fabsf(outb[r] - (out[r] + fbias[r])) <= 1e-4f, "mvm bias row %d", r);
+
+    mvmx(layer_1_weights, fbias, x, outb, LAYER_1_LEN, LAYER_INPUT_LEN);
+    for (int r = 0; r < LAYER_1_LEN; r++)
+        CHECK(fabsf(outb[r] - (out[r] + fbias[r])) <= 1e-3f * (1.0f + fabsf(outb[r])), "mvmx bias row %d", r);
+
+    for (int n = 3; n <= 4; n++) {
+        mmm(layer_1_weights, fzero, x, out, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        mmm(layer_1_weights, fbias, x, outb, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        for (int i = 0; i < n*LAYER_1_LEN; i++)
+            CHECK(fabsf(outb[i] - (out[i] + fbias[i % LAYER_1_LEN])) <= 1e-4f, "mmm bias batch %d elem %d", n, i);
+
+        mmmx(layer_1_weights, fbias, x, outb, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        for (int i = 0; i < n*LAYER_1_LEN; i++)
+            CHECK(fabsf(outb[i] - (out[i] + fbias[i % LAYER_1_LEN])) <= 1e-3f * (1.0f + fabsf(outb[i])),
+                  "mmmx bias batch %d elem %d", n, i);
+
+        // integer kernels must be exact
+        mmm8(layer_1_weights8, zero32, v8, out32, input_zero, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        mmm8(layer_1_weights8, bias32, v8, outb32, input_zero, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        for (int i = 0; i < n*LAYER_1_LEN; i++)
+            CHECK(outb32[i] == out32[i] + bias32[i % LAYER_1_LEN], "mmm8 bias batch %d elem %d", n, i);
+
+        mmm8x(layer_1_weights8, zero32, v8, out32, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        mmm8x(layer_1_weights8, bias32, v8, outb32, LAYER_1_LEN, LAYER_INPUT_LEN, n);
+        for (int i = 0; i < n*LAYER_1_LEN; i++)
+            CHECK(outb32[i] == out32[i] + bias32[i % LAYER_1_LEN], "mmm8x bias batch %d elem %d", n, i);
+
+        // the batch shares each pass over the weights, the sums stay mvm8x's
+        for (int b = 0; b < n; b++) {
+            mvm8x(layer_1_weights8, bias32, &v8[b*LAYER_INPUT_LEN], out32, LAYER_1_LEN, LAYER_INPUT_LEN);
+            for (int r = 0; r < LAYER_1_LEN; r++)
+                CHECK(outb32[b*LAYER_1_LEN + r] == out32[r], "mmm8x batch %d sample %d row %d", n, b, r);
+        }
+    }
+
+    mvm8(layer_1_weights8, zero32, v8, out32, input_zero, LAYER_1_LEN, LAYER_INPUT_LEN);
+    mvm8(layer_1_weights8, bias32, v8, outb32, input_zero, LAYER_1_LEN, LAYER_INPUT_LEN);
+    for (int r = 0; r < LAYER_1_LEN; r++)
+        CHECK(outb32[r] == out32[r] + bias32[r], "mvm8 bias row %d", r);
+
+    mvm8x(layer_1_weights8, zero32, v8, out32, LAYER_1_LEN, LAYER_INPUT_LEN);
+    mvm8x(layer_1_weights8, bias32, v8, outb32, LAYER_1_LEN, LAYER_INPUT_LEN);
+    for (int r = 0; r < LAYER_1_LEN; r++)
+        CHECK(outb32[r] == out32[r] + bias32[r], "mvm8x bias row %d", r);
+}
+
+// the trained biases reach every blob: float or int32, a layer whose
+// bias words are all zero lost them on export
+static void test_exported_bias() {
+    const struct model_header *models[3] = {model_f32, model_int8, model_int4};
+    const char *names[3] = {"f32", "int8", "int4"};
+
+    for (int m = 0; m < 3; m++) {
+        const struct model_layer *layers = model_layers(models[m]);
+
+        for (int l = 0; l < models[m]->nlayers; l++) {
+            const uint32_t *bias = (const uint32_t *)((const char *)models[m] + layers[l].bias);
+            int nonzero = 0;
+
+            for (int r = 0; r < layers[l].nrows; r++)
+                nonzero += bias[r] != 0;
+
+            CHECK(nonzero > 0, "%s blob: layer %d bias is all zeros", names[m], l);
+        }
+    }
+}
+
+static void test_modes() {
+    int agree[4] = {0};
+    const char *names[4] = {"float", "float_simd", "fxp", "fxp_simd"};
+    float x[LAYER_INPUT_LEN], saved[LAYER_INPUT_LEN];
+
+    for (int n = 0; n < NUM_VECTORS; n++) {
+        int expected, got[4];
+
+        golden_input(x);
+        expected = reference_mlp(x);
+        memcpy(saved, x, sizeof(x));
+
+        use_model(model_f32);
+        got[0] = run_mlp(x);
+        got[1] = run_mlpx(x);
+
+        use_model(model_int8);
+        got[2] = run_mlp8(x);
+        got[3] = run_mlp8x(x);
+
+        // the input is const: no pipeline writes to it
+        CHECK(memcmp(x, saved, sizeof(x)) == 0, "vector %d changed by a pipeline", n);
+
+        for (int m = 0; m < 4; m++)
+            agree[m] += got[m] == expected;
+
+        // same integer arithmetic, only the kernel differs
+        CHECK(got[3] == got[2], "fxp_simd/fxp vector %d: %d != %d", n, got[3], got[2]);
+    }
+
+    for (int m = 0; m < 4; m++)
+        printf("%-10s agreement with reference: %6.2f%%\n", names[m], 100.0 * agree[m] / NUM_VECTORS);
+
+    CHECK(agree[0] == NUM_VECTORS, "float mode disagrees with reference");
+    CHECK(agree[1] == NUM_VECTORS, "float_simd mode disagrees with reference");
+    CHECK(agree[2] >= MIN_AGREEMENT_INT8 * NUM_VECTORS, "fxp agreement too low");
+    CHECK(agree[3] >= MIN_AGREEMENT_INT8 * NUM_VECTORS, "fxp_simd agreement too low");
+}
+
+// batched pipelines must label every face exactly like the single ones;
+// odd batch sizes exercise the tail that skips the 4-sample kernels
+static void test_batch() {
+    static float x[BATCH_MAX*LAYER_INPUT_LEN];
+    int labels[4][BATCH_MAX];
+    const int sizes[] = {1, 3, 4, 7, BATCH_MAX};
+
+    for (size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+        int n = sizes[s];
+
+        for (int b = 0; b < n; b++)
+            golden_input(&x[b*LAYER_INPUT_LEN]);
+
+        use_model(model_f32);
+        run_mlp_batch(x, labels[0], n);
+        run_mlpx_batch(x, labels[1], n);
+
+        for (int b = 0; b < n; b++) {
+            CHECK(labels[0][b] == run_mlp(&x[b*LAYER_INPUT_LEN]), "float batch %d sample %d", n, b);
+            CHECK(labels[1][b] == run_mlpx(&x[b*LAYER_INPUT_LEN]), "float_simd batch %d sample %d", n, b);
+        }
+
+        use_model(model_int8);
+        run_mlp8_batch(x, labels[2], n);
+        run_mlp8x_batch(x, labels[3], n);
+
+        for (int b = 0; b < n; b++) {
+            CHECK(labels[2][b] == run_mlp8(&x[b*LAYER_INPUT_LEN]), "fxp batch %d sample %d", n, b);
+            CHECK(labels[3][b] == run_mlp8x(&x[b*LAYER_INPUT_LEN]), "fxp_simd batch %d sample %d", n, b);
+        }
+    }
+}
+
+// splitting layer 1 across cores must not change any label
+static void test_dual_core() {
+    float x[LAYER_INPUT_LEN];
+
+    for (int n = 0; n < 64; n++) {
+        int single[4], dual[4];
+
+        golden_input(x);
+
+        for (int split = 0; split <= 1; split++) {
+            int *got = split ? dual : single;
+
+            set_dual_core(split);
+            use_model(model_f32);
+            got[0] = run_mlp(x);
+            got[1] = run_mlpx(x);
+
+            use_model(model_int8);
+            got[2] = run_mlp8(x);
+            got[3] = run_mlp8x(x);
+        }
+        set_dual_core(0);
+
+        for (int m = 0; m < 4; m++)
+            CHECK(dual[m] == single[m], "dual core mode %d vector %d: %d != %d", m, n, dual[m], single[m]);
+    }
+}
+
+// int8 input variants must match quantizing on device
+static void test_int8_input() {
+    float x[LAYER_INPUT_LEN], back[LAYER_INPUT_LEN];
+    int8_t q[LAYER_INPUT_LEN];
+    static int8_t qbatch[BATCH_MAX*LAYER_INPUT_LEN];
+    static float xbatch[BATCH_MAX*LAYER_INPUT_LEN];
+    int labels[BATCH_MAX], labels_q[BATCH_MAX];
+
+    for (int n = 0; n < 64; n++) {
+        golden_input(x);
+        quantize8(x, input_scale, input_zero, q, LAYER_INPUT_LEN);
+
+        dequantize8(q, input_scale, input_zero, back, LAYER_INPUT_LEN);
+        for (int i = 0; i < LAYER_INPUT_LEN; i++)
+            CHECK(fabsf(back[i] - x[i]) <= 0.5f * input_scale + 1e-4f,
+                  "dequantize8 elem %d: %f != %f", i, back[i], x[i]);
+
+        CHECK(run_mlp8q(q) == run_mlp8(x), "run_mlp8q vector %d", n);
+        CHECK(run_mlp8xq(q) == run_mlp8x(x), "run_mlp8xq vector %d", n);
+    }
+
+    for (int b = 0; b < BATCH_MAX; b++)
+        golden_input(&xbatch[b*LAYER_INPUT_LEN]);
+    quantize8(xbatch, input_scale, input_zero, qbatch, BATCH_MAX*LAYER_INPUT_LEN);
+
+    run_mlp8x_batch(xbatch, labels, BATCH_MAX);
+    run_mlp8xq_batch(qbatch, labels_q, BATCH_MAX);
+    for (int b = 0; b < BATCH_MAX; b++)
+        CHECK(labels[b] == labels_q[b], "run_mlp8xq_batch sample %d", b);
+
+    run_mlp8_batch(xbatch, labels, BATCH_MAX);
+    run_mlp8q_batch(qbatch, labels_q, BATCH_MAX);
+    for (int b = 0; b < BATCH_MAX; b++)
+        CHECK(labels[b] == labels_q[b], "run_mlp8q_batch sample %d", b);
+}
+
+// Packs a float model with random parameters, laid out like pack.py
+// does. Every layer but the last is followed by ReLU.
+static struct model_header *random_model(const int *dims, int nlayers) {
+    uint32_t weights[MLP_MAX_LAYERS], bias[MLP_MAX_LAYERS], size;
+    struct model_header *m = NULL;
+    struct model_layer *layers;
+
+    size = sizeof(*m) + nlayers * sizeof(*layers);
+    for (int i = 0; i < nlayers; i++) {
+        weights[i] = size = (size + MODEL_ALIGN - 1) & ~(MODEL_ALIGN - 1);
+        size += dims[i+1] * dims[i] * sizeof(float);
+        bias[i] = size = (size + MODEL_ALIGN - 1) & ~(MODEL_ALIGN - 1);
+        size += dims[i+1] * sizeof(float);
+    }
+
+    if (posix_memalign((void **)&m, MODEL_ALIGN, size) != 0)
+        exit(EXIT_FAILURE);
+    memset(m, 0, size);
+
+    *m = (struct model_header) {
+        .magic = MODEL_MAGIC,
+        .version = MODEL_VERSION,
+        .dtype = MODEL_DTYPE_F32,
+        .nlayers = nlayers,
+        .size = size,
+        .input_scale = 1.0f,
+    };
+
+    layers = (struct model_layer *)(m + 1);
+    for (int i = 0; i < nlayers; i++) {
+        float *w = (float *)((uint8_t *)m + weights[i]);
+        float *b = (float *)((uint8_t *)m + bias[i]);
+
+        layers[i] = (struct model_layer) {
+            .nrows = dims[i+1],
+            .ncols = dims[i],
+            .scale = 1.0f,
+            .weights_scale = 1.0f,
+            .relu = i < nlayers - 1,
+            .weights = weights[i],
+            .bias = bias[i],
+        };
+
+        for (int j = 0; j < dims[i+1] * dims[i]; j++)
+            w[j] = (float)(next_uniform() - 0.5);
+        for (int j = 0; j < dims[i+1]; j++)
+            b[j] = (float)(next_uniform() - 0.5);
+    }
+
+    return m;
+}
+
+static int reference_deep(const struct model_header *m, const float *x) {
+    const struct model_layer *layers = model_layers(m);
+    double a[MLP_MAX_LEN], out[MLP_MAX_LEN];
+    int best = 0, len = layers[0].ncols;
+
+    for (int c = 0; c < len; c++)
+        a[c] = x[c];
+
+    for (int i = 0; i < m->nlayers; i++) {
+        const struct model_layer *l = &layers[i];
+        const float *w = model_tensor(m, l->weights), *b = model_tensor(m, l->bias);
+
+        for (int r = 0; r < l->nrows; r++) {
+            out[r] = b[r];
+            for (int c = 0; c < l->ncols; c++)
+                out[r] += (double)w[r*l->ncols + c] * a[c];
+            if (l->relu && out[r] < 0)
+                out[r] = 0;
+        }
+
+        len = l->nrows;
+        memcpy(a, out, len * sizeof(double));
+    }
+
+    for (int r = 1; r < len; r++)
+        if (a[r] > a[best])
+            best = r;
+
+    return best;
+}
+
+// the executor runs models of any depth and width, within the arena
+static void test_deep_model() {
+    const int dims[] = {20, 33, 17, 5};
+    const int wide[] = {MLP_MAX_LEN, MLP_MAX_LEN, MLP_MAX_LEN};
+    struct model_header *m = random_model(dims, 3), *w = random_model(wide, 2);
+    static float x[BATCH_MAX*MLP_MAX_LEN];
+    int labels[BATCH_MAX];
+
+    CHECK(load_model(m, m->size) == MODEL_OK, "3-layer model rejected");
+    CHECK(mlp_input_len == 20 && mlp_output_len == 5, "3-layer model shape %dx%d", mlp_input_len, mlp_output_len);
+    CHECK(mlp_graph.arena_size <= MLP_ARENA_SIZE, "arena %d bytes", mlp_graph.arena_size);
+    CHECK(mlp_pca.height == 0, "3-layer model has no PCA");
+
+    for (int b = 0; b < BATCH_MAX*20; b++)
+        x[b] = (float)(next_gaussian() * 2.0);
+
+    for (int b = 0; b < BATCH_MAX; b++) {
+        int expected = reference_deep(m, &x[b*20]);
+
+        CHECK(run_mlp(&x[b*20]) == expected, "3-layer float sample %d", b);
+        CHECK(run_mlpx(&x[b*20]) == expected, "3-layer float_simd sample %d", b);
+
+        set_dual_core(1);
+        CHECK(run_mlpx(&x[b*20]) == expected, "3-layer dual core sample %d", b);
+        set_dual_core(0);
+    }
+
+    run_mlp_batch(x, labels, 7);
+    for (int b = 0; b < 7; b++)
+        CHECK(labels[b] == reference_deep(m, &x[b*20]), "3-layer batch sample %d", b);
+
+    // two 256-wide activations of BATCH_MAX floats need twice the arena
+    CHECK(load_model(w, w->size) == MODEL_ERR_ARENA, "oversized arena accepted");
+    CHECK(mlp_model == m, "oversized model replaced the 3-layer one");
+
+    use_model(model_int8);
+    free(m);
+    free(w);
+}
+
+// Streaming a frame row by row gives exactly the integer projection of
+// the whole frame, and classifying it equals classifying that projection.
+static void test_pca() {
+    static uint8_t frame[64*PCA_MAX_WIDTH];
+    int32_t acc[MLP_MAX_LEN];
+    int8_t q[MLP_MAX_LEN];
+    float x[MLP_MAX_LEN];
+    const struct pca *p = &mlp_pca;
+
+    use_model(model_int8);
+    CHECK(p->height > 0 && p->height * p->width <= (int)sizeof(frame), "int8 blob has no usable PCA");
+    if (p->height == 0 || p->height * p->width > (int)sizeof(frame))
+        return;
+
+    for (int n = 0; n < 8; n++) {
+        // gradients plus noise over most of the pixel range
+        for (int i = 0; i < p->height * p->width; i++)
+            frame[i] = (uint8_t)((i / p->width) * 2 + (i % p->width) + next_uniform() * 64.0 + n * 4);
+
+        pca_begin(p, acc);
+        for (int row = 0; row < p->height; row++)
+            pca_row(p, row, &frame[row * p->width], acc);
+
+        for (int k = 0; k < p->ncomponents; k++) {
+            long long expected = p->bias[k];
+
+            for (int row = 0; row < p->height; row++)
+                for (int c = 0; c < p->width; c++)
+                    expected += (long long)p->basis[(row * p->ncomponents + k) * STRIDE8(p->width) + c] *
+                                (frame[row * p->width + c] - 128);
+
+            CHECK(acc[k] == expected, "frame %d component %d: %d != %lld", n, k, acc[k], expected);
+        }
+
+        pca_output8(p, acc, q);
+        CHECK(mlp_run_pca(acc, 0) == run_mlp8q(q), "fxp frame %d", n);
+        CHECK(mlp_run_pca(acc, 1) == run_mlp8xq(q), "fxp_simd frame %d", n);
+
+        use_model(model_f32);
+        pca_output(p, acc, x);
+        CHECK(mlp_run_pca(acc, 0) == run_mlp(x), "float frame %d", n);
+        CHECK(mlp_run_pca(acc, 1) == run_mlpx(x), "float_simd frame %d", n);
+        use_model(model_int8);
+    }
+}
+
+#define SPARSE_VECTORS 64
+
+// labels of every float or int8 mode, SPARSE_VECTORS per mode
+static void sparse_labels(const struct model_header *m, const float *x, int *labels) {
+    int int8 = m->dtype == MODEL_DTYPE_INT8;
+
+    use_model(m);
+    for (int b = 0; b < SPARSE_VECTORS; b++) {
+        const float *face = &x[b*LAYER_INPUT_LEN];
+
+        labels[b] = int8 ? run_mlp8(face) : run_mlp(face);
+        labels[SPARSE_VECTORS + b] = int8 ? run_mlp8x(face) : run_mlpx(face);
+
+        set_dual_core(1);
+        labels[2*SPARSE_VECTORS + b] = int8 ? run_mlp8x(face) : run_mlpx(face);
+        set_dual_core(0);
+    }
+
+    for (int b = 0; b < SPARSE_VECTORS; b += BATCH_MAX) {
+        if (int8)
+            run_mlp8x_batch(&x[b*LAYER_INPUT_LEN], &labels[3*SPARSE_VECTORS + b], BATCH_MAX);
+        else
+            run_mlpx_batch(&x[b*LAYER_INPUT_LEN], &labels[3*SPARSE_VECTORS + b], BATCH_MAX);
+    }
+}
+
+// The int8 block-sparse kernels match mvm8 and mvm8x on a matrix that
+// keeps every other block of each row, the short last ones included.
+static void test_bsr_kernels() {
+    enum { NROWS = 24, NCOLS = LAYER_INPUT_LEN, NBLOCKS = (NCOLS + BSR_BLOCK - 1) / BSR_BLOCK };
+    static int8_t M[NROWS*STRIDE8(NCOLS)] __attribute__((aligned(16)));
+    static int8_t values[NROWS*NBLOCKS*BSR_BLOCK] __attribute__((aligned(16)));
+    static uint16_t rows[NROWS + 1], cols[NROWS*NBLOCKS];
+    int8_t v[NCOLS];
+    int32_t bias[NROWS], expected[NROWS], out[NROWS];
+    struct bsr B = {values, rows, cols};
+    int n = 0;
+
+    for (int c = 0; c < NCOLS; c++)
+        v[c] = (int8_t)(next_uniform() * 256 - 128);
+
+    for (int r = 0; r < NROWS; r++) {
+        int8_t *row = &M[r*STRIDE8(NCOLS)];
+
+        bias[r] = (int32_t)(next_uniform() * 2000) - 1000;
+        rows[r] = n;
+        memset(row, 0, STRIDE8(NCOLS));
+        for (int b = r % 2; b < NBLOCKS; b += 2, n++) {
+            for (int c = b*BSR_BLOCK; c < NCOLS && c < (b + 1)*BSR_BLOCK; c++)
+                row[c] = (int8_t)(next_uniform() * 256 - 128);
+            memcpy(&values[n*BSR_BLOCK], &row[b*BSR_BLOCK], BSR_BLOCK);
+            cols[n] = b*BSR_BLOCK;
+        }
+    }
+    rows[NROWS] = n;
+
+    mvm8(M, bias, v, expected, -7, NROWS, NCOLS);
+    mvm8_bsr(&B, bias, v, out, -7, NROWS, NCOLS);
+    for (int r = 0; r < NROWS; r++)
+        CHECK(out[r] == expected[r], "mvm8_bsr row %d: %d != %d", r, out[r], expected[r]);
+
+    mvm8x(M, bias, v, expected, NROWS, NCOLS);
+    mvm8x_bsr(&B, bias, v, out, NROWS, NCOLS);
+    for (int r = 0; r < NROWS; r++)
+        CHECK(out[r] == expected[r], "mvm8x_bsr row %d: %d != %d", r, out[r], expected[r]);
+}
+
+// A block-sparse layer 1 classifies exactly like the same pruned weights
+// stored densely, in every mode, and malformed block indexes are rejected.
+static void test_sparse() {
+    static float x[SPARSE_VECTORS*LAYER_INPUT_LEN];
+    static int expected[4*SPARSE_VECTORS], labels[4*SPARSE_VECTORS];
+    const struct model_header *models[] = {model_f32, model_int8};
+    const double sparsities[] = {0.5, 0.75};
+
+    for (int b = 0; b < SPARSE_VECTORS; b++)
+        golden_input(&x[b*LAYER_INPUT_LEN]);
+
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 2; j++) {
+            struct model_header *dense = prune_model(models[i], sparsities[j], 0);
+            struct model_header *sparse = prune_model(models[i], sparsities[j], 1);
+            const struct model_layer *l = model_layers(sparse);
+            const uint16_t *rows = model_tensor(sparse, l->index);
+            int nblocks = l->nrows * ((l->ncols + BSR_BLOCK - 1) / BSR_BLOCK);
+
+            CHECK(abs(rows[l->nrows] - (int)(nblocks * (1 - sparsities[j]))) <= 1,
+                  "%d of %d blocks kept at sparsity %.2f", rows[l->nrows], nblocks, sparsities[j]);
+
+            sparse_labels(dense, x, expected);
+            sparse_labels(sparse, x, labels);
+            for (int k = 0; k < 4*SPARSE_VECTORS; k++)
+                CHECK(labels[k] == expected[k], "%s blob, sparsity %.2f: mode %d sample %d",
+                      i ? "int8" : "f32", sparsities[j], k / SPARSE_VECTORS, k % SPARSE_VECTORS);
+
+            free(dense);
+            free(sparse);
+        }
+    }
+
+    struct model_header *m = prune_model(model_int8, 0.5, 1);
+    struct model_layer *l = (struct model_layer *)(m + 1);
+    uint16_t *rows = (uint16_t *)((uint8_t *)m + l->index), *cols = rows + l->nrows + 1;
+    int second = 0;
+
+    // the second block of the first row that has two
+    for (int r = 0; r < l->nrows && second == 0; r++)
+        if (rows[r + 1] - rows[r] >= 2)
+            second = rows[r] + 1;
+    CHECK(second > 0, "no row keeps two blocks");
+
+#define REJECT(err, field, value) do { \
+    uint32_t saved = field; \
+    field = value; \
+    CHECK(load_model(m, m->size) == err, "%s = %s: expected %s", #field, #value, #err); \
+    field = saved; \
+} while (0)
+
+    use_model(model_int8);
+    REJECT(MODEL_ERR_SHAPE, l->format, 2);
+    REJECT(MODEL_ERR_SHAPE, rows[0], 1);
+    REJECT(MODEL_ERR_SHAPE, rows[1], rows[2] + 1);
+    REJECT(MODEL_ERR_SHAPE, cols[0], cols[0] + 1);
+    REJECT(MODEL_ERR_SHAPE, cols[0], l->ncols + 12);
+    REJECT(MODEL_ERR_SHAPE, cols[second], cols[second - 1]);
+    REJECT(MODEL_ERR_SHAPE, cols[second - 1], (l->ncols - 1) / BSR_BLOCK * BSR_BLOCK);
+    REJECT(MODEL_ERR_SIZE, rows[l->nrows], 0xffff);
+    REJECT(MODEL_ERR_SIZE, l->index, m->size - 8);
+    CHECK(mlp_model == model_int8, "a malformed block-sparse blob replaced the model");
+
+#undef REJECT
+
+    CHECK(load_model(m, m->size) == MODEL_OK, "block-sparse int8 blob rejected");
+    use_model(model_int8);
+    free(m);
+}
+
+// int4 weight of a packed row, unpacked independently of nnops
+static int weight4(const uint8_t *row, int col) {
+    int w = (row[col / 2] >> (col % 2 ? 4 : 0)) & 0xf;
+    return w >= 8 ? w - 16 : w;
+}
+
+// The int4 blob keeps each float weight within half a step of its row
+// scale, mvm4 computes its integer layers exactly, and the int4 mode
+// labels faces like the float reference in all of its paths.
+static void test_int4() {
+    const uint8_t *weights4[] = {layer_1_weights4, layer_3_weights4};
+    const int32_t *bias4[] = {layer_1_bias4, layer_3_bias4};
+    const struct row_scale *scales4[] = {layer_1_scales4, layer_3_scales4};
+    const float *weights[] = {layer_1_weights, layer_3_weights};
+    const int dims[] = {LAYER_INPUT_LEN, LAYER_1_LEN, LAYER_3_LEN};
+    const float in_scales[] = {input_scale, layer_1_scale};
+    const int8_t zeros[] = {input_zero, layer_1_zero};
+    static float x[BATCH_MAX*LAYER_INPUT_LEN];
+    int8_t v8[LAYER_INPUT_LEN], q[LAYER_INPUT_LEN];
+    int32_t bias[LAYER_1_LEN], out[LAYER_1_LEN];
+    int labels[BATCH_MAX], agree = 0;
+
+    for (int i = 0; i < 2; i++) {
+        int nrows = dims[i+1], ncols = dims[i];
+
+        for (int c = 0; c < ncols; c++)
+            v8[c] = (int8_t)(next_uniform() * 256.0 - 128.0);
+
+        fold_zero4(weights4[i], bias4[i], zeros[i], bias, nrows, ncols);
+        mvm4(weights4[i], bias, v8, out, nrows, ncols);
+
+        for (int r = 0; r < nrows; r++) {
+            const uint8_t *row = &weights4[i][r*STRIDE4(ncols)];
+            double step = scales4[i][r].scale / in_scales[i], err = 0;
+            int32_t acc = bias4[i][r];
+
+            for (int c = 0; c < ncols; c++) {
+                acc += weight4(row, c) * (v8[c] - zeros[i]);
+                err = fmax(err, fabs(weight4(row, c) * step - weights[i][r*ncols + c]));
+            }
+            for (int c = ncols; c < 2*STRIDE4(ncols); c++)
+                CHECK(weight4(row, c) == 0, "layer %d row %d padding column %d", i, r, c);
+
+            CHECK(out[r] == acc, "mvm4 layer %d row %d: %d != %d", i, r, out[r], acc);
+            CHECK(err <= 0.5 * step * (1 + 1e-5), "layer %d row %d: weights off by %g, step %g", i, r, err, step);
+        }
+    }
+
+    use_model(model_int4);
+    for (int n = 0; n < NUM_VECTORS; n++) {
+        golden_input(x);
+        agree += run_mlp4(x) == reference_mlp(x);
+    }
+    printf("%-10s agreement with reference: %6.2f%%\n", "int4", 100.0 * agree / NUM_VECTORS);
+    CHECK(agree >= MIN_AGREEMENT_INT8 * NUM_VECTORS, "int4 agreement too low");
+
+    for (int b = 0; b < BATCH_MAX; b++)
+        golden_input(&x[b*LAYER_INPUT_LEN]);
+    run_mlp4_batch(x, labels, 7);
+
+    for (int b = 0; b < 7; b++) {
+        const float *face = &x[b*LAYER_INPUT_LEN];
+
+        CHECK(labels[b] == run_mlp4(face), "int4 batch sample %d", b);
+
+        set_dual_core(1);
+        CHECK(run_mlp4(face) == labels[b], "int4 dual core sample %d", b);
+        set_dual_core(0);
+
+        quantize8(face, input_scale, input_zero, q, LAYER_INPUT_LEN);
+        CHECK(run_mlp4q(q) == labels[b], "int4 int8 input sample %d", b);
+    }
+
+    // the other dtypes' entry points refuse the int4 blob
+    CHECK(run_mlp8q(q) == -1, "run_mlp8q ran the int4 model");
+    CHECK(run_mlp(x) == -1, "run_mlp ran the int4 model");
+    run_mlp8_batch(x, labels, 3);
+    CHECK(labels[0] == -1 && labels[2] == -1, "run_mlp8_batch ran the int4 model");
+    run_mlp4q_batch(q, labels, 1);
+    CHECK(labels[0] == run_mlp4q(q), "int4 int8 input batch");
+
+    use_model(model_int8);
+}
+
+// load_model rejects malformed blobs and keeps the model it had
+static void test_model_format() {
+    size_t size = model_int8->size;
+    struct model_header *m = NULL;
+    struct model_layer *layers;
+
+    if (posix_memalign((void **)&m, MODEL_ALIGN, size) != 0)
+        return;
+    layers = (struct model_layer *)(m + 1);
+
+#define REJECT(err, ...) do { \
+    memcpy(m, model_int8, size); \
+    __VA_ARGS__; \
+    CHECK(load_model(m, size) == err, "expected %s", #err); \
+    CHECK(mlp_model == model_int8, "%s replaced the model", #err); \
+} while (0)
+
+    use_model(model_int8);
+
+    REJECT(MODEL_ERR_MAGIC, m->magic ^= 1);
+    REJECT(MODEL_ERR_VERSION, m->version++);
+    REJECT(MODEL_ERR_SIZE, size--);
+    size = model_int8->size;
+    REJECT(MODEL_ERR_SIZE, layers[1].bias = size);
+    REJECT(MODEL_ERR_SIZE, layers[0].weights += 1);
+    REJECT(MODEL_ERR_DTYPE, m->dtype = 7);
+    REJECT(MODEL_ERR_SHAPE, m->nlayers = 0);
+    REJECT(MODEL_ERR_SHAPE, layers[1].relu = 1);
+    REJECT(MODEL_ERR_SHAPE, layers[1].ncols--);
+    REJECT(MODEL_ERR_SIZE, m->pca += 4);
+    REJECT(MODEL_ERR_SHAPE, ((struct model_pca *)((uint8_t *)m + m->pca))->ncomponents--);
+    REJECT(MODEL_ERR_SIZE, ((struct model_pca *)((uint8_t *)m + m->pca))->height++);
+    REJECT(MODEL_ERR_QUANT, layers[0].shift = REQUANT_SHIFT_MAX + 1);
+    REJECT(MODEL_ERR_QUANT, layers[1].shift = REQUANT_SHIFT_MIN - 1);
+    REJECT(MODEL_ERR_QUANT, ((struct model_pca *)((uint8_t *)m + m->pca))->shift = 31);
+
+#undef REJECT
+
+    memcpy(m, model_int8, size);
+    CHECK(load_model(m, size) == MODEL_OK, "copy of the int8 blob rejected");
+    use_model(model_int8);
+    free(m);
+
+    // int4 blobs also carry per-row scales, and no block-sparse layers
+    size = model_int4->size;
+    if (posix_memalign((void **)&m, MODEL_ALIGN, size) != 0)
+        return;
+    layers = (struct model_layer *)(m + 1);
+
+#define REJECT(err, ...) do { \
+    memcpy(m, model_int4, size); \
+    __VA_ARGS__; \
+    CHECK(load_model(m, size) == err, "int4: expected %s", #err); \
+    CHECK(mlp_model == model_int8, "int4: %s replaced the model", #err); \
+} while (0)
+
+    REJECT(MODEL_ERR_SIZE, layers[0].scales = size - 16);
+    REJECT(MODEL_ERR_SIZE, layers[1].scales += 4);
+    REJECT(MODEL_ERR_SIZE, layers[0].weights = size - 16);
+    REJECT(MODEL_ERR_SHAPE, layers[0].format = MODEL_LAYER_BSR);
+    REJECT(MODEL_ERR_QUANT, ((struct row_scale *)((uint8_t *)m + layers[1].scales))[3].shift = 31);
+
+#undef REJECT
+
+    free(m);
+}
+
+int main() {
+    load_fixture();
+
+    test_kernels();
+    test_requant();
+    test_bias();
+    test_exported_bias();
+    test_modes();
+    test_batch();
+    test_dual_core();
+    test_int8_input();
+    test_model_format();
+    test_deep_model();
+    test_pca();
+    test_bsr_kernels();
+    test_sparse();
+    test_int4();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
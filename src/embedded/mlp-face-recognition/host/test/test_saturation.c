@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nnops.h>
+#include <mlp.h>
+#include <fixture.h>
+
+// Drives every layer with the int8 input that maximises (and minimises)
+// each row's accumulator and checks the integer kernels against an
+// int64 reference, so a narrow accumulator anywhere shows up here.
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        failures++; \
+    } \
+} while (0)
+
+struct layer {
+    const char *name;
+    const int8_t *weights8;
+    const int32_t *bias32;
+    int nrows, ncols;
+    int8_t v_zero;
+};
+
+// input that pushes row's accumulator to its maximum (sign = 1) or
+// minimum (sign = -1) over the whole int8 range
+static void worst_input(const struct layer *l, int row, int sign, int8_t *v) {
+    for (int c = 0; c < l->ncols; c++) {
+        int w = l->weights8[row*STRIDE8(l->ncols) + c] * sign;
+        v[c] = w >= 0 ? INT8_MAX : INT8_MIN;
+    }
+}
+
+static long long reference_dot(const struct layer *l, int row, const int8_t *v) {
+    long long acc = l->bias32[row];
+
+    for (int c = 0; c < l->ncols; c++)
+        acc += (long long)l->weights8[row*STRIDE8(l->ncols) + c] * ((int)v[c] - l->v_zero);
+
+    return acc;
+}
+
+static void test_layer(const struct layer *l) {
+    static int8_t v[4*LAYER_INPUT_LEN];
+    int32_t bias8x[LAYER_1_LEN], out8[LAYER_1_LEN], out8x[LAYER_1_LEN], outb[4*LAYER_1_LEN];
+    long long worst = 0;
+
+    fold_zero8(l->weights8, l->bias32, l->v_zero, bias8x, l->nrows, l->ncols);
+
+    for (int row = 0; row < l->nrows; row++) {
+        for (int sign = -1; sign <= 1; sign += 2) {
+            long long expected;
+
+            worst_input(l, row, sign, v);
+            expected = reference_dot(l, row, v);
+            if (llabs(expected) > worst)
+                worst = llabs(expected);
+
+            mvm8(l->weights8, l->bias32, v, out8, l->v_zero, l->nrows, l->ncols);
+            CHECK(out8[row] == expected, "%s mvm8 row %d: %d != %lld", l->name, row, out8[row], expected);
+
+            for (int b = 1; b < 4; b++)
+                memcpy(&v[b*l->ncols], v, l->ncols);
+            mmm8(l->weights8, l->bias32, v, outb, l->v_zero, l->nrows, l->ncols, 4);
+            for (int b = 0; b < 4; b++)
+                CHECK(outb[b*l->nrows + row] == expected, "%s mmm8 row %d sample %d", l->name, row, b);
+
+            mvm8x(l->weights8, bias8x, v, out8x, l->nrows, l->ncols);
+            CHECK(out8x[row] == expected, "%s mvm8x row %d: %d != %lld", l->name, row, out8x[row], expected);
+        }
+    }
+
+    printf("%s: worst-case |accumulator| = %lld\n", l->name, worst);
+
+    // the bug this guards against: these layers do not fit int16
+    CHECK(worst > INT16_MAX, "%s worst case unexpectedly fits int16", l->name);
+}
+
+static void test_requant_saturates() {
+    int8_t v[LAYER_INPUT_LEN], out[LAYER_1_LEN];
+    const struct layer l1 = {"layer 1", layer_1_weights8, layer_1_bias32, LAYER_1_LEN, LAYER_INPUT_LEN, input_zero};
+
+    // extreme accumulators must clamp to the ReLU floor and INT8_MAX
+    for (int row = 0; row < LAYER_1_LEN; row++) {
+        for (int sign = -1; sign <= 1; sign += 2) {
+            worst_input(&l1, row, sign, v);
+            mvm8_requant(layer_1_weights8, layer_1_bias32, v, input_zero, &l1_requant, out, LAYER_1_LEN, LAYER_INPUT_LEN);
+            CHECK(out[row] >= l1_requant.min && out[row] <= l1_requant.max, "requant row %d out of range", row);
+            if (sign < 0)
+                CHECK(out[row] == l1_requant.min, "requant row %d: negative worst case %d not clamped", row, out[row]);
+        }
+    }
+}
+
+int main() {
+    load_fixture();
+
+    const struct layer layers[] = {
+        {"layer 1", layer_1_weights8, layer_1_bias32, LAYER_1_LEN, LAYER_INPUT_LEN, input_zero},
+        {"layer 3", layer_3_weights8, layer_3_bias32, LAYER_3_LEN, LAYER_1_LEN, layer_1_zero},
+    };
+
+    for (size_t i = 0; i < sizeof(layers)/sizeof(layers[0]); i++)
+        test_layer(&layers[i]);
+    test_requant_saturates();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <nnops.h>
+#include <mlp.h>
+#include <trace.h>
+#include <fixture.h>
+
+// Checks the trace ring buffer and its statistics against known records,
+// then that an inference through the traced build lands in the stages of
+// the ops its graph has. Built with CONFIG_MLP_TRACE_DEPTH=8.
+
+#define DEPTH 8
+
+#define MODE_A 0x09
+#define MODE_B 0x19
+#define MODE_C 0x29
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        failures++; \
+    } \
+} while (0)
+
+static struct trace_stats stats[TRACE_NSTAGES];
+
+static void check_stats(int stage, uint32_t min, uint32_t mean, uint32_t p99) {
+    const struct trace_stats *s = &stats[stage];
+
+    CHECK(s->min == min && s->mean == mean && s->p99 == p99,
+          "stage %d: min/mean/p99 %u/%u/%u, expected %u/%u/%u",
+          stage, s->min, s->mean, s->p99, min, mean, p99);
+}
+
+// 12 requests alternating B, A through a ring of 8: requests 4..11 are kept
+static void test_ring() {
+    int n;
+
+    n = trace_stats(TRACE_ALL_MODES, stats);
+    CHECK(n == 0, "%d requests before any was traced", n);
+    check_stats(TRACE_DENSE, 0, 0, 0);
+
+    for (int i = 0; i < DEPTH + 4; i++) {
+        trace_begin(i % 2 ? MODE_A : MODE_B);
+        trace_add(TRACE_DENSE, 100 + i);
+        trace_add(TRACE_DENSE, 1000);
+        trace_add(TRACE_SEND, 7);
+        trace_end();
+    }
+
+    n = trace_stats(TRACE_ALL_MODES, stats);
+    CHECK(n == DEPTH, "%d requests kept, expected %d", n, DEPTH);
+    check_stats(TRACE_DENSE, 1104, 1107, 1111);
+    check_stats(TRACE_SEND, 7, 7, 7);
+    check_stats(TRACE_RECV, 0, 0, 0);
+
+    // requests 5, 7, 9 and 11
+    n = trace_stats(MODE_A, stats);
+    CHECK(n == 4, "%d requests of mode A, expected 4", n);
+    check_stats(TRACE_DENSE, 1105, 1108, 1111);
+
+    n = trace_stats(0x7f, stats);
+    CHECK(n == 0, "%d requests of a mode never run", n);
+}
+
+// below 100 requests the nearest-rank p99 is the slowest request
+static void test_percentile() {
+    for (int i = 0; i < DEPTH; i++) {
+        trace_begin(MODE_A);
+        trace_add(TRACE_RELU, i == 3 ? 900 : 10);
+        trace_end();
+    }
+
+    trace_stats(MODE_A, stats);
+    check_stats(TRACE_RELU, 10, (7*10 + 900) / 8, 900);
+}
+
+static void test_inference() {
+    float face[LAYER_INPUT_LEN] = {0};
+    int n;
+
+    load_fixture();
+
+    use_model(model_int8);
+    trace_begin(MODE_C);
+    run_mlp8x(face);
+    trace_end();
+
+    n = trace_stats(MODE_C, stats);
+    CHECK(n == 1, "%d int8 inferences traced, expected 1", n);
+    CHECK(stats[TRACE_DENSE].min > 0, "no cycles in the dense layers");
+    CHECK(stats[TRACE_DEQUANTIZE].p99 == 0 && stats[TRACE_RELU].p99 == 0,
+          "cycles in stages the int8 graph does not have");
+}
+
+int main() {
+    test_ring();
+    test_percentile();
+    test_inference();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+"""Throughput, tail latency and accuracy of the firmware's inference modes.
+
+Sends the test split (esp32s3/model/faces_test.bin) over the inference
+protocol (esp32s3/main/main.c), keeping several requests in flight, up to
+what the device's UART receive buffer holds. For each mode it prints
+faces per second, the p50 and p99 latency of a request from its first
+byte written to its reply, and the faces classified as their subject:
+
+    python -m src.python.device.loadgen --port /dev/ttyUSB0 fxp fxp_simd+batch
+
+Without a board, --emulator runs the host build of the firmware on a pty
+(host/emulator), serving --model, and --paced holds its transfers for
+their time on a UART at --baud-rate:
+
+    python -m src.python.device.loadgen --emulator host/build/emulator fxp_simd fxp_simd+batch+dual
+
+Modes are named as in trace_report. Modes with +frame send random frames,
+so their accuracy is not reported.
+"""
+
+import argparse
+import collections
+import contextlib
+import subprocess
+import sys
+import time
+
+import numpy as np
+import serial
+
+from src.python.device.trace_report import ERROR, FLAGS, WAITING, parse_mode
+from src.python.model import pack
+
+MODEL_DIR = "src/embedded/mlp-face-recognition/esp32s3/model"
+
+
+def requests(cmd, faces, subjects, model, batch, rng):
+    """Yields the payload, reply length and subjects (None for random
+    frames) of requests covering the faces once."""
+    _, input_scale, input_zero, frame_shape = model
+    dual = 8 if cmd & FLAGS["dual"] else 0
+
+    if cmd & FLAGS["frame"]:
+        for _ in range(len(faces)):
+            frame = rng.integers(0, 256, frame_shape, dtype=np.uint8)
+            yield bytes([cmd]) + frame.tobytes(), 12 + dual, None
+        return
+
+    if cmd & FLAGS["int8"]:
+        faces = np.clip(np.round(faces / input_scale) + input_zero, -128, 127).astype(np.int8)
+
+    if not cmd & FLAGS["batch"]:
+        for face, subject in zip(faces, subjects):
+            yield bytes([cmd]) + face.tobytes(), 8 + dual, subject[None]
+        return
+
+    for i in range(0, len(faces), batch):
+        chunk = faces[i:i + batch]
+        yield bytes([cmd, len(chunk)]) + chunk.tobytes(), 4*len(chunk) + 8 + dual, subjects[i:i + batch]
+
+
+def run(esp32, reqs, depth, rx_buffer):
+    """Sends reqs with up to depth of them in flight. Returns the latency of
+    each request and the faces classified as their subject, or None if the
+    device rejects the mode."""
+    inflight = collections.deque()
+    latencies, correct, rejected = [], 0, False
+    reqs = iter(reqs)
+    pending = next(reqs, None)
+
+    # bytes of the requests behind the one the device is reading, which
+    # wait in its receive buffer
+    queued = 0
+
+    while inflight or (pending is not None and not rejected):
+        while (pending is not None and not rejected and len(inflight) < depth
+               and (not inflight or queued + len(pending[0]) <= rx_buffer)):
+            if inflight:
+                queued += len(pending[0])
+            esp32.write(pending[0])
+            inflight.append((pending, time.perf_counter()))
+            pending = next(reqs, None)
+
+        (payload, reply_len, subjects), sent = inflight.popleft()
+        if inflight:
+            queued -= len(inflight[0][0][0])
+
+        reply = esp32.read(min(reply_len, len(ERROR)))
+        if reply == ERROR:
+            rejected = True
+        else:
+            reply += esp32.read(reply_len - len(reply))
+            latencies.append(time.perf_counter() - sent)
+            if subjects is not None:
+                labels = np.frombuffer(reply, dtype='<i4', count=len(subjects))
+                correct += int((labels == subjects).sum())
+
+        msg = esp32.read_until(WAITING)
+        assert msg.endswith(WAITING), msg
+
+    return None if rejected else (latencies, correct)
+
+
+@contextlib.contextmanager
+def connect(args):
+    """The board's port, or that of an emulator started on args.model."""
+    emulator = None
+    port = args.port
+
+    if args.emulator:
+        command = [args.emulator, args.model]
+        if args.paced:
+            command[1:1] = ["-b", str(args.baud_rate)]
+        emulator = subprocess.Popen(command, stdout=subprocess.PIPE, text=True)
+        port = emulator.stdout.readline().strip()
+
+    try:
+        with serial.Serial(port, baudrate=args.baud_rate, timeout=None) as esp32:
+            esp32.read_until(b'Ready\n')
+            msg = esp32.read_until(WAITING)
+            assert msg.endswith(WAITING), msg
+            yield esp32
+    finally:
+        if emulator is not None:
+            emulator.terminate()
+            emulator.wait()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("modes", nargs="+", help="modes to run, e.g. fxp_simd+batch")
+    parser.add_argument("--port", default="/dev/ttyUSB0")
+    parser.add_argument("--baud-rate", type=int, default=115200, help="CONFIG_MLP_UART_BAUD_RATE")
+    parser.add_argument("--emulator", help="path of the host emulator to run instead of a board")
+    parser.add_argument("--paced", action="store_true", help="emulate the line rate of --baud-rate")
+    parser.add_argument("--model", default=f"{MODEL_DIR}/mlp_int8.bin",
+                        help="blob the device serves: its input quantization and PCA frame shape")
+    parser.add_argument("--faces", default=f"{MODEL_DIR}/faces_test.bin", help="written by pack.pack_faces")
+    parser.add_argument("--passes", type=int, default=10, help="times each mode goes over the faces")
+    parser.add_argument("--depth", type=int, default=4, help="requests in flight")
+    parser.add_argument("--rx-buffer", type=int, default=2048, help="device UART receive buffer bytes")
+    parser.add_argument("--batch", type=int, default=16, help="faces per batched request")
+    parser.add_argument("--min-accuracy", type=float, default=0.0,
+                        help="exit with an error if a mode is rejected or classifies fewer faces correctly")
+    args = parser.parse_args()
+
+    faces, subjects = pack.unpack_faces(args.faces)
+    model = pack.unpack_header(args.model)
+    rng = np.random.default_rng(0)
+    failed = False
+
+    with connect(args) as esp32:
+        print(f"{'mode':<24}{'faces/s':>10}{'p50 ms':>10}{'p99 ms':>10}  accuracy")
+
+        for name in args.modes:
+            cmd = parse_mode(name)
+            if cmd & FLAGS["frame"] and model[3] is None:
+                print(f"{name:<24}no PCA in {args.model}")
+                continue
+
+            reqs = [r for _ in range(args.passes) for r in requests(cmd, faces, subjects, model, args.batch, rng)]
+
+            begin = time.perf_counter()
+            result = run(esp32, reqs, args.depth, args.rx_buffer)
+            elapsed = time.perf_counter() - begin
+
+            if result is None:
+                print(f"{name:<24}not supported by the loaded model")
+                failed |= args.min_accuracy > 0
+                continue
+
+            latencies, correct = result
+            nfaces = args.passes * len(faces)
+            p50, p99 = np.percentile(latencies, [50, 99]) * 1000
+
+            if cmd & FLAGS["frame"]:
+                accuracy = "-"
+            else:
+                accuracy = f"{correct}/{nfaces} ({correct / nfaces * 100:.1f}%)"
+                failed |= correct < args.min_accuracy * nfaces
+
+            print(f"{name:<24}{nfaces / elapsed:>10.1f}{p50:>10.3f}{p99:>10.3f}  {accuracy}")
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
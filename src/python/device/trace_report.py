@@ -0,0 +1,148 @@
+"""Per-stage cycle breakdown of the firmware's inference modes.
+
+Needs firmware built with CONFIG_MLP_TRACE. For each mode it sends a
+number of requests with random faces over the inference protocol
+(esp32s3/main/main.c), then asks for the stats of that mode with the dump
+stats command and prints min, mean and p99 cycles per stage:
+
+    python -m src.python.device.trace_report --port /dev/ttyUSB0 fxp fxp_simd+batch
+
+A mode is a base mode optionally followed by +batch, +int8, +dual and
++frame, the flags of the command byte.
+"""
+
+import argparse
+import struct
+
+import numpy as np
+import serial
+
+MODES = {
+    "float": 0x01,
+    "float_simd": 0x03,
+    "fxp": 0x05,
+    "fxp_simd": 0x09,
+    "int4": 0x0b,
+}
+
+FLAGS = {
+    "batch": 0x10,
+    "int8": 0x20,
+    "dual": 0x40,
+    "frame": 0x80,
+}
+
+CMD_DUMP_STATS = 0x07
+
+# in the order of the TRACE_* stages of esp32s3/include/trace.h
+STAGES = ["recv", "quantize", "dequantize", "pca", "dense", "relu", "argmax", "send"]
+
+WAITING = b'Waiting for input\n'
+ERROR = b'Error\n'
+
+
+def parse_mode(name):
+    base, *flags = name.split("+")
+    cmd = MODES[base]
+    for flag in flags:
+        cmd |= FLAGS[flag]
+    return cmd
+
+
+def request(cmd, rng, input_len, frame_shape, batch):
+    """Command byte and payload of one request with random faces, and the
+    byte count of its reply."""
+    dual = 8 if cmd & FLAGS["dual"] else 0
+
+    if cmd & FLAGS["frame"]:
+        face = rng.integers(0, 256, frame_shape, dtype=np.uint8)
+        return bytes([cmd]) + face.tobytes(), 12 + dual
+
+    count = batch if cmd & FLAGS["batch"] else 1
+    if cmd & FLAGS["int8"]:
+        faces = rng.integers(-128, 128, (count, input_len), dtype=np.int8)
+    else:
+        faces = rng.standard_normal((count, input_len)).astype(np.float32)
+
+    if cmd & FLAGS["batch"]:
+        return bytes([cmd, count]) + faces.tobytes(), 4*count + 8 + dual
+    return bytes([cmd]) + faces.tobytes(), 8 + dual
+
+
+def run(esp32, cmd, args, rng):
+    """Sends args.requests requests of cmd; False if the device rejects them."""
+    for _ in range(args.requests):
+        msg = esp32.read_until(WAITING)
+        assert msg.endswith(WAITING), msg
+
+        payload, reply_len = request(cmd, rng, args.input_len, args.frame_shape, args.batch)
+        esp32.write(payload)
+
+        reply = esp32.read(min(reply_len, len(ERROR)))
+        if reply == ERROR:
+            return False
+        esp32.read(reply_len - len(reply))
+
+    return True
+
+
+def dump_stats(esp32, cmd):
+    """Number of traced requests of cmd and (min, mean, p99) per stage."""
+    msg = esp32.read_until(WAITING)
+    assert msg.endswith(WAITING), msg
+
+    esp32.write(bytes([CMD_DUMP_STATS, cmd]))
+    count, nstages = struct.unpack('<ii', esp32.read(8))
+    stats = np.frombuffer(esp32.read(12 * nstages), dtype='<u4').reshape(nstages, 3)
+
+    return count, stats
+
+
+def render(name, count, stats, cpu_freq_khz):
+    total = int(stats[:, 1].sum(dtype=np.int64))
+
+    print(f"{name}: {count} requests, {total / cpu_freq_khz:.3f} ms mean")
+    print(f"  {'stage':<12}{'min':>10}{'mean':>10}{'p99':>10}{'share':>8}")
+    for stage, (lo, mean, p99) in zip(STAGES, stats):
+        if p99 == 0:
+            continue
+        share = mean / total if total else 0
+        bar = "#" * int(round(share * 20))
+        print(f"  {stage:<12}{lo:>10}{mean:>10}{p99:>10}{share*100:>7.1f}% {bar}")
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("modes", nargs="+", help="modes to profile, e.g. fxp_simd+batch")
+    parser.add_argument("--port", default="/dev/ttyUSB0")
+    parser.add_argument("--baud-rate", type=int, default=115200, help="CONFIG_MLP_UART_BAUD_RATE")
+    parser.add_argument("--cpu-freq-khz", type=int, default=240000)
+    parser.add_argument("--requests", type=int, default=100, help="requests per mode")
+    parser.add_argument("--batch", type=int, default=16, help="faces per batched request")
+    parser.add_argument("--input-len", type=int, default=132, help="model input width")
+    parser.add_argument("--frame-shape", type=int, nargs=2, default=(48, 64), help="PCA frame rows and columns")
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(0)
+
+    with serial.Serial(args.port, baudrate=args.baud_rate, timeout=None) as esp32:
+        esp32.read_until(b'Ready\n')
+
+        for name in args.modes:
+            cmd = parse_mode(name)
+
+            if not run(esp32, cmd, args, rng):
+                print(f"{name}: not supported by the loaded model\n")
+                continue
+
+            count, stats = dump_stats(esp32, cmd)
+            if count == 0:
+                print("no requests traced, is the firmware built with CONFIG_MLP_TRACE?")
+                return
+
+            render(name, count, stats, args.cpu_freq_khz)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,330 @@
+"""Packs a trained MLP into the binary model blob loaded by the firmware.
+
+The layout mirrors esp32s3/include/model.h: a 32-byte header, one 36-byte
+descriptor per layer, then the weight and bias tensors of every layer,
+each aligned to 16 bytes. A blob carries a single dtype: float tensors
+for the float modes, int8 weights and int32 biases for the int8 modes, or
+int4 weights quantized row by row, with a scale per row, for the int4
+mode.
+Layers pruned with a "sparsity" keep only their 1 x 16 weight blocks of
+largest magnitude, stored block-sparse. An optional PCA stage lets the
+device project downsampled faces itself.
+"""
+
+import math
+import struct
+
+import numpy as np
+
+MAGIC = b'MLPB'
+VERSION = 3
+ALIGN = 16
+
+DTYPE_F32 = 0
+DTYPE_INT8 = 1
+DTYPE_INT4 = 2
+
+LAYER_DENSE = 0
+LAYER_BSR = 1
+
+# columns of a block-sparse weight block (BSR_BLOCK)
+BSR_BLOCK = 16
+
+HEADER = struct.Struct('<4sHBBIfb3xI8x')
+LAYER = struct.Struct('<HHffibbBBIIII')
+PCA = struct.Struct('<HHHxxfib3xIII')
+ROW_SCALE = struct.Struct('<fib3x')
+
+
+def quantize_multiplier(real_multiplier):
+    """Split a positive real multiplier into an int32 Q31 mantissa and a
+    power of two shift, so real = multiplier * 2^(shift - 31)."""
+    mantissa, shift = math.frexp(real_multiplier)
+    multiplier = int(round(mantissa * (1 << 31)))
+
+    if multiplier == (1 << 31):
+        multiplier //= 2
+        shift += 1
+
+    return multiplier, shift
+
+
+def stride8(ncols):
+    """Row length of int8 weights, padded for the S3 vector unit (STRIDE8)."""
+    return (ncols + 15) // 16 * 16
+
+
+def quantize_layer(layer, in_scale):
+    """int8 weights padded to stride8 and the bias pre-scaled to the int32
+    accumulator, whose scale is in_scale * weights_scale."""
+    weights = np.asarray(layer["weights"], dtype=np.float64)
+    weights_zero = layer.get("weights_zero", 0)
+    nrows, ncols = weights.shape
+
+    qweights = np.around(weights / layer["weights_scale"]) + weights_zero
+    qweights = np.clip(qweights, -128, 127) - weights_zero
+    qweights = np.pad(qweights, ((0, 0), (0, stride8(ncols) - ncols))).astype(np.int8)
+
+    acc_scale = in_scale * layer["weights_scale"]
+    qbias = np.around(np.asarray(layer["bias"], dtype=np.float64) / acc_scale)
+    qbias = np.clip(qbias, -2**31, 2**31 - 1).astype('<i4')
+
+    return qweights, qbias, acc_scale
+
+
+def stride4(ncols):
+    """Bytes of a row of packed int4 weights (STRIDE4)."""
+    return stride8(ncols) // 2
+
+
+def quantize_layer4(layer, in_scale):
+    """int4 weights quantized symmetrically row by row and packed two per
+    byte, low nibble first, in rows of stride4 bytes; the bias in each
+    row's accumulator scale, in_scale * the row's weights scale; and one
+    ROW_SCALE per row, requantizing to the layer's output scale."""
+    weights = np.asarray(layer["weights"], dtype=np.float64)
+    nrows, ncols = weights.shape
+
+    row_scales = np.abs(weights).max(axis=1) / 7
+    row_scales[row_scales == 0] = 1
+    qweights = np.clip(np.around(weights / row_scales[:, None]), -8, 7).astype(np.int64)
+    qweights = np.pad(qweights, ((0, 0), (0, stride8(ncols) - ncols))) & 0xf
+    packed = (qweights[:, 0::2] | (qweights[:, 1::2] << 4)).astype(np.uint8)
+
+    acc_scales = in_scale * row_scales
+    qbias = np.around(np.asarray(layer["bias"], dtype=np.float64) / acc_scales)
+    qbias = np.clip(qbias, -2**31, 2**31 - 1).astype('<i4')
+
+    scales = b''.join(ROW_SCALE.pack(acc_scale, *quantize_multiplier(acc_scale / layer["scale"]))
+                      for acc_scale in acc_scales)
+
+    return packed, qbias, scales
+
+
+def prune_blocks(weights, sparsity, block=BSR_BLOCK):
+    """Magnitude pruning in 1 x block blocks of columns: zeroes the
+    fraction sparsity of blocks with the smallest L2 norm over the whole
+    layer. The last block of a row may be narrower."""
+    weights = np.asarray(weights, dtype=np.float64)
+    nrows, ncols = weights.shape
+    padded = np.pad(weights, ((0, 0), (0, -ncols % block))).reshape(nrows, -1, block)
+
+    norms = np.sqrt((padded ** 2).sum(axis=2)).ravel()
+    keep = np.zeros(norms.size, dtype=bool)
+    keep[np.argsort(-norms, kind='stable')[:int(round(norms.size * (1 - sparsity)))]] = True
+
+    padded = padded * keep.reshape(nrows, -1, 1)
+    return padded.reshape(nrows, -1)[:, :ncols]
+
+
+def block_sparse(weights, block=BSR_BLOCK):
+    """Row pointers, block start columns and values (nblocks x block) of
+    the blocks of weights that hold a nonzero, as in struct bsr."""
+    nrows, ncols = weights.shape
+    padded = np.pad(weights, ((0, 0), (0, -ncols % block))).reshape(nrows, -1, block)
+
+    nonzero = np.any(padded != 0, axis=2)
+    rows = np.concatenate(([0], np.cumsum(nonzero.sum(axis=1))))
+    cols = np.nonzero(nonzero)[1] * block
+
+    return rows.astype('<u2'), cols.astype('<u2'), padded[nonzero]
+
+
+def downsample(faces, shape, factor):
+    """8-bit grayscale faces as the device's PCA takes them: flattened
+    images of the given shape with pixels in [0, 1], averaged over factor x
+    factor blocks. Edge pixels that do not fill a block are dropped."""
+    h, w = shape[0] // factor, shape[1] // factor
+    faces = np.asarray(faces).reshape(-1, *shape)[:, :h*factor, :w*factor]
+    blocks = faces.reshape(-1, h, factor, w, factor).mean(axis=(2, 4))
+    return np.around(blocks * 255).astype(np.uint8)
+
+
+def pca_stage(components, mean, shape, factor):
+    """PCA of full-size faces carried over to faces reduced by downsample:
+    each component summed over the same pixel blocks, and the projection of
+    the mean over the pixels the blocks cover (dropped edge pixels are
+    taken to equal the mean)."""
+    h, w = shape[0] // factor, shape[1] // factor
+    components = np.asarray(components, dtype=np.float64).reshape(-1, *shape)[:, :h*factor, :w*factor]
+    mean = np.asarray(mean, dtype=np.float64).reshape(shape)[:h*factor, :w*factor]
+
+    basis = components.reshape(-1, h, factor, w, factor).sum(axis=(2, 4))
+    offset = components.reshape(len(components), -1) @ mean.reshape(-1)
+
+    return {"basis": basis, "offset": offset}
+
+
+def quantize_pca(stage):
+    """int8 basis blocks (height x ncomponents x stride8(width)) and the
+    int32 bias of the device's accumulator, which sums basis * (pixel -
+    128) in units of basis_scale / 255."""
+    basis = stage["basis"]
+    width = basis.shape[2]
+
+    basis_scale = np.abs(basis).max() / 127
+    qbasis = np.clip(np.around(basis / basis_scale), -127, 127)
+    acc_scale = basis_scale / 255
+
+    qbias = 128 * qbasis.sum(axis=(1, 2)) - np.around(stage["offset"] / acc_scale)
+    qbias = qbias.astype('<i4')
+
+    blocks = np.pad(qbasis, ((0, 0), (0, 0), (0, stride8(width) - width)))
+    blocks = blocks.transpose(1, 0, 2).astype(np.int8)
+
+    return blocks, qbias, acc_scale
+
+
+def arena_size(layers, dtype, nbatch=16):
+    """Bytes of activation arena the firmware plans for this model and
+    nbatch faces (graph_plan in esp32s3/main/graph.c); it must not exceed
+    MLP_ARENA_SIZE in esp32s3/include/mlp.h."""
+    int8 = dtype != DTYPE_F32
+    ncols = np.shape(layers[0]["weights"])[1]
+
+    # (bytes, in place) of each op's output: the input conversion, then
+    # each dense layer and, in float models, its ReLU
+    outputs = [(ncols * (1 if int8 else 4), False)]
+    acc = 0
+    for i, layer in enumerate(layers):
+        nrows = np.shape(layer["weights"])[0]
+        last = i == len(layers) - 1
+        outputs.append((nrows * (1 if int8 and not last else 4), False))
+        if int8 and (not last or dtype == DTYPE_INT4):
+            acc = max(acc, nrows * 4)
+        if layer["relu"] and not int8:
+            outputs.append((nrows * 4, True))
+
+    size = [0, 0]
+    slot = -1
+    for nbytes, in_place in outputs:
+        if not in_place or slot < 0:
+            slot = 1 if slot == 0 else 0
+        size[slot] = max(size[slot], nbytes)
+
+    align = lambda x: (x + 15) // 16 * 16
+    return align(size[0] * nbatch) + align(size[1] * nbatch) + acc * nbatch
+
+
+def pack(path, layers, input_scale, input_zero, dtype, pca=None):
+    """Write a model blob to path.
+
+    layers is a list of dicts with the float "weights" (rows x cols) and
+    "bias" of each dense layer, its "weights_scale" (and optional
+    "weights_zero"), the output activation "scale" and int8 "zero", and
+    whether it is followed by a "relu". An optional "sparsity" prunes the
+    layer with prune_blocks and stores it block-sparse (int4 blobs store
+    the pruned weights densely). input_zero and every "zero" use the
+    device's int8 convention (PyTorch quint8 zero point - 128). pca is an
+    optional stage from pca_stage.
+    """
+    tensors = []
+    descriptors = []
+    offset = HEADER.size + LAYER.size * len(layers)
+    pca_at = 0
+    if pca is not None:
+        pca_at = (offset + ALIGN - 1) // ALIGN * ALIGN
+        offset = pca_at + PCA.size
+    in_scale = input_scale
+
+    def place(data):
+        nonlocal offset
+        offset = (offset + ALIGN - 1) // ALIGN * ALIGN
+        tensors.append((offset, data))
+        at = offset
+        offset += len(data)
+        return at
+
+    for layer in layers:
+        nrows, ncols = np.shape(layer["weights"])
+        if layer.get("sparsity", 0) > 0:
+            layer = dict(layer, weights=prune_blocks(layer["weights"], layer["sparsity"]))
+        sparse = layer.get("sparsity", 0) > 0 and dtype != DTYPE_INT4
+
+        qweights, qbias, acc_scale = quantize_layer(layer, in_scale)
+        multiplier, shift = quantize_multiplier(acc_scale / layer["scale"])
+        weights_scale = layer["weights_scale"]
+
+        if dtype == DTYPE_INT4:
+            weights, bias, scales = quantize_layer4(layer, in_scale)
+            weights_scale, multiplier, shift = 0, 0, 0
+        elif dtype == DTYPE_INT8:
+            weights, bias = qweights[:, :ncols], qbias
+        else:
+            weights, bias = np.asarray(layer["weights"], dtype='<f4'), np.asarray(layer["bias"], dtype='<f4')
+        in_scale = layer["scale"]
+
+        index_at = scales_at = 0
+        if sparse:
+            rows, cols, blocks = block_sparse(weights)
+            weights_at = place(blocks.tobytes())
+            index_at = place(rows.tobytes() + cols.tobytes())
+        elif dtype == DTYPE_INT8:
+            weights_at = place(qweights.tobytes())
+        else:
+            weights_at = place(weights.tobytes())
+        bias_at = place(bias.tobytes())
+        if dtype == DTYPE_INT4:
+            scales_at = place(scales)
+
+        descriptors.append(LAYER.pack(nrows, ncols, layer["scale"], weights_scale,
+                                      multiplier, shift, layer["zero"], int(bool(layer["relu"])),
+                                      LAYER_BSR if sparse else LAYER_DENSE, weights_at, bias_at, index_at,
+                                      scales_at))
+
+    if pca is not None:
+        blocks, qbias, acc_scale = quantize_pca(pca)
+        multiplier, shift = quantize_multiplier(acc_scale / input_scale)
+        height, ncomponents, _ = blocks.shape
+        pca_descriptor = PCA.pack(height, pca["basis"].shape[2], ncomponents, acc_scale,
+                                  multiplier, shift, place(blocks.tobytes()), place(qbias.tobytes()), 0)
+
+    blob = bytearray(offset)
+    blob[0:HEADER.size] = HEADER.pack(MAGIC, VERSION, dtype, len(layers), offset,
+                                      input_scale, input_zero, pca_at)
+    if pca is not None:
+        blob[pca_at:pca_at + PCA.size] = pca_descriptor
+    for i, descriptor in enumerate(descriptors):
+        at = HEADER.size + LAYER.size * i
+        blob[at:at + LAYER.size] = descriptor
+    for at, data in tensors:
+        blob[at:at + len(data)] = data
+
+    with open(path, 'wb') as f:
+        f.write(blob)
+
+    return len(blob)
+
+
+def pack_faces(path, faces, labels):
+    """Write PCA-projected faces and their subjects for the host benchmark:
+    int32 count and width, the faces as float32 rows, then int32 labels."""
+    faces = np.asarray(faces, dtype='<f4')
+    labels = np.asarray(labels, dtype='<i4')
+
+    with open(path, 'wb') as f:
+        f.write(struct.pack('<ii', *faces.shape))
+        f.write(faces.tobytes())
+        f.write(labels.tobytes())
+
+
+def unpack_faces(path):
+    """Faces and subjects written by pack_faces."""
+    with open(path, 'rb') as f:
+        count, ncols = struct.unpack('<ii', f.read(8))
+        faces = np.frombuffer(f.read(4 * count * ncols), dtype='<f4').reshape(count, ncols)
+        labels = np.frombuffer(f.read(4 * count), dtype='<i4')
+
+    return faces, labels
+
+
+def unpack_header(path):
+    """dtype, input scale and input zero point of a blob, and the (height,
+    width) of the frames its PCA projects, or None without PCA."""
+    with open(path, 'rb') as f:
+        blob = f.read()
+
+    _, _, dtype, _, _, input_scale, input_zero, pca_at = HEADER.unpack_from(blob)
+    frame_shape = PCA.unpack_from(blob, pca_at)[:2] if pca_at else None
+
+    return dtype, input_scale, input_zero, frame_shape